@@ -67,3 +67,82 @@ Channel::getTag(void)
 {
 		return tag;
 }
+
+// the default for the posted communication is to do it at once, the
+// requests returned are then requestDone
+
+int
+Channel::postSendMsg(int dbTag, int commitTag, const Message &theMessage, ChannelAddress *theAddress)
+{
+  if (this->sendMsg(dbTag, commitTag, theMessage, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postRecvMsg(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  if (this->recvMsg(dbTag, commitTag, theMessage, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postSendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  if (this->sendMatrix(dbTag, commitTag, theMatrix, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postRecvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  if (this->recvMatrix(dbTag, commitTag, theMatrix, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postSendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+  if (this->sendVector(dbTag, commitTag, theVector, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postRecvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+  if (this->recvVector(dbTag, commitTag, theVector, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postSendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+  if (this->sendID(dbTag, commitTag, theID, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::postRecvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+  if (this->recvID(dbTag, commitTag, theID, theAddress) < 0)
+    return -1;
+  return requestDone;
+}
+
+int
+Channel::waitRequest(int request)
+{
+  return 0;
+}
+
+int
+Channel::waitAll(void)
+{
+  return 0;
+}
@@ -109,6 +109,42 @@ class Channel
 		    ID &theID, 
 		    ChannelAddress *theAddress =0) =0;      
 
+    // returned by the post methods for a request completed at once; no
+    // request returned for a posted send or receive is ever equal to it
+    enum {requestDone = 0};
+
+    // methods to post sends and receives; the data must not be touched
+    // until the request returned has been waited on. a channel that
+    // cannot overlap communication does it at once and returns
+    // requestDone, a negative value is returned if the post failed
+    virtual int postSendMsg(int dbTag, int commitTag, 
+			const Message &theMessage, 
+		    ChannelAddress *theAddress =0);  
+    virtual int postRecvMsg(int dbTag, int commitTag, 
+			Message &theMessage, 
+			ChannelAddress *theAddress =0);  
+    virtual int postSendMatrix(int dbTag, int commitTag, 
+			const Matrix &theMatrix, 
+			ChannelAddress *theAddress =0);  
+    virtual int postRecvMatrix(int dbTag, int commitTag, 
+			Matrix &theMatrix, 
+			ChannelAddress *theAddress =0);  
+    virtual int postSendVector(int dbTag, int commitTag, 
+			const Vector &theVector, 
+			ChannelAddress *theAddress =0);  
+    virtual int postRecvVector(int dbTag, int commitTag, 
+			Vector &theVector, 
+			ChannelAddress *theAddress =0);  
+    virtual int postSendID(int dbTag, int commitTag, 
+		    const ID &theID, 
+		    ChannelAddress *theAddress =0);  
+    virtual int postRecvID(int dbTag, int commitTag, 
+		    ID &theID, 
+		    ChannelAddress *theAddress =0);      
+
+    virtual int waitRequest(int request);
+    virtual int waitAll(void);
+
   protected:
     
   private:
@@ -42,7 +42,9 @@
 //	given by the OS. 
 
 MPI_Channel::MPI_Channel(int other)
- :otherTag(other), otherComm(MPI_COMM_WORLD)
+ :otherTag(other), otherComm(MPI_COMM_WORLD),
+  theRequests(0), theTypes(0), theSizes(0), numRequests(0), maxNumRequests(0),
+  requestGeneration(0)
 {
   
 }    
@@ -52,7 +54,11 @@ MPI_Channel::MPI_Channel(int other)
 
 MPI_Channel::~MPI_Channel()
 {
-
+  if (theRequests != 0) {
+    delete [] theRequests;
+    delete [] theTypes;
+    delete [] theSizes;
+  }
 }
 
 
@@ -472,6 +478,244 @@ MPI_Channel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *t
 }
 
 
+int 
+MPI_Channel::postSendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postSendMsg") < 0)
+      return -1;
+
+    return this->postRequest((void *)msg.data, msg.length, MPI_CHAR, false);
+}
+
+int 
+MPI_Channel::postRecvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postRecvMsg") < 0)
+      return -1;
+
+    return this->postRequest((void *)msg.data, msg.length, MPI_CHAR, true);
+}
+
+int 
+MPI_Channel::postSendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postSendMatrix") < 0)
+      return -1;
+
+    return this->postRequest((void *)theMatrix.data, theMatrix.dataSize, MPI_DOUBLE, false);
+}
+
+int 
+MPI_Channel::postRecvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postRecvMatrix") < 0)
+      return -1;
+
+    return this->postRequest((void *)theMatrix.data, theMatrix.dataSize, MPI_DOUBLE, true);
+}
+
+int 
+MPI_Channel::postSendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postSendVector") < 0)
+      return -1;
+
+    return this->postRequest((void *)theVector.theData, theVector.sz, MPI_DOUBLE, false);
+}
+
+int 
+MPI_Channel::postRecvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postRecvVector") < 0)
+      return -1;
+
+    return this->postRequest((void *)theVector.theData, theVector.sz, MPI_DOUBLE, true);
+}
+
+int 
+MPI_Channel::postSendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postSendID") < 0)
+      return -1;
+
+    return this->postRequest((void *)theID.data, theID.sz, MPI_INT, false);
+}
+
+int 
+MPI_Channel::postRecvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+    if (this->setOtherAddress(theAddress, "postRecvID") < 0)
+      return -1;
+
+    return this->postRequest((void *)theID.data, theID.sz, MPI_INT, true);
+}
+
+
+// int waitRequest(int request):
+//	Method to wait for a posted send or receive to complete; for a
+//	receive the number of entries received is checked. A request is
+//	only valid until waitAll() is invoked or all the requests posted
+//	have been waited on, an older request is reported as an error.
+
+int 
+MPI_Channel::waitRequest(int request)
+{
+    if (request == requestDone)
+      return 0;
+
+    int index = this->getRequestIndex(request);
+    if (index < 0) {
+      opserr << "MPI_Channel::waitRequest() - request " << request;
+      opserr << " is not one currently posted\n";
+      return -1;
+    }
+
+    return this->waitIndex(index);
+}
+
+
+int 
+MPI_Channel::waitAll(void)
+{
+    int result = 0;
+    for (int i=0; i<numRequests; i++)
+      if (this->waitIndex(i) < 0)
+	result = -1;
+
+    this->resetRequests();
+    return result;
+}
+
+
+int
+MPI_Channel::setOtherAddress(ChannelAddress *theAddress, const char *method)
+{
+    if (theAddress != 0) {
+      if (theAddress->getType() == MPI_TYPE) {
+	MPI_ChannelAddress *theMPI_ChannelAddress = (MPI_ChannelAddress *)theAddress;
+	otherTag = theMPI_ChannelAddress->otherTag;
+	otherComm= theMPI_ChannelAddress->otherComm;
+      } else {
+	opserr << "MPI_Channel::" << method << "() - a MPI_Channel ";
+	opserr << "can only communicate with a MPI_Channel";
+	opserr << " address given is not of type MPI_ChannelAddress\n"; 
+	return -1;	    
+      }		    
+    }
+
+    return 0;
+}
+
+
+int
+MPI_Channel::waitIndex(int index)
+{
+    MPI_Status status;
+    MPI_Wait(&theRequests[index], &status);
+
+    int size = theSizes[index];
+    theSizes[index] = -1;
+
+    if (size >= 0) {
+      int count = 0;
+      MPI_Get_count(&status, theTypes[index], &count);
+      if (count != size) {
+	opserr << "MPI_Channel::waitRequest() -";
+	opserr << " incorrect number of entries received: " << count << 
+	  " expected: " << size << endln;
+	return -1;
+      }
+    }
+
+    return 0;
+}
+
+
+// the request returned to the caller holds the index of its MPI_Request
+// and the generation in which it was posted; the generation changes each
+// time the MPI_Requests are reused, so that a request kept by a caller
+// can never be taken for one posted later. neither part is ever such
+// that a request equals requestDone.
+
+int
+MPI_Channel::getRequestIndex(int request)
+{
+    if (request <= 0)
+      return -1;
+
+    int index = (request & MAX_NUM_REQUESTS) - 1;
+    int generation = request >> REQUEST_INDEX_BITS;
+    if (generation != requestGeneration || index < 0 || index >= numRequests)
+      return -1;
+
+    return index;
+}
+
+
+void
+MPI_Channel::resetRequests(void)
+{
+    numRequests = 0;
+    requestGeneration++;
+    if (requestGeneration > MAX_REQUEST_GENERATION)
+      requestGeneration = 0;
+}
+
+
+int
+MPI_Channel::postRequest(void *data, int size, MPI_Datatype type, bool isRecv)
+{
+    // the requests are reused once all those posted have been waited on
+    bool allDone = true;
+    for (int i=0; i<numRequests && allDone == true; i++)
+      if (theRequests[i] != MPI_REQUEST_NULL)
+	allDone = false;
+    if (allDone == true && numRequests != 0)
+      this->resetRequests();
+
+    if (numRequests == MAX_NUM_REQUESTS) {
+      opserr << "MPI_Channel::postRequest() - more than " << MAX_NUM_REQUESTS;
+      opserr << " requests posted without being waited on\n";
+      return -1;
+    }
+
+    if (numRequests == maxNumRequests) {
+      int newMax = (maxNumRequests == 0) ? 8 : 2*maxNumRequests;
+      if (newMax > MAX_NUM_REQUESTS)
+	newMax = MAX_NUM_REQUESTS;
+      MPI_Request *newRequests = new MPI_Request[newMax];
+      MPI_Datatype *newTypes = new MPI_Datatype[newMax];
+      int *newSizes = new int[newMax];
+      for (int i=0; i<numRequests; i++) {
+	newRequests[i] = theRequests[i];
+	newTypes[i] = theTypes[i];
+	newSizes[i] = theSizes[i];
+      }
+      if (theRequests != 0) {
+	delete [] theRequests;
+	delete [] theTypes;
+	delete [] theSizes;
+      }
+      theRequests = newRequests;
+      theTypes = newTypes;
+      theSizes = newSizes;
+      maxNumRequests = newMax;
+    }
+
+    int index = numRequests++;
+    theTypes[index] = type;
+    if (isRecv == true) {
+      theSizes[index] = size;
+      MPI_Irecv(data, size, type, otherTag, 0, otherComm, &theRequests[index]);
+    } else {
+      theSizes[index] = -1;
+      MPI_Isend(data, size, type, otherTag, 0, otherComm, &theRequests[index]);
+    }
+
+    return (requestGeneration << REQUEST_INDEX_BITS) + index + 1;
+}
+
+
 /*
 int 
 MPI_Channel::getPortNumber(void) const
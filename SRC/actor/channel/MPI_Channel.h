@@ -30,10 +30,20 @@
 // MPI_Channel is a sub-class of channel. It is implemented with Berkeley
 // stream sockets using the TCP protocol. Messages delivery is garaunteed. 
 // Communication is full-duplex between a pair of connected sockets.
+// Sends and receives may also be posted, the post methods returning a
+// request, never equal to Channel::requestDone, which is completed by
+// waitRequest() or waitAll(); all messages use the same MPI tag so that posted and
+// blocking messages are matched in the order they were issued.
 
 #ifndef MPI_Channel_h
 #define MPI_Channel_h
 
+// a posted request is returned as its index plus one in the low bits
+// and the generation of the requests in the high bits
+#define REQUEST_INDEX_BITS 16
+#define MAX_NUM_REQUESTS 0xffff
+#define MAX_REQUEST_GENERATION 0x7ffe
+
 #include <mpi.h>
 #include <Channel.h>
 
@@ -74,12 +84,36 @@ class MPI_Channel : public Channel
     int sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress =0);
     int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress =0);    
     
+    int postSendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress =0);    
+    int postRecvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress =0);       
+    int postSendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress =0);
+    int postRecvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress =0);
+    int postSendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress =0);
+    int postRecvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress =0);
+    int postSendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress =0);
+    int postRecvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress =0);    
+
+    int waitRequest(int request);
+    int waitAll(void);
     
   protected:
 	
   private:
+    int setOtherAddress(ChannelAddress *theAddress, const char *method);
+    int postRequest(void *data, int size, MPI_Datatype type, bool isRecv);
+    int waitIndex(int index);
+    int getRequestIndex(int request);
+    void resetRequests(void);
+
     int otherTag;
     MPI_Comm otherComm;    
+
+    MPI_Request *theRequests;	// the posted sends and receives
+    MPI_Datatype *theTypes;
+    int *theSizes;		// entries expected by a receive, -1 for a send
+    int numRequests;
+    int maxNumRequests;
+    int requestGeneration;	// changes each time the requests are reused
 };
 
 
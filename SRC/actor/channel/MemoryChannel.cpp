@@ -0,0 +1,330 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/MemoryChannel.cpp,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the implementation of MemoryChannel.
+// Each record is stored as two ints, the type of data and its size,
+// followed by the data padded to a multiple of 8 bytes.
+//
+// What: "@(#) MemoryChannel.cpp, revA"
+
+#include <MemoryChannel.h>
+#include <MovableObject.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <string.h>
+
+enum {MEMORY_CHANNEL_ID = 1, MEMORY_CHANNEL_VECTOR = 2,
+      MEMORY_CHANNEL_MATRIX = 3, MEMORY_CHANNEL_MESSAGE = 4};
+
+#define MEMORY_CHANNEL_HEADER (2*sizeof(int))
+
+MemoryChannel::MemoryChannel()
+  :data(0), numBytes(0), capacity(0), position(0)
+{
+
+}
+
+MemoryChannel::~MemoryChannel()
+{
+  if (data != 0)
+    delete [] data;
+}
+
+void
+MemoryChannel::clear(void)
+{
+  numBytes = 0;
+  position = 0;
+}
+
+void
+MemoryChannel::rewind(void)
+{
+  position = 0;
+}
+
+long
+MemoryChannel::getNumBytes(void) const
+{
+  return numBytes;
+}
+
+const char *
+MemoryChannel::getData(void) const
+{
+  return data;
+}
+
+char *
+MemoryChannel::setNumBytes(long nBytes)
+{
+  if (nBytes > capacity) {
+    char *newData = new char[nBytes];
+    if (newData == 0) {
+      opserr << "MemoryChannel::setNumBytes() - ran out of memory for " << nBytes << " bytes\n";
+      return 0;
+    }
+    if (data != 0)
+      delete [] data;
+    data = newData;
+    capacity = nBytes;
+  }
+
+  numBytes = nBytes;
+  position = 0;
+
+  return data;
+}
+
+char *
+MemoryChannel::addToProgram(void)
+{
+  return 0;
+}
+
+int
+MemoryChannel::setUpConnection(void)
+{
+  return 0;
+}
+
+int
+MemoryChannel::setNextAddress(const ChannelAddress &otherChannelAddress)
+{
+  return 0;
+}
+
+ChannelAddress *
+MemoryChannel::getLastSendersAddress(void)
+{
+  return 0;
+}
+
+int
+MemoryChannel::sendObj(int commitTag, MovableObject &theObject, ChannelAddress *theAddress)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+int
+MemoryChannel::recvObj(int commitTag, MovableObject &theObject, FEM_ObjectBroker &theBroker, 
+		       ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+char *
+MemoryChannel::addRecord(int type, int size, int nBytes)
+{
+  long length = MEMORY_CHANNEL_HEADER + ((nBytes + 7)/8)*8;
+
+  if (numBytes + length > capacity) {
+    long newCapacity = (capacity == 0) ? 65536 : 2*capacity;
+    while (newCapacity < numBytes + length)
+      newCapacity *= 2;
+    char *newData = new char[newCapacity];
+    if (newData == 0) {
+      opserr << "MemoryChannel::addRecord() - ran out of memory for " << newCapacity << " bytes\n";
+      return 0;
+    }
+    if (data != 0) {
+      memcpy(newData, data, numBytes);
+      delete [] data;
+    }
+    data = newData;
+    capacity = newCapacity;
+  }
+
+  int *theHeader = (int *)(data + numBytes);
+  theHeader[0] = type;
+  theHeader[1] = size;
+
+  char *theRecord = data + numBytes + MEMORY_CHANNEL_HEADER;
+  numBytes += length;
+
+  return theRecord;
+}
+
+const char *
+MemoryChannel::nextRecord(int type, int size, int nBytes)
+{
+  long length = MEMORY_CHANNEL_HEADER + ((nBytes + 7)/8)*8;
+  if (position + (long)MEMORY_CHANNEL_HEADER > numBytes) {
+    opserr << "MemoryChannel::nextRecord() - no more data in channel\n";
+    return 0;
+  }
+
+  const int *theHeader = (const int *)(data + position);
+  if (theHeader[0] != type || (size >= 0 && theHeader[1] != size)) {
+    opserr << "MemoryChannel::nextRecord() - data received does not match data sent\n";
+    return 0;
+  }
+
+  const char *theRecord = data + position + MEMORY_CHANNEL_HEADER;
+  position += length;
+
+  return theRecord;
+}
+
+int 
+MemoryChannel::sendMsg(int dbTag, int commitTag, const Message &theMessage, ChannelAddress *theAddress)
+{
+  Message &msg = const_cast<Message &>(theMessage);
+  int size = msg.getSize();
+  char *to = this->addRecord(MEMORY_CHANNEL_MESSAGE, size, size);
+  if (to == 0)
+    return -1;
+
+  if (size > 0)
+    memcpy(to, msg.getData(), size);
+
+  return 0;
+}
+
+int 
+MemoryChannel::recvMsg(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  int size = theMessage.getSize();
+  const char *from = this->nextRecord(MEMORY_CHANNEL_MESSAGE, size, size);
+  if (from == 0)
+    return -1;
+
+  if (size > 0)
+    memcpy((char *)theMessage.getData(), from, size);
+
+  return 0;
+}
+
+int 
+MemoryChannel::recvMsgUnknownSize(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  if (position + (long)MEMORY_CHANNEL_HEADER > numBytes) {
+    opserr << "MemoryChannel::recvMsgUnknownSize() - no more data in channel\n";
+    return -1;
+  }
+
+  int size = ((const int *)(data + position))[1];
+  const char *from = this->nextRecord(MEMORY_CHANNEL_MESSAGE, size, size);
+  if (from == 0)
+    return -1;
+
+  theMessage.setData((char *)from, size);
+
+  return 0;
+}
+
+int 
+MemoryChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  int numRows = theMatrix.noRows();
+  int numCols = theMatrix.noCols();
+  int size = numRows*numCols;
+  double *to = (double *)this->addRecord(MEMORY_CHANNEL_MATRIX, size, size*sizeof(double));
+  if (to == 0)
+    return -1;
+
+  for (int j=0; j<numCols; j++)
+    for (int i=0; i<numRows; i++)
+      *to++ = theMatrix(i,j);
+
+  return 0;
+}
+
+int 
+MemoryChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  int numRows = theMatrix.noRows();
+  int numCols = theMatrix.noCols();
+  int size = numRows*numCols;
+  const double *from = (const double *)this->nextRecord(MEMORY_CHANNEL_MATRIX, size, size*sizeof(double));
+  if (from == 0)
+    return -1;
+
+  for (int j=0; j<numCols; j++)
+    for (int i=0; i<numRows; i++)
+      theMatrix(i,j) = *from++;
+
+  return 0;
+}
+
+int 
+MemoryChannel::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  double *to = (double *)this->addRecord(MEMORY_CHANNEL_VECTOR, size, size*sizeof(double));
+  if (to == 0)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    to[i] = theVector(i);
+
+  return 0;
+}
+
+int 
+MemoryChannel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  const double *from = (const double *)this->nextRecord(MEMORY_CHANNEL_VECTOR, size, size*sizeof(double));
+  if (from == 0)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    theVector(i) = from[i];
+
+  return 0;
+}
+
+int 
+MemoryChannel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  int *to = (int *)this->addRecord(MEMORY_CHANNEL_ID, size, size*sizeof(int));
+  if (to == 0)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    to[i] = theID(i);
+
+  return 0;
+}
+
+int 
+MemoryChannel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  const int *from = (const int *)this->nextRecord(MEMORY_CHANNEL_ID, size, size*sizeof(int));
+  if (from == 0)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    theID(i) = from[i];
+
+  return 0;
+}
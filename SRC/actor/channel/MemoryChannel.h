@@ -0,0 +1,119 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/MemoryChannel.h,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the class definition for MemoryChannel.
+// MemoryChannel is a sub-class of channel that keeps everything sent
+// to it in one contiguous block of memory. After rewind() the data is
+// received back in the order it was sent, so an object can be copied
+// by invoking sendSelf() and then recvSelf() with the same channel.
+// The dbTag and commitTag arguments are ignored. A message received
+// with recvMsgUnknownSize() points into the channel and is valid until
+// the channel is cleared. The block of data can be shipped elsewhere
+// as a whole, with getData(), and placed in another MemoryChannel,
+// with setNumBytes(), to be received there.
+//
+// What: "@(#) MemoryChannel.h, revA"
+
+#ifndef MemoryChannel_h
+#define MemoryChannel_h
+
+#include <Channel.h>
+
+class MemoryChannel : public Channel
+{
+  public:
+    MemoryChannel();
+    ~MemoryChannel();
+
+    // remove all data, keeping the memory for the next sends
+    void clear(void);
+    // position the channel at the first data sent
+    void rewind(void);
+    long getNumBytes(void) const;
+
+    // the data sent, getNumBytes() long
+    const char *getData(void) const;
+    // make room for nBytes shipped from another MemoryChannel and rewind;
+    // the block returned is to be filled with that channel's data
+    char *setNumBytes(long nBytes);
+
+    char *addToProgram(void);
+    int setUpConnection(void);
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    ChannelAddress *getLastSendersAddress(void);
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+  protected:
+
+  private:
+    char *addRecord(int type, int size, int numBytes);
+    const char *nextRecord(int type, int size, int numBytes);
+
+    char *data;
+    long numBytes;   // bytes sent
+    long capacity;   // bytes allocated
+    long position;   // offset of the next record to be received
+};
+
+#endif
@@ -159,6 +159,66 @@ Shadow::recvID(ID &theID)
     return theChannel->recvID(0, commitTag, theID, theRemoteActorsAddress);
 }
 
+int
+Shadow::postSendMessage(const Message &theMessage)
+{
+    return theChannel->postSendMsg(0, commitTag, theMessage, theRemoteActorsAddress);
+}
+
+int
+Shadow::postRecvMessage(Message &theMessage)
+{
+    return theChannel->postRecvMsg(0, commitTag, theMessage, theRemoteActorsAddress);
+}
+
+int
+Shadow::postSendMatrix(const Matrix &theMatrix)
+{
+    return theChannel->postSendMatrix(0, commitTag, theMatrix, theRemoteActorsAddress);
+}
+
+int
+Shadow::postRecvMatrix(Matrix &theMatrix)
+{
+    return theChannel->postRecvMatrix(0, commitTag, theMatrix, theRemoteActorsAddress);
+}
+
+int
+Shadow::postSendVector(const Vector &theVector)
+{
+    return theChannel->postSendVector(0, commitTag, theVector, theRemoteActorsAddress);
+}
+
+int
+Shadow::postRecvVector(Vector &theVector)
+{
+    return theChannel->postRecvVector(0, commitTag, theVector, theRemoteActorsAddress);
+}
+
+int
+Shadow::postSendID(const ID &theID)
+{
+    return theChannel->postSendID(0, commitTag, theID, theRemoteActorsAddress);
+}
+
+int
+Shadow::postRecvID(ID &theID)
+{
+    return theChannel->postRecvID(0, commitTag, theID, theRemoteActorsAddress);
+}
+
+int
+Shadow::waitRequest(int request)
+{
+    return theChannel->waitRequest(request);
+}
+
+int
+Shadow::waitAll(void)
+{
+    return theChannel->waitAll();
+}
+
 
 void
 Shadow::setCommitTag(int tag)
@@ -75,6 +75,19 @@ class Shadow
     virtual int recvVector(Vector &theVector);      
     virtual int sendID(const ID &theID);  
     virtual int recvID(ID &theID);      
+
+    // posted communication, see Channel
+    virtual int postSendMessage(const Message &theMessage);  
+    virtual int postRecvMessage(Message &theMessage);  
+    virtual int postSendMatrix(const Matrix &theMatrix);  
+    virtual int postRecvMatrix(Matrix &theMatrix);      
+    virtual int postSendVector(const Vector &theVector);  
+    virtual int postRecvVector(Vector &theVector);      
+    virtual int postSendID(const ID &theID);  
+    virtual int postRecvID(ID &theID);      
+    virtual int waitRequest(int request);
+    virtual int waitAll(void);
+
     void setCommitTag(int commitTag);
 
     Channel 		  *getChannelPtr(void) const;
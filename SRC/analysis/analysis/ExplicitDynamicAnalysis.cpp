@@ -0,0 +1,512 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ExplicitDynamicAnalysis.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of the
+// ExplicitDynamicAnalysis class.
+//
+// What: "@(#) ExplicitDynamicAnalysis.cpp, revA"
+
+#include <ExplicitDynamicAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <MP_Constraint.h>
+#include <MP_ConstraintIter.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <ThreadPool.h>
+#include <map>
+
+// ThreadTask used to form the resisting forces of the elements; each
+// element writes only its own entries of eleForce
+class ExplicitDynamicAnalysisElementTask : public ThreadTask
+{
+ public:
+  ExplicitDynamicAnalysisElementTask(Element **theElements, const int *theForceLoc,
+				     double *theForces)
+    :theEles(theElements), eleForceLoc(theForceLoc), eleForce(theForces) {};
+
+  int execute(int start, int end, int threadID) {
+    for (int i=start; i<end; i++) {
+      const Vector &theForce = theEles[i]->getResistingForce();
+      double *force = &eleForce[eleForceLoc[i]];
+      int numDOF = eleForceLoc[i+1] - eleForceLoc[i];
+      for (int j=0; j<numDOF; j++)
+	force[j] = theForce(j);
+    }
+    return 0;
+  };
+
+ private:
+  Element **theEles;
+  const int *eleForceLoc;
+  double *eleForce;
+};
+
+// ThreadTask used to advance the dofs of the nodes a step and set the
+// new trial response at the nodes; the forces of a dof are summed in
+// the order of the elements, whatever the number of threads
+class ExplicitDynamicAnalysisNodeTask : public ThreadTask
+{
+ public:
+  ExplicitDynamicAnalysisNodeTask(Node **theNodes, const int *nodeDOF,
+				  Vector **nodeDisp, Vector **nodeVel, Vector **nodeAccel,
+				  double *U, double *V, double *A, const double *invMass,
+				  const double *eleForce, const int *dofForceStart,
+				  const int *dofForces, double deltaT)
+    :theNodes(theNodes), nodeDOF(nodeDOF), 
+     nodeDisp(nodeDisp), nodeVel(nodeVel), nodeAccel(nodeAccel),
+     U(U), V(V), A(A), invMass(invMass), eleForce(eleForce), 
+     dofForceStart(dofForceStart), dofForces(dofForces), deltaT(deltaT) {};
+
+  int execute(int start, int end, int threadID) {
+    for (int i=start; i<end; i++) {
+      Node *theNode = theNodes[i];
+      const Vector &P = theNode->getUnbalancedLoad();
+      int loc = nodeDOF[i];
+      int numDOF = nodeDOF[i+1] - loc;
+      for (int j=0; j<numDOF; j++, loc++) {
+	double R = P(j);
+	for (int k=dofForceStart[loc]; k<dofForceStart[loc+1]; k++)
+	  R -= eleForce[dofForces[k]];
+
+	//  the acceleration at time t, the velocity at t + 0.5 delta t
+	//  and the displacement at t + delta t
+	double a = R * invMass[loc];
+	A[loc] = a;
+	V[loc] += deltaT * a;
+	U[loc] += deltaT * V[loc];
+      }
+      theNode->setTrialDisp(*nodeDisp[i]);
+      theNode->setTrialVel(*nodeVel[i]);
+      theNode->setTrialAccel(*nodeAccel[i]);
+    }
+    return 0;
+  };
+
+ private:
+  Node **theNodes;
+  const int *nodeDOF;
+  Vector **nodeDisp, **nodeVel, **nodeAccel;
+  double *U, *V, *A;
+  const double *invMass;
+  const double *eleForce;
+  const int *dofForceStart, *dofForces;
+  double deltaT;
+};
+
+ExplicitDynamicAnalysis::ExplicitDynamicAnalysis(Domain &the_Domain)
+:TransientAnalysis(the_Domain), 
+ domainStamp(0),
+ numNodes(0), theNodes(0), nodeDOF(0), nodeDisp(0), nodeVel(0), nodeAccel(0),
+ numDOF(0), U(0), V(0), A(0), invMass(0),
+ numEles(0), numThreadSafeEles(0), theEles(0), eleForceLoc(0), eleForce(0),
+ dofForceStart(0), dofForces(0)
+{
+
+}    
+
+ExplicitDynamicAnalysis::~ExplicitDynamicAnalysis()
+{
+  this->clearAll();
+}    
+
+void
+ExplicitDynamicAnalysis::clearAll(void)
+{
+  if (nodeDisp != 0) {
+    for (int i=0; i<numNodes; i++) {
+      if (nodeDisp[i] != 0) delete nodeDisp[i];
+      if (nodeVel[i] != 0) delete nodeVel[i];
+      if (nodeAccel[i] != 0) delete nodeAccel[i];
+    }
+    delete [] nodeDisp;
+    delete [] nodeVel;
+    delete [] nodeAccel;
+  }
+  if (theNodes != 0) delete [] theNodes;
+  if (nodeDOF != 0) delete [] nodeDOF;
+  if (U != 0) delete [] U;
+  if (V != 0) delete [] V;
+  if (A != 0) delete [] A;
+  if (invMass != 0) delete [] invMass;
+  if (theEles != 0) delete [] theEles;
+  if (eleForceLoc != 0) delete [] eleForceLoc;
+  if (eleForce != 0) delete [] eleForce;
+  if (dofForceStart != 0) delete [] dofForceStart;
+  if (dofForces != 0) delete [] dofForces;
+
+  numNodes = 0; theNodes = 0; nodeDOF = 0;
+  nodeDisp = 0; nodeVel = 0; nodeAccel = 0;
+  numDOF = 0; U = 0; V = 0; A = 0; invMass = 0;
+  numEles = 0; numThreadSafeEles = 0; theEles = 0; eleForceLoc = 0; eleForce = 0;
+  dofForceStart = 0; dofForces = 0;
+}    
+
+int 
+ExplicitDynamicAnalysis::initialize(void)
+{
+    Domain *the_Domain = this->getDomainPtr();
+
+    // check if domain has undergone change
+    int stamp = the_Domain->hasDomainChanged();
+    if (stamp != domainStamp || theNodes == 0) {
+      domainStamp = stamp;	
+      if (this->domainChanged() < 0) {
+	opserr << "ExplicitDynamicAnalysis::initialize() - domainChanged() failed\n";
+	return -1;
+      }	
+    } else
+      this->getCommittedResponse();
+
+    return 0;
+}
+
+int 
+ExplicitDynamicAnalysis::analyze(int numSteps, double dT)
+{
+  if (dT <= 0.0) {
+    opserr << "ExplicitDynamicAnalysis::analyze() - error in variable\n";
+    opserr << "dT = " << dT << endln;
+    return -2;	
+  }
+
+  Domain *the_Domain = this->getDomainPtr();
+  ThreadPool *thePool = ThreadPool::getThreadPool();
+
+  // the response may have been changed since the last call
+  if (this->initialize() < 0)
+    return -1;
+
+  for (int i=0; i<numSteps; i++) {
+
+    if (the_Domain->analysisStep(dT) < 0) {
+      opserr << "ExplicitDynamicAnalysis::analyze() - the Domain failed in analysisStep";
+      opserr << " at time " << the_Domain->getCurrentTime() << endln;
+      the_Domain->revertToLastCommit();
+      this->getCommittedResponse();
+      return -2;
+    }
+
+    // check if domain has undergone change
+    int stamp = the_Domain->hasDomainChanged();
+    if (stamp != domainStamp) {
+      domainStamp = stamp;	
+      if (this->domainChanged() < 0) {
+	opserr << "ExplicitDynamicAnalysis::analyze() - domainChanged() failed\n";
+	return -1;
+      }	
+    }
+
+    // apply the loads at time t and form the resisting forces
+    double time = the_Domain->getCurrentTime();
+    the_Domain->applyLoad(time);
+
+    if (this->formResistingForces() < 0) {
+      opserr << "ExplicitDynamicAnalysis::analyze() - failed to form the resisting forces";
+      opserr << " at time " << time << endln;
+      the_Domain->revertToLastCommit();
+      this->getCommittedResponse();
+      return -3;
+    }
+
+    // advance the dofs and set the new response at the nodes
+    ExplicitDynamicAnalysisNodeTask theTask(theNodes, nodeDOF, nodeDisp, nodeVel, nodeAccel,
+					    U, V, A, invMass, eleForce, 
+					    dofForceStart, dofForces, dT);
+    if (thePool != 0)
+      thePool->run(theTask, numNodes);
+    else
+      theTask.execute(0, numNodes, 0);
+
+    // update time in Domain to T + deltaT, then update the elements
+    // through the Domain, which sets ops_Dt and only gives the thread
+    // safe elements to the threads, & commit the domain
+    the_Domain->setCurrentTime(time + dT);
+    if (the_Domain->update() != 0) {
+      opserr << "ExplicitDynamicAnalysis::analyze() - the Domain failed in update";
+      opserr << " at time " << time + dT << endln;
+      the_Domain->revertToLastCommit();
+      this->getCommittedResponse();
+      return -3;
+    }
+
+    if (the_Domain->commit() < 0) {
+      opserr << "ExplicitDynamicAnalysis::analyze() - ";
+      opserr << "the Domain failed to commit";
+      opserr << " at time " << time + dT << endln;
+      the_Domain->revertToLastCommit();
+      this->getCommittedResponse();
+      return -4;
+    } 
+  }    
+
+  return 0;
+}
+
+int
+ExplicitDynamicAnalysis::formResistingForces(void)
+{
+  ExplicitDynamicAnalysisElementTask theTask(theEles, eleForceLoc, eleForce);
+
+  // only the thread safe elements, at the front of theEles, are given
+  // to the threads; the others are done by this thread
+  int ok = 0;
+  ThreadPool *thePool = ThreadPool::getThreadPool();
+  if (thePool != 0) {
+    ok = thePool->run(theTask, numThreadSafeEles);
+    ok += theTask.execute(numThreadSafeEles, numEles, 0);
+  } else
+    ok = theTask.execute(0, numEles, 0);
+
+  return ok;
+}
+
+void
+ExplicitDynamicAnalysis::getCommittedResponse(void)
+{
+  // the last committed displacement and velocity of the nodes; the
+  // velocity of the fixed dofs is taken as zero
+  for (int i=0; i<numNodes; i++) {
+    const Vector &disp = theNodes[i]->getDisp();
+    const Vector &vel = theNodes[i]->getVel();
+    int loc = nodeDOF[i];
+    int numNodeDOF = nodeDOF[i+1] - loc;
+    for (int j=0; j<numNodeDOF; j++, loc++) {
+      U[loc] = disp(j);
+      V[loc] = (invMass[loc] != 0.0) ? vel(j) : 0.0;
+      A[loc] = 0.0;
+    }
+  }
+}
+
+int 
+ExplicitDynamicAnalysis::domainChanged(void)
+{
+    Domain *the_Domain = this->getDomainPtr();
+    this->clearAll();
+
+    MP_ConstraintIter &theMPs = the_Domain->getMPs();
+    if (theMPs() != 0) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - ";
+      opserr << "MP_Constraints are not supported\n";
+      return -1;
+    }
+
+    //
+    // the nodes and the location of their dofs
+    //
+
+    numNodes = the_Domain->getNumNodes();
+    theNodes = new Node *[numNodes];
+    nodeDOF = new int[numNodes+1];
+
+    std::map<int, int> nodeIndex;
+    NodeIter &theNodeIter = the_Domain->getNodes();
+    Node *nodePtr;
+    int count = 0;
+    nodeDOF[0] = 0;
+    while ((nodePtr = theNodeIter()) != 0 && count < numNodes) {
+      theNodes[count] = nodePtr;
+      nodeIndex[nodePtr->getTag()] = count;
+      nodeDOF[count+1] = nodeDOF[count] + nodePtr->getNumberDOF();
+      count++;
+    }
+    numNodes = count;
+    numDOF = nodeDOF[numNodes];
+
+    U = new double[numDOF];
+    V = new double[numDOF];
+    A = new double[numDOF];
+    invMass = new double[numDOF];
+    for (int i=0; i<numDOF; i++)
+      invMass[i] = 0.0;
+
+    // the lumped mass, first of the nodes ..
+    for (int i=0; i<numNodes; i++) {
+      if (theNodes[i]->hasRayleighDamping() == true) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - node " << theNodes[i]->getTag();
+	opserr << " has rayleigh damping, which is not supported\n";
+	return -1;
+      }
+      const Matrix &mass = theNodes[i]->getMass();
+      int loc = nodeDOF[i];
+      int numNodeDOF = nodeDOF[i+1] - loc;
+      for (int j=0; j<numNodeDOF; j++)
+	invMass[loc+j] += mass(j,j);
+    }
+
+    //
+    // the elements and the dofs of their forces
+    //
+
+    numEles = the_Domain->getNumElements();
+    theEles = new Element *[numEles];
+    eleForceLoc = new int[numEles+1];
+
+    // the elements that are thread safe are placed first, the others
+    // from the back; those are then put back in the domain's order,
+    // after the thread safe ones
+    ElementIter &theEleIter = the_Domain->getElements();
+    Element *elePtr;
+    count = 0;
+    int numOther = 0;
+    while ((elePtr = theEleIter()) != 0 && count+numOther < numEles) {
+      if (elePtr->isSubdomain() == true) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - ";
+	opserr << "subdomains are not supported\n";
+	return -1;
+      }
+      if (elePtr->hasRayleighDamping() == true) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - element " << elePtr->getTag();
+	opserr << " has rayleigh damping, which is not supported\n";
+	return -1;
+      }
+      if (elePtr->isThreadSafe() == true)
+	theEles[count++] = elePtr;
+      else
+	theEles[numEles - ++numOther] = elePtr;
+    }
+    numThreadSafeEles = count;
+    for (int i=0, j=numEles-1; i<numOther/2; i++, j--) {
+      Element *theEle = theEles[numEles-numOther+i];
+      theEles[numEles-numOther+i] = theEles[j];
+      theEles[j] = theEle;
+    }
+    for (int i=0; i<numOther; i++)
+      theEles[count+i] = theEles[numEles-numOther+i];
+    numEles = count + numOther;
+
+    eleForceLoc[0] = 0;
+    for (int e=0; e<numEles; e++)
+      eleForceLoc[e+1] = eleForceLoc[e] + theEles[e]->getNumDOF();
+
+    int numEleDOF = eleForceLoc[numEles];
+    eleForce = new double[numEleDOF];
+    int *eleDOF = new int[numEleDOF];
+
+    for (int e=0; e<numEles; e++) {
+      elePtr = theEles[e];
+      const ID &theNodeTags = elePtr->getExternalNodes();
+      int loc = eleForceLoc[e];
+      for (int k=0; k<theNodeTags.Size(); k++) {
+	std::map<int, int>::iterator it = nodeIndex.find(theNodeTags(k));
+	if (it == nodeIndex.end()) {
+	  opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - node " << theNodeTags(k);
+	  opserr << " of element " << elePtr->getTag() << " not in the domain\n";
+	  delete [] eleDOF;
+	  return -2;
+	}
+	int node = it->second;
+	for (int j=nodeDOF[node]; j<nodeDOF[node+1] && loc<eleForceLoc[e+1]; j++)
+	  eleDOF[loc++] = j;
+      }
+      if (loc != eleForceLoc[e+1]) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - the dofs of element ";
+	opserr << elePtr->getTag() << " do not match those of its nodes\n";
+	delete [] eleDOF;
+	return -2;
+      }
+
+      // .. then of the elements
+      const Matrix &mass = elePtr->getMass();
+      loc = eleForceLoc[e];
+      for (int j=0; j<eleForceLoc[e+1]-eleForceLoc[e]; j++)
+	invMass[eleDOF[loc+j]] += mass(j,j);
+    }
+
+    // the map from each dof to the element forces acting on it, in
+    // the order of the elements
+    dofForceStart = new int[numDOF+1];
+    dofForces = new int[numEleDOF];
+    for (int i=0; i<=numDOF; i++)
+      dofForceStart[i] = 0;
+    for (int i=0; i<numEleDOF; i++)
+      dofForceStart[eleDOF[i]+1]++;
+    for (int i=0; i<numDOF; i++)
+      dofForceStart[i+1] += dofForceStart[i];
+    for (int i=0; i<numEleDOF; i++)
+      dofForces[dofForceStart[eleDOF[i]]++] = i;
+    for (int i=numDOF; i>0; i--)
+      dofForceStart[i] = dofForceStart[i-1];
+    dofForceStart[0] = 0;
+
+    delete [] eleDOF;
+
+    //
+    // fix the constrained dofs and invert the mass of the others
+    //
+
+    SP_ConstraintIter &theSPs = the_Domain->getDomainAndLoadPatternSPs();
+    SP_Constraint *theSP; 
+    while ((theSP = theSPs()) != 0) {
+      if (theSP->isHomogeneous() == false) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - ";
+	opserr << " non-homogeneos constraint";
+	opserr << " for node " << theSP->getNodeTag();
+	opserr << " homo assumed\n";
+      }
+      std::map<int, int>::iterator it = nodeIndex.find(theSP->getNodeTag());
+      int dof = theSP->getDOF_Number();
+      if (it != nodeIndex.end() && dof >= 0 && dof < nodeDOF[it->second+1]-nodeDOF[it->second])
+	invMass[nodeDOF[it->second]+dof] = -1.0;
+    }
+
+    for (int i=0; i<numNodes; i++) {
+      for (int j=nodeDOF[i]; j<nodeDOF[i+1]; j++) {
+	double mass = invMass[j];
+	if (mass == -1.0)
+	  invMass[j] = 0.0;
+	else if (mass > 0.0)
+	  invMass[j] = 1.0/mass;
+	else {
+	  opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - dof " << j-nodeDOF[i]+1;
+	  opserr << " of node " << theNodes[i]->getTag() << " is free but has no mass\n";
+	  return -3;
+	}
+      }
+    }
+
+    // Vectors on the response of each node, passed to the nodes
+    nodeDisp = new Vector *[numNodes];
+    nodeVel = new Vector *[numNodes];
+    nodeAccel = new Vector *[numNodes];
+    for (int i=0; i<numNodes; i++) {
+      int numNodeDOF = nodeDOF[i+1] - nodeDOF[i];
+      nodeDisp[i] = new Vector(&U[nodeDOF[i]], numNodeDOF);
+      nodeVel[i] = new Vector(&V[nodeDOF[i]], numNodeDOF);
+      nodeAccel[i] = new Vector(&A[nodeDOF[i]], numNodeDOF);
+    }
+
+    this->getCommittedResponse();
+
+    return 0;
+}
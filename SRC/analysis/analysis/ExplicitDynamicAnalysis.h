@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ExplicitDynamicAnalysis.h,v $
+
+#ifndef ExplicitDynamicAnalysis_h
+#define ExplicitDynamicAnalysis_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for 
+// ExplicitDynamicAnalysis. ExplicitDynamicAnalysis is a subclass of
+// TransientAnalysis. It performs the same central difference steps as a
+// DirectIntegrationAnalysis with the CentralDifferenceNoDamping
+// integrator and a DiagonalSOE, but without an AnalysisModel, LinearSOE
+// or solution algorithm: the lumped mass, displacement, velocity and
+// acceleration of every nodal dof are kept in contiguous arrays, and the
+// resisting forces of the elements are gathered into them through dof
+// maps formed when the domain changes. When threads have been requested
+// the node loop and the element loops, over the elements that are
+// thread safe, are split among the ThreadPool threads.
+//
+// The mass of a dof is the diagonal of the nodal and element mass
+// matrices; every free dof needs a non-zero mass. SP_Constraints fix
+// their dof (they are taken to be homogeneous, as in the PlainHandler);
+// MP_Constraints and subdomains are not supported. There is no damping;
+// the analysis fails if rayleigh damping is set on a node or element.
+//
+// What: "@(#) ExplicitDynamicAnalysis.h, revA"
+
+#include <TransientAnalysis.h>
+
+class Node;
+class Element;
+class Vector;
+
+class ExplicitDynamicAnalysis: public TransientAnalysis
+{
+  public:
+    ExplicitDynamicAnalysis(Domain &theDomain);
+    virtual ~ExplicitDynamicAnalysis();
+
+    void clearAll(void);	    
+    
+    int analyze(int numSteps, double dT);
+    int initialize(void);
+    int domainChanged(void);
+
+  protected:
+    
+  private:
+    int formResistingForces(void);
+    void getCommittedResponse(void);
+
+    int domainStamp;
+
+    int numNodes;
+    Node **theNodes;
+    int *nodeDOF;          // location of the first dof of each node
+    Vector **nodeDisp, **nodeVel, **nodeAccel; // slices of U, V and A
+    
+    int numDOF;
+    double *U, *V, *A;     // response at the dofs
+    double *invMass;       // inverse lumped mass, 0 at fixed dofs
+    
+    int numEles;
+    int numThreadSafeEles; // the first elements, given to the threads
+    Element **theEles;
+    int *eleForceLoc;      // location of each element's forces in eleForce
+    double *eleForce;      // resisting forces of the elements
+
+    int *dofForceStart;    // the entries of eleForce to be added to each
+    int *dofForces;        // dof: dofForces[dofForceStart[i]], ...
+};
+
+#endif
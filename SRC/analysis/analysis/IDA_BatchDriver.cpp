@@ -0,0 +1,382 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/IDA_BatchDriver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of IDA_BatchDriver.
+// Case c is record c%numRecords at scale factor c/numRecords, so the
+// cases go out lowest scale factor first. Each worker process runs one
+// case and returns (status, peak, time) as doubles down a pipe; it is
+// then stopped.
+//
+// What: "@(#) IDA_BatchDriver.cpp, revA"
+
+#include <IDA_BatchDriver.h>
+#include <DirectIntegrationAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <UniformExcitation.h>
+#include <GroundMotion.h>
+#include <TimeSeries.h>
+#include <SnapshotStack.h>
+#include <OPS_Stream.h>
+#include <OPS_Globals.h>
+
+#include <math.h>
+
+IDA_BatchDriver::IDA_BatchDriver(Domain &passedDomain,
+				 DirectIntegrationAnalysis &passedAnalysis,
+				 FEM_ObjectBroker &passedBroker,
+				 int passedDir, double passedDT,
+				 int passedNodeTag, int passedDof)
+  :theDomain(&passedDomain), theAnalysis(&passedAnalysis), theBroker(&passedBroker),
+   dir(passedDir), dT(passedDT), nodeTag(passedNodeTag), dof(passedDof),
+   theRecords(0), numRecords(0), scaleFactors(0),
+   collapseLimit(0.0), freeVibrationTime(0.0), numProcesses(1), numCollapses(0),
+   workerRecord(0), workerScale(0.0)
+{
+
+}
+
+IDA_BatchDriver::~IDA_BatchDriver()
+{
+  for (int i=0; i<numRecords; i++)
+    delete theRecords[i];
+  if (theRecords != 0)
+    delete [] theRecords;
+}
+
+int
+IDA_BatchDriver::addRecord(TimeSeries *theAccelSeries)
+{
+  if (theAccelSeries == 0)
+    return -1;
+
+  TimeSeries **newRecords = new TimeSeries *[numRecords+1];
+  for (int i=0; i<numRecords; i++)
+    newRecords[i] = theRecords[i];
+  newRecords[numRecords] = theAccelSeries;
+
+  if (theRecords != 0)
+    delete [] theRecords;
+  theRecords = newRecords;
+  numRecords++;
+
+  return 0;
+}
+
+int
+IDA_BatchDriver::setScaleFactors(const Vector &theScaleFactors)
+{
+  // kept in increasing order, the order in which the cases are run
+  int numScales = theScaleFactors.Size();
+  scaleFactors.resize(numScales);
+  for (int i=0; i<numScales; i++) {
+    double scale = theScaleFactors(i);
+    int j = i;
+    while (j > 0 && scaleFactors(j-1) > scale) {
+      scaleFactors(j) = scaleFactors(j-1);
+      j--;
+    }
+    scaleFactors(j) = scale;
+  }
+
+  return 0;
+}
+
+void
+IDA_BatchDriver::setCollapseLimit(double limit)
+{
+  collapseLimit = limit;
+}
+
+void
+IDA_BatchDriver::setFreeVibrationTime(double time)
+{
+  freeVibrationTime = (time > 0.0) ? time : 0.0;
+}
+
+void
+IDA_BatchDriver::setNumProcesses(int passedNumProcesses)
+{
+  numProcesses = (passedNumProcesses < 1) ? 1 : passedNumProcesses;
+}
+
+int
+IDA_BatchDriver::getNumRecords(void) const
+{
+  return numRecords;
+}
+
+int
+IDA_BatchDriver::getNumCollapses(void) const
+{
+  return numCollapses;
+}
+
+int
+IDA_BatchDriver::runCase(int record, double scale, double *result)
+{
+  result[0] = 0.0;
+  result[1] = 0.0;
+  result[2] = 0.0;
+
+  Node *theNode = theDomain->getNode(nodeTag);
+  if (theNode == 0 || dof < 0 || dof >= theNode->getNumberDOF()) {
+    opserr << "IDA_BatchDriver::runCase() - no dof " << dof+1 << " at node " << nodeTag << endln;
+    return -1;
+  }
+
+  // a tag no other load pattern has
+  int patternTag = 1;
+  LoadPattern *theLP;
+  LoadPatternIter &theLPs = theDomain->getLoadPatterns();
+  while ((theLP = theLPs()) != 0)
+    if (theLP->getTag() >= patternTag)
+      patternTag = theLP->getTag()+1;
+
+  TimeSeries *theSeries = theRecords[record]->getCopy();
+  GroundMotion *theMotion = new GroundMotion(0, 0, theSeries);
+  UniformExcitation *thePattern = new UniformExcitation(*theMotion, dir, patternTag, 0.0, scale);
+  if (theDomain->addLoadPattern(thePattern) == false) {
+    opserr << "IDA_BatchDriver::runCase() - could not add the load pattern for record " << record+1 << endln;
+    delete thePattern;
+    return -1;
+  }
+
+  double startTime = theDomain->getCurrentTime();
+  double duration = theMotion->getDuration() + freeVibrationTime;
+  int numSteps = (int)(duration/dT + 0.5);
+
+  double peak = 0.0;
+  for (int i=0; i<numSteps; i++) {
+    if (theAnalysis->analyze(1, dT) < 0) {
+      result[0] = 2.0;
+      break;
+    }
+
+    double u = fabs(theNode->getDisp()(dof));
+    if (u > peak)
+      peak = u;
+
+    if (collapseLimit > 0.0 && peak > collapseLimit) {
+      result[0] = 1.0;
+      break;
+    }
+  }
+
+  result[1] = peak;
+  result[2] = theDomain->getCurrentTime() - startTime;
+
+  return patternTag;
+}
+
+int
+IDA_BatchDriver::runWorker(int fromParent, int toParent)
+{
+  double result[3];
+  if (this->runCase(workerRecord, workerScale, result) < 0)
+    result[0] = -1.0;
+
+  return WorkerProcesses::writeAll(toParent, result, 3*sizeof(double));
+}
+
+int
+IDA_BatchDriver::writeResult(OPS_Stream &theOutput, int record, double scale, const double *result)
+{
+  theOutput << record+1 << " " << scale << " " << (int)result[0] << " "
+	    << result[1] << " " << result[2] << endln;
+
+  if (result[0] > 0.0)
+    numCollapses++;
+
+  return 0;
+}
+
+int
+IDA_BatchDriver::run(OPS_Stream &theOutput)
+{
+  int numScales = scaleFactors.Size();
+  int numCases = numRecords*numScales;
+  numCollapses = 0;
+
+  if (numCases == 0)
+    return 0;
+
+  // index of the lowest scale factor each record collapsed at
+  int *collapseScale = new int[numRecords];
+  for (int r=0; r<numRecords; r++)
+    collapseScale[r] = numScales;
+
+  int res = 0;
+
+#ifndef _WIN32
+  if (numProcesses > 1) {
+    WorkerProcesses theWorkers(theDomain, numProcesses);
+    int *workerCase = new int[numProcesses];
+    for (int i=0; i<numProcesses; i++)
+      workerCase[i] = -1;
+
+    // the results are kept until all are in, to be written in case order
+    double *results = new double[3*numCases];
+    bool *caseDone = new bool[numCases];
+    for (int c=0; c<numCases; c++)
+      caseDone[c] = false;
+
+    int next = 0;
+
+    while (res == 0) {
+
+      // start a case on every free process
+      while (theWorkers.getNumWorkers() < numProcesses && next < numCases) {
+	int c = next;
+	while (c < numCases && c/numRecords > collapseScale[c%numRecords])
+	  c++;
+	if (c >= numCases) {
+	  next = c;
+	  break;
+	}
+
+	workerRecord = c%numRecords;
+	workerScale = scaleFactors(c/numRecords);
+	int i = theWorkers.start(*this, true);
+	if (i < 0)
+	  break;
+	workerCase[i] = c;
+	next = c+1;
+      }
+
+      if (theWorkers.getNumWorkers() == 0) {
+	if (next < numCases) {
+	  opserr << "IDA_BatchDriver::run() - could not start a process\n";
+	  res = -1;
+	}
+	break;
+      }
+
+      int i = theWorkers.waitForReply();
+      if (i < 0) {
+	res = -1;
+	break;
+      }
+
+      int c = workerCase[i];
+      int r = c%numRecords;
+      int s = c/numRecords;
+
+      double result[3];
+      int ok = theWorkers.receive(i, result, 3*sizeof(double));
+      theWorkers.stop(i);
+      workerCase[i] = -1;
+
+      if (ok < 0 || result[0] < 0.0) {
+	opserr << "IDA_BatchDriver::run() - record " << r+1 << " at scale factor "
+	       << scaleFactors(s) << " could not be run\n";
+	res = -1;
+	break;
+      }
+
+      for (int k=0; k<3; k++)
+	results[3*c+k] = result[k];
+      caseDone[c] = true;
+
+      if (result[0] > 0.0 && s < collapseScale[r]) {
+	collapseScale[r] = s;
+
+	// the larger scale factors of the record are not needed
+	for (int k=0; k<numProcesses; k++) {
+	  int ck = workerCase[k];
+	  if (ck >= 0 && ck%numRecords == r && ck/numRecords > s) {
+	    theWorkers.stop(k);
+	    workerCase[k] = -1;
+	  }
+	}
+      }
+    }
+
+    // the cases the serial run would have written, up to the first one
+    // missing after an error; a case finished before a lower scale factor
+    // of its record collapsed is left out
+    for (int c=0; c<numCases; c++) {
+      int r = c%numRecords;
+      int s = c/numRecords;
+      if (s > collapseScale[r])
+	continue;
+      if (caseDone[c] == false)
+	break;
+      this->writeResult(theOutput, r, scaleFactors(s), &results[3*c]);
+    }
+
+    // anything still running after an error is stopped by theWorkers
+    delete [] workerCase;
+    delete [] results;
+    delete [] caseDone;
+    delete [] collapseScale;
+
+    return res;
+  }
+#endif
+
+  // one case after the other, returning to the starting state each time
+  SnapshotStack theStart(*theDomain, *theBroker, 1);
+  if (theStart.push() < 0) {
+    opserr << "IDA_BatchDriver::run() - could not save the starting state of the model\n";
+    delete [] collapseScale;
+    return -1;
+  }
+
+  for (int c=0; c<numCases && res == 0; c++) {
+    int r = c%numRecords;
+    int s = c/numRecords;
+    if (s > collapseScale[r])
+      continue;
+
+    double result[3];
+    int patternTag = this->runCase(r, scaleFactors(s), result);
+    if (patternTag < 0) {
+      opserr << "IDA_BatchDriver::run() - record " << r+1 << " at scale factor "
+	     << scaleFactors(s) << " could not be run\n";
+      res = -1;
+    } else {
+      this->writeResult(theOutput, r, scaleFactors(s), result);
+      if (result[0] > 0.0)
+	collapseScale[r] = s;
+
+      LoadPattern *thePattern = theDomain->removeLoadPattern(patternTag);
+      if (thePattern != 0)
+	delete thePattern;
+    }
+
+    if (theStart.revert(1) < 0 || theAnalysis->domainChanged() < 0) {
+      opserr << "IDA_BatchDriver::run() - could not return the model to its starting state\n";
+      res = -1;
+    }
+  }
+
+  delete [] collapseScale;
+
+  return res;
+}
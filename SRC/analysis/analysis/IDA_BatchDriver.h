@@ -0,0 +1,113 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/IDA_BatchDriver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// IDA_BatchDriver. An IDA_BatchDriver runs an incremental dynamic
+// analysis: every ground motion record given is applied to the model
+// as a UniformExcitation at every scale factor given, and the
+// DirectIntegrationAnalysis of the model is run for the duration of
+// the record (plus any free vibration time). For each case the peak
+// absolute displacement of a control node is recorded; a case in which
+// the peak exceeds the collapse limit, or in which the analysis fails,
+// is a collapse, and the larger scale factors of that record are then
+// not run. A line "record scale status peak time" is written to the
+// output for each case, in the order scale factor then record whatever
+// the number of processes, status being 0 if the model survived, 1 if
+// the collapse limit was exceeded and 2 if the analysis failed.
+//
+// The cases are started from the state of the model when run() is
+// called, e.g. after the gravity loads have been applied. With more
+// than one process each case is run in a fork() of the program (see
+// WorkerProcesses), which shares the model with the parent until
+// either modifies it and does not write to the recorders; the cases
+// are handed out lowest scale factor first to whichever process is
+// free, so that collapses are known before the larger scale factors
+// are started, and cases made unnecessary by a collapse are stopped.
+// With one process, or where fork() is not available, the cases are
+// run in turn in the calling process, the model being returned to its
+// starting state after each of them.
+//
+// What: "@(#) IDA_BatchDriver.h, revA"
+
+#ifndef IDA_BatchDriver_h
+#define IDA_BatchDriver_h
+
+#include <Vector.h>
+#include <WorkerProcesses.h>
+
+class Domain;
+class DirectIntegrationAnalysis;
+class FEM_ObjectBroker;
+class TimeSeries;
+class OPS_Stream;
+
+class IDA_BatchDriver : public WorkerTask
+{
+  public:
+    IDA_BatchDriver(Domain &theDomain, DirectIntegrationAnalysis &theAnalysis,
+		    FEM_ObjectBroker &theBroker, int dir, double dT,
+		    int nodeTag, int dof);
+    ~IDA_BatchDriver();
+
+    int addRecord(TimeSeries *theAccelSeries);
+    int setScaleFactors(const Vector &theScaleFactors);
+    void setCollapseLimit(double limit);
+    void setFreeVibrationTime(double time);
+    void setNumProcesses(int numProcesses);
+
+    int run(OPS_Stream &theOutput);
+
+    int getNumRecords(void) const;
+    int getNumCollapses(void) const;
+    
+  protected:
+    int runWorker(int fromParent, int toParent);
+
+  private:
+    int runCase(int record, double scale, double *result);
+    int writeResult(OPS_Stream &theOutput, int record, double scale, const double *result);
+
+    Domain *theDomain;
+    DirectIntegrationAnalysis *theAnalysis;
+    FEM_ObjectBroker *theBroker;
+    int dir;
+    double dT;
+    int nodeTag;
+    int dof;
+
+    TimeSeries **theRecords;
+    int numRecords;
+    Vector scaleFactors;
+    double collapseLimit;
+    double freeVibrationTime;
+    int numProcesses;
+    int numCollapses;
+
+    int workerRecord;        // the case run by the next worker started
+    double workerScale;
+};
+
+#endif
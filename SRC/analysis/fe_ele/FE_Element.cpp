@@ -42,15 +42,38 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <ThreadWorkspace.h>
 
 #define MAX_NUM_DOF 64
 
 // static variables initialisation
 Matrix FE_Element::errMatrix(1,1);
 Vector FE_Element::errVector(1);
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
+
+// class wide matrix and vector objects used to return the tangent and
+// residual of FE_Elements with at most MAX_NUM_DOF dof, one set for
+// each thread so that FE_Elements can be formed concurrently
+struct FE_ElementWorkspace {
+  FE_ElementWorkspace() {
+    for (int i=0; i<=MAX_NUM_DOF; i++) {
+      theMatrices[i] = 0;
+      theVectors[i] = 0;
+    }
+  };
+  ~FE_ElementWorkspace() {
+    for (int i=0; i<=MAX_NUM_DOF; i++) {
+      if (theVectors[i] != 0)
+	delete theVectors[i];
+      if (theMatrices[i] != 0)
+	delete theMatrices[i];
+    }
+  };
+
+  Matrix *theMatrices[MAX_NUM_DOF+1];
+  Vector *theVectors[MAX_NUM_DOF+1];
+};
+
+static ThreadWorkspace<FE_ElementWorkspace> theWorkspace;
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
@@ -58,7 +81,7 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0), sharedStorage(false)
 {
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
@@ -96,23 +119,6 @@ FE_Element::FE_Element(int tag, Element *ele)
 	}
     }
 
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-
     if (ele->isSubdomain() == false) {
 	
 	// if Elements are not subdomains, set up pointers to
@@ -120,22 +126,8 @@ FE_Element::FE_Element(int tag, Element *ele)
 
 	if (numDOF <= MAX_NUM_DOF) {
 	    // use class wide objects
-	    if (theVectors[numDOF] == 0) {
-		theVectors[numDOF] = new Vector(numDOF);
-		theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-		if (theResidual == 0 || theResidual->Size() != numDOF ||	
-		    theTangent == 0 || theTangent->noCols() != numDOF)	{  
-		    opserr << "FE_Element::FE_Element(Element *) ";
-		    opserr << " ran out of memory for vector/Matrix of size :";
-		    opserr << numDOF << endln;
-		    exit(-1);
-		}
-	    } else {
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-	    }
+	    sharedStorage = true;
+	    this->setSharedStorage();
 	} else {
 	    // create matrices and vectors for each object instance
 	    theResidual = new Vector(numDOF);
@@ -158,37 +150,16 @@ FE_Element::FE_Element(int tag, Element *ele)
 	Subdomain *theSub = (Subdomain *)ele;
 	theSub->setFE_ElementPtr(this);
     }
- 
-    // increment number of FE_Elements by 1
-    numFEs++;
 }
 
 
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0), sharedStorage(false)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
-    numFEs++;
-
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-    
+
     // as subtypes have no access to the tangent or residual we don't set them
     // this way we can detect if subclass does not provide all methods it should
 }
@@ -199,29 +170,59 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
 //	destructor.
 FE_Element::~FE_Element()
 {
-
-    // decrement number of FE_Elements
-    numFEs--;
-
     // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
+    if (sharedStorage == false) {
 	if (theTangent != 0) delete theTangent;
 	if (theResidual != 0) delete theResidual;
     }
+}    
+
 
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numFEs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
+// void setSharedStorage(void);
+//	Method to point theTangent and theResidual at the class wide
+//	objects of the calling thread. Invoked at the start of each method
+//	that begins forming the tangent or residual, so that an FE_Element
+//	formed by a thread only ever writes into that thread's objects.
+
+void
+FE_Element::setSharedStorage(void)
+{
+    if (sharedStorage == false)
+	return;
+
+    FE_ElementWorkspace &theWork = theWorkspace.get();
+    if (theWork.theVectors[numDOF] == 0) {
+	theWork.theVectors[numDOF] = new Vector(numDOF);
+	theWork.theMatrices[numDOF] = new Matrix(numDOF,numDOF);
+	if (theWork.theVectors[numDOF]->Size() != numDOF ||	
+	    theWork.theMatrices[numDOF]->noCols() != numDOF)	{  
+	    opserr << "FE_Element::setSharedStorage() ";
+	    opserr << " ran out of memory for vector/Matrix of size :";
+	    opserr << numDOF << endln;
+	    exit(-1);
+	}
     }
-}    
+
+    theResidual = theWork.theVectors[numDOF];
+    theTangent = theWork.theMatrices[numDOF];
+}
+
+
+// bool canAssembleConcurrently(void);
+//	Method to return true if the tangent and residual of the FE_Element
+//	may be formed and assembled by a thread while other threads are
+//	doing the same for other FE_Elements: the FE_Element must use the
+//	per-thread storage and the Element must have opted in through
+//	Element::isThreadSafe(); all others are formed by the serial loop.
+
+bool
+FE_Element::canAssembleConcurrently(void)
+{
+    if (sharedStorage == false || myEle == 0)
+	return false;
+
+    return myEle->isThreadSafe();
+}
 
 
 const ID &
@@ -288,6 +289,7 @@ const Matrix &
 FE_Element::getTangent(Integrator *theNewIntegrator)
 {
     theIntegrator = theNewIntegrator;
+    this->setSharedStorage();
     
     if (myEle == 0) {
 	opserr << "FATAL FE_Element::getTangent() - no Element *given ";
@@ -312,6 +314,7 @@ const Vector &
 FE_Element::getResidual(Integrator *theNewIntegrator)
 {
     theIntegrator = theNewIntegrator;
+    this->setSharedStorage();
 
     if (theIntegrator == 0)
       return *theResidual;
@@ -338,6 +341,8 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
 void  
 FE_Element::zeroTangent(void)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {
 	if (myEle->isSubdomain() == false)
 	    theTangent->Zero();
@@ -449,6 +454,8 @@ FE_Element::storePreviousK(int numP)
 void  
 FE_Element::zeroResidual(void)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {
 	if (myEle->isSubdomain() == false)
 	    theResidual->Zero();
@@ -512,6 +519,8 @@ FE_Element::addRIncInertiaToResidual(double fact)
 const Vector &
 FE_Element::getTangForce(const Vector &disp, double fact)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {    
 
 	// zero out the force vector
@@ -558,9 +567,23 @@ FE_Element::getTangForce(const Vector &disp, double fact)
 
 
 
+// bool canFormTangForce(void);
+//	Method to return true if getTangForce() forms the product of the
+//	tangent and a vector; subclasses that do not implement it return
+//	false, so that ele-by-ele strategies keep their tangent instead.
+
+bool
+FE_Element::canFormTangForce(void)
+{
+    return true;
+}
+
+
 const Vector &
 FE_Element::getK_Force(const Vector &disp, double fact)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {    
 
 	// zero out the force vector
@@ -599,6 +622,8 @@ FE_Element::getK_Force(const Vector &disp, double fact)
 const Vector &
 FE_Element::getKi_Force(const Vector &disp, double fact)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {    
 
 	// zero out the force vector
@@ -636,6 +661,7 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
 const Vector &
 FE_Element::getM_Force(const Vector &disp, double fact)
 {
+    this->setSharedStorage();
 
     if (myEle != 0) {    
 
@@ -675,6 +701,8 @@ FE_Element::getM_Force(const Vector &disp, double fact)
 const Vector &
 FE_Element::getC_Force(const Vector &disp, double fact)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {    
 
 	// zero out the force vector
@@ -720,6 +748,8 @@ FE_Element::getLastIntegrator(void)
 const Vector &
 FE_Element::getLastResponse(void)
 {
+    this->setSharedStorage();
+
     if (myEle != 0) {
       if (theIntegrator != 0) {
 	if (theIntegrator->getLastResponse(*theResidual,myID) < 0) {
@@ -77,6 +77,7 @@ class FE_Element: public TaggedObject
 
     // methods for ele-by-ele strategies
     virtual const Vector &getTangForce(const Vector &x, double fact = 1.0);
+    virtual bool canFormTangForce(void);
     virtual const Vector &getK_Force(const Vector &x, double fact = 1.0);
     virtual const Vector &getKi_Force(const Vector &x, double fact = 1.0);
     virtual const Vector &getC_Force(const Vector &x, double fact = 1.0);
@@ -90,6 +91,7 @@ class FE_Element: public TaggedObject
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
+    virtual bool canAssembleConcurrently(void);
 
     virtual void  Print(OPS_Stream&, int = 0) {return;};
 
@@ -119,14 +121,13 @@ class FE_Element: public TaggedObject
     Vector *theResidual;
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
+    bool sharedStorage;        // true if theTangent & theResidual are class wide
 
+    void setSharedStorage(void);
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
     
 
 };
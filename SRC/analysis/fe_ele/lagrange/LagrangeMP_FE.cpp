@@ -236,6 +236,13 @@ LagrangeMP_FE::getTangForce(const Vector &disp, double fact)
  return *resid;
 }
 
+bool
+LagrangeMP_FE::canFormTangForce(void)
+{
+    // getTangForce() is not implemented
+    return false;
+}
+
 
 const Vector &
 LagrangeMP_FE::getK_Force(const Vector &disp, double fact)
@@ -222,6 +222,13 @@ PenaltyMP_FE::getTangForce(const Vector &disp, double fact)
  return *resid;
 }
 
+bool
+PenaltyMP_FE::canFormTangForce(void)
+{
+    // getTangForce() is not implemented
+    return false;
+}
+
 const Vector &
 PenaltyMP_FE::getK_Force(const Vector &disp, double fact)
 {
@@ -59,6 +59,7 @@ class PenaltyMP_FE: public FE_Element
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
     virtual const Vector &getTangForce(const Vector &x, double fact = 1.0);
+    bool canFormTangForce(void);
 
     virtual const Vector &getK_Force(const Vector &x, double fact = 1.0);
     virtual const Vector &getKi_Force(const Vector &x, double fact = 1.0);
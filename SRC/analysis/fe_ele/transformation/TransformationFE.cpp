@@ -452,6 +452,13 @@ TransformationFE::getTangForce(const Vector &disp, double fact)
     return *modResidual;
 }
 
+bool
+TransformationFE::canFormTangForce(void)
+{
+    // getTangForce() is not implemented
+    return false;
+}
+
 const Vector &
 TransformationFE::getK_Force(const Vector &accel, double fact)
 {
@@ -952,6 +959,14 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
 
 
 
+bool
+TransformationFE::canAssembleConcurrently(void)
+{
+    // the modified tangent and residual are formed in class wide objects
+    return false;
+}
+
+
 // CHANGE THE ID SENT
 const Vector &
 TransformationFE::getLastResponse(void)
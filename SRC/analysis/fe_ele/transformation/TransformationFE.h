@@ -59,6 +59,7 @@ class TransformationFE: public FE_Element
     
     // methods for ele-by-ele strategies
     virtual const Vector &getTangForce(const Vector &x, double fact = 1.0);
+    bool canFormTangForce(void);
     virtual const Vector &getK_Force(const Vector &accel, double fcat = 1.0);
     virtual const Vector &getKi_Force(const Vector &accel, double fcat = 1.0);
     virtual const Vector &getM_Force(const Vector &accel, double fcat = 1.0);
@@ -68,6 +69,7 @@ class TransformationFE: public FE_Element
     
     const Vector &getLastResponse(void);
     int addSP(SP_Constraint &theSP);
+    bool canAssembleConcurrently(void);
 
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
@@ -39,8 +39,64 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <ThreadPool.h>
 #include <cmath>
 
+// ThreadTasks used to form and assemble the FE_Elements of one color;
+// as no two FE_Elements of a color share an equation, the threads add
+// into different locations of the LinearSOE and need no locking
+class IncrementalIntegratorTangentTask : public ThreadTask
+{
+ public:
+  IncrementalIntegratorTangentTask(FE_Element **theEles, LinearSOE *theLinSOE,
+				   IncrementalIntegrator *theIntegr)
+    :theFEs(theEles), theSOE(theLinSOE), theIntegrator(theIntegr) {};
+
+  int execute(int start, int end, int threadID) {
+    int numFail = 0;
+    for (int i=start; i<end; i++) {
+      FE_Element *elePtr = theFEs[i];
+      if (theSOE->addA(elePtr->getTangent(theIntegrator),elePtr->getID()) < 0) {
+	opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+	opserr << " failed in addA for ID " << elePtr->getID();	    
+	numFail++;
+      }
+    }
+    return numFail;
+  };
+
+ private:
+  FE_Element **theFEs;
+  LinearSOE *theSOE;
+  IncrementalIntegrator *theIntegrator;
+};
+
+class IncrementalIntegratorResidualTask : public ThreadTask
+{
+ public:
+  IncrementalIntegratorResidualTask(FE_Element **theEles, LinearSOE *theLinSOE,
+				    IncrementalIntegrator *theIntegr)
+    :theFEs(theEles), theSOE(theLinSOE), theIntegrator(theIntegr) {};
+
+  int execute(int start, int end, int threadID) {
+    int numFail = 0;
+    for (int i=start; i<end; i++) {
+      FE_Element *elePtr = theFEs[i];
+      if (theSOE->addB(elePtr->getResidual(theIntegrator),elePtr->getID()) < 0) {
+	opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+	opserr << " failed in addB for ID " << elePtr->getID();
+	numFail++;
+      }
+    }
+    return numFail;
+  };
+
+ private:
+  FE_Element **theFEs;
+  LinearSOE *theSOE;
+  IncrementalIntegrator *theIntegrator;
+};
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
@@ -100,14 +156,8 @@ IncrementalIntegrator::formTangent(int statFlag)
     // efficiency when performing parallel computations - CHANGE
 
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "WARNING IncrementalIntegrator::formTangent -";
-	    opserr << " failed in addA for ID " << elePtr->getID();	    
-	    result = -3;
-	}
+    if (this->formElementTangent() < 0)
+	result = -3;
 
     return result;
 }
@@ -258,6 +308,30 @@ IncrementalIntegrator::formElementResidual(void)
 
     int res = 0;    
 
+    // if threads have been requested, assemble the FE_Elements color by color
+    ThreadPool *thePool = ThreadPool::getThreadPool();
+    if (thePool != 0 && theSOE->canAddConcurrently() == true && 
+	this->canFormConcurrently() == true) {
+
+	int numFail = 0;
+	int numFE;
+	int numColors = theAnalysisModel->getNumFE_EleColors();
+	for (int color=0; color<numColors; color++) {
+	    FE_Element **theFEs = theAnalysisModel->getFE_EleColor(color, numFE);
+	    IncrementalIntegratorResidualTask theTask(theFEs, theSOE, this);
+	    numFail += thePool->run(theTask, numFE);
+	}
+
+	FE_Element **theFEs = theAnalysisModel->getSerialFE_Eles(numFE);
+	IncrementalIntegratorResidualTask theSerialTask(theFEs, theSOE, this);
+	numFail += theSerialTask.execute(0, numFE, 0);
+
+	if (numFail != 0)
+	    res = -2;
+
+	return res;
+    }
+
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0) {
 
@@ -271,6 +345,58 @@ IncrementalIntegrator::formElementResidual(void)
     return res;	    
 }
 
+
+int
+IncrementalIntegrator::formElementTangent(void)
+{
+    // loop through the FE_Elements adding their contributions to the tangent
+    FE_Element *elePtr;
+
+    int res = 0;    
+
+    // if threads have been requested, assemble the FE_Elements color by color;
+    // the colors are kept by the AnalysisModel until the domain changes
+    ThreadPool *thePool = ThreadPool::getThreadPool();
+    if (thePool != 0 && theSOE->canAddConcurrently() == true && 
+	this->canFormConcurrently() == true) {
+
+	int numFail = 0;
+	int numFE;
+	int numColors = theAnalysisModel->getNumFE_EleColors();
+	for (int color=0; color<numColors; color++) {
+	    FE_Element **theFEs = theAnalysisModel->getFE_EleColor(color, numFE);
+	    IncrementalIntegratorTangentTask theTask(theFEs, theSOE, this);
+	    numFail += thePool->run(theTask, numFE);
+	}
+
+	FE_Element **theFEs = theAnalysisModel->getSerialFE_Eles(numFE);
+	IncrementalIntegratorTangentTask theSerialTask(theFEs, theSOE, this);
+	numFail += theSerialTask.execute(0, numFE, 0);
+
+	if (numFail != 0)
+	    res = -1;
+
+	return res;
+    }
+
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+    while((elePtr = theEles2()) != 0)     
+	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+	    opserr << " failed in addA for ID " << elePtr->getID();	    
+	    res = -1;
+	}
+
+    return res;
+}
+
+
+bool
+IncrementalIntegrator::canFormConcurrently(void)
+{
+    return true;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
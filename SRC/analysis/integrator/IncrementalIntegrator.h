@@ -106,6 +106,12 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    int formElementTangent(void);
+
+    // true if formEleTangent() and formEleResidual() may be invoked for
+    // different FE_Elements by several threads at the same time
+    virtual bool canFormConcurrently(void);
+
     int statusFlag;
 
     //    Vector *modalDampingValues;
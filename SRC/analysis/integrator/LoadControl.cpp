@@ -221,6 +221,13 @@ LoadControl::formEleResidual(FE_Element* theEle)
     return 0;
 }
 
+bool
+LoadControl::canFormConcurrently(void)
+{
+    // the element sensitivity methods are not safe to call concurrently
+    return (sensitivityFlag == 0);
+}
+
 int
 LoadControl::formIndependentSensitivityRHS()
 {
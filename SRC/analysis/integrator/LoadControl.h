@@ -74,6 +74,7 @@ class LoadControl : public StaticIntegrator
     ///////////////////////
     
 protected:
+    bool canFormConcurrently(void);
     
   private:
     double deltaLambda;  // dlambda at step (i-1)
@@ -642,6 +642,13 @@ int Newmark::formEleResidual(FE_Element* theEle)
     return 0;
 }
 
+bool
+Newmark::canFormConcurrently(void)
+{
+    // the sensitivity residual loops over the shared DOF_Group iterator
+    return (sensitivityFlag == 0);
+}
+
 int
 Newmark::formNodUnbalance(DOF_Group *theDof)
 {
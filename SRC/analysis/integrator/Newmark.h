@@ -83,6 +83,8 @@ public:
     // AddingSensitivity:END ////////////////////////////////////
     
 protected:
+    bool canFormConcurrently(void);
+
     bool displ;      // a flag indicating whether displ or accel increments
     double gamma;
     double beta;
@@ -260,6 +260,14 @@ PFEMIntegrator::formEleResidual(FE_Element *theEle)
     return 0;
 }    
 
+bool
+PFEMIntegrator::canFormConcurrently(void)
+{
+    // the sensitivity residual loops over the shared DOF_Group iterator
+    // and into dVn, a member of the integrator
+    return (sensitivityFlag == 0);
+}
+
 int
 PFEMIntegrator::formNodUnbalance(DOF_Group *theDof)
 {
@@ -77,6 +77,7 @@ public:
     // AddingSensitivity:END ////////////////////////////////////
     
 protected:
+    bool canFormConcurrently(void);
     
     double c1, c2, c3;              // some constants we need to keep
     double c4, c5, c6;              // some constants we need to keep
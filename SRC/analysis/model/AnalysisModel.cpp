@@ -41,21 +41,149 @@
 #include <AnalysisModel.h>
 #include <Domain.h>
 #include <FE_Element.h>
+#include <ID.h>
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <Node.h>
 #include <NodeIter.h>
 #include <ConstraintHandler.h>
+#include <ThreadPool.h>
 
 
 #include <MapOfTaggedObjects.h>
+#include <vector>
+#include <algorithm>
+#include <string.h>
 
 #define START_EQN_NUM 0
 #define START_VERTEX_NUM 0
 
+// ThreadTask used to form the rows of a CSR_Graph; the vertices adjacent
+// to a vertex are found from the FE_Elements it belongs to, each thread
+// writing its block of rows, sorted, into its own buffer and marking the
+// vertices already found in its own marker array
+class AnalysisModelGraphTask : public ThreadTask
+{
+ public:
+  AnalysisModelGraphTask(int numV, const int *theEleStart, const int *theEleVertices,
+			 const int *theVertexEleStart, const int *theVertexEles,
+			 int *theRowSize, std::vector<int> *theBuffers, int *theBlockStart)
+    :numVertex(numV), eleStart(theEleStart), eleVertices(theEleVertices),
+     vertexEleStart(theVertexEleStart), vertexEles(theVertexEles), 
+     rowSize(theRowSize), buffers(theBuffers), blockStart(theBlockStart) {};
+
+  int execute(int start, int end, int threadID) {
+    std::vector<int> &theBuffer = buffers[threadID];
+    blockStart[threadID] = start;
+    int *marker = new int[numVertex];
+    for (int i=0; i<numVertex; i++)
+      marker[i] = -1;
+
+    for (int i=start; i<end; i++) {
+      int rowStart = theBuffer.size();
+      for (int j=vertexEleStart[i]; j<vertexEleStart[i+1]; j++) {
+	int ele = vertexEles[j];
+	for (int k=eleStart[ele]; k<eleStart[ele+1]; k++) {
+	  int other = eleVertices[k];
+	  if (other != i && marker[other] != i) {
+	    marker[other] = i;
+	    theBuffer.push_back(START_VERTEX_NUM + other);
+	  }
+	}
+      }
+      std::sort(theBuffer.begin() + rowStart, theBuffer.end());
+      rowSize[i] = theBuffer.size() - rowStart;
+    }
+
+    delete [] marker;
+    return 0;
+  };
+
+ private:
+  int numVertex;
+  const int *eleStart;
+  const int *eleVertices;
+  const int *vertexEleStart;
+  const int *vertexEles;
+  int *rowSize;
+  std::vector<int> *buffers;
+  int *blockStart;
+};
+
+// static CSR_Graph *buildCSR_Graph(int numVertex, int numEle, const int *eleStart,
+//				    const int *eleVertices, int *refs, int *colors);
+//	Function to build the CSR_Graph in which two vertices are adjacent if
+//	they belong to a common FE_Element, the vertices of FE_Element i being
+//	eleVertices[eleStart[i]] through eleVertices[eleStart[i+1]-1] given as
+//	numbers from 0 through numVertex-1. The rows are formed in parallel
+//	when a ThreadPool exists. The CSR_Graph takes ownership of refs and
+//	colors.
+
+static CSR_Graph *
+buildCSR_Graph(int numVertex, int numEle, const int *eleStart, const int *eleVertices,
+	       int *refs, int *colors)
+{
+  // the FE_Elements each vertex belongs to
+  int *vertexEleStart = new int[numVertex+1];
+  int *vertexEles = new int[eleStart[numEle]+1];
+
+  for (int i=0; i<=numVertex; i++)
+    vertexEleStart[i] = 0;
+  for (int i=0; i<eleStart[numEle]; i++)
+    vertexEleStart[eleVertices[i]+1]++;
+  for (int i=0; i<numVertex; i++)
+    vertexEleStart[i+1] += vertexEleStart[i];
+
+  int *loc = new int[numVertex+1];
+  for (int i=0; i<numVertex; i++)
+    loc[i] = vertexEleStart[i];
+  for (int i=0; i<numEle; i++)
+    for (int j=eleStart[i]; j<eleStart[i+1]; j++)
+      vertexEles[loc[eleVertices[j]]++] = i;
+  delete [] loc;
+
+  // form the rows, each thread filling its own buffer
+  ThreadPool *thePool = ThreadPool::getThreadPool();
+  int numThreads = (thePool != 0) ? thePool->getNumThreads() : 1;
+  std::vector<int> *buffers = new std::vector<int>[numThreads];
+  int *blockStart = new int[numThreads];
+  int *rowStart = new int[numVertex+1];
+
+  for (int i=0; i<numThreads; i++)
+    blockStart[i] = -1;
+
+  AnalysisModelGraphTask theTask(numVertex, eleStart, eleVertices, 
+				 vertexEleStart, vertexEles, &rowStart[1], 
+				 buffers, blockStart);
+  if (thePool != 0)
+    thePool->run(theTask, numVertex);
+  else
+    theTask.execute(0, numVertex, 0);
+
+  rowStart[0] = 0;
+  for (int i=0; i<numVertex; i++)
+    rowStart[i+1] += rowStart[i];
+
+  // the blocks of rows are contiguous, so each buffer is copied whole
+  int *adjacency = new int[rowStart[numVertex]+1];
+  for (int i=0; i<numThreads; i++) {
+    int numEntries = buffers[i].size();
+    if (blockStart[i] >= 0 && numEntries > 0)
+      memcpy(&adjacency[rowStart[blockStart[i]]], &(buffers[i][0]), numEntries*sizeof(int));
+  }
+
+  delete [] buffers;
+  delete [] blockStart;
+  delete [] vertexEleStart;
+  delete [] vertexEles;
+
+  return new CSR_Graph(numVertex, rowStart, adjacency, refs, colors);
+}
+
 //  AnalysisModel();
 //	constructor
 
@@ -63,7 +191,8 @@ AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ theColoredFEs(0), colorStart(0), numColors(-1), numColoredFEs(0)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    =  new ArrayOfTaggedObjects(1024);
@@ -77,7 +206,8 @@ AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ theColoredFEs(0), colorStart(0), numColors(-1), numColoredFEs(0)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -90,7 +220,8 @@ AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &t
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ theColoredFEs(0), colorStart(0), numColors(-1), numColoredFEs(0)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -125,6 +256,8 @@ AnalysisModel::~AnalysisModel()
   if (myDOFGraph != 0) {
     delete myDOFGraph;
   }
+
+  this->clearFE_EleColors();
 }    
 
 void
@@ -159,6 +292,7 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
   if (result == true) {
     theElement->setAnalysisModel(*this);
     numFE_Ele++;
+    this->clearFE_EleColors();
     return true;  // o.k.
   } else
     return false;
@@ -219,6 +353,8 @@ AnalysisModel::clearAll(void)
     numFE_Ele =0;
     numDOF_Grp = 0;
     numEqn = 0;    
+
+    this->clearFE_EleColors();
 }
 
 void
@@ -279,6 +415,9 @@ void
 AnalysisModel::setNumEqn(int theNumEqn)
 {
     numEqn = theNumEqn;
+
+    // the equation numbers have changed, the colors must be redone
+    this->clearFE_EleColors();
 }
 
 int 
@@ -288,9 +427,302 @@ AnalysisModel::getNumEqn(void) const
 }
 
 
+int
+AnalysisModel::getNumFE_EleColors(void)
+{
+  if (numColors < 0)
+    this->buildFE_EleColors();
+
+  return numColors;
+}
+
+FE_Element **
+AnalysisModel::getFE_EleColor(int color, int &numFE)
+{
+  if (numColors < 0)
+    this->buildFE_EleColors();
+
+  if (color < 0 || color >= numColors) {
+    numFE = 0;
+    return 0;
+  }
+
+  numFE = colorStart[color+1] - colorStart[color];
+  return &theColoredFEs[colorStart[color]];
+}
+
+FE_Element **
+AnalysisModel::getSerialFE_Eles(int &numFE)
+{
+  if (numColors < 0)
+    this->buildFE_EleColors();
+
+  numFE = numColoredFEs - colorStart[numColors];
+  return &theColoredFEs[colorStart[numColors]];
+}
+
+// void buildFE_EleColors(void);
+//	Method to color the FE_Elements: a greedy coloring where each color is
+//	filled in turn with every remaining FE_Element that shares no equation
+//	with the FE_Elements already given that color. The FE_Elements keep
+//	their iteration order within a color, so the assembly order, and
+//	hence the result, does not depend on the number of threads.
+
+void
+AnalysisModel::buildFE_EleColors(void)
+{
+  this->clearFE_EleColors();
+
+  int numFE = 0;
+  FE_Element *elePtr;
+  FE_EleIter &theEles1 = this->getFEs();
+  while ((elePtr = theEles1()) != 0)
+    numFE++;
+
+  int theNumEqn = this->getNumEqn();
+
+  theColoredFEs = new FE_Element *[numFE+1];
+  colorStart = new int[numFE+2];
+  FE_Element **theLeft = new FE_Element *[numFE+1];
+  FE_Element **theSerial = new FE_Element *[numFE+1];
+  int *eqnColor = new int[theNumEqn+1];
+  numColoredFEs = numFE;
+
+  for (int i=0; i<theNumEqn; i++)
+    eqnColor[i] = -1;
+
+  // FE_Elements that cannot be colored go at the end of theColoredFEs
+  int numLeft = 0;
+  int numSerial = 0;
+  FE_EleIter &theEles2 = this->getFEs();
+  while ((elePtr = theEles2()) != 0) {
+    bool canColor = elePtr->canAssembleConcurrently();
+    const ID &id = elePtr->getID();
+    for (int j=0; j<id.Size(); j++)
+      if (id(j) >= theNumEqn)
+	canColor = false;
+
+    if (canColor == true)
+      theLeft[numLeft++] = elePtr;
+    else
+      theSerial[numSerial++] = elePtr;
+  }
+
+  for (int i=0; i<numSerial; i++)
+    theColoredFEs[numFE-numSerial+i] = theSerial[i];
+
+  int loc = 0;
+  numColors = 0;
+  while (numLeft > 0) {
+    colorStart[numColors] = loc;
+    int numNext = 0;
+    for (int i=0; i<numLeft; i++) {
+      elePtr = theLeft[i];
+      const ID &id = elePtr->getID();
+      int idSize = id.Size();
+      bool isFree = true;
+      for (int j=0; j<idSize && isFree == true; j++) {
+	int eqn = id(j);
+	if (eqn >= 0 && eqnColor[eqn] == numColors)
+	  isFree = false;
+      }
+      if (isFree == true) {
+	for (int j=0; j<idSize; j++) {
+	  int eqn = id(j);
+	  if (eqn >= 0)
+	    eqnColor[eqn] = numColors;
+	}
+	theColoredFEs[loc++] = elePtr;
+      } else
+	theLeft[numNext++] = elePtr;
+    }
+    numLeft = numNext;
+    numColors++;
+  }
+  colorStart[numColors] = loc;
+
+  delete [] theLeft;
+  delete [] theSerial;
+  delete [] eqnColor;
+}
+
+void
+AnalysisModel::clearFE_EleColors(void)
+{
+  if (theColoredFEs != 0)
+    delete [] theColoredFEs;
+  if (colorStart != 0)
+    delete [] colorStart;
+
+  theColoredFEs = 0;
+  colorStart = 0;
+  numColors = -1;
+  numColoredFEs = 0;
+}
+
+
+// Graph *buildCSR_DOFGraph(void);
+//	Method to build the DOF graph as a CSR_Graph from the IDs of the
+//	FE_Elements; returns 0 if the equation numbers of the DOF_Groups are
+//	not START_EQN_NUM through START_EQN_NUM+numEqn-1.
+
+Graph *
+AnalysisModel::buildCSR_DOFGraph(void)
+{
+  int numVertex = this->getNumEqn();
+  if (numVertex <= 0)
+    return 0;
+
+  // check every equation number is used and no other
+  int *eqnCount = new int[numVertex];
+  for (int i=0; i<numVertex; i++)
+    eqnCount[i] = 0;
+
+  bool ok = true;
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = this->getDOFs();
+  while ((dofPtr = theDOFs()) != 0 && ok == true) {
+    const ID &id = dofPtr->getID();
+    for (int i=0; i<id.Size(); i++) {
+      int eqn = id(i) - START_EQN_NUM;
+      if (eqn >= numVertex)
+	ok = false;
+      else if (eqn >= 0)
+	eqnCount[eqn]++;
+    }
+  }
+  for (int i=0; i<numVertex && ok == true; i++)
+    if (eqnCount[i] == 0)
+      ok = false;
+  delete [] eqnCount;
+
+  if (ok == false)
+    return 0;
+
+  // the valid equation numbers of each FE_Element
+  int numEle = 0;
+  int numEntries = 0;
+  FE_Element *elePtr;
+  FE_EleIter &theEles1 = this->getFEs();
+  while ((elePtr = theEles1()) != 0) {
+    numEle++;
+    numEntries += elePtr->getID().Size();
+  }
+
+  int *eleStart = new int[numEle+1];
+  int *eleVertices = new int[numEntries+1];
+  int numEle2 = 0;
+  int loc = 0;
+  FE_EleIter &theEles2 = this->getFEs();
+  while ((elePtr = theEles2()) != 0) {
+    eleStart[numEle2++] = loc;
+    const ID &id = elePtr->getID();
+    for (int i=0; i<id.Size(); i++) {
+      int eqn = id(i) - START_EQN_NUM;
+      if (eqn >= numVertex)
+	ok = false;
+      else if (eqn >= 0)
+	eleVertices[loc++] = eqn;
+    }
+  }
+  eleStart[numEle] = loc;
+
+  Graph *theGraph = 0;
+  if (ok == true)
+    theGraph = buildCSR_Graph(numVertex, numEle, eleStart, eleVertices, 0, 0);
+
+  delete [] eleStart;
+  delete [] eleVertices;
+
+  return theGraph;
+}
+
+// Graph *buildCSR_DOFGroupGraph(void);
+//	Method to build the DOF_Group graph as a CSR_Graph from the DOF_Group
+//	tags of the FE_Elements; returns 0 if the tags of the DOF_Groups are
+//	not START_VERTEX_NUM through START_VERTEX_NUM+numDOF_Grp-1.
+
+Graph *
+AnalysisModel::buildCSR_DOFGroupGraph(void)
+{
+  int numVertex = this->getNumDOF_Groups();
+  if (numVertex <= 0)
+    return 0;
+
+  int *refs = new int[numVertex];
+  int *colors = new int[numVertex];
+  for (int i=0; i<numVertex; i++)
+    colors[i] = -1;
+
+  bool ok = true;
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = this->getDOFs();
+  while ((dofPtr = theDOFs()) != 0 && ok == true) {
+    int vertex = dofPtr->getTag() - START_VERTEX_NUM;
+    if (vertex < 0 || vertex >= numVertex || colors[vertex] != -1)
+      ok = false;
+    else {
+      refs[vertex] = dofPtr->getNodeTag();
+      colors[vertex] = dofPtr->getNumFreeDOF();
+    }
+  }
+  for (int i=0; i<numVertex && ok == true; i++)
+    if (colors[i] == -1)
+      ok = false;
+
+  if (ok == false) {
+    delete [] refs;
+    delete [] colors;
+    return 0;
+  }
+
+  int numEle = 0;
+  int numEntries = 0;
+  FE_Element *elePtr;
+  FE_EleIter &theEles1 = this->getFEs();
+  while ((elePtr = theEles1()) != 0) {
+    numEle++;
+    numEntries += elePtr->getDOFtags().Size();
+  }
+
+  int *eleStart = new int[numEle+1];
+  int *eleVertices = new int[numEntries+1];
+  int numEle2 = 0;
+  int loc = 0;
+  FE_EleIter &theEles2 = this->getFEs();
+  while ((elePtr = theEles2()) != 0) {
+    eleStart[numEle2++] = loc;
+    const ID &id = elePtr->getDOFtags();
+    for (int i=0; i<id.Size(); i++) {
+      int vertex = id(i) - START_VERTEX_NUM;
+      if (vertex < 0 || vertex >= numVertex)
+	ok = false;
+      else
+	eleVertices[loc++] = vertex;
+    }
+  }
+  eleStart[numEle] = loc;
+
+  Graph *theGraph = 0;
+  if (ok == true)
+    theGraph = buildCSR_Graph(numVertex, numEle, eleStart, eleVertices, refs, colors);
+  else {
+    delete [] refs;
+    delete [] colors;
+  }
+
+  delete [] eleStart;
+  delete [] eleVertices;
+
+  return theGraph;
+}
+
 Graph &
 AnalysisModel::getDOFGraph(void)
 {
+  if (myDOFGraph == 0)
+    myDOFGraph = this->buildCSR_DOFGraph();
+
   if (myDOFGraph == 0) {
     int numVertex = this->getNumDOF_Groups();
 
@@ -363,6 +795,9 @@ AnalysisModel::getDOFGraph(void)
 Graph &
 AnalysisModel::getDOFGroupGraph(void)
 {
+  if (myGroupGraph == 0)
+    myGroupGraph = this->buildCSR_DOFGroupGraph();
+
   if (myGroupGraph == 0) {
     int numVertex = this->getNumDOF_Groups();
 
@@ -74,6 +74,13 @@ class AnalysisModel: public MovableObject
     virtual FE_EleIter &getFEs();
     virtual DOF_GrpIter &getDOFs();
 
+    // methods to access the FE_Elements grouped by color, no two FE_Elements
+    // of a color share an equation; FE_Elements that cannot be assembled
+    // concurrently are not colored and are returned by getSerialFE_Eles()
+    virtual int getNumFE_EleColors(void);
+    virtual FE_Element **getFE_EleColor(int color, int &numFE);
+    virtual FE_Element **getSerialFE_Eles(int &numFE);
+
     // method to access the connectivity for SysOfEqn to size itself
     virtual void setNumEqn(int) ;	
     virtual int getNumEqn(void) const ; 
@@ -140,6 +147,18 @@ class AnalysisModel: public MovableObject
     
     FE_EleIter    *theFEiter;     
     DOF_GrpIter   *theDOFiter;    
+
+    void buildFE_EleColors(void);
+    void clearFE_EleColors(void);
+
+    // the DOF and DOF_Group graphs in compressed rows, 0 if not possible
+    Graph *buildCSR_DOFGraph(void);
+    Graph *buildCSR_DOFGroupGraph(void);
+    
+    FE_Element **theColoredFEs; // FE_Elements ordered by color, serial ones last
+    int *colorStart;            // location of first FE_Element of each color
+    int numColors;              // number of colors, -1 if not yet built
+    int numColoredFEs;          // number of FE_Elements in theColoredFEs
 };
 
 #endif
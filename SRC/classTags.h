@@ -845,6 +845,7 @@
 #define LinSOE_TAGS_PFEMLinSOE 26
 #define LinSOE_TAGS_SProfileSPDLinSOE		27
 #define LinSOE_TAGS_PFEMCompressibleLinSOE 28
+#define LinSOE_TAGS_PCGLinSOE 29
 
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
@@ -878,6 +879,7 @@
 #define SOLVER_TAGS_CulaSparseS4                        29
 #define SOLVER_TAGS_CulaSparseS5                        30
 #define SOLVER_TAGS_CuSP                                31
+#define SOLVER_TAGS_PCGLinSolver                        32
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -908,6 +910,8 @@
 #define OPS_STREAM_TAGS_TCP_Stream              8
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
+#define OPS_STREAM_TAGS_ThreadedStream         11
+#define OPS_STREAM_TAGS_ColumnarFileStream     12
 
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
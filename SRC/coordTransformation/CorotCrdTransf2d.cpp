@@ -49,20 +49,56 @@ Journal of Structural Engineering, 133(2):155-165.
 #include <math.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <MatrixND.h>
 #include <Node.h>
 #include <Channel.h>
 #include <elementAPI.h>
 #include <string>
 #include <CorotCrdTransf2d.h>
-
-// initialize static variables
-Matrix CorotCrdTransf2d::Tlg(6,6);
-Matrix CorotCrdTransf2d::Tbl(3,6);
-Vector CorotCrdTransf2d::uxg(3); 
-Vector CorotCrdTransf2d::pg(6); 
-Vector CorotCrdTransf2d::dub(3); 
-Vector CorotCrdTransf2d::Dub(3); 
-Matrix CorotCrdTransf2d::kg(6,6);
+#include <ThreadWorkspace.h>
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct CorotCrdTransf2dWorkspace {
+  CorotCrdTransf2dWorkspace()
+    :Tlg(6,6), Tbl(3,6), uxg(3), pg(6), dub(3), Dub(3), kg(6,6), ug(6),
+     ul(6), dx(2), vl(6), vb(3), al(6), ab(3), pl(6), kl(6,6), T(3,6),
+     getGeomStiffMatrix_kg(6,6), kg0(6,6), kg12(6,6),
+     data(14), xg(3), dpgdh(6), U(6),
+     dpldh(6), Abl(3,6), dvdh(3), dUdh(6), dudh(6), dAdh_U(6) {};
+
+  Matrix Tlg;
+  Matrix Tbl;
+  Vector uxg;
+  Vector pg;
+  Vector dub;
+  Vector Dub;
+  Matrix kg;
+  Vector ug;
+  Vector ul;
+  Vector dx;
+  Vector vl;
+  Vector vb;
+  Vector al;
+  Vector ab;
+  Vector pl;
+  Matrix kl;
+  Matrix T;
+  Matrix getGeomStiffMatrix_kg;
+  Matrix kg0;
+  Matrix kg12;
+  Vector data;
+  Vector xg;
+  Vector dpgdh;
+  Vector U;
+  Vector dpldh;
+  Matrix Abl;
+  Vector dvdh;
+  Vector dUdh;
+  Vector dudh;
+  Vector dAdh_U;
+};
+
+static ThreadWorkspace<CorotCrdTransf2dWorkspace> theWorkspace;
 
 void* OPS_CorotCrdTransf2d()
 {
@@ -229,11 +265,14 @@ CorotCrdTransf2d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 int  
 CorotCrdTransf2d::update(void)
 {       
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &Tbl = theWork.Tbl;
+
     // get global displacements 
     const Vector &dispI = nodeIPtr->getTrialDisp();
     const Vector &dispJ = nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);    
+    Vector &ug = theWork.ug;    
     for (int i = 0; i < 3; i++) {
         ug(i  ) = dispI(i);
         ug(i+3) = dispJ(i);
@@ -259,7 +298,7 @@ CorotCrdTransf2d::update(void)
     }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);
+    Vector &ul = theWork.ul;
     
     ul(0) = cosTheta*ug(0) + sinTheta*ug(1);
     ul(1) = cosTheta*ug(1) - sinTheta*ug(0);
@@ -285,8 +324,10 @@ CorotCrdTransf2d::update(void)
 int 
 CorotCrdTransf2d::compElemtLengthAndOrient(void)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // element projection
-    static Vector dx(2);
+    Vector &dx = theWork.dx;
     
     if (nodeOffsets == true) 
       dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
@@ -423,6 +464,9 @@ CorotCrdTransf2d::getBasicTrialDisp(void)
 const Vector &
 CorotCrdTransf2d::getBasicIncrDeltaDisp(void)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Vector &dub = theWork.dub;
+
     // dub = ub - ubpr;
     dub = ub;
     dub.addVector (1.0, ubpr, -1.0);
@@ -434,6 +478,9 @@ CorotCrdTransf2d::getBasicIncrDeltaDisp(void)
 const Vector &
 CorotCrdTransf2d::getBasicIncrDisp(void)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Vector &Dub = theWork.Dub;
+
     // Dub = ub - ubcommit;
     Dub = ub;
     Dub.addVector(1.0, ubcommit, -1.0);
@@ -445,18 +492,20 @@ CorotCrdTransf2d::getBasicIncrDisp(void)
 const Vector &
 CorotCrdTransf2d::getBasicTrialVel(void)
 {
+  CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// determine global velocities
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	double vg[6];
 	for (int i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
 		vg[i+3] = vel2(i);
 	}
 	
     // transform global end velocities to local coordinates
-    static Vector vl(6);
+    Vector &vl = theWork.vl;
 
     vl(0) = cosTheta*vg[0] + sinTheta*vg[1];
     vl(1) = cosTheta*vg[1] - sinTheta*vg[0];
@@ -469,7 +518,7 @@ CorotCrdTransf2d::getBasicTrialVel(void)
     Lydot = vl(4) - vl(1);
 
     // transform local velocities to basic coordinates
-    static Vector vb(3);
+    Vector &vb = theWork.vb;
 	
     vb(0) = (Lx*Lxdot + Ly*Lydot)/Ln;
     vb(1) = vl(2) - (Lx*Lydot - Ly*Lxdot)/pow(Ln,2);
@@ -482,11 +531,13 @@ CorotCrdTransf2d::getBasicTrialVel(void)
 const Vector &
 CorotCrdTransf2d::getBasicTrialAccel(void)
 {
+  CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// determine global velocities
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	double vg[6];
 	int i;
 	for (i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
@@ -494,7 +545,7 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
 	}
 	
     // transform global end velocities to local coordinates
-    static Vector vl(6);
+    Vector &vl = theWork.vl;
 
     vl(0) = cosTheta*vg[0] + sinTheta*vg[1];
     vl(1) = cosTheta*vg[1] - sinTheta*vg[0];
@@ -510,14 +561,14 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[6];
+	double ag[6];
 	for (i = 0; i < 3; i++) {
 		ag[i]   = accel1(i);
 		ag[i+3] = accel2(i);
 	}
 	
     // transform global end accelerations to local coordinates
-    static Vector al(6);
+    Vector &al = theWork.al;
 
     al(0) = cosTheta*ag[0] + sinTheta*ag[1];
     al(1) = cosTheta*ag[1] - sinTheta*ag[0];
@@ -530,7 +581,7 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
     Lydotdot = al(4) - al(1);
 
     // transform local accelerations to basic coordinates
-    static Vector ab(3);
+    Vector &ab = theWork.ab;
 	
     ab(0) = (Lxdot*Lxdot + Lx*Lxdotdot + Ly*Lydotdot + Lydot*Lydot)/Ln
           - pow(Lx*Lxdot + Ly*Lydot,2)/pow(Ln,3);
@@ -545,10 +596,13 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
 const Vector &
 CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &Tbl = theWork.Tbl;
+    Vector &pg = theWork.pg;
     
     // transform resisting forces from the basic system to local coordinates
     this->compTransfMatrixBasicLocal(Tbl);
-    static Vector pl(6);
+    Vector &pl = theWork.pl;
     pl.addMatrixTransposeVector(0.0, Tbl, pb, 1.0);    // pl = Tbl ^ pb;
     
     // add end forces due to element p0 loads
@@ -590,8 +644,12 @@ CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 CorotCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &Tbl = theWork.Tbl;
+    Matrix &kg = theWork.kg;
+
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
+    Matrix &kl = theWork.kl;
     this->compTransfMatrixBasicLocal(Tbl);
     kl.addMatrixTripleProduct(0.0, Tbl, kb, 1.0);      // kl = Tbl ^ kb * Tbl;
     
@@ -750,9 +808,12 @@ CorotCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 CorotCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
-    static Matrix T(3,6);
+    Matrix &kl = theWork.kl;
+    Matrix &T = theWork.T;
     
     T(0,0) = -1.0;
     T(1,0) = 0;
@@ -934,6 +995,10 @@ CorotCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 const Matrix &
 CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) const
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg0 = theWork.kg0;
+    Matrix &kg12 = theWork.kg12;
+
     // get  geometric stiffness matrix present in the transformation 
     // from basic to local system
     double s2, c2, cs;  
@@ -942,7 +1007,6 @@ CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) const
     c2 = cosAlpha*cosAlpha;
     cs = sinAlpha*cosAlpha;
     
-    static Matrix kg0(6,6), kg12(6,6);
     kg0.Zero();
     
     kg12.Zero();
@@ -971,7 +1035,7 @@ CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) const
     
     kg12 *= (pb(1)+pb(2))/(Ln*Ln);
     
-    static Matrix kg(6,6);
+    Matrix &kg = theWork.getGeomStiffMatrix_kg;
     // kg = kg0 + kg12;
     kg = kg0;
     kg.addMatrix(1.0, kg12, 1.0);
@@ -1024,7 +1088,9 @@ CorotCrdTransf2d::getCopy2d(void)
 int 
 CorotCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 {
-    static Vector data(14);
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+    Vector &data = theWork.data;
     data(13) = this->getTag();
     data(0) = ubcommit(0);
     data(1) = ubcommit(1);
@@ -1065,7 +1131,9 @@ CorotCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 int 
 CorotCrdTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    static Vector data(14);
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+    Vector &data = theWork.data;
     if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
         opserr << " CorotCrdTransf2d::recvSelf() - data could not be received\n" ;
         return -1;
@@ -1112,8 +1180,30 @@ CorotCrdTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theB
 const Matrix &
 CorotCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 {
-    this->compTransfMatrixLocalGlobal(Tlg);  // OPTIMIZE LATER
-    kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);  // OPTIMIZE LATER
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    // kg = Tlg'*ml*Tlg, formed by 3x3 blocks as Tlg is block diagonal in R
+    MatrixND<3,3> Rlg, mlij, kgij;
+    Rlg.Zero();
+    Rlg(0,0) = Rlg(1,1) = cosTheta;
+    Rlg(0,1) = sinTheta;
+    Rlg(1,0) = -sinTheta;
+    Rlg(2,2) = 1.0;
+
+    for (int bi = 0; bi < 6; bi += 3) {
+        for (int bj = 0; bj < 6; bj += 3) {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    mlij(i,j) = ml(bi+i,bj+j);
+
+            kgij.addMatrixTripleProduct(0.0, Rlg, mlij, 1.0);
+
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    kg(bi+i,bj+j) = kgij(i,j);
+        }
+    }
 
     return kg;
 }
@@ -1122,7 +1212,9 @@ CorotCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 CorotCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+    Vector &xg = theWork.xg;
     opserr << " CorotCrdTransf2d::getPointGlobalCoordFromLocal: not implemented yet" ;
     
     return xg;  
@@ -1132,6 +1224,9 @@ CorotCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 CorotCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
+    CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Vector &uxg = theWork.uxg;
+
     opserr << " CorotCrdTransf2d::getPointGlobalDisplFromBasic: not implemented yet" ;
     
     return uxg;  
@@ -1152,7 +1247,10 @@ CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &q,
 							  const Vector &p0,
 							  int gradNumber)
 {
-  static Vector dpgdh(6);
+  CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+  Matrix &Tlg = theWork.Tlg;
+
+  Vector &dpgdh = theWork.dpgdh;
   dpgdh.Zero();
 
   int nodeIid = nodeIPtr->getCrdsSensitivity();
@@ -1205,14 +1303,12 @@ CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &q,
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector U(6);
+  Vector &U = theWork.U;
   for (int i = 0; i < 3; i++) {
     U(i)   = disp1(i);
     U(i+3) = disp2(i);
   }
   
-  static Vector u(6);
-
   double dux =  cosTheta*(U(3)-U(0)) + sinTheta*(U(4)-U(1));
   double duy = -sinTheta*(U(3)-U(0)) + cosTheta*(U(4)-U(1));
 
@@ -1228,7 +1324,7 @@ CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &q,
   double q1 = q(1);
   double q2 = q(2);
 
-  static Vector dpldh(6);
+  Vector &dpldh = theWork.dpldh;
   dpldh.Zero();
 
   dpldh(0) = (-dcosAlphadh*q0 - dsinAlphaOverLndh*(q1+q2) )*dLdh;
@@ -1241,10 +1337,10 @@ CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &q,
   this->compTransfMatrixLocalGlobal(Tlg);     // OPTIMIZE LATER
   dpgdh.addMatrixTransposeVector(0.0, Tlg, dpldh, 1.0);   // pg = Tlg ^ pl; residual
 
-  static Vector pl(6);
+  Vector &pl = theWork.pl;
   pl.Zero();
 
-  static Matrix Abl(3,6);
+  Matrix &Abl = theWork.Abl;
   this->compTransfMatrixBasicLocal(Abl);
 
   pl.addMatrixTransposeVector(0.0, Abl, q, 1.0); // OPTIMIZE LATER
@@ -1263,7 +1359,9 @@ CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &q,
 const Vector&
 CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
 {
-  static Vector dvdh(3);
+  CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &dvdh = theWork.dvdh;
   dvdh.Zero();
 
   int nodeIid = nodeIPtr->getCrdsSensitivity();
@@ -1305,8 +1403,8 @@ CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dsinThetadh = 1/L-sinTheta/L*dLdh;
   }
   
-  static Vector U(6);
-  static Vector dUdh(6);
+  Vector &U = theWork.U;
+  Vector &dUdh = theWork.dUdh;
 
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
@@ -1317,7 +1415,7 @@ CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dUdh(i+3) = nodeJPtr->getDispSensitivity((i+1),gradNumber);
   }
 
-  static Vector dudh(6);
+  Vector &dudh = theWork.dudh;
 
   dudh(0) =  cosTheta*dUdh(0) + sinTheta*dUdh(1);
   dudh(1) = -sinTheta*dUdh(0) + cosTheta*dUdh(1);
@@ -1353,7 +1451,9 @@ CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
 const Vector&
 CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
 {
-  static Vector dvdh(3);
+  CorotCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &dvdh = theWork.dvdh;
   dvdh.Zero();
 
   int nodeIid = nodeIPtr->getCrdsSensitivity();
@@ -1362,7 +1462,7 @@ CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   if (nodeIid == 0 && nodeJid == 0)
     return dvdh;
 
-  static Matrix Abl(3,6);
+  Matrix &Abl = theWork.Abl;
 
   this->update();
   this->compTransfMatrixBasicLocal(Abl);
@@ -1404,7 +1504,7 @@ CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector U(6);
+  Vector &U = theWork.U;
   for (int i = 0; i < 3; i++) {
     U(i)   = disp1(i);
     U(i+3) = disp2(i);
@@ -1414,7 +1514,7 @@ CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   dvdh(1) =  (sinAlpha/Ln)*dLdh;
   dvdh(2) =  (sinAlpha/Ln)*dLdh;
 
-  static Vector dAdh_U(6);
+  Vector &dAdh_U = theWork.dAdh_U;
   // dAdh * U
   dAdh_U(0) =  dcosThetadh*U(0) + dsinThetadh*U(1);
   dAdh_U(1) = -dsinThetadh*U(0) + dcosThetadh*U(1);
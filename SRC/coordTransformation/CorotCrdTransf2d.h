@@ -57,6 +57,7 @@ public:
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void) {return true;}
     
     const Vector &getBasicTrialDisp(void);
     const Vector &getBasicIncrDisp(void);
@@ -118,14 +119,6 @@ private:
     Vector ubcommit;           // commited basic displacements
     Vector ubpr;               // previous basic displacements
     
-    static Matrix Tlg;         // matrix that transforms from global to local coordinates
-    static Matrix Tbl;         // matrix that transforms from local  to basic coordinates
-    static Matrix kg;          // global stiffness matrix
-    static Vector uxg;     
-    static Vector pg;     
-    static Vector dub;     
-    static Vector Dub;     
-    
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
     bool nodeOffsets;
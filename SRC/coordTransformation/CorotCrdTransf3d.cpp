@@ -41,19 +41,197 @@
 #include <elementAPI.h>
 #include <string>
 #include <CorotCrdTransf3d.h>
+#include <MatrixND.h>
+#include <ThreadWorkspace.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3); 
-Matrix CorotCrdTransf3d::RJ(3,3); 
-Matrix CorotCrdTransf3d::Rbar(3,3); 
-Matrix CorotCrdTransf3d::e(3,3); 
 Matrix CorotCrdTransf3d::Tp(6,7); 
-Matrix CorotCrdTransf3d::T(7,12);
-Matrix CorotCrdTransf3d::Tlg(12,12);
-Matrix CorotCrdTransf3d::kg(12,12);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::A(3,3);
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct CorotCrdTransf3dWorkspace {
+  CorotCrdTransf3dWorkspace()
+    :RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Tlg(12,12), kg(12,12),
+     Lr2(12,3), Lr3(12,3), A(3,3), XAxis(3), YAxis(3), ZAxis(3),
+     dAlphaI(3), dAlphaJ(3), dispI(6), dispJ(6), dAlphaIq(4), dAlphaJq(4),
+     dRgamma(3,3), gammaq(4), gammaw(3), update_e1(3),
+     compTransfMatrixBasicGlobalNew_e1(3), getGlobalStiffMatrix_e1(3),
+     getLMatrix_e1(3), getKs2Matrix_e1(3), update_e2(3),
+     compTransfMatrixBasicGlobalNew_e2(3), getGlobalStiffMatrix_e2(3),
+     update_e3(3), compTransfMatrixBasicGlobalNew_e3(3),
+     getGlobalStiffMatrix_e3(3), dJI(3), xJI(3), dx(3), update_r1(3),
+     compTransfMatrixBasicGlobalNew_r1(3), getGlobalStiffMatrix_r1(3),
+     getLMatrix_r1(3), getKs2Matrix_r1(3), update_r2(3),
+     compTransfMatrixBasicGlobalNew_r2(3), getGlobalStiffMatrix_r2(3),
+     update_r3(3), compTransfMatrixBasicGlobalNew_r3(3),
+     getGlobalStiffMatrix_r3(3), tmp(3), update_rI1(3),
+     compTransfMatrixBasicGlobalNew_rI1(3), getGlobalStiffMatrix_rI1(3),
+     update_rI2(3), compTransfMatrixBasicGlobalNew_rI2(3),
+     getGlobalStiffMatrix_rI2(3), update_rI3(3),
+     compTransfMatrixBasicGlobalNew_rI3(3), getGlobalStiffMatrix_rI3(3),
+     update_rJ1(3), compTransfMatrixBasicGlobalNew_rJ1(3),
+     getGlobalStiffMatrix_rJ1(3), update_rJ2(3),
+     compTransfMatrixBasicGlobalNew_rJ2(3), getGlobalStiffMatrix_rJ2(3),
+     update_rJ3(3), compTransfMatrixBasicGlobalNew_rJ3(3),
+     getGlobalStiffMatrix_rJ3(3), I(3,3),
+     compTransfMatrixBasicGlobalNew_Sr1(3,3), getLMatrix_Sr1(3,3),
+     getKs2Matrix_Sr1(3,3), Sr2(3,3), Sr3(3,3), Se(3), At(3), hI1(12),
+     hI2(12), hI3(12), hJ1(12), hJ2(12), hJ3(12), Lr(12), thetaI(3),
+     thetaJ(3), ub(6), dub(6), dul(7), Dub(6), Dul(7), dummy(6), pl(7),
+     pg(12), kl(7,7), m(6), getGlobalStiffMatrix_Se1(3,3),
+     getKs2Matrix_Se1(3,3), Se2(3,3), Se3(3,3), SrI1(3,3), SrI2(3,3),
+     SrI3(3,3), SrJ1(3,3), SrJ2(3,3), SrJ3(3,3), Sm(3,3), kbar(12,3),
+     ks33(3,3), v(3), m33(3,3), rm(3), yAxis(3), zAxis(3), q(4), q12(4),
+     q1xq2(3), qqT(3,3), getRotationMatrixFromQuaternion_S(3,3),
+     getRotMatrixFromTangScaledPseudoVector_S(3,3),
+     getSkewSymMatrix_S(3,3), R(3,3), w(3), S2(3,3), L1(3,3), L2(3,3),
+     rie1r1(3,3), e1e1r1(3,3), Sri(3,3), L(12,3), ks2(12,12), zrit(3,3),
+     ze1t(3,3), rizt(3,3), r1e1t(3,3), rie1t(3,3), e1zt(3,3), U(3,3),
+     ks(3,3), Sz(3,3), m1(3,3), data(48), xg(3), uxg(3) {};
+
+  Matrix RI;
+  Matrix RJ;
+  Matrix Rbar;
+  Matrix e;
+  Matrix T;
+  Matrix Tlg;
+  Matrix kg;
+  Matrix Lr2;
+  Matrix Lr3;
+  Matrix A;
+  Vector XAxis;
+  Vector YAxis;
+  Vector ZAxis;
+  Vector dAlphaI;
+  Vector dAlphaJ;
+  Vector dispI;
+  Vector dispJ;
+  Vector dAlphaIq;
+  Vector dAlphaJq;
+  Matrix dRgamma;
+  Vector gammaq;
+  Vector gammaw;
+  Vector update_e1;
+  Vector compTransfMatrixBasicGlobalNew_e1;
+  Vector getGlobalStiffMatrix_e1;
+  Vector getLMatrix_e1;
+  Vector getKs2Matrix_e1;
+  Vector update_e2;
+  Vector compTransfMatrixBasicGlobalNew_e2;
+  Vector getGlobalStiffMatrix_e2;
+  Vector update_e3;
+  Vector compTransfMatrixBasicGlobalNew_e3;
+  Vector getGlobalStiffMatrix_e3;
+  Vector dJI;
+  Vector xJI;
+  Vector dx;
+  Vector update_r1;
+  Vector compTransfMatrixBasicGlobalNew_r1;
+  Vector getGlobalStiffMatrix_r1;
+  Vector getLMatrix_r1;
+  Vector getKs2Matrix_r1;
+  Vector update_r2;
+  Vector compTransfMatrixBasicGlobalNew_r2;
+  Vector getGlobalStiffMatrix_r2;
+  Vector update_r3;
+  Vector compTransfMatrixBasicGlobalNew_r3;
+  Vector getGlobalStiffMatrix_r3;
+  Vector tmp;
+  Vector update_rI1;
+  Vector compTransfMatrixBasicGlobalNew_rI1;
+  Vector getGlobalStiffMatrix_rI1;
+  Vector update_rI2;
+  Vector compTransfMatrixBasicGlobalNew_rI2;
+  Vector getGlobalStiffMatrix_rI2;
+  Vector update_rI3;
+  Vector compTransfMatrixBasicGlobalNew_rI3;
+  Vector getGlobalStiffMatrix_rI3;
+  Vector update_rJ1;
+  Vector compTransfMatrixBasicGlobalNew_rJ1;
+  Vector getGlobalStiffMatrix_rJ1;
+  Vector update_rJ2;
+  Vector compTransfMatrixBasicGlobalNew_rJ2;
+  Vector getGlobalStiffMatrix_rJ2;
+  Vector update_rJ3;
+  Vector compTransfMatrixBasicGlobalNew_rJ3;
+  Vector getGlobalStiffMatrix_rJ3;
+  Matrix I;
+  Matrix compTransfMatrixBasicGlobalNew_Sr1;
+  Matrix getLMatrix_Sr1;
+  Matrix getKs2Matrix_Sr1;
+  Matrix Sr2;
+  Matrix Sr3;
+  Vector Se;
+  Vector At;
+  Vector hI1;
+  Vector hI2;
+  Vector hI3;
+  Vector hJ1;
+  Vector hJ2;
+  Vector hJ3;
+  Vector Lr;
+  Vector thetaI;
+  Vector thetaJ;
+  Vector ub;
+  Vector dub;
+  Vector dul;
+  Vector Dub;
+  Vector Dul;
+  Vector dummy;
+  Vector pl;
+  Vector pg;
+  Matrix kl;
+  Vector m;
+  Matrix getGlobalStiffMatrix_Se1;
+  Matrix getKs2Matrix_Se1;
+  Matrix Se2;
+  Matrix Se3;
+  Matrix SrI1;
+  Matrix SrI2;
+  Matrix SrI3;
+  Matrix SrJ1;
+  Matrix SrJ2;
+  Matrix SrJ3;
+  Matrix Sm;
+  Matrix kbar;
+  Matrix ks33;
+  Vector v;
+  Matrix m33;
+  Vector rm;
+  Vector yAxis;
+  Vector zAxis;
+  Vector q;
+  Vector q12;
+  Vector q1xq2;
+  Matrix qqT;
+  Matrix getRotationMatrixFromQuaternion_S;
+  Matrix getRotMatrixFromTangScaledPseudoVector_S;
+  Matrix getSkewSymMatrix_S;
+  Matrix R;
+  Vector w;
+  Matrix S2;
+  Matrix L1;
+  Matrix L2;
+  Matrix rie1r1;
+  Matrix e1e1r1;
+  Matrix Sri;
+  Matrix L;
+  Matrix ks2;
+  Matrix zrit;
+  Matrix ze1t;
+  Matrix rizt;
+  Matrix r1e1t;
+  Matrix rie1t;
+  Matrix e1zt;
+  Matrix U;
+  Matrix ks;
+  Matrix Sz;
+  Matrix m1;
+  Vector data;
+  Vector xg;
+  Vector uxg;
+};
+
+static ThreadWorkspace<CorotCrdTransf3dWorkspace> theWorkspace;
 
 void* OPS_CorotCrdTransf3d()
 {
@@ -281,6 +459,8 @@ CorotCrdTransf3d::revertToStart(void)
 int 
 CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 {       
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int error;
     
     nodeIPtr = nodeIPointer;
@@ -315,9 +495,9 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 	initialDispChecked = true;
     }
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    Vector &XAxis = theWork.XAxis;
+    Vector &YAxis = theWork.YAxis;
+    Vector &ZAxis = theWork.ZAxis;
     
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -346,6 +526,12 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 int  
 CorotCrdTransf3d::update(void)
 {       
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &RI = theWork.RI;
+    Matrix &RJ = theWork.RJ;
+    Matrix &Rbar = theWork.Rbar;
+    Matrix &e = theWork.e;
+
     int i, j, k;
     
     /********* OLD REMO - REPLACED BELOW TO FIX BUG ***************
@@ -356,8 +542,8 @@ CorotCrdTransf3d::update(void)
      // get the iterative spins dAlphaI and dAlphaJ 
      // (rotational displacement increments at both nodes)
      
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
+      Vector &dAlphaI = theWork.dAlphaI;
+      Vector &dAlphaJ = theWork.dAlphaJ;
       
        
         for (k = 0; k < 3; k++)
@@ -368,8 +554,8 @@ CorotCrdTransf3d::update(void)
     **************************************************************/
     
     // determine global displacement increments from last iteration
-    static Vector dispI(6);
-    static Vector dispJ(6);
+    Vector &dispI = theWork.dispI;
+    Vector &dispJ = theWork.dispJ;
     dispI = nodeIPtr->getTrialDisp();
     dispJ = nodeJPtr->getTrialDisp();
     
@@ -386,8 +572,8 @@ CorotCrdTransf3d::update(void)
     // get the iterative spins dAlphaI and dAlphaJ 
     // (rotational displacement increments at both nodes)
     
-    static Vector dAlphaI(3);
-    static Vector dAlphaJ(3);
+    Vector &dAlphaI = theWork.dAlphaI;
+    Vector &dAlphaJ = theWork.dAlphaJ;
     
     for (k = 0; k < 3; k++) {
         dAlphaI(k) = dispI(k+3) - alphaI(k);
@@ -399,8 +585,8 @@ CorotCrdTransf3d::update(void)
     /************** END OF REPLACEMENT **************************/
     
     // update the nodal triads TI and RJ using quaternions
-    static Vector dAlphaIq(4);
-    static Vector dAlphaJq(4);
+    Vector &dAlphaIq = theWork.dAlphaIq;
+    Vector &dAlphaJq = theWork.dAlphaJq;
 
     dAlphaIq = this->getQuaternionFromPseudoRotVector (dAlphaI);
     dAlphaJq = this->getQuaternionFromPseudoRotVector (dAlphaJ);
@@ -412,9 +598,9 @@ CorotCrdTransf3d::update(void)
     RJ = this->getRotationMatrixFromQuaternion (alphaJq);
 
     // compute the mean nodal triad
-    static Matrix dRgamma(3,3); 
-    static Vector gammaq(4);
-    static Vector gammaw(3);
+    Matrix &dRgamma = theWork.dRgamma; 
+    Vector &gammaq = theWork.gammaq;
+    Vector &gammaw = theWork.gammaw;
     
     dRgamma.Zero();
     
@@ -436,17 +622,17 @@ CorotCrdTransf3d::update(void)
             Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
             
             // compute the base vectors e1, e2, e3
-            static Vector e1(3);
-            static Vector e2(3);
-            static Vector e3(3);
+            Vector &e1 = theWork.update_e1;
+            Vector &e2 = theWork.update_e2;
+            Vector &e3 = theWork.update_e3;
             
             // relative translation displacements
-            static Vector dJI(3);    
+            Vector &dJI = theWork.dJI;    
             for (int kk = 0; kk < 3; kk++)
                 dJI(kk) = dispJ(kk) - dispI(kk);
             
             // element projection
-            static Vector xJI(3);
+            Vector &xJI = theWork.xJI;
             xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
             
             if (nodeIInitialDisp != 0) {
@@ -461,7 +647,7 @@ CorotCrdTransf3d::update(void)
                 xJI(2) += nodeJInitialDisp[2];
             }
             
-            static Vector dx(3);
+            Vector &dx = theWork.dx;
             // dx = xJI + dJI;  
             dx = xJI;
             dx.addVector (1.0, dJI, 1.0);
@@ -481,9 +667,9 @@ CorotCrdTransf3d::update(void)
             
             // 'rotate' the mean rotation matrix Rbar on to e1 to 
             // obtain e2 and e3 (using the 'mid-point' procedure)
-            static Vector r1(3);
-            static Vector r2(3);
-            static Vector r3(3);
+            Vector &r1 = theWork.update_r1;
+            Vector &r2 = theWork.update_r2;
+            Vector &r3 = theWork.update_r3;
             
             for (k = 0; k < 3; k ++)
             {
@@ -495,7 +681,7 @@ CorotCrdTransf3d::update(void)
             //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
             // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
             
-            static Vector tmp(3);
+            Vector &tmp = theWork.tmp;
             tmp = e1;
             tmp += r1;
             
@@ -511,8 +697,12 @@ CorotCrdTransf3d::update(void)
             e3.addVector(-1.0,  r3, 1.0);
             
             // compute the basic rotations
-            static Vector rI1(3), rI2(3), rI3(3);
-            static Vector rJ1(3), rJ2(3), rJ3(3);
+            Vector &rI1 = theWork.update_rI1;
+            Vector &rI2 = theWork.update_rI2;
+            Vector &rI3 = theWork.update_rI3;
+            Vector &rJ1 = theWork.update_rJ1;
+            Vector &rJ2 = theWork.update_rJ2;
+            Vector &rJ3 = theWork.update_rJ3;
             
             for (k = 0; k < 3; k ++)
             {
@@ -553,18 +743,26 @@ CorotCrdTransf3d::update(void)
 void
 CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &RI = theWork.RI;
+    Matrix &RJ = theWork.RJ;
+    Matrix &Rbar = theWork.Rbar;
+    Matrix &e = theWork.e;
+    Matrix &T = theWork.T;
+    Matrix &Lr2 = theWork.Lr2;
+    Matrix &Lr3 = theWork.Lr3;
+    Matrix &A = theWork.A;
+
     // extract columns of rotation matrices
     int i, j, k;
     
-    //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    VectorND<3> r2, r3;
+    VectorND<3> e1, e2, e3;
+    VectorND<3> rI1, rI2, rI3;
+    VectorND<3> rJ1, rJ2, rJ3;
     
     for (k = 0; k < 3; k ++)
     {
-        r1(k) = Rbar(k,0);
         r2(k) = Rbar(k,1);
         r3(k) = Rbar(k,2);
         
@@ -583,184 +781,200 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    MatrixND<3,3> An;
     
     //   A = (1/Ln)*(I - e1*e1');
     for (i = 0; i < 3; i++)
-        I(i,i) = 1;
+        for (j = 0; j < 3; j++) {
+            An(i,j) = ((i == j ? 1.0 : 0.0) - e1(i)*e1(j))/Ln;
+            A(i,j) = An(i,j);
+        }
+    
+    Vector r2View(r2.values, 3);
+    Vector r3View(r3.values, 3);
+    Lr2 = this->getLMatrix (r2View);
+    Lr3 = this->getLMatrix (r3View);
+    
+    MatrixND<12,3> Lr2n, Lr3n;
+    Lr2n = Lr2;
+    Lr3n = Lr3;
+    
+    // the products with the skew symmetric matrices, S(r)*v, are
+    // formed as the cross products r x v
+    VectorND<3> Se, At, Sv;
+    
+    //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
+    //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
+    //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
+    //  
+    //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
+    //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
+    //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
+    
+    T.Zero();
+    
+    //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
+    
+    Se.cross(rI2, e3);                     // (-S(rI3)*e2 + S(rI2)*e3)
+    Se.addVector(1.0, Sv.cross(rI3, e2), -1.0);
     
     for (i = 0; i < 3; i++)
-        for (j = 0; j < 3; j++)
-            A(i,j) = (I(i,j) - e1(i)*e1(j))/Ln;
-        
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
-        
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
-        
-        //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-        //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        //  
-        //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-        //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-        //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        
-        T.Zero();
-        
-        Sr1 = this->getSkewSymMatrix(rI1);
-        Sr2 = this->getSkewSymMatrix(rI2);
-        Sr3 = this->getSkewSymMatrix(rI3);
-        
-        //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-        
-        Se.addMatrixVector(0.0, Sr3, e2, -1.0);     // (-S(rI3)*e2 + S(rI2)*e3)
-        Se.addMatrixVector(1.0, Sr2, e3,  1.0);    
-        
-        for (i = 0; i < 3; i++)
-            T(0,i+3) =  Se(i);
-        
-        //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        
-        At.addMatrixVector(0.0, A, rI2, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rI2)*e1 + S(rI1)*e2)'
-        Se.addMatrixVector(1.0, Sr1, e2,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(1,i  ) =  At(i);  
-            T(1,i+3) =  Se(i);
-            T(1,i+6) = -At(i);
-        }
-        
-        //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        
-        At.addMatrixVector(0.0, A, rI3, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rI3)*e1 + S(rI1)*e3)
-        Se.addMatrixVector(1.0, Sr1, e3,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(2,i  ) =  At(i);  
-            T(2,i+3) =  Se(i);
-            T(2,i+6) = -At(i);
-        }
-        
-        Sr1 = this->getSkewSymMatrix(rJ1);
-        Sr2 = this->getSkewSymMatrix(rJ2);
-        Sr3 = this->getSkewSymMatrix(rJ3);
-        
-        //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-        
-        Se.addMatrixVector(0.0, Sr3, e2, -1.0);    // -S(rJ3)*e2 + S(rJ2)*e3
-        Se.addMatrixVector(1.0, Sr2, e3,  1.0);    
-        
-        for (i = 0; i < 3; i++)
-            T(3,i+9) =  Se(i);
-        
-        //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-        
-        At.addMatrixVector(0.0, A, rJ2, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rJ2)*e1 + S(rJ1)*e2)
-        Se.addMatrixVector(1.0, Sr1, e2,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(4,i  ) =  At(i);  
-            T(4,i+6) = -At(i);
-            T(4,i+9) =  Se(i);
-        }
-        
-        //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        
-        At.addMatrixVector(0.0, A, rJ3, 1.0);   
-        
-        Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rJ3)*e1 + S(rJ1)*e3)
-        Se.addMatrixVector(1.0, Sr1, e3,  1.0);
-        
-        for (i = 0; i < 3; i++)
-        {
-            T(5,i  ) =  At(i);  
-            T(5,i+6) = -At(i);
-            T(5,i+9) =  Se(i);
-        }
-        
-        // setup tranformation matrix
-        static Vector Lr(12);
-        
-        // T(:,1) += Lr3*rI2 - Lr2*rI3;
-        // T(:,2) +=           Lr2*rI1;
-        // T(:,3) += Lr3*rI1          ;
-        
-        // T(:,4) += Lr3*rJ2 - Lr2*rJ3;
-        // T(:,5) += Lr2*rJ1          ;      // ?????? check sign
-        // T(:,6) += Lr3*rJ1          ;      // ?????? check sign
-        
-        Lr.addMatrixVector(0.0, Lr3, rI2,  1.0);  //  T(:,1) += Lr3*rI2 - Lr2*rI3 
-        Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
-        
-        for (i = 0; i < 12; i++)
-            T(0,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr2, rI1,  1.0);  //  T(:,2) +=           Lr2*rI1
-        
-        for (i = 0; i < 12; i++)
-            T(1,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr3, rI1,  1.0);  //  T(:,3) += Lr3*rI1 
-        
-        for (i = 0; i < 12; i++)
-            T(2,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr3, rJ2,  1.0);  //  T(:,4) += Lr3*rJ2 - Lr2*rJ3;
-        Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
-        
-        for (i = 0; i < 12; i++)
-            T(3,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr2, rJ1,  1.0);  //  T(:,5) += Lr2*rJ1   
-        
-        for (i = 0; i < 12; i++)
-            T(4,i) += Lr(i);
-        
-        Lr.addMatrixVector(0.0, Lr3, rJ1,  1.0);  //   T(:,6) += Lr3*rJ1
-        
-        for (i = 0; i < 12; i++)
-            T(5,i) += Lr(i);
-        
-        double c;
-        for (j = 0; j < 6; j++)
-        {
-            c = 2 * cos(ul(j));
-            
-            for (i = 0; i < 12; i++) 
-                T(j,i) /= c;
-        }
+        T(0,i+3) =  Se(i);
+    
+    //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
+    
+    At.addMatrixVector(0.0, An, rI2, 1.0);   
+    
+    Se.cross(rI1, e2);                     // (-S(rI2)*e1 + S(rI1)*e2)'
+    Se.addVector(1.0, Sv.cross(rI2, e1), -1.0);
+    
+    for (i = 0; i < 3; i++)
+    {
+        T(1,i  ) =  At(i);  
+        T(1,i+3) =  Se(i);
+        T(1,i+6) = -At(i);
+    }
+    
+    //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
+    
+    At.addMatrixVector(0.0, An, rI3, 1.0);   
+    
+    Se.cross(rI1, e3);                     // (-S(rI3)*e1 + S(rI1)*e3)
+    Se.addVector(1.0, Sv.cross(rI3, e1), -1.0);
+    
+    for (i = 0; i < 3; i++)
+    {
+        T(2,i  ) =  At(i);  
+        T(2,i+3) =  Se(i);
+        T(2,i+6) = -At(i);
+    }
+    
+    //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
+    
+    Se.cross(rJ2, e3);                     // -S(rJ3)*e2 + S(rJ2)*e3
+    Se.addVector(1.0, Sv.cross(rJ3, e2), -1.0);
+    
+    for (i = 0; i < 3; i++)
+        T(3,i+9) =  Se(i);
+    
+    //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
+    
+    At.addMatrixVector(0.0, An, rJ2, 1.0);   
+    
+    Se.cross(rJ1, e2);                     // (-S(rJ2)*e1 + S(rJ1)*e2)
+    Se.addVector(1.0, Sv.cross(rJ2, e1), -1.0);
+    
+    for (i = 0; i < 3; i++)
+    {
+        T(4,i  ) =  At(i);  
+        T(4,i+6) = -At(i);
+        T(4,i+9) =  Se(i);
+    }
+    
+    //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
+    
+    At.addMatrixVector(0.0, An, rJ3, 1.0);   
+    
+    Se.cross(rJ1, e3);                     // (-S(rJ3)*e1 + S(rJ1)*e3)
+    Se.addVector(1.0, Sv.cross(rJ3, e1), -1.0);
+    
+    for (i = 0; i < 3; i++)
+    {
+        T(5,i  ) =  At(i);  
+        T(5,i+6) = -At(i);
+        T(5,i+9) =  Se(i);
+    }
+    
+    // setup tranformation matrix
+    VectorND<12> Lr;
+    
+    // T(:,1) += Lr3*rI2 - Lr2*rI3;
+    // T(:,2) +=           Lr2*rI1;
+    // T(:,3) += Lr3*rI1          ;
+    
+    // T(:,4) += Lr3*rJ2 - Lr2*rJ3;
+    // T(:,5) += Lr2*rJ1          ;      // ?????? check sign
+    // T(:,6) += Lr3*rJ1          ;      // ?????? check sign
+    
+    Lr.addMatrixVector(0.0, Lr3n, rI2,  1.0);  //  T(:,1) += Lr3*rI2 - Lr2*rI3 
+    Lr.addMatrixVector(1.0, Lr2n, rI3, -1.0);
+    
+    for (i = 0; i < 12; i++)
+        T(0,i) += Lr(i);
+    
+    Lr.addMatrixVector(0.0, Lr2n, rI1,  1.0);  //  T(:,2) +=           Lr2*rI1
+    
+    for (i = 0; i < 12; i++)
+        T(1,i) += Lr(i);
+    
+    Lr.addMatrixVector(0.0, Lr3n, rI1,  1.0);  //  T(:,3) += Lr3*rI1 
+    
+    for (i = 0; i < 12; i++)
+        T(2,i) += Lr(i);
+    
+    Lr.addMatrixVector(0.0, Lr3n, rJ2,  1.0);  //  T(:,4) += Lr3*rJ2 - Lr2*rJ3;
+    Lr.addMatrixVector(1.0, Lr2n, rJ3, -1.0);
+    
+    for (i = 0; i < 12; i++)
+        T(3,i) += Lr(i);
+    
+    Lr.addMatrixVector(0.0, Lr2n, rJ1,  1.0);  //  T(:,5) += Lr2*rJ1   
+    
+    for (i = 0; i < 12; i++)
+        T(4,i) += Lr(i);
+    
+    Lr.addMatrixVector(0.0, Lr3n, rJ1,  1.0);  //   T(:,6) += Lr3*rJ1
+    
+    for (i = 0; i < 12; i++)
+        T(5,i) += Lr(i);
+    
+    double c;
+    for (j = 0; j < 6; j++)
+    {
+        c = 2 * cos(ul(j));
         
-        // T(:,7) = [-e1' O' e1' O']';
-        for (i = 0; i < 3; i++)
-        {
-            T(6,i  ) = -e1(i);
-            T(6,i+6) =  e1(i);
-        }      
+        for (i = 0; i < 12; i++) 
+            T(j,i) /= c;
+    }
+    
+    // T(:,7) = [-e1' O' e1' O']';
+    for (i = 0; i < 3; i++)
+    {
+        T(6,i  ) = -e1(i);
+        T(6,i+6) =  e1(i);
+    }      
 }
 
 
 void
 CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &RI = theWork.RI;
+    Matrix &RJ = theWork.RJ;
+    Matrix &Rbar = theWork.Rbar;
+    Matrix &e = theWork.e;
+    Matrix &T = theWork.T;
+    Matrix &Lr2 = theWork.Lr2;
+    Matrix &Lr3 = theWork.Lr3;
+    Matrix &A = theWork.A;
+
     // extract columns of rotation matrices
     int i, j, k;
     
     //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    Vector &r1 = theWork.compTransfMatrixBasicGlobalNew_r1;
+    Vector &r2 = theWork.compTransfMatrixBasicGlobalNew_r2;
+    Vector &r3 = theWork.compTransfMatrixBasicGlobalNew_r3;
+    Vector &e1 = theWork.compTransfMatrixBasicGlobalNew_e1;
+    Vector &e2 = theWork.compTransfMatrixBasicGlobalNew_e2;
+    Vector &e3 = theWork.compTransfMatrixBasicGlobalNew_e3;
+    Vector &rI1 = theWork.compTransfMatrixBasicGlobalNew_rI1;
+    Vector &rI2 = theWork.compTransfMatrixBasicGlobalNew_rI2;
+    Vector &rI3 = theWork.compTransfMatrixBasicGlobalNew_rI3;
+    Vector &rJ1 = theWork.compTransfMatrixBasicGlobalNew_rJ1;
+    Vector &rJ2 = theWork.compTransfMatrixBasicGlobalNew_rJ2;
+    Vector &rJ3 = theWork.compTransfMatrixBasicGlobalNew_rJ3;
     
     for (k = 0; k < 3; k ++)
     {
@@ -783,7 +997,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    Matrix &I = theWork.I;
     
     //   A = (1/Ln)*(I - e1*e1');
     for (i = 0; i < 3; i++)
@@ -816,8 +1030,11 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // opserr << "Lr2: " << Lr2;
         // opserr << "Lr3: " << Lr3;
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        Matrix &Sr1 = theWork.compTransfMatrixBasicGlobalNew_Sr1;
+        Matrix &Sr2 = theWork.Sr2;
+        Matrix &Sr3 = theWork.Sr3;
+        Vector &Se = theWork.Se;
+        Vector &At = theWork.At;
         
         
         // O = zeros(3,1);
@@ -828,12 +1045,12 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
         // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
         
-        static Vector hI1(12);
-        static Vector hI2(12);
-        static Vector hI3(12);
-        static Vector hJ1(12);
-        static Vector hJ2(12);
-        static Vector hJ3(12);
+        Vector &hI1 = theWork.hI1;
+        Vector &hI2 = theWork.hI2;
+        Vector &hI3 = theWork.hI3;
+        Vector &hJ1 = theWork.hJ1;
+        Vector &hJ2 = theWork.hJ2;
+        Vector &hJ3 = theWork.hJ3;
         
         Sr1 = this->getSkewSymMatrix(rI1);
         Sr2 = this->getSkewSymMatrix(rI2);
@@ -926,7 +1143,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         
         // T = F'
         T.Zero();
-        static Vector Lr(12);
+        Vector &Lr = theWork.Lr;
         
         // f1 =  [-e1' O' e1' O'];
         for (i=0; i<3; i++) {
@@ -934,8 +1151,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             T(i+3,0) = e1(i);
         }
         
-        static Vector thetaI(3);
-        static Vector thetaJ(3);
+        Vector &thetaI = theWork.thetaI;
+        Vector &thetaJ = theWork.thetaJ;
         
         
         thetaI(0) = ul(0);
@@ -1019,7 +1236,9 @@ CorotCrdTransf3d::compTransfMatrixLocalGlobal(Matrix &Tlg)
 const Vector &
 CorotCrdTransf3d::getBasicTrialDisp(void)
 {
-    static Vector ub(6);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &ub = theWork.ub;
     
     // use transformation matrix to renumber the degrees of freedom
     ub.addMatrixVector(0.0, Tp, ul, 1.0);
@@ -1031,8 +1250,10 @@ CorotCrdTransf3d::getBasicTrialDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDeltaDisp(void)
 {
-    static Vector dub(6);
-    static Vector dul(7);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &dub = theWork.dub;
+    Vector &dul = theWork.dul;
     
     // dul = ul - ulpr;
     dul = ul;
@@ -1048,8 +1269,10 @@ CorotCrdTransf3d::getBasicIncrDeltaDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDisp(void)
 {
-    static Vector Dub(6);
-    static Vector Dul(7);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &Dub = theWork.Dub;
+    Vector &Dul = theWork.Dul;
     
     // Dul = ul - ulcommit;
     Dul = ul;
@@ -1065,10 +1288,12 @@ CorotCrdTransf3d::getBasicIncrDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicTrialVel(void)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     opserr << "WARNING CorotCrdTransf3d::getBasicTrialVel()"
         << " - has not been implemented yet. Returning zeros." << endln;
     
-    static Vector dummy(6);
+    Vector &dummy = theWork.dummy;
     return dummy;
 }
 
@@ -1076,10 +1301,12 @@ CorotCrdTransf3d::getBasicTrialVel(void)
 const Vector &
 CorotCrdTransf3d::getBasicTrialAccel(void)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     opserr << "WARNING CorotCrdTransf3d::getBasicTrialAccel()"
         << " - has not been implemented yet. Returning zeros." << endln;
     
-    static Vector dummy(6);
+    Vector &dummy = theWork.dummy;
     return dummy;
 }
 
@@ -1087,11 +1314,14 @@ CorotCrdTransf3d::getBasicTrialAccel(void)
 const Vector &
 CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &T = theWork.T;
+
     this->update();
     
     //   opserr << "basic forces: " << pb;  
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    Vector &pl = theWork.pl;
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     //opserr << "pl: " << pl;
     // Add effects of member loads
@@ -1103,7 +1333,7 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     //pl(8) += p0(4);
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    Vector &pg = theWork.pg;
     pg.addMatrixTransposeVector(0.0, T, pl, 1.0);   // pg = T ^ pl; residual
     //opserr << "pg: " << pg;
     
@@ -1120,19 +1350,29 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &RI = theWork.RI;
+    Matrix &RJ = theWork.RJ;
+    Matrix &Rbar = theWork.Rbar;
+    Matrix &e = theWork.e;
+    Matrix &T = theWork.T;
+    Matrix &kg = theWork.kg;
+    Matrix &Lr2 = theWork.Lr2;
+    Matrix &Lr3 = theWork.Lr3;
+    Matrix &A = theWork.A;
     
     this->update();
     
     int i, j, k;   
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    Matrix &kl = theWork.kl;
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
 
     //    opserr << "kb: " << kb;
     //    opserr << "Tp: " << Tp;
     
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    Vector &pl = theWork.pl;
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     
     // transform tangent  stiffness matrix from local to global coordinates
@@ -1141,16 +1381,24 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     // compute the tangent stiffness matrix in global coordinates
     kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
     
-    static Vector m(6);
+    Vector &m = theWork.m;
     for (i = 0; i < 6; i++)
         m(i) = pl(i)/(2*cos(ul(i)));
     
     // compute the basic rotations
     
-    static Vector e1(3), e2(3), e3(3);
-    static Vector r1(3), r2(3), r3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    Vector &e1 = theWork.getGlobalStiffMatrix_e1;
+    Vector &e2 = theWork.getGlobalStiffMatrix_e2;
+    Vector &e3 = theWork.getGlobalStiffMatrix_e3;
+    Vector &r1 = theWork.getGlobalStiffMatrix_r1;
+    Vector &r2 = theWork.getGlobalStiffMatrix_r2;
+    Vector &r3 = theWork.getGlobalStiffMatrix_r3;
+    Vector &rI1 = theWork.getGlobalStiffMatrix_rI1;
+    Vector &rI2 = theWork.getGlobalStiffMatrix_rI2;
+    Vector &rI3 = theWork.getGlobalStiffMatrix_rI3;
+    Vector &rJ1 = theWork.getGlobalStiffMatrix_rJ1;
+    Vector &rJ2 = theWork.getGlobalStiffMatrix_rJ2;
+    Vector &rJ3 = theWork.getGlobalStiffMatrix_rJ3;
     
     for (k = 0; k < 3; k ++)
     {
@@ -1177,9 +1425,15 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
     //        ks3 + ks3' + ks4 + ks5;
     
-    static Matrix Se1(3,3), Se2(3,3), Se3(3,3);
-    static Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
-    static Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
+    Matrix &Se1 = theWork.getGlobalStiffMatrix_Se1;
+    Matrix &Se2 = theWork.Se2;
+    Matrix &Se3 = theWork.Se3;
+    Matrix &SrI1 = theWork.SrI1;
+    Matrix &SrI2 = theWork.SrI2;
+    Matrix &SrI3 = theWork.SrI3;
+    Matrix &SrJ1 = theWork.SrJ1;
+    Matrix &SrJ2 = theWork.SrJ2;
+    Matrix &SrJ3 = theWork.SrJ3;
     
     Se1 = this->getSkewSymMatrix(e1);
     Se2 = this->getSkewSymMatrix(e2);
@@ -1219,8 +1473,8 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     
     //     ks3 = [o kbar2 o kbar4];
     
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
+    Matrix &Sm = theWork.Sm;
+    Matrix &kbar = theWork.kbar;
     
     Sm.addMatrix(0.0, SrI3,  m(3));
     Sm.addMatrix(1.0, SrI1,  m(1));
@@ -1264,7 +1518,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //           O    O     O    O;
     //           O    O     O  Ks4_44];
     
-    static Matrix ks33(3,3);
+    Matrix &ks33 = theWork.ks33;
     
     ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
     ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1298,7 +1552,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //          Ks5_14t     O   -Ks5_14t   O];
     
     // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-    static Vector v(3);
+    Vector &v = theWork.v;
     v.addVector (0.0, rI2, m(1));
     v.addVector (1.0, rI3, m(2));
     v.addVector (1.0, rJ2, m(4));
@@ -1307,7 +1561,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     v /= Ln;
     
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
+    Matrix &m33 = theWork.m33;
     double  e1tv = 0;   // dot product e1. v
     
     for (i = 0; i < 3; i++)
@@ -1357,7 +1611,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
             //opserr << "kg += ksigma5: " << kg;
             
             // Ksigma -------------------------------
-            static Vector rm(3);
+            Vector &rm = theWork.rm;
             
             rm = rI3;
             rm.addVector (1.0, rJ3, -1.0); 
@@ -1398,8 +1652,12 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &T = theWork.T;
+    Matrix &kg = theWork.kg;
+
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    Matrix &kl = theWork.kl;
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform tangent  stiffness matrix from local to global coordinates
@@ -1415,9 +1673,11 @@ CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &kb)
 int 
 CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // element projection
     
-    static Vector dx(3);
+    Vector &dx = theWork.dx;
     
     dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
     if (nodeIInitialDisp != 0) {
@@ -1449,7 +1709,8 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
     
     // calculate the cross-product y = v * x   
-    static Vector yAxis(3), zAxis(3);
+    Vector &yAxis = theWork.yAxis;
+    Vector &zAxis = theWork.zAxis;
     
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
@@ -1501,11 +1762,13 @@ CorotCrdTransf3d::getDeformedLength(void)
 const Vector &
 CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // obtains the normalised quaternion from the rotation matrix
     int i, j, k;
     double trR;              // trace of R
     double a    ;
-    static Vector q(4);      // normalized quaternion
+    Vector &q = theWork.q;      // normalized quaternion
     
     trR = R(0,0) + R(1,1) + R(2,2);    
     
@@ -1548,9 +1811,11 @@ CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
 const Vector &
 CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     double t;                // norm of the pseudo rotation vector
     double factor;
-    static Vector q(4);      // normalized quaternion
+    Vector &q = theWork.q;      // normalized quaternion
     
     t = theta.Norm();
     
@@ -1572,11 +1837,12 @@ CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
 const Vector &
 CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
     
-    static Vector q12(4);
+    Vector &q12 = theWork.q12;
     int i;
     double q1Tq2= 0;  // dot product
-    static Vector q1xq2(3);     // cross product
+    Vector &q1xq2 = theWork.q1xq2;     // cross product
     
     // calculate the dot product q1.q2
     for (i = 0; i < 3; i++)       // NOTE i <3, not i<4
@@ -1600,12 +1866,13 @@ CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
 const Matrix &
 CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 { 
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int i, j;
     double factor;
-    static Matrix I(3,3); // identity matrix
-    static Matrix qqT(3,3); 
-    static Matrix S(3,3);
-    static Matrix R(3,3);
+    Matrix &qqT = theWork.qqT; 
+    Matrix &S = theWork.getRotationMatrixFromQuaternion_S;
+    Matrix &R = theWork.R;
     
     // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
     
@@ -1634,7 +1901,9 @@ CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 const Vector &
 CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
 { 
-    static Vector w(3);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &w = theWork.w;
     
     for (int i = 0; i < 3; i++)
         w(i) = 2.0 * q(i)/q(3);
@@ -1646,10 +1915,12 @@ CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
 const Matrix &
 CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 { 
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // Rotation matrix in terms of the tangent-scaled pseudo-vector
-    static Matrix S(3,3);
-    static Matrix S2(3,3);
-    static Matrix R(3,3);
+    Matrix &S = theWork.getRotMatrixFromTangScaledPseudoVector_S;
+    Matrix &S2 = theWork.S2;
+    Matrix &R = theWork.R;
     double normw2;
     
     S = this->getSkewSymMatrix(w);
@@ -1675,7 +1946,9 @@ CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 const Matrix &
 CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
 {
-    static Matrix S(3,3);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Matrix &S = theWork.getSkewSymMatrix_S;
     
     //  St = [   0       -theta(2)  theta(1);
     //         theta(2)     0      -theta(0);
@@ -1703,14 +1976,21 @@ CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
 const Matrix &
 CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 {
-    static Matrix L1(3,3), L2(3,3);
-    static Vector r1(3), e1(3);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &Rbar = theWork.Rbar;
+    Matrix &e = theWork.e;
+    Matrix &A = theWork.A;
+
+    Matrix &L1 = theWork.L1;
+    Matrix &L2 = theWork.L2;
+    Vector &r1 = theWork.getLMatrix_r1;
+    Vector &e1 = theWork.getLMatrix_e1;
     double rie1, e1r1k;
-    static Matrix rie1r1(3,3);
-    static Matrix e1e1r1(3,3);
-    static Matrix Sri(3,3);
-    static Matrix Sr1(3,3);
-    static Matrix L(12,3);
+    Matrix &rie1r1 = theWork.rie1r1;
+    Matrix &e1e1r1 = theWork.e1e1r1;
+    Matrix &Sri = theWork.Sri;
+    Matrix &Sr1 = theWork.getLMatrix_Sr1;
+    Matrix &L = theWork.L;
     
     int j, k;
     
@@ -1775,8 +2055,14 @@ CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 const Matrix &
 CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
 {
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &Rbar = theWork.Rbar;
+    Matrix &e = theWork.e;
+    Matrix &A = theWork.A;
+
+    Matrix &ks2 = theWork.ks2;
+    Vector &e1 = theWork.getKs2Matrix_e1;
+    Vector &r1 = theWork.getKs2Matrix_r1;
     
     //opserr << "\ngetKs2Matrix:\n";
     //opserr << "ri: " << ri;
@@ -1805,9 +2091,12 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
         ztr1  += z(i)*r1(i);
     }
     
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
+    Matrix &zrit = theWork.zrit;
+    Matrix &ze1t = theWork.ze1t;
+    Matrix &rizt = theWork.rizt;
+    Matrix &r1e1t = theWork.r1e1t;
+    Matrix &rie1t = theWork.rie1t;
+    Matrix &e1zt = theWork.e1zt;
     
     for (i = 0; i < 3; i++)
         for (j = 0; j < 3; j++)
@@ -1820,7 +2109,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             rie1t(i,j) = ri(i)*e1(j);
         }
         
-        static Matrix U(3,3);
+        Matrix &U = theWork.U;
         //opserr << " rite1: "<< rite1;
         //opserr << " zte1: "<< zte1;
         //opserr << " ztr1: "<< ztr1;
@@ -1840,7 +2129,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
         U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
         
         //opserr << "U: " << U;
-        static Matrix ks(3,3);
+        Matrix &ks = theWork.ks;
         
         //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
         
@@ -1862,7 +2151,10 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             ks2.Assemble(ks, 6, 0, -1.0);
             ks2.Assemble(ks, 6, 6,  1.0);
             
-            static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
+            Matrix &Sri = theWork.Sri;
+            Matrix &Sr1 = theWork.getKs2Matrix_Sr1;
+            Matrix &Sz = theWork.Sz;
+            Matrix &Se1 = theWork.getKs2Matrix_Se1;
             
             Sri = this->getSkewSymMatrix(ri);  
             Sr1 = this->getSkewSymMatrix(r1);
@@ -1871,7 +2163,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             
             //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
             
-            static Matrix m1(3,3);
+            Matrix &m1 = theWork.m1;
             
             m1.addMatrixProduct(0.0, A, ze1t, -1.0);
             ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -1957,7 +2249,9 @@ CorotCrdTransf3d::getCopy3d(void)
 int 
 CorotCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(48);
+  CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+  Vector &data = theWork.data;
   for (int i=0; i<7; i++) 
     data(i) = ulcommit(i);
   for (int j=0; j<4; j++) {
@@ -2021,7 +2315,9 @@ CorotCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 int 
 CorotCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static Vector data(48);
+  CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+  Vector &data = theWork.data;
   if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
     opserr << " CorotCrdTransf3d::recvSelf() - data could not be received\n" ;
     return -1;
@@ -2080,6 +2376,10 @@ CorotCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theB
 const Matrix &
 CorotCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 {
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &Tlg = theWork.Tlg;
+    Matrix &kg = theWork.kg;
+
     this->compTransfMatrixLocalGlobal(Tlg);  // OPTIMIZE LATER
     kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);  // OPTIMIZE LATER
 
@@ -2090,7 +2390,9 @@ CorotCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &xg = theWork.xg;
     opserr << " CorotCrdTransf3d::getPointGlobalCoordFromLocal: not implemented yet" ;
     
     return xg;  
@@ -2100,7 +2402,9 @@ CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 CorotCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
-    static Vector uxg(3);
+    CorotCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &uxg = theWork.uxg;
     opserr << " CorotCrdTransf3d::getPointGlobalDisplFromBasic: not implemented yet" ;
     
     
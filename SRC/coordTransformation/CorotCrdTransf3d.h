@@ -59,6 +59,7 @@ public:
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void) {return true;}
     
     const Vector &getBasicTrialDisp(void);
     const Vector &getBasicIncrDisp(void);
@@ -124,15 +125,7 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
-    static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
-    static Matrix Tlg;          // transformation matrix from global to local system
-    static Matrix kg;           // global stiffness matrix
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices
+    static Matrix Tp;           // transformation matrix to renumber dofs (constant)
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
@@ -65,6 +65,10 @@ public:
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
+
+    // true if update() and the get methods touch no storage shared
+    // with other transformations, so that several threads may call them
+    virtual bool isThreadSafe(void) {return false;}
     
     virtual const Vector &getBasicTrialDisp(void) = 0;
     virtual const Vector &getBasicIncrDisp(void) = 0;
@@ -39,15 +39,40 @@
 #include <ID.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <MatrixND.h>
 #include <Node.h>
 #include <Channel.h>
 #include <elementAPI.h>
 #include <string>
 #include <LinearCrdTransf2d.h>
-
-// initialize static variables
-Matrix LinearCrdTransf2d::Tlg(6,6);
-Matrix LinearCrdTransf2d::kg(6,6);
+#include <ThreadWorkspace.h>
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct LinearCrdTransf2dWorkspace {
+  LinearCrdTransf2dWorkspace()
+    :kg(6,6), dx(2), ub(3), dub(3), Dub(3), vb(3), ab(3), pg(6),
+     data(12), xg(2), ug(6), ul(6), U(6), dUdh(6), dvdh(3), dudh(6), u(6) {};
+
+  Matrix kg;
+  Vector dx;
+  Vector ub;
+  Vector dub;
+  Vector Dub;
+  Vector vb;
+  Vector ab;
+  Vector pg;
+  Vector data;
+  Vector xg;
+  Vector ug;
+  Vector ul;
+  Vector U;
+  Vector dUdh;
+  Vector dvdh;
+  Vector dudh;
+  Vector u;
+};
+
+static ThreadWorkspace<LinearCrdTransf2dWorkspace> theWorkspace;
 
 void* OPS_LinearCrdTransf2d()
 {
@@ -226,8 +251,10 @@ LinearCrdTransf2d::update(void)
 int 
 LinearCrdTransf2d::computeElemtLengthAndOrient()
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // element projection
-    static Vector dx(2);
+    Vector &dx = theWork.dx;
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -304,11 +331,13 @@ LinearCrdTransf2d::getDeformedLength(void)
 const Vector &
 LinearCrdTransf2d::getBasicTrialDisp(void)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[6];
+    double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
@@ -324,7 +353,7 @@ LinearCrdTransf2d::getBasicTrialDisp(void)
             ug[j+3] -= nodeJInitialDisp[j];
     }
     
-    static Vector ub(3);
+    Vector &ub = theWork.ub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -359,17 +388,19 @@ LinearCrdTransf2d::getBasicTrialDisp(void)
 const Vector &
 LinearCrdTransf2d::getBasicIncrDisp(void)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double dug[6];
+    double dug[6];
     for (int i = 0; i < 3; i++) {
         dug[i]   = disp1(i);
         dug[i+3] = disp2(i);
     }
     
-    static Vector dub(3);
+    Vector &dub = theWork.dub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -404,17 +435,19 @@ LinearCrdTransf2d::getBasicIncrDisp(void)
 const Vector &
 LinearCrdTransf2d::getBasicIncrDeltaDisp(void)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double Dug[6];
+    double Dug[6];
     for (int i = 0; i < 3; i++) {
         Dug[i]   = disp1(i);
         Dug[i+3] = disp2(i);
     }
     
-    static Vector Dub(3);
+    Vector &Dub = theWork.Dub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -449,17 +482,19 @@ LinearCrdTransf2d::getBasicIncrDeltaDisp(void)
 const Vector &
 LinearCrdTransf2d::getBasicTrialVel(void)
 {
+  LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// determine global velocities
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	double vg[6];
 	for (int i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
 		vg[i+3] = vel2(i);
 	}
 	
-	static Vector vb(3);
+	Vector &vb = theWork.vb;
 	
 	double oneOverL = 1.0/L;
 	double sl = sinTheta*oneOverL;
@@ -494,17 +529,19 @@ LinearCrdTransf2d::getBasicTrialVel(void)
 const Vector &
 LinearCrdTransf2d::getBasicTrialAccel(void)
 {
+  LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// determine global accelerations
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[6];
+	double ag[6];
 	for (int i = 0; i < 3; i++) {
 		ag[i]   = accel1(i);
 		ag[i+3] = accel2(i);
 	}
 	
-	static Vector ab(3);
+	Vector &ab = theWork.ab;
 	
 	double oneOverL = 1.0/L;
 	double sl = sinTheta*oneOverL;
@@ -539,8 +576,10 @@ LinearCrdTransf2d::getBasicTrialAccel(void)
 const Vector &
 LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    double pl[6];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -562,7 +601,7 @@ LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[4] += p0(2);
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    Vector &pg = theWork.pg;
     
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -594,8 +633,10 @@ LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Vector &
 LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb, const Vector &p0)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    double pl[6];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -617,7 +658,7 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb, con
     //	pl[4] += p0(2);
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    Vector &pg = theWork.pg;
     pg.Zero();
     
     static ID nodeParameterID(2);
@@ -675,7 +716,10 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb, con
 const Matrix &
 LinearCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-    static double tmp [6][6];
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double tmp [6][6];
     double oneOverL = 1.0/L;
     double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
     
@@ -796,7 +840,10 @@ LinearCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 LinearCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-    static double tmp [6][6];
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double tmp [6][6];
     double oneOverL = 1.0/L;
     double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
     
@@ -949,9 +996,11 @@ LinearCrdTransf2d::getCopy2d(void)
 int 
 LinearCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(12);
+    Vector &data = theWork.data;
     data(0) = this->getTag();
     data(1) = L;
     if (nodeIOffset != 0) {
@@ -1003,9 +1052,11 @@ LinearCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 int 
 LinearCrdTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(12);
+    Vector &data = theWork.data;
     
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -1074,8 +1125,30 @@ LinearCrdTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
 const Matrix &
 LinearCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 {
-    this->compTransfMatrixLocalGlobal(Tlg);  // OPTIMIZE LATER
-    kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);  // OPTIMIZE LATER
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    // kg = Tlg'*ml*Tlg, formed by 3x3 blocks as Tlg is block diagonal in R
+    MatrixND<3,3> Rlg, mlij, kgij;
+    Rlg.Zero();
+    Rlg(0,0) = Rlg(1,1) = cosTheta;
+    Rlg(0,1) = sinTheta;
+    Rlg(1,0) = -sinTheta;
+    Rlg(2,2) = 1.0;
+
+    for (int bi = 0; bi < 6; bi += 3) {
+        for (int bj = 0; bj < 6; bj += 3) {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    mlij(i,j) = ml(bi+i,bj+j);
+
+            kgij.addMatrixTripleProduct(0.0, Rlg, mlij, 1.0);
+
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    kg(bi+i,bj+j) = kgij(i,j);
+        }
+    }
 
     return kg;
 }
@@ -1084,7 +1157,9 @@ LinearCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 LinearCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(2);
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+    Vector &xg = theWork.xg;
     
     const Vector &nodeICoords = nodeIPtr->getCrds();
     xg(0) = nodeICoords(0);
@@ -1106,11 +1181,13 @@ LinearCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 LinearCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);
+    Vector &ug = theWork.ug;
     for (int i = 0; i < 3; i++)
     {
         ug(i)   = disp1(i);
@@ -1128,7 +1205,7 @@ LinearCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);      // total displacements
+    Vector &ul = theWork.ul;      // total displacements
     
     ul(0) =  cosTheta*ug(0) + sinTheta*ug(1);
     ul(1) = -sinTheta*ug(0) + cosTheta*ug(1);
@@ -1187,8 +1264,10 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
 							   const Vector &p0,
 							   int gradNumber)
 {
+  LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// transform resisting forces from the basic system to local coordinates
-	static double pl[6];
+	double pl[6];
 
 	double q0 = pb(0);
 	double q1 = pb(1);
@@ -1210,7 +1289,7 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
 	pl[4] += p0(2);
 
 	// transform resisting forces  from local to global coordinates
-	static Vector pg(6);
+	Vector &pg = theWork.pg;
 	pg.Zero();
 
 	static ID nodeParameterID(2);
@@ -1268,8 +1347,10 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
 const Vector &
 LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
 {
-  static Vector U(6);
-  static Vector dUdh(6);
+  LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &U = theWork.U;
+  Vector &dUdh = theWork.dUdh;
 
   const Vector &dispI = nodeIPtr->getTrialDisp();
   const Vector &dispJ = nodeJPtr->getTrialDisp();
@@ -1282,7 +1363,7 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dUdh(i+3) = nodeJPtr->getDispSensitivity((i+1),gradNumber);
   }
 
-  static Vector dvdh(3);
+  Vector &dvdh = theWork.dvdh;
 
   double dcosThetadh = 0.0;
   double dsinThetadh = 0.0;
@@ -1314,7 +1395,7 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dcosThetadh = -dx*dy/(L*L*L);
   }
 
-  static Vector dudh(6);
+  Vector &dudh = theWork.dudh;
   //dudh = A*dUdh + dAdh*U;
   dudh(0) =  cosTheta*dUdh(0) + sinTheta*dUdh(1) + dcosThetadh*U(0) + dsinThetadh*U(1);
   dudh(1) = -sinTheta*dUdh(0) + cosTheta*dUdh(1) - dsinThetadh*U(0) + dcosThetadh*U(1);
@@ -1323,7 +1404,7 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
   dudh(4) = -sinTheta*dUdh(3) + cosTheta*dUdh(4) - dsinThetadh*U(3) + dcosThetadh*U(4);
   dudh(5) =  dUdh(5);
 
-  static Vector u(6);
+  Vector &u = theWork.u;
   //u = A*U;
   u(0) =  cosTheta*U(0) + sinTheta*U(1);
   u(1) = -sinTheta*U(0) + cosTheta*U(1);
@@ -1417,13 +1498,15 @@ LinearCrdTransf2d::getd1overLdh(void)
 const Vector &
 LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // Want to return dAdh * u
 
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[6];
+    double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
@@ -1439,7 +1522,7 @@ LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
             ug[j+3] -= nodeJInitialDisp[j];
     }
 
-    static Vector ub(3);
+    Vector &ub = theWork.ub;
     ub.Zero();
 
     static ID nodeParameterID(2);
@@ -1501,19 +1584,20 @@ LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
 const Vector &
 LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber, int flag)
 {
+    LinearCrdTransf2dWorkspace &theWork = theWorkspace.get();
     
     // This method is created by simply copying the 
     // getBasicTrialDisp method. Instead of picking
     // up the nodal displacements we just pick up 
     // the nodal displacement sensitivities. 
     
-    static double ug[6];
+    double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = nodeIPtr->getDispSensitivity((i+1),gradNumber);
         ug[i+3] = nodeJPtr->getDispSensitivity((i+1),gradNumber);
     }
     
-    static Vector ub(3);
+    Vector &ub = theWork.ub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -62,6 +62,7 @@ public:
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void) {return true;}
     
     const Vector &getBasicTrialDisp(void);
     const Vector &getBasicIncrDisp(void);
@@ -118,8 +119,6 @@ private:
     double cosTheta, sinTheta;  // direction cosines of undeformed element wrt to global system 
     double L;  // undeformed element length
 
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
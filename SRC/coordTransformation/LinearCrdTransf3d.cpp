@@ -37,15 +37,41 @@
 
 #include <Vector.h>
 #include <Matrix.h>
+#include <MatrixND.h>
 #include <Node.h>
 #include <Channel.h>
 #include <elementAPI.h>
 #include <string>
 #include <LinearCrdTransf3d.h>
-
-// initialize static variables
-Matrix LinearCrdTransf3d::Tlg(12,12);
-Matrix LinearCrdTransf3d::kg(12,12);
+#include <ThreadWorkspace.h>
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct LinearCrdTransf3dWorkspace {
+  LinearCrdTransf3dWorkspace()
+    :kg(12,12), XAxis(3), YAxis(3), ZAxis(3), dx(3), vAxis(3),
+     xAxis(3), yAxis(3), zAxis(3), ub(6), vb(6), ab(6), pg(12), xz(3),
+     data(23), xg(3), uxg(3) {};
+
+  Matrix kg;
+  Vector XAxis;
+  Vector YAxis;
+  Vector ZAxis;
+  Vector dx;
+  Vector vAxis;
+  Vector xAxis;
+  Vector yAxis;
+  Vector zAxis;
+  Vector ub;
+  Vector vb;
+  Vector ab;
+  Vector pg;
+  Vector xz;
+  Vector data;
+  Vector xg;
+  Vector uxg;
+};
+
+static ThreadWorkspace<LinearCrdTransf3dWorkspace> theWorkspace;
 
 void* OPS_LinearCrdTransf3d()
 {
@@ -194,6 +220,8 @@ LinearCrdTransf3d::revertToStart(void)
 int 
 LinearCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 {       
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int error;
     
     nodeIPtr = nodeIPointer;
@@ -233,9 +261,9 @@ LinearCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     if ((error = this->computeElemtLengthAndOrient()))
         return error;
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    Vector &XAxis = theWork.XAxis;
+    Vector &YAxis = theWork.YAxis;
+    Vector &ZAxis = theWork.ZAxis;
     
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -255,8 +283,10 @@ LinearCrdTransf3d::update(void)
 int 
 LinearCrdTransf3d::computeElemtLengthAndOrient()
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // element projection
-    static Vector dx(3);
+    Vector &dx = theWork.dx;
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -328,16 +358,18 @@ LinearCrdTransf3d::compTransfMatrixLocalGlobal(Matrix &Tlg)
 int
 LinearCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // Compute y = v cross x
     // Note: v(i) is stored in R[2][i]
-    static Vector vAxis(3);
+    Vector &vAxis = theWork.vAxis;
     vAxis(0) = R[2][0];	vAxis(1) = R[2][1];	vAxis(2) = R[2][2];
     
-    static Vector xAxis(3);
+    Vector &xAxis = theWork.xAxis;
     xAxis(0) = R[0][0];	xAxis(1) = R[0][1];	xAxis(2) = R[0][2];
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
     
-    static Vector yAxis(3);
+    Vector &yAxis = theWork.yAxis;
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
     yAxis(2) = vAxis(0)*xAxis(1) - vAxis(1)*xAxis(0);
@@ -355,7 +387,7 @@ LinearCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     YAxis(0) = yAxis(0);    YAxis(1) = yAxis(1);    YAxis(2) = yAxis(2);
     
     // Compute z = x cross y
-    static Vector zAxis(3);
+    Vector &zAxis = theWork.zAxis;
     
     zAxis(0) = xAxis(1)*yAxis(2) - xAxis(2)*yAxis(1);
     zAxis(1) = xAxis(2)*yAxis(0) - xAxis(0)*yAxis(2);
@@ -392,11 +424,13 @@ LinearCrdTransf3d::getDeformedLength(void)
 const Vector &
 LinearCrdTransf3d::getBasicTrialDisp(void)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -414,9 +448,9 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    Vector &ub = theWork.ub;
     
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -434,7 +468,7 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -472,11 +506,13 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
 const Vector &
 LinearCrdTransf3d::getBasicIncrDisp(void)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -484,9 +520,9 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    Vector &ub = theWork.ub;
     
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -504,7 +540,7 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -542,11 +578,13 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
 const Vector &
 LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -554,9 +592,9 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    Vector &ub = theWork.ub;
     
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -574,7 +612,7 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -612,11 +650,13 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
 const Vector &
 LinearCrdTransf3d::getBasicTrialVel(void)
 {
+  LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
 	// determine global velocities
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[12];
+	double vg[12];
 	for (int i = 0; i < 6; i++) {
 		vg[i]   = vel1(i);
 		vg[i+6] = vel2(i);
@@ -624,9 +664,9 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 	
 	double oneOverL = 1.0/L;
 	
-	static Vector vb(6);
+	Vector &vb = theWork.vb;
 	
-	static double vl[12];
+	double vl[12];
 	
 	vl[0]  = R[0][0]*vg[0] + R[0][1]*vg[1] + R[0][2]*vg[2];
 	vl[1]  = R[1][0]*vg[0] + R[1][1]*vg[1] + R[1][2]*vg[2];
@@ -644,7 +684,7 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 	vl[10] = R[1][0]*vg[9] + R[1][1]*vg[10] + R[1][2]*vg[11];
 	vl[11] = R[2][0]*vg[9] + R[2][1]*vg[10] + R[2][2]*vg[11];
 	
-	static double Wu[3];
+	double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*vg[4] - nodeIOffset[1]*vg[5];
 		Wu[1] = -nodeIOffset[2]*vg[3] + nodeIOffset[0]*vg[5];
@@ -682,11 +722,13 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 const Vector &
 LinearCrdTransf3d::getBasicTrialAccel(void)
 {
+  LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
 	// determine global accelerations
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[12];
+	double ag[12];
 	for (int i = 0; i < 6; i++) {
 		ag[i]   = accel1(i);
 		ag[i+6] = accel2(i);
@@ -694,9 +736,9 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 	
 	double oneOverL = 1.0/L;
 	
-	static Vector ab(6);
+	Vector &ab = theWork.ab;
 	
-	static double al[12];
+	double al[12];
 	
 	al[0]  = R[0][0]*ag[0] + R[0][1]*ag[1] + R[0][2]*ag[2];
 	al[1]  = R[1][0]*ag[0] + R[1][1]*ag[1] + R[1][2]*ag[2];
@@ -714,7 +756,7 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 	al[10] = R[1][0]*ag[9] + R[1][1]*ag[10] + R[1][2]*ag[11];
 	al[11] = R[2][0]*ag[9] + R[2][1]*ag[10] + R[2][2]*ag[11];
 	
-	static double Wu[3];
+	double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*ag[4] - nodeIOffset[1]*ag[5];
 		Wu[1] = -nodeIOffset[2]*ag[3] + nodeIOffset[0]*ag[5];
@@ -752,8 +794,10 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 const Vector &
 LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // transform resisting forces from the basic system to local coordinates
-    static double pl[12];
+    double pl[12];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -784,7 +828,7 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[8] += p0(4);
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    Vector &pg = theWork.pg;
     
     pg(0)  = R[0][0]*pl[0] + R[1][0]*pl[1] + R[2][0]*pl[2];
     pg(1)  = R[0][1]*pl[0] + R[1][1]*pl[1] + R[2][1]*pl[2];
@@ -821,9 +865,12 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double kb[6][6];		// Basic stiffness
+    double kl[12][12];	// Local stiffness
+    double tmp[12][12];	// Temporary storage
     double oneOverL = 1.0/L;
     
     int i,j;
@@ -864,7 +911,7 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
             kl[11][i] =  tmp[2][i];
         }
         
-        static double RWI[3][3];
+        double RWI[3][3];
         
         if (nodeIOffset) {
             // Compute RWI
@@ -881,7 +928,7 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
             RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
         }
         
-        static double RWJ[3][3];
+        double RWJ[3][3];
         
         if (nodeJOffset) {
             // Compute RWJ
@@ -970,9 +1017,12 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 const Matrix &
 LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double kb[6][6];		// Basic stiffness
+    double kl[12][12];	// Local stiffness
+    double tmp[12][12];	// Temporary storage
     double oneOverL = 1.0/L;
     
     int i,j;
@@ -1013,7 +1063,7 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
             kl[11][i] =  tmp[2][i];
         }
         
-        static double RWI[3][3];
+        double RWI[3][3];
         
         if (nodeIOffset) {
             // Compute RWI
@@ -1030,7 +1080,7 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
             RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
         }
         
-        static double RWJ[3][3];
+        double RWJ[3][3];
         
         if (nodeJOffset) {
             // Compute RWJ
@@ -1119,11 +1169,13 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 CrdTransf *
 LinearCrdTransf3d::getCopy3d(void)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // create a new instance of LinearCrdTransf3d 
     
     LinearCrdTransf3d *theCopy;
     
-    static Vector xz(3);
+    Vector &xz = theWork.xz;
     xz(0) = R[2][0];
     xz(1) = R[2][1];
     xz(2) = R[2][2];
@@ -1159,9 +1211,11 @@ LinearCrdTransf3d::getCopy3d(void)
 int 
 LinearCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(23);
+    Vector &data = theWork.data;
     data(0) = this->getTag();
     data(1) = L;
     
@@ -1235,9 +1289,11 @@ LinearCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 int 
 LinearCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(23);
+    Vector &data = theWork.data;
     
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -1312,8 +1368,28 @@ LinearCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
 const Matrix &
 LinearCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 {
-    this->compTransfMatrixLocalGlobal(Tlg);  // OPTIMIZE LATER
-    kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);  // OPTIMIZE LATER
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    // kg = Tlg'*ml*Tlg, formed by 3x3 blocks as Tlg is block diagonal in R
+    MatrixND<3,3> Rlg, mlij, kgij;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            Rlg(i,j) = R[i][j];
+
+    for (int bi = 0; bi < 12; bi += 3) {
+        for (int bj = 0; bj < 12; bj += 3) {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    mlij(i,j) = ml(bi+i,bj+j);
+
+            kgij.addMatrixTripleProduct(0.0, Rlg, mlij, 1.0);
+
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    kg(bi+i,bj+j) = kgij(i,j);
+        }
+    }
 
     return kg;
 }
@@ -1322,7 +1398,9 @@ LinearCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 LinearCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &xg = theWork.xg;
     
     //xg = nodeIPtr->getCrds() + nodeIOffset;
     xg = nodeIPtr->getCrds();
@@ -1353,11 +1431,13 @@ LinearCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
+    LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++)
     {
         ug[i]   = disp1(i);
@@ -1378,7 +1458,7 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     
     // transform global end displacements to local coordinates
     //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -1387,7 +1467,7 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     ul[7]  = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
     ul[8]  = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -1408,8 +1488,8 @@ LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // compute displacements at point xi, in local coordinates
-    static double uxl[3];
-    static Vector uxg(3);
+    double uxl[3];
+    Vector &uxg = theWork.uxg;
     
     uxl[0] = uxb(0) +        ul[0];
     uxl[1] = uxb(1) + (1-xi)*ul[1] + xi*ul[7];
@@ -1441,8 +1521,9 @@ LinearCrdTransf3d::Print(OPS_Stream &s, int flag)
 const Vector &
 LinearCrdTransf3d::getBasicDisplSensitivity(int gradNumber)
 {
+  LinearCrdTransf3dWorkspace &theWork = theWorkspace.get();
   
-  static double ug[12];
+  double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]   = nodeIPtr->getDispSensitivity((i+1),gradNumber);
     ug[i+6] = nodeJPtr->getDispSensitivity((i+1),gradNumber);
@@ -1450,9 +1531,9 @@ LinearCrdTransf3d::getBasicDisplSensitivity(int gradNumber)
 
 	double oneOverL = 1.0/L;
 
-	static Vector ub(6);
+	Vector &ub = theWork.ub;
 
-	static double ul[12];
+	double ul[12];
 
 	ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
 	ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -1470,7 +1551,7 @@ LinearCrdTransf3d::getBasicDisplSensitivity(int gradNumber)
 	ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
 	ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
 
-	static double Wu[3];
+	double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
 		Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
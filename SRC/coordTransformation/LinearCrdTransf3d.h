@@ -61,6 +61,7 @@ public:
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void) {return true;}
     
     const Vector &getBasicTrialDisp(void);
     const Vector &getBasicIncrDisp(void);
@@ -103,8 +104,6 @@ private:
     double R[3][3];	 // rotation matrix
     double L;        // undeformed element length
 
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
@@ -37,15 +37,37 @@
 
 #include <Vector.h>
 #include <Matrix.h>
+#include <MatrixND.h>
 #include <Node.h>
 #include <Channel.h>
 #include <elementAPI.h>
 #include <string>
 #include <PDeltaCrdTransf2d.h>
-
-// initialize static variables
-Matrix PDeltaCrdTransf2d::Tlg(6,6);
-Matrix PDeltaCrdTransf2d::kg(6,6);
+#include <ThreadWorkspace.h>
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct PDeltaCrdTransf2dWorkspace {
+  PDeltaCrdTransf2dWorkspace()
+    :kg(6,6), nodeIDisp(3), nodeJDisp(3), dx(2), ub(3), dub(3),
+     Dub(3), vb(3), ab(3), pg(6), data(12), xg(2), ug(6), ul(6) {};
+
+  Matrix kg;
+  Vector nodeIDisp;
+  Vector nodeJDisp;
+  Vector dx;
+  Vector ub;
+  Vector dub;
+  Vector Dub;
+  Vector vb;
+  Vector ab;
+  Vector pg;
+  Vector data;
+  Vector xg;
+  Vector ug;
+  Vector ul;
+};
+
+static ThreadWorkspace<PDeltaCrdTransf2dWorkspace> theWorkspace;
 
 void* OPS_PDeltaCrdTransf2d()
 {
@@ -219,8 +241,10 @@ PDeltaCrdTransf2d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 int
 PDeltaCrdTransf2d::update(void)
 {
-    static Vector nodeIDisp(3);
-    static Vector nodeJDisp(3);
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+    Vector &nodeIDisp = theWork.nodeIDisp;
+    Vector &nodeJDisp = theWork.nodeJDisp;
     nodeIDisp = nodeIPtr->getTrialDisp();
     nodeJDisp = nodeJPtr->getTrialDisp();
     
@@ -259,8 +283,10 @@ PDeltaCrdTransf2d::update(void)
 int 
 PDeltaCrdTransf2d::computeElemtLengthAndOrient()
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // element projection
-    static Vector dx(2);
+    Vector &dx = theWork.dx;
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -337,11 +363,13 @@ PDeltaCrdTransf2d::getDeformedLength(void)
 const Vector &
 PDeltaCrdTransf2d::getBasicTrialDisp(void)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[6];
+    double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
@@ -357,7 +385,7 @@ PDeltaCrdTransf2d::getBasicTrialDisp(void)
             ug[j+3] -= nodeJInitialDisp[j];
     }
     
-    static Vector ub(3);
+    Vector &ub = theWork.ub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -392,17 +420,19 @@ PDeltaCrdTransf2d::getBasicTrialDisp(void)
 const Vector &
 PDeltaCrdTransf2d::getBasicIncrDisp(void)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double dug[6];
+    double dug[6];
     for (int i = 0; i < 3; i++) {
         dug[i]   = disp1(i);
         dug[i+3] = disp2(i);
     }
     
-    static Vector dub(3);
+    Vector &dub = theWork.dub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -437,17 +467,19 @@ PDeltaCrdTransf2d::getBasicIncrDisp(void)
 const Vector &
 PDeltaCrdTransf2d::getBasicIncrDeltaDisp(void)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double Dug[6];
+    double Dug[6];
     for (int i = 0; i < 3; i++) {
         Dug[i]   = disp1(i);
         Dug[i+3] = disp2(i);
     }
     
-    static Vector Dub(3);
+    Vector &Dub = theWork.Dub;
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -482,17 +514,19 @@ PDeltaCrdTransf2d::getBasicIncrDeltaDisp(void)
 const Vector &
 PDeltaCrdTransf2d::getBasicTrialVel(void)
 {
+  PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// determine global velocities
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	double vg[6];
 	for (int i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
 		vg[i+3] = vel2(i);
 	}
 	
-	static Vector vb(3);
+	Vector &vb = theWork.vb;
 	
 	double oneOverL = 1.0/L;
 	double sl = sinTheta*oneOverL;
@@ -527,17 +561,19 @@ PDeltaCrdTransf2d::getBasicTrialVel(void)
 const Vector &
 PDeltaCrdTransf2d::getBasicTrialAccel(void)
 {
+  PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
 	// determine global accelerations
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[6];
+	double ag[6];
 	for (int i = 0; i < 3; i++) {
 		ag[i]   = accel1(i);
 		ag[i+3] = accel2(i);
 	}
 	
-	static Vector ab(3);
+	Vector &ab = theWork.ab;
 	
 	double oneOverL = 1.0/L;
 	double sl = sinTheta*oneOverL;
@@ -572,8 +608,10 @@ PDeltaCrdTransf2d::getBasicTrialAccel(void)
 const Vector &
 PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    double pl[6];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -600,7 +638,7 @@ PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[4] -= NoverL;
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    Vector &pg = theWork.pg;
     
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -632,8 +670,11 @@ PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 PDeltaCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-    static double kl[6][6];
-    static double tmp[6][6];
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double kl[6][6];
+    double tmp[6][6];
     double oneOverL = 1.0/L;
     
     // Basic stiffness
@@ -840,7 +881,10 @@ PDeltaCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 PDeltaCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-    static double tmp [6][6];
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double tmp [6][6];
     double oneOverL = 1.0/L;
     double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
     
@@ -994,9 +1038,11 @@ PDeltaCrdTransf2d::getCopy2d(void)
 int 
 PDeltaCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(12);
+    Vector &data = theWork.data;
     data(0) = this->getTag();
     data(1) = L;
     if (nodeIOffset != 0) {
@@ -1048,9 +1094,11 @@ PDeltaCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 int 
 PDeltaCrdTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(12);
+    Vector &data = theWork.data;
     
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -1121,8 +1169,30 @@ PDeltaCrdTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
 const Matrix &
 PDeltaCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 {
-    this->compTransfMatrixLocalGlobal(Tlg);  // OPTIMIZE LATER
-    kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);  // OPTIMIZE LATER
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    // kg = Tlg'*ml*Tlg, formed by 3x3 blocks as Tlg is block diagonal in R
+    MatrixND<3,3> Rlg, mlij, kgij;
+    Rlg.Zero();
+    Rlg(0,0) = Rlg(1,1) = cosTheta;
+    Rlg(0,1) = sinTheta;
+    Rlg(1,0) = -sinTheta;
+    Rlg(2,2) = 1.0;
+
+    for (int bi = 0; bi < 6; bi += 3) {
+        for (int bj = 0; bj < 6; bj += 3) {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    mlij(i,j) = ml(bi+i,bj+j);
+
+            kgij.addMatrixTripleProduct(0.0, Rlg, mlij, 1.0);
+
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    kg(bi+i,bj+j) = kgij(i,j);
+        }
+    }
 
     return kg;
 }
@@ -1131,7 +1201,9 @@ PDeltaCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 PDeltaCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(2);
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
+    Vector &xg = theWork.xg;
     
     const Vector &nodeICoords = nodeIPtr->getCrds();
     xg(0) = nodeICoords(0);
@@ -1153,11 +1225,13 @@ PDeltaCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
+    PDeltaCrdTransf2dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);
+    Vector &ug = theWork.ug;
     for (int i = 0; i < 3; i++)
     {
         ug(i)   = disp1(i);
@@ -1175,7 +1249,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);      // total displacements
+    Vector &ul = theWork.ul;      // total displacements
     
     ul(0) =  cosTheta*ug(0) + sinTheta*ug(1);
     ul(1) = -sinTheta*ug(0) + cosTheta*ug(1);
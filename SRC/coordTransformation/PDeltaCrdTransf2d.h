@@ -64,6 +64,7 @@ public:
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void) {return true;}
     
     const Vector &getBasicTrialDisp(void);
     const Vector &getBasicIncrDisp(void);
@@ -102,8 +103,6 @@ private:
     double L;     // undeformed element length
     double ul14;  // Transverse local displacement offset of P-Delta
     
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
@@ -36,15 +36,41 @@
 
 #include <Vector.h>
 #include <Matrix.h>
+#include <MatrixND.h>
 #include <Node.h>
 #include <Channel.h>
 #include <elementAPI.h>
 #include <string>
 #include <PDeltaCrdTransf3d.h>
-
-// initialize static variables
-Matrix PDeltaCrdTransf3d::Tlg(12,12);
-Matrix PDeltaCrdTransf3d::kg(12,12);
+#include <ThreadWorkspace.h>
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct PDeltaCrdTransf3dWorkspace {
+  PDeltaCrdTransf3dWorkspace()
+    :kg(12,12), XAxis(3), YAxis(3), ZAxis(3), dx(3), vAxis(3),
+     xAxis(3), yAxis(3), zAxis(3), ub(6), vb(6), ab(6), pg(12), xz(3),
+     data(23), xg(3), uxg(3) {};
+
+  Matrix kg;
+  Vector XAxis;
+  Vector YAxis;
+  Vector ZAxis;
+  Vector dx;
+  Vector vAxis;
+  Vector xAxis;
+  Vector yAxis;
+  Vector zAxis;
+  Vector ub;
+  Vector vb;
+  Vector ab;
+  Vector pg;
+  Vector xz;
+  Vector data;
+  Vector xg;
+  Vector uxg;
+};
+
+static ThreadWorkspace<PDeltaCrdTransf3dWorkspace> theWorkspace;
 
 void* OPS_PDeltaCrdTransf3d()
 {
@@ -196,6 +222,8 @@ PDeltaCrdTransf3d::revertToStart(void)
 int 
 PDeltaCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 {       
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int error;
     
     nodeIPtr = nodeIPointer;
@@ -235,9 +263,9 @@ PDeltaCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     if ((error = this->computeElemtLengthAndOrient()))
         return error;
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    Vector &XAxis = theWork.XAxis;
+    Vector &YAxis = theWork.YAxis;
+    Vector &ZAxis = theWork.ZAxis;
     
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))      
@@ -253,7 +281,7 @@ PDeltaCrdTransf3d::update(void)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -277,7 +305,7 @@ PDeltaCrdTransf3d::update(void)
     ul7 = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
     ul8 = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
     
-    static double Wu[3];
+    double Wu[3];
     
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
@@ -307,8 +335,10 @@ PDeltaCrdTransf3d::update(void)
 int 
 PDeltaCrdTransf3d::computeElemtLengthAndOrient()
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // element projection
-    static Vector dx(3);
+    Vector &dx = theWork.dx;
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -380,16 +410,18 @@ PDeltaCrdTransf3d::compTransfMatrixLocalGlobal(Matrix &Tlg)
 int
 PDeltaCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // Compute y = v cross x
     // Note: v(i) is stored in R[2][i]
-    static Vector vAxis(3);
+    Vector &vAxis = theWork.vAxis;
     vAxis(0) = R[2][0];	vAxis(1) = R[2][1];	vAxis(2) = R[2][2];
     
-    static Vector xAxis(3);
+    Vector &xAxis = theWork.xAxis;
     xAxis(0) = R[0][0];	xAxis(1) = R[0][1];	xAxis(2) = R[0][2];
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
     
-    static Vector yAxis(3);
+    Vector &yAxis = theWork.yAxis;
     
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
@@ -408,7 +440,7 @@ PDeltaCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     YAxis(0) = yAxis(0);    YAxis(1) = yAxis(1);    YAxis(2) = yAxis(2);
     
     // Compute z = x cross y
-    static Vector zAxis(3);
+    Vector &zAxis = theWork.zAxis;
     
     zAxis(0) = xAxis(1)*yAxis(2) - xAxis(2)*yAxis(1);
     zAxis(1) = xAxis(2)*yAxis(0) - xAxis(0)*yAxis(2);
@@ -445,11 +477,13 @@ PDeltaCrdTransf3d::getDeformedLength(void)
 const Vector &
 PDeltaCrdTransf3d::getBasicTrialDisp(void)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -467,9 +501,9 @@ PDeltaCrdTransf3d::getBasicTrialDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    Vector &ub = theWork.ub;
     
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -487,7 +521,7 @@ PDeltaCrdTransf3d::getBasicTrialDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -525,11 +559,13 @@ PDeltaCrdTransf3d::getBasicTrialDisp(void)
 const Vector &
 PDeltaCrdTransf3d::getBasicIncrDisp(void)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -537,9 +573,9 @@ PDeltaCrdTransf3d::getBasicIncrDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    Vector &ub = theWork.ub;
     
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -557,7 +593,7 @@ PDeltaCrdTransf3d::getBasicIncrDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -595,11 +631,13 @@ PDeltaCrdTransf3d::getBasicIncrDisp(void)
 const Vector &
 PDeltaCrdTransf3d::getBasicIncrDeltaDisp(void)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++) {
         ug[i]   = disp1(i);
         ug[i+6] = disp2(i);
@@ -607,9 +645,9 @@ PDeltaCrdTransf3d::getBasicIncrDeltaDisp(void)
     
     double oneOverL = 1.0/L;
     
-    static Vector ub(6);
+    Vector &ub = theWork.ub;
     
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -627,7 +665,7 @@ PDeltaCrdTransf3d::getBasicIncrDeltaDisp(void)
     ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
     ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -665,11 +703,13 @@ PDeltaCrdTransf3d::getBasicIncrDeltaDisp(void)
 const Vector &
 PDeltaCrdTransf3d::getBasicTrialVel(void)
 {
+  PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
 	// determine global velocities
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[12];
+	double vg[12];
 	for (int i = 0; i < 6; i++) {
 		vg[i]   = vel1(i);
 		vg[i+6] = vel2(i);
@@ -677,9 +717,9 @@ PDeltaCrdTransf3d::getBasicTrialVel(void)
 	
 	double oneOverL = 1.0/L;
 	
-	static Vector vb(6);
+	Vector &vb = theWork.vb;
 	
-	static double vl[12];
+	double vl[12];
 	
 	vl[0]  = R[0][0]*vg[0] + R[0][1]*vg[1] + R[0][2]*vg[2];
 	vl[1]  = R[1][0]*vg[0] + R[1][1]*vg[1] + R[1][2]*vg[2];
@@ -697,7 +737,7 @@ PDeltaCrdTransf3d::getBasicTrialVel(void)
 	vl[10] = R[1][0]*vg[9] + R[1][1]*vg[10] + R[1][2]*vg[11];
 	vl[11] = R[2][0]*vg[9] + R[2][1]*vg[10] + R[2][2]*vg[11];
 	
-	static double Wu[3];
+	double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*vg[4] - nodeIOffset[1]*vg[5];
 		Wu[1] = -nodeIOffset[2]*vg[3] + nodeIOffset[0]*vg[5];
@@ -735,11 +775,13 @@ PDeltaCrdTransf3d::getBasicTrialVel(void)
 const Vector &
 PDeltaCrdTransf3d::getBasicTrialAccel(void)
 {
+  PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
 	// determine global accelerations
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[12];
+	double ag[12];
 	for (int i = 0; i < 6; i++) {
 		ag[i]   = accel1(i);
 		ag[i+6] = accel2(i);
@@ -747,9 +789,9 @@ PDeltaCrdTransf3d::getBasicTrialAccel(void)
 	
 	double oneOverL = 1.0/L;
 	
-	static Vector ab(6);
+	Vector &ab = theWork.ab;
 	
-	static double al[12];
+	double al[12];
 	
 	al[0]  = R[0][0]*ag[0] + R[0][1]*ag[1] + R[0][2]*ag[2];
 	al[1]  = R[1][0]*ag[0] + R[1][1]*ag[1] + R[1][2]*ag[2];
@@ -767,7 +809,7 @@ PDeltaCrdTransf3d::getBasicTrialAccel(void)
 	al[10] = R[1][0]*ag[9] + R[1][1]*ag[10] + R[1][2]*ag[11];
 	al[11] = R[2][0]*ag[9] + R[2][1]*ag[10] + R[2][2]*ag[11];
 	
-	static double Wu[3];
+	double Wu[3];
 	if (nodeIOffset) {
 		Wu[0] =  nodeIOffset[2]*ag[4] - nodeIOffset[1]*ag[5];
 		Wu[1] = -nodeIOffset[2]*ag[3] + nodeIOffset[0]*ag[5];
@@ -805,8 +847,10 @@ PDeltaCrdTransf3d::getBasicTrialAccel(void)
 const Vector &
 PDeltaCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // transform resisting forces from the basic system to local coordinates
-    static double pl[12];
+    double pl[12];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -846,7 +890,7 @@ PDeltaCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[8] -= NoverL;
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    Vector &pg = theWork.pg;
     
     pg(0)  = R[0][0]*pl[0] + R[1][0]*pl[1] + R[2][0]*pl[2];
     pg(1)  = R[0][1]*pl[0] + R[1][1]*pl[1] + R[2][1]*pl[2];
@@ -883,9 +927,12 @@ PDeltaCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 PDeltaCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double kb[6][6];		// Basic stiffness
+    double kl[12][12];	// Local stiffness
+    double tmp[12][12];	// Temporary storage
     double oneOverL = 1.0/L;
     
     int i,j;
@@ -937,7 +984,7 @@ PDeltaCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
         kl[2][8] -= NoverL;
         kl[8][2] -= NoverL;
         
-        static double RWI[3][3];
+        double RWI[3][3];
         
         if (nodeIOffset) {
             // Compute RWI
@@ -954,7 +1001,7 @@ PDeltaCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
             RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
         }
         
-        static double RWJ[3][3];
+        double RWJ[3][3];
         
         if (nodeJOffset) {
             // Compute RWJ
@@ -1043,9 +1090,12 @@ PDeltaCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 const Matrix &
 PDeltaCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    double kb[6][6];		// Basic stiffness
+    double kl[12][12];	// Local stiffness
+    double tmp[12][12];	// Temporary storage
     double oneOverL = 1.0/L;
     
     int i,j;
@@ -1098,7 +1148,7 @@ PDeltaCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
         //kl[8][2] -= NoverL;
         
         
-        static double RWI[3][3];
+        double RWI[3][3];
         
         if (nodeIOffset) {
             // Compute RWI
@@ -1115,7 +1165,7 @@ PDeltaCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
             RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
         }
         
-        static double RWJ[3][3];
+        double RWJ[3][3];
         
         if (nodeJOffset) {
             // Compute RWJ
@@ -1205,11 +1255,13 @@ PDeltaCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 CrdTransf *
 PDeltaCrdTransf3d::getCopy3d(void)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // create a new instance of PDeltaCrdTransf3d 
     
     PDeltaCrdTransf3d *theCopy;
     
-    static Vector xz(3);
+    Vector &xz = theWork.xz;
     xz(0) = R[2][0];
     xz(1) = R[2][1];
     xz(2) = R[2][2];
@@ -1248,9 +1300,11 @@ PDeltaCrdTransf3d::getCopy3d(void)
 int 
 PDeltaCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(23);
+    Vector &data = theWork.data;
     data(0) = this->getTag();
     data(1) = L;
     
@@ -1323,9 +1377,11 @@ PDeltaCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 int 
 PDeltaCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
     
-    static Vector data(23);
+    Vector &data = theWork.data;
     
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -1391,8 +1447,28 @@ PDeltaCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
 const Matrix &
 PDeltaCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 {
-    this->compTransfMatrixLocalGlobal(Tlg);  // OPTIMIZE LATER
-    kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);  // OPTIMIZE LATER
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+    Matrix &kg = theWork.kg;
+
+    // kg = Tlg'*ml*Tlg, formed by 3x3 blocks as Tlg is block diagonal in R
+    MatrixND<3,3> Rlg, mlij, kgij;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            Rlg(i,j) = R[i][j];
+
+    for (int bi = 0; bi < 12; bi += 3) {
+        for (int bj = 0; bj < 12; bj += 3) {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    mlij(i,j) = ml(bi+i,bj+j);
+
+            kgij.addMatrixTripleProduct(0.0, Rlg, mlij, 1.0);
+
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    kg(bi+i,bj+j) = kgij(i,j);
+        }
+    }
 
     return kg;
 }
@@ -1401,7 +1477,9 @@ PDeltaCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 PDeltaCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &xg = theWork.xg;
     
     //xg = nodeIPtr->getCrds() + nodeIOffset;
     xg = nodeIPtr->getCrds();
@@ -1425,11 +1503,13 @@ PDeltaCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 PDeltaCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
+    PDeltaCrdTransf3dWorkspace &theWork = theWorkspace.get();
+
     // determine global displacements
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    double ug[12];
     for (int i = 0; i < 6; i++)
     {
         ug[i]   = disp1(i);
@@ -1448,7 +1528,7 @@ PDeltaCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     
     // transform global end displacements to local coordinates
     //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-    static double ul[12];
+    double ul[12];
     
     ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
     ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
@@ -1457,7 +1537,7 @@ PDeltaCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     ul[7]  = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
     ul[8]  = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
     
-    static double Wu[3];
+    double Wu[3];
     if (nodeIOffset) {
         Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
         Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
@@ -1478,8 +1558,8 @@ PDeltaCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // compute displacements at point xi, in local coordinates
-    static double uxl[3];
-    static Vector uxg(3);
+    double uxl[3];
+    Vector &uxg = theWork.uxg;
     
     uxl[0] = uxb(0) +        ul[0];
     uxl[1] = uxb(1) + (1-xi)*ul[1] + xi*ul[7];
@@ -0,0 +1,731 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/database/CheckpointDatastore.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for
+// CheckpointDatastore and for CheckpointImage, the in memory image
+// the domain is sent to and received from.
+//
+// An image file consists of a 32 byte header followed by the records:
+//
+//   header:  char[8] magic "OPSCKPT1", int byteOrder (0x01020304),
+//            int version, int commitTag, int numRecords,
+//            long long number of bytes of record data
+//   record:  int type, int dbTag, int commitTag, int size, int numRows,
+//            int unused, followed by the data padded to 8 bytes
+//
+// where size is the number of ints (ID), doubles (Vector, Matrix) or
+// chars (Message) in the record.
+//
+// What: "@(#) CheckpointDatastore.cpp, revA"
+
+#include <CheckpointDatastore.h>
+#include <Domain.h>
+#include <FEM_ObjectBroker.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <map>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define CHECKPOINT_MAGIC "OPSCKPT1"
+#define CHECKPOINT_VERSION 1
+#define CHECKPOINT_BYTE_ORDER 0x01020304
+
+// size of the blocks handed to fwrite()
+#define CHECKPOINT_WRITE_BLOCK 8388608
+
+enum {CHECKPOINT_ID = 1, CHECKPOINT_VECTOR = 2, 
+      CHECKPOINT_MATRIX = 3, CHECKPOINT_MESSAGE = 4};
+
+struct CheckpointHeader {
+  char magic[8];
+  int byteOrder;
+  int version;
+  int commitTag;
+  int numRecords;
+  long long dataSize;
+};
+
+struct CheckpointRecord {
+  int type;
+  int dbTag;
+  int commitTag;
+  int size;
+  int numRows;
+  int unused;
+};
+
+struct CheckpointKey {
+  int type;
+  int dbTag;
+  int commitTag;
+  int size;
+
+  bool operator<(const CheckpointKey &other) const {
+    if (type != other.type) return type < other.type;
+    if (dbTag != other.dbTag) return dbTag < other.dbTag;
+    if (commitTag != other.commitTag) return commitTag < other.commitTag;
+    return size < other.size;
+  }
+};
+
+static long
+recordLength(int type, int size)
+{
+  long numBytes = size;
+  if (type == CHECKPOINT_ID)
+    numBytes *= sizeof(int);
+  else if (type != CHECKPOINT_MESSAGE)
+    numBytes *= sizeof(double);
+
+  return sizeof(CheckpointRecord) + ((numBytes + 7)/8)*8;
+}
+
+//
+// CheckpointImage - a channel whose records are kept in one contiguous
+// block of memory. A record sent again with the same dbTag, commitTag
+// and size replaces the old one in place.
+//
+
+class CheckpointImage: public FE_Datastore
+{
+  public:
+    CheckpointImage(Domain &theDomain, FEM_ObjectBroker &theBroker);
+    ~CheckpointImage();
+
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, Message &, ChannelAddress *theAddress =0);        
+    int sendMatrix(int dbTag, int commitTag, const Matrix &, ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, Matrix &, ChannelAddress *theAddress =0);
+    int sendVector(int dbTag, int commitTag, const Vector &, ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, Vector &, ChannelAddress *theAddress =0);
+    int sendID(int dbTag, int commitTag, const ID &, ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, ID &, ChannelAddress *theAddress =0);
+
+    int write(const char *fileName, int commitTag);
+    int read(const char *fileName);
+
+  private:
+    char *addRecord(int type, int dbTag, int commitTag, int size, int numRows);
+    const CheckpointRecord *findRecord(int type, int dbTag, int commitTag, int size);
+
+    std::map<CheckpointKey, long> theIndex;
+
+    char *records;       // start of the record data
+    long dataSize;       // bytes of record data
+    long dataCapacity;   // bytes allocated, 0 if records is mapped
+
+    void *mapping;       // the mapped file when read()
+    long mapLength;
+};
+
+CheckpointImage::CheckpointImage(Domain &theDomain, FEM_ObjectBroker &theBroker)
+  :FE_Datastore(theDomain, theBroker), 
+   records(0), dataSize(0), dataCapacity(0), mapping(0), mapLength(0)
+{
+
+}
+
+CheckpointImage::~CheckpointImage()
+{
+  if (mapping != 0) {
+#ifdef _WIN32
+    delete [] (char *)mapping;
+#else
+    munmap(mapping, mapLength);
+#endif
+  } else if (records != 0)
+    delete [] records;
+}
+
+char *
+CheckpointImage::addRecord(int type, int dbTag, int commitTag, int size, int numRows)
+{
+  if (mapping != 0) {
+    opserr << "CheckpointImage::addRecord() - image is read only\n";
+    return 0;
+  }
+
+  CheckpointKey key;
+  key.type = type;
+  key.dbTag = dbTag;
+  key.commitTag = commitTag;
+  key.size = size;
+
+  long length = recordLength(type, size);
+
+  // reuse the old record if the object has been sent before
+  long offset;
+  std::map<CheckpointKey, long>::iterator theRecord = theIndex.find(key);
+  if (theRecord != theIndex.end()) 
+    offset = theRecord->second;
+  else {
+    if (dataSize + length > dataCapacity) {
+      long newCapacity = (dataCapacity == 0) ? 1048576 : 2*dataCapacity;
+      while (newCapacity < dataSize + length)
+	newCapacity *= 2;
+      char *newRecords = new char[newCapacity];
+      if (newRecords == 0) {
+	opserr << "CheckpointImage::addRecord() - ran out of memory for " << newCapacity << " bytes\n";
+	return 0;
+      }
+      if (records != 0) {
+	memcpy(newRecords, records, dataSize);
+	delete [] records;
+      }
+      records = newRecords;
+      dataCapacity = newCapacity;
+    }
+    offset = dataSize;
+    dataSize += length;
+    theIndex[key] = offset;
+  }
+
+  CheckpointRecord *theHeader = (CheckpointRecord *)(records + offset);
+  theHeader->type = type;
+  theHeader->dbTag = dbTag;
+  theHeader->commitTag = commitTag;
+  theHeader->size = size;
+  theHeader->numRows = numRows;
+  theHeader->unused = 0;
+
+  return records + offset + sizeof(CheckpointRecord);
+}
+
+const CheckpointRecord *
+CheckpointImage::findRecord(int type, int dbTag, int commitTag, int size)
+{
+  CheckpointKey key;
+  key.type = type;
+  key.dbTag = dbTag;
+  key.commitTag = commitTag;
+  key.size = size;
+
+  std::map<CheckpointKey, long>::iterator theRecord = theIndex.find(key);
+  if (theRecord == theIndex.end())
+    return 0;
+
+  return (const CheckpointRecord *)(records + theRecord->second);
+}
+
+int 
+CheckpointImage::sendMsg(int dbTag, int commitTag, const Message &theMessage, ChannelAddress *theAddress)
+{
+  Message &msg = const_cast<Message &>(theMessage);
+  int size = msg.getSize();
+  char *to = this->addRecord(CHECKPOINT_MESSAGE, dbTag, commitTag, size, 0);
+  if (to == 0)
+    return -1;
+
+  if (size > 0)
+    memcpy(to, msg.getData(), size);
+
+  return 0;
+}
+
+int 
+CheckpointImage::recvMsg(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  int size = theMessage.getSize();
+  const CheckpointRecord *theRecord = this->findRecord(CHECKPOINT_MESSAGE, dbTag, commitTag, size);
+  if (theRecord == 0)
+    return -1;
+
+  if (size > 0)
+    memcpy((char *)theMessage.getData(), (const char *)(theRecord+1), size);
+
+  return 0;
+}
+
+int 
+CheckpointImage::recvMsgUnknownSize(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  opserr << "CheckpointImage::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}
+
+int 
+CheckpointImage::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  int numRows = theMatrix.noRows();
+  int numCols = theMatrix.noCols();
+  double *to = (double *)this->addRecord(CHECKPOINT_MATRIX, dbTag, commitTag, numRows*numCols, numRows);
+  if (to == 0)
+    return -1;
+
+  for (int j=0; j<numCols; j++)
+    for (int i=0; i<numRows; i++)
+      *to++ = theMatrix(i,j);
+
+  return 0;
+}
+
+int 
+CheckpointImage::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  int numRows = theMatrix.noRows();
+  int numCols = theMatrix.noCols();
+  const CheckpointRecord *theRecord = this->findRecord(CHECKPOINT_MATRIX, dbTag, commitTag, numRows*numCols);
+  if (theRecord == 0 || theRecord->numRows != numRows)
+    return -1;
+
+  const double *from = (const double *)(theRecord+1);
+  for (int j=0; j<numCols; j++)
+    for (int i=0; i<numRows; i++)
+      theMatrix(i,j) = *from++;
+
+  return 0;
+}
+
+int 
+CheckpointImage::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  double *to = (double *)this->addRecord(CHECKPOINT_VECTOR, dbTag, commitTag, size, 0);
+  if (to == 0)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    to[i] = theVector(i);
+
+  return 0;
+}
+
+int 
+CheckpointImage::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  const CheckpointRecord *theRecord = this->findRecord(CHECKPOINT_VECTOR, dbTag, commitTag, size);
+  if (theRecord == 0)
+    return -1;
+
+  const double *from = (const double *)(theRecord+1);
+  for (int i=0; i<size; i++)
+    theVector(i) = from[i];
+
+  return 0;
+}
+
+int 
+CheckpointImage::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  int *to = (int *)this->addRecord(CHECKPOINT_ID, dbTag, commitTag, size, 0);
+  if (to == 0)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    to[i] = theID(i);
+
+  return 0;
+}
+
+int 
+CheckpointImage::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  const CheckpointRecord *theRecord = this->findRecord(CHECKPOINT_ID, dbTag, commitTag, size);
+  if (theRecord == 0)
+    return -1;
+
+  const int *from = (const int *)(theRecord+1);
+  for (int i=0; i<size; i++)
+    theID(i) = from[i];
+
+  return 0;
+}
+
+int
+CheckpointImage::write(const char *fileName, int commitTag)
+{
+  CheckpointHeader theHeader;
+  memcpy(theHeader.magic, CHECKPOINT_MAGIC, 8);
+  theHeader.byteOrder = CHECKPOINT_BYTE_ORDER;
+  theHeader.version = CHECKPOINT_VERSION;
+  theHeader.commitTag = commitTag;
+  theHeader.numRecords = theIndex.size();
+  theHeader.dataSize = dataSize;
+
+  // write to a temporary file, renamed once the image is complete
+  char *tmpName = new char[strlen(fileName)+5];
+  strcpy(tmpName, fileName);
+  strcat(tmpName, ".tmp");
+
+  FILE *theFile = fopen(tmpName, "wb");
+  if (theFile == 0) {
+    opserr << "CheckpointImage::write() - could not open file " << tmpName << endln;
+    delete [] tmpName;
+    return -1;
+  }
+
+  int res = 0;
+  if (fwrite(&theHeader, sizeof(CheckpointHeader), 1, theFile) != 1)
+    res = -1;
+
+  for (long pos = 0; pos < dataSize && res == 0; pos += CHECKPOINT_WRITE_BLOCK) {
+    long numBytes = dataSize - pos;
+    if (numBytes > CHECKPOINT_WRITE_BLOCK)
+      numBytes = CHECKPOINT_WRITE_BLOCK;
+    if (fwrite(records + pos, 1, numBytes, theFile) != (size_t)numBytes)
+      res = -1;
+  }
+
+  if (fclose(theFile) != 0)
+    res = -1;
+
+  if (res == 0 && rename(tmpName, fileName) != 0)
+    res = -1;
+
+  if (res != 0) {
+    opserr << "CheckpointImage::write() - failed to write file " << fileName << endln;
+    remove(tmpName);
+  }
+
+  delete [] tmpName;
+  return res;
+}
+
+int
+CheckpointImage::read(const char *fileName)
+{
+  long fileLength = 0;
+  char *theImage = 0;
+
+#ifdef _WIN32
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0) {
+    opserr << "CheckpointImage::read() - could not open file " << fileName << endln;
+    return -1;
+  }
+  fseek(theFile, 0, SEEK_END);
+  fileLength = ftell(theFile);
+  fseek(theFile, 0, SEEK_SET);
+  theImage = new char[fileLength];
+  if (fread(theImage, 1, fileLength, theFile) != (size_t)fileLength) {
+    opserr << "CheckpointImage::read() - could not read file " << fileName << endln;
+    delete [] theImage;
+    fclose(theFile);
+    return -1;
+  }
+  fclose(theFile);
+#else
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0) {
+    opserr << "CheckpointImage::read() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  struct stat theStat;
+  if (fstat(fd, &theStat) != 0 || theStat.st_size < (long)sizeof(CheckpointHeader)) {
+    opserr << "CheckpointImage::read() - file " << fileName << " is not a checkpoint\n";
+    close(fd);
+    return -1;
+  }
+  fileLength = theStat.st_size;
+
+  void *theMap = mmap(0, fileLength, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (theMap == MAP_FAILED) {
+    opserr << "CheckpointImage::read() - could not map file " << fileName << endln;
+    return -1;
+  }
+  madvise(theMap, fileLength, MADV_SEQUENTIAL);
+  theImage = (char *)theMap;
+#endif
+
+  mapping = theImage;
+  mapLength = fileLength;
+
+  const CheckpointHeader *theHeader = (const CheckpointHeader *)theImage;
+  if (fileLength < (long)sizeof(CheckpointHeader) ||
+      memcmp(theHeader->magic, CHECKPOINT_MAGIC, 8) != 0 ||
+      theHeader->version != CHECKPOINT_VERSION) {
+    opserr << "CheckpointImage::read() - file " << fileName << " is not a checkpoint\n";
+    return -1;
+  }
+  if (theHeader->byteOrder != CHECKPOINT_BYTE_ORDER) {
+    opserr << "CheckpointImage::read() - file " << fileName << " was written on a machine with a different byte order\n";
+    return -1;
+  }
+  if (theHeader->dataSize > fileLength - (long)sizeof(CheckpointHeader)) {
+    opserr << "CheckpointImage::read() - file " << fileName << " is truncated\n";
+    return -1;
+  }
+
+  records = theImage + sizeof(CheckpointHeader);
+  dataSize = theHeader->dataSize;
+
+  // build the index
+  long pos = 0;
+  int numRecords = 0;
+  while (pos + (long)sizeof(CheckpointRecord) <= dataSize) {
+    const CheckpointRecord *theRecord = (const CheckpointRecord *)(records + pos);
+    CheckpointKey key;
+    key.type = theRecord->type;
+    key.dbTag = theRecord->dbTag;
+    key.commitTag = theRecord->commitTag;
+    key.size = theRecord->size;
+    theIndex[key] = pos;
+    pos += recordLength(theRecord->type, theRecord->size);
+    numRecords++;
+  }
+
+  if (pos != dataSize || numRecords != theHeader->numRecords) {
+    opserr << "CheckpointImage::read() - file " << fileName << " is corrupt\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+//
+// CheckpointDatastore
+//
+
+CheckpointDatastore::CheckpointDatastore(const char *name,
+					 Domain &domain, 
+					 FEM_ObjectBroker &broker,
+					 bool useThread)
+  :FE_Datastore(domain, broker), fileName(0), theDomain(&domain), theBroker(&broker),
+   async(useThread), writeImage(0), writeFileName(0), writeCommitTag(0), writeError(0)
+{
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+#ifdef _WIN32
+  async = false;
+#else
+  writerRunning = false;
+#endif
+}
+
+CheckpointDatastore::~CheckpointDatastore()
+{
+  this->waitForWriter();
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+char *
+CheckpointDatastore::getFileName(int commitTag)
+{
+  char *theName = new char[strlen(fileName)+16];
+  sprintf(theName, "%s.%d", fileName, commitTag);
+  return theName;
+}
+
+#ifndef _WIN32
+void *
+CheckpointDatastore::writer(void *data)
+{
+  CheckpointDatastore *self = (CheckpointDatastore *)data;
+  self->writeError = self->writeImage->write(self->writeFileName, self->writeCommitTag);
+  return 0;
+}
+#endif
+
+int
+CheckpointDatastore::waitForWriter(void)
+{
+#ifndef _WIN32
+  if (writerRunning == true) {
+    pthread_join(theWriter, 0);
+    writerRunning = false;
+  }
+#endif
+
+  int res = 0;
+  if (writeImage != 0) {
+    if (writeError < 0) {
+      opserr << "WARNING CheckpointDatastore - failed to write checkpoint " << writeFileName << endln;
+      res = -1;
+    }
+    delete writeImage;
+    writeImage = 0;
+  }
+
+  if (writeFileName != 0) {
+    delete [] writeFileName;
+    writeFileName = 0;
+  }
+
+  writeError = 0;
+  return res;
+}
+
+int
+CheckpointDatastore::commitState(int commitTag)
+{
+  // only one image is in flight; a failure writing the last one is
+  // reported here but does not stop this checkpoint being taken
+  this->waitForWriter();
+
+  // the image is a new channel, so the domain sends its geometry as well
+  CheckpointImage *theImage = new CheckpointImage(*theDomain, *theBroker);
+  if (theImage->commitState(commitTag) < 0) {
+    opserr << "CheckpointDatastore::commitState() - domain failed to sendSelf\n";
+    delete theImage;
+    return -1;
+  }
+
+  char *theFileName = this->getFileName(commitTag);
+
+#ifndef _WIN32
+  if (async == true) {
+    writeImage = theImage;
+    writeFileName = theFileName;
+    writeCommitTag = commitTag;
+    if (pthread_create(&theWriter, 0, CheckpointDatastore::writer, this) == 0) {
+      writerRunning = true;
+      return 0;
+    }
+    writeImage = 0;
+    writeFileName = 0;
+  }
+#endif
+
+  int res = theImage->write(theFileName, commitTag);
+  delete theImage;
+  delete [] theFileName;
+
+  return res;
+}
+
+int
+CheckpointDatastore::restoreState(int commitTag)
+{
+  // the file may still be being written
+  this->waitForWriter();
+
+  char *theFileName = this->getFileName(commitTag);
+
+  CheckpointImage *theImage = new CheckpointImage(*theDomain, *theBroker);
+  int res = theImage->read(theFileName);
+  if (res == 0) {
+    res = theImage->restoreState(commitTag);
+    if (res < 0)
+      opserr << "CheckpointDatastore::restoreState() - domain failed to recvSelf from " << theFileName << endln;
+  }
+
+  delete theImage;
+  delete [] theFileName;
+
+  return res;
+}
+
+int 
+CheckpointDatastore::sendMsg(int dataTag, int commitTag, 
+			     const Message &, 
+			     ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::sendMsg() - data can only be stored using commitState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::recvMsg(int dataTag, int commitTag, 
+			     Message &, 
+			     ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::recvMsg() - data can only be restored using restoreState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+					Message &, 
+					ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::recvMsgUnknownSize() - data can only be restored using restoreState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::sendMatrix(int dataTag, int commitTag, 
+				const Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::sendMatrix() - data can only be stored using commitState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::recvMatrix(int dataTag, int commitTag, 
+				Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::recvMatrix() - data can only be restored using restoreState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::sendVector(int dataTag, int commitTag, 
+				const Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::sendVector() - data can only be stored using commitState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::recvVector(int dataTag, int commitTag, 
+				Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::recvVector() - data can only be restored using restoreState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::sendID(int dataTag, int commitTag, 
+			    const ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::sendID() - data can only be stored using commitState()\n";
+  return -1;
+}		       
+
+int 
+CheckpointDatastore::recvID(int dataTag, int commitTag, 
+			    ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  opserr << "CheckpointDatastore::recvID() - data can only be restored using restoreState()\n";
+  return -1;
+}		       
@@ -0,0 +1,131 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/database/CheckpointDatastore.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// CheckpointDatastore. CheckpointDatastore is a concrete subclass of
+// FE_Datastore used to checkpoint a domain during a long analysis and
+// to restart it later. On commitState(commitTag) the geometry and the
+// committed state of the domain, i.e. everything the nodes, elements,
+// materials and sections send in sendSelf() together with the analysis
+// time, is collected in memory into a single contiguous image which is
+// then written to the file "fileName.commitTag" with a few large
+// sequential writes. The image is written to a temporary file that is
+// renamed when complete, so an interrupted write never destroys an
+// earlier checkpoint. If asynchronous output is requested the image is
+// written by a background thread while the analysis continues; at most
+// one image is in flight at any time. On restoreState(commitTag) the
+// file is mapped into memory and the domain is rebuilt from it.
+//
+// Every image holds the complete geometry of the domain, so a restart
+// needs only the one file. Images are written in the byte order of the
+// machine and can only be read back on a machine with the same.
+//
+// What: "@(#) CheckpointDatastore.h, revA"
+
+#ifndef CheckpointDatastore_h
+#define CheckpointDatastore_h
+
+#include <FE_Datastore.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class FEM_ObjectBroker;
+class CheckpointImage;
+
+class CheckpointDatastore: public FE_Datastore
+{
+  public:
+    CheckpointDatastore(const char *fileName,
+			Domain &theDomain, 
+			FEM_ObjectBroker &theBroker,
+			bool async = false);
+    ~CheckpointDatastore();
+
+    // methods for sending and receiving the data; objects send to the
+    // image built in commitState() and so these are not used directly
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    // the commitState and restoreState methods
+    int commitState(int commitTag);        
+    int restoreState(int commitTag);        
+    
+  protected:
+
+  private:
+    char *getFileName(int commitTag);
+    int waitForWriter(void);
+
+    char *fileName;
+    Domain *theDomain;
+    FEM_ObjectBroker *theBroker;
+    bool async;
+
+    // the image being written in the background
+    CheckpointImage *writeImage;
+    char *writeFileName;
+    int writeCommitTag;
+    int writeError;
+
+#ifndef _WIN32
+    static void *writer(void *);
+
+    pthread_t theWriter;
+    bool writerRunning;
+#endif
+};
+
+#endif
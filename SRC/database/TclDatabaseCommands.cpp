@@ -46,6 +46,7 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <CheckpointDatastore.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -96,7 +97,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
 
   // make sure at least one other argument to contain integrator
   if (argc < 2) {
-    opserr << "WARNING need to specify a Database type; valid type File, MySQL, BerkeleyDB \n";
+    opserr << "WARNING need to specify a Database type; valid type File, Checkpoint, MySQL, BerkeleyDB \n";
     return TCL_ERROR;
   }    
 
@@ -123,6 +124,36 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
       return TCL_ERROR;
     } 
     
+    return TCL_OK;
+
+  // a Checkpoint Database
+  } else if (strcmp(argv[1],"Checkpoint") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING database Checkpoint fileName? <-async>";
+      return TCL_ERROR;
+    }    
+
+    bool async = false;
+    for (int i=3; i<argc; i++) {
+      if (strcmp(argv[i],"-async") == 0)
+	async = true;
+      else {
+	opserr << "WARNING database Checkpoint fileName? <-async> - unknown option " << argv[i] << endln;
+	return TCL_ERROR;
+      }
+    }
+
+    // delete the old database
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    theDatabase = new CheckpointDatastore(argv[2], theDomain, theBroker, async);
+    // check we instantiated a database .. if not ran out of memory
+    if (theDatabase == 0) {
+      opserr << "WARNING ran out of memory - database Checkpoint " << argv[2] << endln;
+      return TCL_ERROR;
+    } 
+    
     return TCL_OK;
   } else {
 
@@ -173,7 +204,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
     }
   }
   opserr << "WARNING No database type exists ";
-  opserr << "for database of type:" << argv[1] << "valid database type File\n";
+  opserr << "for database of type:" << argv[1] << "valid database type File, Checkpoint\n";
 
   return TCL_ERROR;
 }    
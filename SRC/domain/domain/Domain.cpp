@@ -34,6 +34,9 @@
 
 #include <stdlib.h>
 #include <math.h>
+#ifndef _WIN32
+#include <time.h>
+#endif
 
 #include <OPS_Globals.h>
 #include <Domain.h>
@@ -74,6 +77,8 @@
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <ThreadPool.h>
+#include <ResponseGather.h>
 
 //
 // global variables
@@ -83,6 +88,48 @@ Domain       *ops_TheActiveDomain = 0;
 double        ops_Dt = 0.0;
 bool          ops_InitialStateAnalysis = false;
 
+// wall clock time in seconds, fine enough to time a single ele update
+static double
+getElementClock(void)
+{
+#ifdef _WIN32
+  return 0.0;
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1.0e-9*t.tv_nsec;
+#endif
+}
+
+// ThreadTask used by Domain::update() when the ele's are updated by
+// threads; each thread works on its own contiguous block of theEleArray
+class DomainUpdateTask : public ThreadTask
+{
+ public:
+  DomainUpdateTask(Element **theEles, int *theResults, double *theCosts)
+    :theEleArray(theEles), theEleResults(theResults), theEleCosts(theCosts) {};
+
+  int execute(int start, int end, int threadID) {
+    int ok = 0;
+    for (int i=start; i<end; i++) {
+      if (theEleCosts != 0) {
+	double startTime = getElementClock();
+	theEleResults[i] = theEleArray[i]->update();
+	theEleCosts[i] += getElementClock() - startTime;
+      } else
+	theEleResults[i] = theEleArray[i]->update();
+      ok += theEleResults[i];
+    }
+    return ok;
+  };
+
+ private:
+  Element **theEleArray;
+  int *theEleResults;
+  double *theEleCosts;
+};
+
+
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
@@ -90,6 +137,9 @@ Domain::Domain()
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
+ eleArrayBuiltFlag(false), theEleArray(0), theEleResults(0), numEleArray(0),
+ numThreadSafeEleArray(0), measureEleCosts(false), theEleCosts(0),
+ theGather(0), gatherPlanTag(-1),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -145,6 +195,9 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0),
+ eleArrayBuiltFlag(false), theEleArray(0), theEleResults(0), numEleArray(0),
+ numThreadSafeEleArray(0), measureEleCosts(false), theEleCosts(0),
+ theGather(0), gatherPlanTag(-1),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -200,6 +253,9 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
+ eleArrayBuiltFlag(false), theEleArray(0), theEleResults(0), numEleArray(0),
+ numThreadSafeEleArray(0), measureEleCosts(false), theEleCosts(0),
+ theGather(0), gatherPlanTag(-1),
  theElements(&theElementsStorage),
  theNodes(&theNodesStorage),
  theSPs(&theSPsStorage),
@@ -263,6 +319,9 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
+ eleArrayBuiltFlag(false), theEleArray(0), theEleResults(0), numEleArray(0),
+ numThreadSafeEleArray(0), measureEleCosts(false), theEleCosts(0),
+ theGather(0), gatherPlanTag(-1),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -373,6 +432,15 @@ Domain::~Domain()
 
   if (theModalDampingFactors != 0)
     delete theModalDampingFactors;
+
+  if (theEleArray != 0)
+    delete [] theEleArray;
+
+  if (theEleResults != 0)
+    delete [] theEleResults;
+
+  if (theEleCosts != 0)
+    delete [] theEleCosts;
   
   int i;
   for (i=0; i<numRecorders; i++) 
@@ -383,6 +451,9 @@ Domain::~Domain()
     delete [] theRecorders;
     theRecorders = 0;
   }
+
+  if (theGather != 0)
+    delete theGather;
   
   for (i=0; i<numRegions; i++)  
     delete theRegions[i];
@@ -952,6 +1023,9 @@ Domain::clearAll(void) {
     theRecorders = 0;
   }
 
+  if (theGather != 0)
+    theGather->clear();
+
   for (i=0; i<numRegions; i++)
     delete theRegions[i];
   numRegions = 0;
@@ -981,6 +1055,7 @@ Domain::clearAll(void) {
   hasDomainChangedFlag = false;
   nodeGraphBuiltFlag = false;
   eleGraphBuiltFlag = false;
+  eleArrayBuiltFlag = false;
   
   dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; dbMPs =0; dbLPs = 0; dbParam = 0;
 
@@ -1017,6 +1092,7 @@ Domain::removeElement(int tag)
 
   // otherwise mark the domain as having changed
   this->domainChange();
+  eleArrayBuiltFlag = false;
   
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
@@ -1525,6 +1601,12 @@ Domain::getCurrentTime(void) const
     return currentTime;
 }
 
+double
+Domain::getCommittedTime(void) const
+{
+    return committedTime;
+}
+
 int
 Domain::getCommitTag(void) const
 {
@@ -1786,7 +1868,10 @@ Domain::applyLoad(double timeStep)
       theSP->applyConstraint(timeStep);
     }
 
-    ops_Dt = dT;
+    // as in update(), the global is not set from a thread of the pool
+    ThreadPool *thePool = ThreadPool::getThreadPool();
+    if (thePool == 0 || thePool->isRunning() == false)
+      ops_Dt = dT;
 }
 
 
@@ -1858,10 +1943,15 @@ Domain::record(bool fromAnalysis)
 {
   int res = 0;
 
-  // invoke record on all recorders
+  // fetch the responses of the recorders, then invoke record on all
+  this->gatherRecorderResponses();
+
   for (int i=0; i<numRecorders; i++)
     if (theRecorders[i] != 0)
       res += theRecorders[i]->record(commitTag, currentTime);
+
+  if (theGather != 0)
+    theGather->release();
   
   // update the commitTag
   commitTag++;
@@ -1891,16 +1981,42 @@ Domain::commit(void)
     committedTime = currentTime;
     dT = 0.0;
 
-    // invoke record on all recorders
+    // fetch the responses of the recorders, then invoke record on all
+    this->gatherRecorderResponses();
+
     for (int i=0; i<numRecorders; i++)
       if (theRecorders[i] != 0)
 	theRecorders[i]->record(commitTag, currentTime);
 
+    if (theGather != 0)
+      theGather->release();
+
     // update the commitTag
     commitTag++;
     return 0;
 }
 
+int
+Domain::gatherRecorderResponses(void)
+{
+  if (numRecorders == 0)
+    return 0;
+
+  if (theGather == 0)
+    theGather = new ResponseGather();
+
+  // (re)build the plan if the domain or the recorders have changed
+  if (gatherPlanTag != theGather->getPlanTag()) {
+    theGather->clear();
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != 0)
+	theRecorders[i]->addToGather(*theGather);
+    gatherPlanTag = theGather->getPlanTag();
+  }
+
+  return theGather->gather(*this, currentTime);
+}
+
 int
 Domain::revertToLastCommit(void)
 {
@@ -1968,19 +2084,54 @@ Domain::revertToStart(void)
 int
 Domain::update(void)
 {
-  // set the global constants
-  ops_Dt = dT;
-  ops_TheActiveDomain = this;
+  // set the global constants, unless this is one of several domains
+  // being updated on the ThreadPool (see ThreadedSubdomain), when the
+  // thread that started the pool has set them
+  ThreadPool *thePool = ThreadPool::getThreadPool();
+  bool setGlobals = (thePool == 0 || thePool->isRunning() == false);
+  if (setGlobals == true) {
+    ops_Dt = dT;
+    ops_TheActiveDomain = this;
+  }
 
   int ok = 0;
 
-  // invoke update on all the ele's
-  ElementIter &theEles = this->getElements();
-  Element *theEle;
+  // if threads have been requested, split the ele's among the threads;
+  // the ele array is also used when the cost of each ele is measured
+  if (thePool != 0 || measureEleCosts == true) {
+    if (eleArrayBuiltFlag == false || numEleArray != theElements->getNumComponents())
+      this->buildEleArray();
+
+    // only the ele's that are thread safe, which buildEleArray() puts
+    // at the front of the array, are given to the threads
+    DomainUpdateTask theTask(theEleArray, theEleResults, theEleCosts);
+    if (thePool != 0) {
+      ok = thePool->run(theTask, numThreadSafeEleArray);
+      ok += theTask.execute(numThreadSafeEleArray, numEleArray, 0);
+    } else
+      ok = theTask.execute(0, numEleArray, 0);
+
+    // the ele's were not updated in order, so set the active element
+    // to the first that failed (or the last, as a serial update would)
+    if (numEleArray != 0 && setGlobals == true)
+      ops_TheActiveElement = theEleArray[numEleArray-1];
+    if (setGlobals == true)
+      for (int i=0; i<numEleArray; i++)
+	if (theEleResults[i] != 0) {
+	  ops_TheActiveElement = theEleArray[i];
+	  break;
+	}
+
+  } else {
+
+    // invoke update on all the ele's
+    ElementIter &theEles = this->getElements();
+    Element *theEle;
 
-  while ((theEle = theEles()) != 0) {
-    ops_TheActiveElement = theEle;
-    ok += theEle->update();
+    while ((theEle = theEles()) != 0) {
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
   }
 
   if (ok != 0)
@@ -2141,6 +2292,11 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    eleArrayBuiltFlag = false;
+
+    // the recorders may refer to different nodes and elements
+    if (theGather != 0)
+      theGather->clear();
 }
 
 
@@ -2163,6 +2319,7 @@ Domain::hasDomainChanged(void)
 	currentGeoTag++;
 	nodeGraphBuiltFlag = false;
 	eleGraphBuiltFlag = false;
+	eleArrayBuiltFlag = false;
     }
 
     // return the integer so user can determine if domain has changed 
@@ -2247,6 +2404,8 @@ Domain::addRecorder(Recorder &theRecorder)
   for (int i=0; i<numRecorders; i++) {
     if (theRecorders[i] == 0) {
       theRecorders[i] = &theRecorder;
+      if (theGather != 0)
+	theGather->clear();
       return 0;
     }
   }
@@ -2266,6 +2425,10 @@ Domain::addRecorder(Recorder &theRecorder)
   
   theRecorders = newRecorders;
   numRecorders++;
+
+  if (theGather != 0)
+    theGather->clear();
+
   return 0;
 }
 
@@ -2283,6 +2446,52 @@ Domain::removeRecorders(void)
   
     theRecorders = 0;
     numRecorders = 0;
+
+    if (theGather != 0)
+      theGather->clear();
+
+    return 0;
+}
+
+// int recordersDomainChanged(void);
+//	invokes domainChanged() on the recorders, for a change they must
+//	pick up before they next record, such as the moving of elements
+//	and nodes between subdomains which deletes those they refer to.
+
+int
+Domain::recordersDomainChanged(void)
+{
+    int result = 0;
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != 0)
+	if (theRecorders[i]->domainChanged() < 0) {
+	  opserr << "Domain::recordersDomainChanged() - recorder ";
+	  opserr << theRecorders[i]->getTag() << " failed in domainChanged()\n";
+	  result = -1;
+	}
+
+    // the recorders may refer to different nodes and elements
+    if (theGather != 0)
+      theGather->clear();
+
+    return result;
+}
+
+// int detachRecorders(void);
+//	drops the recorders from the domain without deleting them; used in
+//	a copy of the program made by fork(), whose recorders share their
+//	files with those of the parent and must neither write to nor close
+//	them.
+
+int
+Domain::detachRecorders(void)
+{
+    theRecorders = 0;
+    numRecorders = 0;
+
+    if (theGather != 0)
+      theGather->clear();
+
     return 0;
 }
 
@@ -2294,6 +2503,8 @@ Domain::removeRecorder(int tag)
       if (theRecorders[i]->getTag() == tag) {
 	delete theRecorders[i];
 	theRecorders[i] = 0;
+	if (theGather != 0)
+	  theGather->clear();
 	return 0;
       }
     }    
@@ -2514,6 +2725,90 @@ Domain::buildEleGraph(Graph *theEleGraph)
 
 }
 
+int
+Domain::buildEleArray(void)
+{
+  if (theEleArray != 0)
+    delete [] theEleArray;
+  if (theEleResults != 0)
+    delete [] theEleResults;
+  if (theEleCosts != 0)
+    delete [] theEleCosts;
+
+  numEleArray = theElements->getNumComponents();
+  theEleArray = 0;
+  theEleResults = 0;
+  theEleCosts = 0;
+
+  if (numEleArray != 0) {
+    theEleArray = new Element *[numEleArray];
+    theEleResults = new int[numEleArray];
+    if (measureEleCosts == true) {
+      theEleCosts = new double[numEleArray];
+      for (int i=0; i<numEleArray; i++)
+	theEleCosts[i] = 0.0;
+    }
+  }
+
+  // the thread safe ele's first, the others after them
+  ElementIter &theEles = this->getElements();
+  Element *theEle;
+  int count = 0;
+  while ((theEle = theEles()) != 0 && count < numEleArray)
+    if (theEle->isThreadSafe() == true)
+      theEleArray[count++] = theEle;
+  numThreadSafeEleArray = count;
+
+  ElementIter &theEles2 = this->getElements();
+  while ((theEle = theEles2()) != 0 && count < numEleArray)
+    if (theEle->isThreadSafe() == false)
+      theEleArray[count++] = theEle;
+  numEleArray = count;
+
+  eleArrayBuiltFlag = true;
+  return 0;
+}
+
+
+int
+Domain::setElementCostMeasurement(bool measure)
+{
+  if (measure != measureEleCosts) {
+    measureEleCosts = measure;
+    eleArrayBuiltFlag = false;
+  }
+
+#ifdef _WIN32
+  if (measure == true) {
+    opserr << "WARNING Domain::setElementCostMeasurement() - no timer on this machine\n";
+    return -1;
+  }
+#endif
+
+  return 0;
+}
+
+
+int
+Domain::getElementCosts(ID &eleTags, Vector &costs, bool reset)
+{
+  // nothing measured since the ele's last changed
+  if (measureEleCosts == false || theEleCosts == 0 || eleArrayBuiltFlag == false)
+    return 0;
+
+  eleTags.resize(numEleArray);
+  costs.resize(numEleArray);
+  for (int i=0; i<numEleArray; i++) {
+    eleTags(i) = theEleArray[i]->getTag();
+    costs(i) = theEleCosts[i];
+    if (reset == true)
+      theEleCosts[i] = 0.0;
+  }
+
+  return numEleArray;
+}
+
+
 int
 Domain::buildNodeGraph(Graph *theNodeGraph)
 {
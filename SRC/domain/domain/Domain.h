@@ -67,6 +67,7 @@ class SingleDomParamIter;
 
 class MeshRegion;
 class Recorder;
+class ResponseGather;
 class Graph;
 class NodeGraph;
 class ElementGraph;
@@ -152,6 +153,7 @@ class Domain
 
     // methods to query the state of the domain
     virtual double  getCurrentTime(void) const;
+    virtual double  getCommittedTime(void) const;
     virtual int     getCommitTag(void) const;    	
     virtual int getNumElements(void) const;
     virtual int getNumNodes(void) const;
@@ -211,6 +213,8 @@ class Domain
     virtual int  addRecorder(Recorder &theRecorder);    	
     virtual int  removeRecorders(void);
     virtual int  removeRecorder(int tag);
+    virtual int  detachRecorders(void);
+    virtual int  recordersDomainChanged(void);
     virtual int  record(bool fromAnalysis=true);
 
     virtual int  addRegion(MeshRegion &theRegion);    	
@@ -232,10 +236,18 @@ class Domain
 
     virtual int calculateNodalReactions(int flag);
 
+    // time spent in the state determination of each ele, summed over the
+    // calls to update() since measuring started or the costs were reset;
+    // getElementCosts() returns the number of ele's placed in eleTags
+    virtual int setElementCostMeasurement(bool measure);
+    virtual int getElementCosts(ID &eleTags, Vector &costs, bool reset = true);
+
   protected:    
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    virtual int buildEleArray(void);
+    int gatherRecorderResponses(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -256,6 +268,21 @@ class Domain
     Graph *theNodeGraph;
     Graph *theElementGraph;
 
+    // flat copy of theElements used when the ele's are updated by threads
+    bool eleArrayBuiltFlag;
+    Element **theEleArray;
+    int *theEleResults;
+    int numEleArray;
+    int numThreadSafeEleArray;   // ele's at the front that are thread safe
+
+    // measured cost of the ele's in theEleArray, 0 unless measuring
+    bool measureEleCosts;
+    double *theEleCosts;
+
+    // plan used to fetch the responses of all the recorders in one pass
+    ResponseGather *theGather;
+    int gatherPlanTag;
+
     TaggedObjectStorage  *theElements;
     TaggedObjectStorage  *theNodes;
     TaggedObjectStorage  *theSPs;    
@@ -0,0 +1,224 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/domain/SnapshotStack.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of SnapshotStack.
+//
+// What: "@(#) SnapshotStack.cpp, revA"
+
+#include <SnapshotStack.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <MemoryChannel.h>
+#include <FEM_ObjectBroker.h>
+#include <Vector.h>
+#include <ID.h>
+
+class DomainSnapshot
+{
+  public:
+    DomainSnapshot() :nodeTags(0, 64), nodeState(0), numElements(0), commitTag(0), time(0.0) {};
+
+    ID nodeTags;
+    Vector nodeState;          // disp, vel and accel of each node
+    MemoryChannel eleState;    // sendSelf() of each element
+    int numElements;
+    int commitTag;
+    double time;
+};
+
+SnapshotStack::SnapshotStack(Domain &domain, FEM_ObjectBroker &broker, int maxNum)
+  :theDomain(&domain), theBroker(&broker), theSnapshots(0),
+   maxNumSnapshots(maxNum), numSnapshots(0), last(-1)
+{
+  if (maxNumSnapshots < 1)
+    maxNumSnapshots = 1;
+
+  theSnapshots = new DomainSnapshot *[maxNumSnapshots];
+  for (int i=0; i<maxNumSnapshots; i++)
+    theSnapshots[i] = 0;
+}
+
+SnapshotStack::~SnapshotStack()
+{
+  for (int i=0; i<maxNumSnapshots; i++)
+    if (theSnapshots[i] != 0)
+      delete theSnapshots[i];
+
+  delete [] theSnapshots;
+}
+
+int
+SnapshotStack::push(void)
+{
+  last = (last+1) % maxNumSnapshots;
+  if (numSnapshots < maxNumSnapshots)
+    numSnapshots++;
+
+  if (theSnapshots[last] == 0)
+    theSnapshots[last] = new DomainSnapshot;
+
+  DomainSnapshot &theSnapshot = *theSnapshots[last];
+  theSnapshot.time = theDomain->getCommittedTime();
+  theSnapshot.commitTag++;
+
+  // the nodes
+  int numNodes = theDomain->getNumNodes();
+  int numDOF = 0;
+  Node *theNode;
+  NodeIter &theNodes = theDomain->getNodes();
+  while ((theNode = theNodes()) != 0)
+    numDOF += theNode->getNumberDOF();
+
+  if (theSnapshot.nodeState.Size() != 3*numDOF)
+    theSnapshot.nodeState.resize(3*numDOF);
+  theSnapshot.nodeTags.resize(numNodes);
+
+  double *state = (numDOF > 0) ? &theSnapshot.nodeState(0) : 0;
+  int loc = 0;
+  int i = 0;
+  NodeIter &theNodes2 = theDomain->getNodes();
+  while ((theNode = theNodes2()) != 0) {
+    theSnapshot.nodeTags(i++) = theNode->getTag();
+    int ndf = theNode->getNumberDOF();
+    const Vector &disp = theNode->getDisp();
+    const Vector &vel = theNode->getVel();
+    const Vector &accel = theNode->getAccel();
+    for (int j=0; j<ndf; j++) {
+      state[loc+j] = disp(j);
+      state[loc+ndf+j] = vel(j);
+      state[loc+2*ndf+j] = accel(j);
+    }
+    loc += 3*ndf;
+  }
+
+  // the elements, with their materials and sections
+  theSnapshot.eleState.clear();
+  theSnapshot.numElements = 0;
+  Element *theEle;
+  ElementIter &theElements = theDomain->getElements();
+  while ((theEle = theElements()) != 0) {
+    if (theEle->sendSelf(theSnapshot.commitTag, theSnapshot.eleState) < 0) {
+      opserr << "SnapshotStack::push() - element with tag " << theEle->getTag() << " failed in sendSelf\n";
+      numSnapshots--;
+      last = (last+maxNumSnapshots-1) % maxNumSnapshots;
+      return -1;
+    }
+    theSnapshot.numElements++;
+  }
+
+  return 0;
+}
+
+int
+SnapshotStack::revert(int numBack)
+{
+  if (numBack < 1 || numBack > numSnapshots) {
+    opserr << "SnapshotStack::revert() - only " << numSnapshots << " snapshots available\n";
+    return -1;
+  }
+
+  int loc = (last-numBack+1+maxNumSnapshots) % maxNumSnapshots;
+  DomainSnapshot &theSnapshot = *theSnapshots[loc];
+
+  // check the domain has not changed
+  if (theSnapshot.nodeTags.Size() != theDomain->getNumNodes() ||
+      theSnapshot.numElements != theDomain->getNumElements()) {
+    opserr << "SnapshotStack::revert() - domain has changed since the snapshot was taken\n";
+    return -2;
+  }
+
+  // the nodes, the trial state is made the committed state
+  double *state = (theSnapshot.nodeState.Size() > 0) ? &theSnapshot.nodeState(0) : 0;
+  int pos = 0;
+  int i = 0;
+  Node *theNode;
+  NodeIter &theNodes = theDomain->getNodes();
+  while ((theNode = theNodes()) != 0) {
+    if (theNode->getTag() != theSnapshot.nodeTags(i++)) {
+      opserr << "SnapshotStack::revert() - domain has changed since the snapshot was taken\n";
+      return -2;
+    }
+    int ndf = theNode->getNumberDOF();
+    Vector disp(&state[pos], ndf);
+    Vector vel(&state[pos+ndf], ndf);
+    Vector accel(&state[pos+2*ndf], ndf);
+    theNode->setTrialDisp(disp);
+    theNode->setTrialVel(vel);
+    theNode->setTrialAccel(accel);
+    theNode->commitState();
+    pos += 3*ndf;
+  }
+
+  // the elements
+  theSnapshot.eleState.rewind();
+  Element *theEle;
+  ElementIter &theElements = theDomain->getElements();
+  while ((theEle = theElements()) != 0) {
+    if (theEle->recvSelf(theSnapshot.commitTag, theSnapshot.eleState, *theBroker) < 0) {
+      opserr << "SnapshotStack::revert() - element with tag " << theEle->getTag() << " failed in recvSelf\n";
+      return -3;
+    }
+  }
+
+  // drop the newer snapshots
+  numSnapshots -= numBack-1;
+  last = loc;
+
+  // the trial state of elements and loads now follow from the committed state
+  theDomain->setCommittedTime(theSnapshot.time);
+  return theDomain->revertToLastCommit();
+}
+
+void
+SnapshotStack::clear(void)
+{
+  numSnapshots = 0;
+  last = -1;
+}
+
+int
+SnapshotStack::getNumSnapshots(void) const
+{
+  return numSnapshots;
+}
+
+int
+SnapshotStack::getMaxNumSnapshots(void) const
+{
+  return maxNumSnapshots;
+}
+
+double
+SnapshotStack::getTime(int numBack) const
+{
+  if (numBack < 1 || numBack > numSnapshots)
+    return 0.0;
+
+  return theSnapshots[(last-numBack+1+maxNumSnapshots) % maxNumSnapshots]->time;
+}
@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/domain/SnapshotStack.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for SnapshotStack.
+// A SnapshotStack holds in memory copies of the last committed state of
+// a Domain, so that an analysis can be rolled back more than the one
+// step Domain::revertToLastCommit() allows. push() captures the
+// committed displacements, velocities and accelerations of the nodes,
+// the committed state of the elements (with their materials and
+// sections, through sendSelf() into a MemoryChannel) and the committed
+// time. revert(numBack) restores the domain to the numBack'th most
+// recent snapshot, 1 being the last one taken, discarding any newer
+// snapshots; the snapshot reverted to stays on the stack. When the
+// stack is full the oldest snapshot is dropped; the memory of the
+// snapshots is reused from one push() to the next.
+//
+// The nodes and elements of the domain must not change between the
+// push() and the revert(). revert() hands the saved state to recvSelf()
+// of the elements already in the domain, so a snapshot can be reverted
+// to any number of times only if recvSelf() frees or reuses whatever an
+// earlier call allocated.
+//
+// What: "@(#) SnapshotStack.h, revA"
+
+#ifndef SnapshotStack_h
+#define SnapshotStack_h
+
+class Domain;
+class FEM_ObjectBroker;
+class DomainSnapshot;
+
+class SnapshotStack
+{
+  public:
+    SnapshotStack(Domain &theDomain, FEM_ObjectBroker &theBroker, 
+		  int maxNumSnapshots = 10);
+    ~SnapshotStack();
+
+    int push(void);
+    int revert(int numBack = 1);
+    void clear(void);
+
+    int getNumSnapshots(void) const;
+    int getMaxNumSnapshots(void) const;
+    double getTime(int numBack = 1) const;
+    
+  protected:
+
+  private:
+    Domain *theDomain;
+    FEM_ObjectBroker *theBroker;
+
+    DomainSnapshot **theSnapshots;  // ring of snapshots
+    int maxNumSnapshots;
+    int numSnapshots;
+    int last;                        // position of the most recent
+};
+
+#endif
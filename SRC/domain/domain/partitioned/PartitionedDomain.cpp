@@ -1314,6 +1314,46 @@ PartitionedDomain::removeRecorders(void)
 }
 
 
+int
+PartitionedDomain::detachRecorders(void)
+{
+  // do the same for all the subdomains
+  if (theSubdomains != 0) {
+    ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
+    TaggedObject *theObject;
+    while ((theObject = theSubsIter()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      theSub->detachRecorders();
+    }
+  }
+
+  return this->Domain::detachRecorders();
+}
+
+
+int
+PartitionedDomain::recordersDomainChanged(void)
+{
+  int result = this->Domain::recordersDomainChanged();
+
+  // do the same for all the subdomains
+  if (theSubdomains != 0) {
+    ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
+    TaggedObject *theObject;
+    while ((theObject = theSubsIter()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      if (theSub->recordersDomainChanged() < 0) {
+	opserr << "PartitionedDomain::recordersDomainChanged(void)";
+	opserr << " - failed in Subdomain::recordersDomainChanged()\n";
+	result = -1;
+      }
+    }
+  }
+
+  return result;
+}
+
+
 int  
 PartitionedDomain::removeRecorder(int tag)
 {
@@ -117,6 +117,8 @@ class PartitionedDomain: public Domain
     virtual int  addRecorder(Recorder &theRecorder);    	
     virtual int  removeRecorders(void);
     virtual int  removeRecorder(int tag);
+    virtual int  detachRecorders(void);
+    virtual int  recordersDomainChanged(void);
     
     virtual  void Print(OPS_Stream &s, int flag =0);    
     virtual void Print(OPS_Stream &s, ID *nodeTags, ID *eleTags, int flag =0);
@@ -0,0 +1,71 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/loadBalancer/RepartitionImbalanced.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of RepartitionImbalanced.
+//
+// What: "@(#) RepartitionImbalanced.cpp, revA"
+
+#include <RepartitionImbalanced.h>
+#include <OPS_Globals.h>
+
+RepartitionImbalanced::RepartitionImbalanced(double threshold, int p)
+ :imbalanceThreshold(threshold), period(p), numCalls(0)
+{
+    if (imbalanceThreshold < 1.0)
+	imbalanceThreshold = 1.0;
+    if (period < 1)
+	period = 1;
+}
+
+RepartitionImbalanced::~RepartitionImbalanced()
+{
+    
+}
+
+int
+RepartitionImbalanced::balance(Graph &theWeightedGraph)
+{
+    // check to see a domain partitioner has been set
+    DomainPartitioner *thePartitioner = this->getDomainPartitioner();
+    if (thePartitioner == 0) {
+	opserr << "RepartitionImbalanced::balance - No DomainPartitioner has been set\n";
+	return -1;
+    }
+
+    // the first call starts the measurement, which then covers period commits
+    numCalls++;
+    if (numCalls != 1 && (numCalls-1)%period != 0)
+	return 0;
+
+    int res = thePartitioner->rebalance(imbalanceThreshold);
+    if (res < 0) {
+	opserr << "WARNING RepartitionImbalanced::balance() ";
+	opserr << " - DomainPartitioner::rebalance returned ";
+	opserr << res << endln;
+    }
+
+    return res;
+}
@@ -0,0 +1,58 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/loadBalancer/RepartitionImbalanced.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// RepartitionImbalanced. A RepartitionImbalanced is a LoadBalancer which,
+// every period commits, asks the DomainPartitioner to repartition the
+// elements using the time measured for their state determination, if
+// the costliest subdomain exceeds the average by more than the given
+// factor (see DomainPartitioner::rebalance()).
+//
+// What: "@(#) RepartitionImbalanced.h, revA"
+
+#ifndef RepartitionImbalanced_h
+#define RepartitionImbalanced_h
+
+#include <LoadBalancer.h>
+
+class RepartitionImbalanced: public LoadBalancer
+{
+  public:
+    RepartitionImbalanced(double imbalanceThreshold = 1.1, int period = 10);
+
+    virtual  ~RepartitionImbalanced();    
+
+    virtual int balance(Graph &theWeightedGraph);
+
+  protected:    
+	
+  private:
+    double imbalanceThreshold;
+    int period;
+    int numCalls;
+};
+
+#endif
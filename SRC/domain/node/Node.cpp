@@ -1210,6 +1210,12 @@ Node::setRayleighDampingFactor(double alpham) {
 }
 
 
+bool
+Node::hasRayleighDamping(void) {
+  return (alphaM != 0.0);
+}
+
+
 const Matrix &
 Node::getDamp(void) 
 {
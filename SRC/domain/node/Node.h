@@ -115,6 +115,7 @@ class Node : public DomainComponent
     virtual const Vector &getRV(const Vector &V);        
 
     virtual int setRayleighDampingFactor(double alphaM);
+    virtual bool hasRayleighDamping(void);
     virtual const Matrix &getDamp(void);
 
     // public methods for eigen vector
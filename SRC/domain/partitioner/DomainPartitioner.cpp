@@ -62,14 +62,25 @@
 
 #include <MapOfTaggedObjects.h>
 
+#include <map>
+using namespace std;
+
+typedef map<int, int> MAP_INT;
+typedef MAP_INT::value_type   MAP_INT_TYPE;
+typedef MAP_INT::iterator     MAP_INT_ITERATOR;
+
 class NodeLocations: public TaggedObject
 {
 public:
   NodeLocations(int tag);
   void Print(OPS_Stream &s, int flag =0);  
   int addPartition(int partition);
+  int addElement(int eleTag);
   ID nodePartitions;
   int numPartitions;
+  ID elements;       // the elements connected to the node
+  int numElements;
+  bool pinned;       // the node may not be moved by rebalance()
 };
 
 
@@ -77,7 +88,10 @@ public:
 NodeLocations::NodeLocations(int tag)
 :TaggedObject(tag), 
  nodePartitions(0,1), 
- numPartitions(0)
+ numPartitions(0),
+ elements(0,4),
+ numElements(0),
+ pinned(false)
 {
 
 }
@@ -96,10 +110,37 @@ NodeLocations::addPartition(int partition)
   return 0;
 }
 
+int
+NodeLocations::addElement(int eleTag)
+{
+  elements[numElements++] = eleTag;
+  return 0;
+}
+
+// the partitions a node is in once its elements have the colors they
+// have in theGraph; newPartitions must be empty on entry
+static int
+getNewNodePartitions(NodeLocations &theLocation, Graph &theGraph,
+		     MAP_INT &theEleToVertexMap, ID &newPartitions)
+{
+  int numNew = 0;
+  for (int i=0; i<theLocation.numElements; i++) {
+    MAP_INT_ITERATOR theEle = theEleToVertexMap.find(theLocation.elements(i));
+    if (theEle != theEleToVertexMap.end()) {
+      int color = theGraph.getVertexPtr((*theEle).second)->getColor();
+      if (newPartitions.insert(color) != 1)
+	numNew++;
+    }
+  }
+
+  return numNew;
+}
+
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(0),
  theElementGraph(0), theBoundaryElements(0), 
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ pinnedElements(0,16), measuringCosts(false)
 {
 
 }    
@@ -108,7 +149,8 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 				     LoadBalancer &theLoadBalancer)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(&theLoadBalancer),
  theElementGraph(0), theBoundaryElements(0),
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ pinnedElements(0,16), measuringCosts(false)
 {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -123,6 +165,13 @@ DomainPartitioner::~DomainPartitioner()
 	delete theBoundaryElements[i];
     delete []theBoundaryElements;
   }
+
+  // once partitioned the element graph is our own copy
+  if (partitionFlag == true && theElementGraph != 0)
+    delete theElementGraph;
+
+  if (theNodeLocations != 0)
+    delete theNodeLocations;
 }
 
 void 
@@ -155,6 +204,11 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   //    Graph &theEleGraph = myDomain->getElementGraph();
   //    theElementGraph = new Graph(myDomain->getElementGraph());
 
+  if (partitionFlag == true && theElementGraph != 0)
+    delete theElementGraph;
+  partitionFlag = false;
+  measuringCosts = false;
+
   theElementGraph = &(myDomain->getElementGraph());
 
   int theError = thePartitioner.partition(*theElementGraph, numParts);
@@ -242,6 +296,9 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   // we now create a MapOfTaggedObjectStorage to store the NodeLocations
   // and create a new NodeLocation for each node; adding it to the map object
 
+  if (theNodeLocations != 0)
+    delete theNodeLocations;
+
   theNodeLocations = new MapOfTaggedObjects();
   if (theNodeLocations == 0) {
     opserr << "DomainPartitioner::partition(int numParts)";
@@ -306,6 +363,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
       }
       NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
       theNodeLocation->addPartition(vertexColor);
+      theNodeLocation->addElement(eleTag);
     }
   }
 
@@ -339,6 +397,15 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     }
   }
 
+  // determine the elements rebalance() may not move
+  this->pinElements(specialElementTag);
+
+  // the nodes and elements are migrated to each subdomain as one batch
+  SubdomainIter &theMigratingSubs = myDomain->getSubdomains();
+  Subdomain *theMigratingSub;
+  while ((theMigratingSub = theMigratingSubs()) != 0) 
+    theMigratingSub->startMigration();
+
   // we now add the nodes, 
   TaggedObjectIter &theNodeLocationIter = theNodeLocations->getComponents();
   TaggedObject *theNodeObject;
@@ -390,6 +457,11 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     } 
   }
 
+  // ship the batches, the subdomains sending them at the same time
+  SubdomainIter &theMigratedSubs = myDomain->getSubdomains();
+  while ((theMigratingSub = theMigratedSubs()) != 0) 
+    theMigratingSub->endMigration();
+
   // now we go through the load patterns and move NodalLoad
   // 1) make sure each subdomain has a copy of the partitioneddomains load patterns.
   // 2) move nodal loads
@@ -565,6 +637,14 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   // we invoke change on the PartitionedDomain
   myDomain->domainChange();
 
+  // keep a copy of the colored element graph for rebalance(), the
+  // domain deletes its graph
+  Graph *theColoredGraph = new Graph(*theElementGraph);
+  VertexIter &theColoredVertices = theElementGraph->getVertices();
+  while ((vertexPtr = theColoredVertices()) != 0)
+    theColoredGraph->getVertexPtr(vertexPtr->getTag())->setColor(vertexPtr->getColor());
+  theElementGraph = theColoredGraph;
+
   myDomain->clearElementGraph();
     
   // we are done
@@ -591,15 +671,18 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
 	// call on the LoadBalancer to partition		
 	res = theBalancer->balance(theWeightedPGraph);
 	    
-	// now invoke domainChanged on Subdomains and PartitionedDomain
-	SubdomainIter &theSubDomains = myDomain->getSubdomains();
-	Subdomain *theSubDomain;
-
-	while ((theSubDomain = theSubDomains()) != 0) 
-	  theSubDomain->domainChange();
+	// now invoke domainChanged on Subdomains and PartitionedDomain,
+	// only if the balancer moved some elements
+	if (res > 0) {
+	  SubdomainIter &theSubDomains = myDomain->getSubdomains();
+	  Subdomain *theSubDomain;
+
+	  while ((theSubDomain = theSubDomains()) != 0) 
+	    theSubDomain->domainChange();
 	
-	// we invoke change on the PartitionedDomain
-	myDomain->domainChange();
+	  // we invoke change on the PartitionedDomain
+	  myDomain->domainChange();
+	}
     }
 
     return res;
@@ -607,6 +690,335 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
 
 
 
+// int rebalance(double imbalanceThreshold);
+//	the first call starts the measurement of the cost of the elements in
+//	the subdomains. on later calls, if the costliest subdomain costs more
+//	than imbalanceThreshold times the average, the element graph is
+//	partitioned again with the measured costs as the vertex weights, the
+//	new partitions relabelled to overlap the old as much as possible, and
+//	the elements and nodes, with their committed state, moved to their
+//	new subdomains. elements at nodes with constraints or loads, and
+//	elements with elemental loads, are not moved. the recorders, whose
+//	responses hold pointers to the elements and nodes, are then told
+//	through domainChanged() to look them up again. returns the number
+//	of elements moved; the caller must invoke domainChange() on the
+//	domains.
+
+int
+DomainPartitioner::rebalance(double imbalanceThreshold)
+{
+  // check that the object did the partitioning
+  if (partitionFlag == false || theElementGraph == 0) {
+    opserr << "DomainPartitioner::rebalance";
+    opserr << " - not partitioned or DomainPartitioner did not partition\n";
+    return -1;
+  }
+
+  if (usingMainDomain == true) {
+    opserr << "DomainPartitioner::rebalance";
+    opserr << " - elements in the main domain cannot be moved\n";
+    return -1;
+  }
+
+  Subdomain *theSub;
+
+  if (measuringCosts == false) {
+    SubdomainIter &theSubs = myDomain->getSubdomains();
+    while ((theSub = theSubs()) != 0) 
+      theSub->setElementCostMeasurement(true);
+    measuringCosts = true;
+    return 0;
+  }
+
+  // the measured cost of an element becomes the weight of its vertex
+  MAP_INT theEleToVertexMap;
+  VertexIter &theVertices = theElementGraph->getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = theVertices()) != 0) {
+    theEleToVertexMap.insert(MAP_INT_TYPE(vertexPtr->getRef(), vertexPtr->getTag()));
+    vertexPtr->setWeight(0.0);
+  }
+
+  Vector partitionCosts(numPartitions);
+  ID eleTags(0);
+  Vector eleCosts(0);
+  for (int i=1; i<=numPartitions; i++) {
+    theSub = myDomain->getSubdomainPtr(i);
+    if (theSub == 0)
+      continue;
+    int numEle = theSub->getElementCosts(eleTags, eleCosts);
+    for (int j=0; j<numEle; j++) {
+      MAP_INT_ITERATOR theEle = theEleToVertexMap.find(eleTags(j));
+      if (theEle != theEleToVertexMap.end()) {
+	theElementGraph->getVertexPtr((*theEle).second)->setWeight(eleCosts(j));
+	partitionCosts(i-1) += eleCosts(j);
+      }
+    }
+  }
+
+  double maxCost = 0.0;
+  double totalCost = 0.0;
+  for (int i=0; i<numPartitions; i++) {
+    totalCost += partitionCosts(i);
+    if (partitionCosts(i) > maxCost)
+      maxCost = partitionCosts(i);
+  }
+
+  if (totalCost <= 0.0 || maxCost*numPartitions <= imbalanceThreshold*totalCost)
+    return 0;
+
+  // partition the weighted graph, remembering the old colors
+  int numVertex = theElementGraph->getNumVertex();
+  ID oldColors(numVertex);
+  for (int v=0; v<numVertex; v++)
+    oldColors(v) = theElementGraph->getVertexPtr(v+START_VERTEX_NUM)->getColor();
+
+  if (thePartitioner.partition(*theElementGraph, numPartitions) < 0) {
+    opserr << "DomainPartitioner::rebalance";
+    opserr << " - the graph partitioner failed to partition the element graph\n";
+    for (int v=0; v<numVertex; v++)
+      theElementGraph->getVertexPtr(v+START_VERTEX_NUM)->setColor(oldColors(v));
+    return -2;
+  }
+
+  // give each new partition the label of the old one it shares the
+  // most elements with, largest overlaps first
+  ID overlap(numPartitions*numPartitions);
+  overlap.Zero();
+  for (int v=0; v<numVertex; v++) {
+    int newColor = theElementGraph->getVertexPtr(v+START_VERTEX_NUM)->getColor();
+    overlap((newColor-1)*numPartitions + oldColors(v)-1) += 1;
+  }
+
+  ID newLabel(numPartitions);
+  ID labelUsed(numPartitions);
+  newLabel.Zero();
+  labelUsed.Zero();
+  for (int k=0; k<numPartitions; k++) {
+    int bestNew = -1;
+    int bestOld = -1;
+    for (int i=0; i<numPartitions; i++)
+      if (newLabel(i) == 0)
+	for (int j=0; j<numPartitions; j++)
+	  if (labelUsed(j) == 0 && 
+	      (bestNew == -1 || overlap(i*numPartitions+j) > overlap(bestNew*numPartitions+bestOld))) {
+	    bestNew = i;
+	    bestOld = j;
+	  }
+    newLabel(bestNew) = bestOld+1;
+    labelUsed(bestOld) = 1;
+  }
+
+  // the elements that change partition
+  ID touched(numVertex);
+  touched.Zero();
+  int numMoved = 0;
+  for (int v=0; v<numVertex; v++) {
+    vertexPtr = theElementGraph->getVertexPtr(v+START_VERTEX_NUM);
+    int color = newLabel(vertexPtr->getColor()-1);
+    if (pinnedElements.getLocationOrdered(vertexPtr->getRef()) >= 0)
+      color = oldColors(v);
+    vertexPtr->setColor(color);
+    if (color != oldColors(v)) {
+      touched(v) = 1;
+      numMoved++;
+    }
+  }
+
+  if (numMoved == 0)
+    return 0;
+
+  // the nodes whose partitions change; an element staying in a subdomain
+  // in which one of its nodes goes from internal to external, or back,
+  // is taken out and added again so it picks up the new node
+  ID changedNodes(0,64);
+  int numChanged = 0;
+  TaggedObjectIter &theLocations = theNodeLocations->getComponents();
+  TaggedObject *theObject;
+  while ((theObject = theLocations()) != 0) {
+    NodeLocations *theLocation = (NodeLocations *)theObject;
+    if (theLocation->pinned == true)
+      continue;
+
+    ID newPartitions(0,4);
+    int numNew = getNewNodePartitions(*theLocation, *theElementGraph, 
+				      theEleToVertexMap, newPartitions);
+    int numOld = theLocation->numPartitions;
+    ID &oldPartitions = theLocation->nodePartitions;
+    if (numNew == 0)
+      continue;
+
+    bool changed = (numNew != numOld);
+    for (int i=0; i<numNew && changed == false; i++)
+      if (newPartitions(i) != oldPartitions(i))
+	changed = true;
+    if (changed == false)
+      continue;
+
+    changedNodes[numChanged++] = theLocation->getTag();
+    if ((numOld == 1) != (numNew == 1)) {
+      for (int i=0; i<theLocation->numElements; i++) {
+	MAP_INT_ITERATOR theEle = theEleToVertexMap.find(theLocation->elements(i));
+	if (theEle == theEleToVertexMap.end())
+	  continue;
+	int v = (*theEle).second - START_VERTEX_NUM;
+	int color = theElementGraph->getVertexPtr(v+START_VERTEX_NUM)->getColor();
+	if (color == oldColors(v) && oldPartitions.getLocationOrdered(color) >= 0)
+	  touched(v) = 1;
+      }
+    }
+  }
+
+  // 1. take the elements out of their old subdomains
+  Element **theElements = new Element *[numVertex];
+  for (int v=0; v<numVertex; v++) {
+    theElements[v] = 0;
+    if (touched(v) == 1) {
+      vertexPtr = theElementGraph->getVertexPtr(v+START_VERTEX_NUM);
+      theSub = myDomain->getSubdomainPtr(oldColors(v));
+      theElements[v] = theSub->removeElement(vertexPtr->getRef());
+      if (theElements[v] == 0) 
+	opserr << "DomainPartitioner::rebalance - element GONE! - eleTag " << vertexPtr->getRef() << endln;
+    }
+  }
+
+  SubdomainIter &theMigratingSubs = myDomain->getSubdomains();
+  while ((theSub = theMigratingSubs()) != 0) 
+    theSub->startMigration();
+
+  // 2. move the nodes; a node on the boundary lives in the
+  //    PartitionedDomain, each subdomain holding a copy
+  for (int n=0; n<numChanged; n++) {
+    int nodeTag = changedNodes(n);
+    NodeLocations *theLocation = (NodeLocations *)theNodeLocations->getComponentPtr(nodeTag);
+    ID newPartitions(0,4);
+    int numNew = getNewNodePartitions(*theLocation, *theElementGraph, 
+				      theEleToVertexMap, newPartitions);
+    int numOld = theLocation->numPartitions;
+    ID &oldPartitions = theLocation->nodePartitions;
+
+    Node *nodePtr = 0;
+    if (numOld == 1) 
+      nodePtr = myDomain->getSubdomainPtr(oldPartitions(0))->removeNode(nodeTag);
+    else {
+      for (int i=0; i<numOld; i++)
+	if (numNew == 1 || newPartitions.getLocationOrdered(oldPartitions(i)) < 0) {
+	  Node *theCopy = myDomain->getSubdomainPtr(oldPartitions(i))->removeNode(nodeTag);
+	  if (theCopy != 0)
+	    delete theCopy;
+	}
+      // PartitionedDomain::removeNode() would also remove it from the subdomains
+      if (numNew == 1)
+	nodePtr = myDomain->Domain::removeNode(nodeTag);
+    }
+
+    if (numNew == 1) {
+      if (nodePtr == 0 || myDomain->getSubdomainPtr(newPartitions(0))->addNode(nodePtr) == false)
+	opserr << "DomainPartitioner::rebalance - failed to move node " << nodeTag << endln;
+    } else {
+      if (numOld == 1 && (nodePtr == 0 || myDomain->addNode(nodePtr) == false))
+	opserr << "DomainPartitioner::rebalance - failed to move node " << nodeTag << endln;
+      nodePtr = myDomain->getNode(nodeTag);
+      if (nodePtr != 0)
+	for (int i=0; i<numNew; i++)
+	  if (numOld == 1 || oldPartitions.getLocationOrdered(newPartitions(i)) < 0)
+	    myDomain->getSubdomainPtr(newPartitions(i))->addExternalNode(nodePtr);
+    }
+
+    oldPartitions = newPartitions;
+    theLocation->numPartitions = numNew;
+  }
+
+  // 3. add the elements to their new subdomains
+  for (int v=0; v<numVertex; v++)
+    if (theElements[v] != 0) {
+      theSub = myDomain->getSubdomainPtr(theElementGraph->getVertexPtr(v+START_VERTEX_NUM)->getColor());
+      theSub->addElement(theElements[v]);
+    }
+  delete [] theElements;
+
+  SubdomainIter &theMigratedSubs = myDomain->getSubdomains();
+  while ((theSub = theMigratedSubs()) != 0) 
+    theSub->endMigration();
+
+  // a recorder added to the domain is also in every subdomain, each
+  // copy must drop the elements and nodes that have left
+  if (myDomain->recordersDomainChanged() < 0)
+    opserr << "DomainPartitioner::rebalance - failed to update the recorders\n";
+
+  return numMoved;
+}
+
+
+// int pinElements(int specialElementTag);
+//	pins the elements that rebalance() must leave in place: those at
+//	nodes with SP or MP constraints or nodal loads, and those with
+//	elemental loads together with every element sharing a node with
+//	them, the loads holding pointers to their element and nodes.
+
+int
+DomainPartitioner::pinElements(int specialElementTag)
+{
+  pinnedElements = ID(0,16);
+
+  if (specialElementTag != 0)
+    pinnedElements.insert(specialElementTag);
+
+  SP_ConstraintIter &theSPs = myDomain->getSPs();
+  SP_Constraint *spPtr;
+  while ((spPtr = theSPs()) != 0)
+    this->pinNode(spPtr->getNodeTag());
+
+  MP_ConstraintIter &theMPs = myDomain->getMPs();
+  MP_Constraint *mpPtr;
+  while ((mpPtr = theMPs()) != 0) {
+    this->pinNode(mpPtr->getNodeRetained());
+    this->pinNode(mpPtr->getNodeConstrained());
+  }
+
+  LoadPatternIter &theLoadPatterns = myDomain->getLoadPatterns();
+  LoadPattern *theLoadPattern;
+  while ((theLoadPattern = theLoadPatterns()) != 0) {
+    NodalLoadIter &theNodalLoads = theLoadPattern->getNodalLoads();
+    NodalLoad *theNodalLoad;
+    while ((theNodalLoad = theNodalLoads()) != 0)
+      this->pinNode(theNodalLoad->getNodeTag());
+
+    SP_ConstraintIter &thePatternSPs = theLoadPattern->getSPs();
+    while ((spPtr = thePatternSPs()) != 0)
+      this->pinNode(spPtr->getNodeTag());
+
+    ElementalLoadIter &theLoads = theLoadPattern->getElementalLoads();
+    ElementalLoad *theLoad;
+    while ((theLoad = theLoads()) != 0) {
+      Element *elePtr = myDomain->getElement(theLoad->getElementTag());
+      if (elePtr != 0) {
+	const ID &nodes = elePtr->getExternalNodes();
+	for (int i=0; i<nodes.Size(); i++)
+	  this->pinNode(nodes(i));
+      }
+    }
+  }
+
+  return 0;
+}
+
+int
+DomainPartitioner::pinNode(int nodeTag)
+{
+  TaggedObject *theObject = theNodeLocations->getComponentPtr(nodeTag);
+  if (theObject == 0)
+    return -1;
+
+  NodeLocations *theLocation = (NodeLocations *)theObject;
+  theLocation->pinned = true;
+  for (int i=0; i<theLocation->numElements; i++)
+    pinnedElements.insert(theLocation->elements(i));
+
+  return 0;
+}
+
+
 int 
 DomainPartitioner::getNumPartitions(void) const
 {
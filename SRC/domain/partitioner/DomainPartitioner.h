@@ -62,6 +62,9 @@ class DomainPartitioner
 
     virtual int balance(Graph &theWeightedSubdomainGraph);
 
+    // move elements between the subdomains using their measured cost
+    virtual int rebalance(double imbalanceThreshold);
+
     // public member functions needed by the load balancer
     virtual int getNumPartitions(void) const;
     virtual Graph &getPartitionGraph(void);
@@ -92,6 +95,9 @@ class DomainPartitioner
   protected:    
     
   private:
+    int pinElements(int specialElementTag);
+    int pinNode(int nodeTag);
+
     PartitionedDomain *myDomain; 
     GraphPartitioner  &thePartitioner;
     LoadBalancer      *theBalancer;    
@@ -107,6 +113,10 @@ class DomainPartitioner
     
     bool usingMainDomain;
     int mainPartition;
+
+    // elements rebalance() must leave where they are
+    ID pinnedElements;
+    bool measuringCosts;
 };
 
 #endif
@@ -44,6 +44,7 @@
 #include <Recorder.h>
 #include <Parameter.h>
 #include <Message.h>
+#include <MemoryChannel.h>
 
 #include <ArrayOfTaggedObjects.h>
 #include <ShadowActorSubdomain.h>
@@ -177,6 +178,28 @@ ActorSubdomain::run(void)
 	    this->sendVector(theVect);
 	    break;	    
 
+	  case ShadowActorSubdomain_setElementCostMeasurement:
+	    if (msgData(1) == 1)
+	      this->setElementCostMeasurement(true);
+	    else
+	      this->setElementCostMeasurement(false);
+	    break;
+
+	  case ShadowActorSubdomain_getElementCosts: {
+	    ID eleTags(0);
+	    Vector eleCosts(0);
+	    if (msgData(1) == 1)
+	      msgData(0) = this->getElementCosts(eleTags, eleCosts, true);
+	    else
+	      msgData(0) = this->getElementCosts(eleTags, eleCosts, false);
+	    this->sendID(msgData);
+	    if (msgData(0) > 0) {
+	      this->sendID(eleTags);
+	      this->sendVector(eleCosts);
+	    }
+	    break;
+	  }
+
  	  case ShadowActorSubdomain_addElement:
 	    theType = msgData(1);
 	    dbTag = msgData(2);
@@ -276,6 +299,56 @@ ActorSubdomain::run(void)
 
 	    break;	    
 
+
+	  case ShadowActorSubdomain_addObjects: {
+	    // the nodes and elements packed by ShadowSubdomain::startMigration()
+	    int numObjects = msgData(1);
+	    int numBytes = msgData(2);
+	    MemoryChannel theBatch;
+	    ID objectData(4);
+
+	    char *theData = theBatch.setNumBytes(numBytes);
+	    Message theMessage(theData, numBytes);
+	    if (theData == 0 || this->recvMessage(theMessage) < 0) {
+	      opserr << "ActorSubdomain::run - failed to receive " << numObjects << " objects\n";
+	      break;
+	    }
+
+	    for (i=0; i<numObjects; i++) {
+	      if (theBatch.recvID(0, 0, objectData) < 0)
+		break;
+	      theType = objectData(1);
+	      dbTag = objectData(2);
+
+	      bool result = false;
+	      if (objectData(0) == ShadowActorSubdomain_addElement) {
+		theEle = theBroker->getNewElement(theType);
+		if (theEle != 0) {
+		  theEle->setDbTag(dbTag);
+		  theEle->recvSelf(0, theBatch, *theBroker);
+		  result = this->addElement(theEle);
+		}
+	      } else {
+		theNod = theBroker->getNewNode(theType);
+		if (theNod != 0) {
+		  theNod->setDbTag(dbTag);
+		  theNod->recvSelf(0, theBatch, *theBroker);
+		  if (objectData(0) == ShadowActorSubdomain_addNode)
+		    result = this->addNode(theNod);
+		  else {
+		    result = this->Subdomain::addExternalNode(theNod);
+		    delete theNod;
+		  }
+		}
+	      }
+
+	      if (result == false) {
+		opserr << "ActorSubdomain::run - failed to add object of class " << theType << endln;
+		break;
+	      }
+	    }
+	    break;
+	  }
 	    
 	  case ShadowActorSubdomain_addSP_Constraint:
 	    theType = msgData(1);
@@ -686,6 +759,10 @@ opserr << "ActorSubdomain::addSP_AXIS :: DONE\n";
 	    theType = msgData(1);
 	    this->removeRecorder(theType);
 	    break;	    	    
+
+	  case ShadowActorSubdomain_recordersDomainChanged:
+	    this->recordersDomainChanged();
+	    break;	    	    
 	    
 
 	case ShadowActorSubdomain_wipeAnalysis:
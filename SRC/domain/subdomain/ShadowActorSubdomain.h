@@ -102,3 +102,7 @@ static const int ShadowActorSubdomain_addSP_ConstraintAXIS = 103;
 static const int ShadowActorSubdomain_getDomainChangeFlag = 104;
 static const int ShadowActorSubdomain_record = 105;
 static const int ShadowActorSubdomain_getElementResponse = 106;
+static const int ShadowActorSubdomain_addObjects = 107;
+static const int ShadowActorSubdomain_setElementCostMeasurement = 108;
+static const int ShadowActorSubdomain_getElementCosts = 109;
+static const int ShadowActorSubdomain_recordersDomainChanged = 110;
@@ -67,6 +67,11 @@
 
 #include <ShadowActorSubdomain.h>
 #include <Message.h>
+#include <MemoryChannel.h>
+
+// size at which the objects batched for a subdomain are sent, so that
+// the message size fits in an int
+#define SHADOW_SUBDOMAIN_MAX_BATCH 268435456
 
 int ShadowSubdomain::count = 0; // MHS
 int ShadowSubdomain::numShadowSubdomains = 0;
@@ -82,7 +87,9 @@ ShadowSubdomain::ShadowSubdomain(int tag,
   :Shadow(ACTOR_TAGS_SUBDOMAIN, theObjectBroker, theMachineBroker, 0),
 	  
    Subdomain(tag),
-   msgData(4),
+   msgData(4), computeData(4), replyData(4),
+   tangPosted(false), residualPosted(false),
+   theBatch(0), batchData(4), numBatched(0), migrating(false),
    theElements(0,128),
    theNodes(0,128),
    theExternalNodes(0,128), 
@@ -129,7 +136,9 @@ ShadowSubdomain::ShadowSubdomain(int tag,
 				 FEM_ObjectBroker &theObjectBroker)
   :Shadow(the_Channel, theObjectBroker),
    Subdomain(tag),
-   msgData(4),
+   msgData(4), computeData(4), replyData(4),
+   tangPosted(false), residualPosted(false),
+   theBatch(0), batchData(4), numBatched(0), migrating(false),
    theElements(0,128),
    theNodes(0,128),
    theExternalNodes(0,128), 
@@ -165,6 +174,9 @@ ShadowSubdomain::ShadowSubdomain(int tag,
 
 ShadowSubdomain::~ShadowSubdomain()    
 {
+  // complete any posted communication
+  this->waitAll();
+
   // send a message to the remote actor telling it to shut sown
   msgData(0) = ShadowActorSubdomain_DIE;
   this->sendID(msgData);
@@ -176,6 +188,9 @@ ShadowSubdomain::~ShadowSubdomain()
   delete theShadowSPs;
   delete theShadowMPs;
   delete theShadowLPs;
+
+  if (theBatch != 0)
+    delete theBatch;
 }
 
 /*
@@ -235,11 +250,15 @@ ShadowSubdomain::addElement(Element *theEle)
 	// do all the checking stuff
 #endif
 
-    msgData(0) = ShadowActorSubdomain_addElement;
-    msgData(1) = theEle->getClassTag();
-    msgData(2) = theEle->getDbTag();
-    this->sendID(msgData);
-    this->sendObject(*theEle);
+    if (migrating == true) 
+      this->addToBatch(ShadowActorSubdomain_addElement, *theEle);
+    else {
+      msgData(0) = ShadowActorSubdomain_addElement;
+      msgData(1) = theEle->getClassTag();
+      msgData(2) = theEle->getDbTag();
+      this->sendID(msgData);
+      this->sendObject(*theEle);
+    }
     theElements[numElements] = tag;
     numElements++;
     //    this->Domain::domainChange();
@@ -266,11 +285,15 @@ ShadowSubdomain::addNode(Node *theNode)
 #ifdef _G3DEBUG
   // do all the checking stuff
 #endif
-  msgData(0) = ShadowActorSubdomain_addNode;
-  msgData(1) = theNode->getClassTag();
-  msgData(2) = theNode->getDbTag();
-  this->sendID(msgData);
-  this->sendObject(*theNode);
+  if (migrating == true) 
+    this->addToBatch(ShadowActorSubdomain_addNode, *theNode);
+  else {
+    msgData(0) = ShadowActorSubdomain_addNode;
+    msgData(1) = theNode->getClassTag();
+    msgData(2) = theNode->getDbTag();
+    this->sendID(msgData);
+    this->sendObject(*theNode);
+  }
   theNodes[numNodes] = tag;
   numNodes++;    
   // this->Domain::domainChange();
@@ -288,11 +311,15 @@ ShadowSubdomain::addExternalNode(Node *theNode)
 	// do all the checking stuff
 #endif
 
-    msgData(0) = ShadowActorSubdomain_addExternalNode;
-    msgData(1) = theNode->getClassTag();
-    msgData(2) = theNode->getDbTag();
-    this->sendID(msgData);
-    this->sendObject(*theNode);
+    if (migrating == true) 
+      this->addToBatch(ShadowActorSubdomain_addExternalNode, *theNode);
+    else {
+      msgData(0) = ShadowActorSubdomain_addExternalNode;
+      msgData(1) = theNode->getClassTag();
+      msgData(2) = theNode->getDbTag();
+      this->sendID(msgData);
+      this->sendObject(*theNode);
+    }
     theNodes[numNodes] = tag;
     theExternalNodes[numExternalNodes] = tag;    
     numNodes++;    
@@ -304,6 +331,85 @@ ShadowSubdomain::addExternalNode(Node *theNode)
     return true;    
 }
 
+// int startMigration(void);
+//	while migrating the nodes and elements added are not sent one at a
+//	time; they are packed, with the action and class tag of each, into
+//	a MemoryChannel which endMigration() sends to the actor as one
+//	message. the send is posted so that the DomainPartitioner can ship
+//	the batches of all the subdomains at the same time.
+
+int
+ShadowSubdomain::startMigration(void)
+{
+  // the batch may still be being sent
+  this->waitAll();
+
+  if (theBatch == 0)
+    theBatch = new MemoryChannel();
+  theBatch->clear();
+
+  numBatched = 0;
+  migrating = true;
+
+  return 0;
+}
+
+int
+ShadowSubdomain::endMigration(void)
+{
+  if (migrating == false)
+    return 0;
+
+  migrating = false;
+  return this->sendBatch();
+}
+
+int
+ShadowSubdomain::addToBatch(int action, MovableObject &theObject)
+{
+  batchData(0) = action;
+  batchData(1) = theObject.getClassTag();
+  batchData(2) = theObject.getDbTag();
+
+  if (theBatch->sendID(0, 0, batchData) < 0 || theObject.sendSelf(0, *theBatch) < 0) {
+    opserr << "ShadowSubdomain::addToBatch() - failed to pack object of class " << batchData(1) << endln;
+    return -1;
+  }
+  numBatched++;
+
+  // a large batch is sent now and a new one started
+  if (theBatch->getNumBytes() > SHADOW_SUBDOMAIN_MAX_BATCH) {
+    int res = this->sendBatch();
+    this->waitAll();
+    theBatch->clear();
+    return res;
+  }
+
+  return 0;
+}
+
+int
+ShadowSubdomain::sendBatch(void)
+{
+  if (numBatched == 0)
+    return 0;
+
+  msgData(0) = ShadowActorSubdomain_addObjects;
+  msgData(1) = numBatched;
+  msgData(2) = theBatch->getNumBytes();
+  this->sendID(msgData);
+
+  Message theMessage((char *)theBatch->getData(), theBatch->getNumBytes());
+  numBatched = 0;
+
+  if (this->postSendMessage(theMessage) < 0) {
+    opserr << "ShadowSubdomain::sendBatch() - failed to send the objects\n";
+    return -1;
+  }
+
+  return 0;
+}
+
 bool 
 ShadowSubdomain::addSP_Constraint(SP_Constraint *theSP)
 {
@@ -1052,6 +1158,14 @@ ShadowSubdomain::removeRecorder(int tag)
   return 0;
 }
 
+int  
+ShadowSubdomain::recordersDomainChanged(void)
+{
+  msgData(0) = ShadowActorSubdomain_recordersDomainChanged;
+  this->sendID(msgData);
+  return 0;
+}
+
 int
 ShadowSubdomain::commit(void)
 {
@@ -1265,6 +1379,14 @@ ShadowSubdomain::getTang(void)
   if (gotRemoteData == false && buildRemote == true)
     this->getRemoteData();
 
+    // the reply was posted in computeTang()
+    if (tangPosted == true) {
+      tangPosted = false;
+      if (this->waitAll() < 0)
+	opserr << "ShadowSubdomain::getTang() - failed to receive the tangent\n";
+      return *theMatrix;
+    }
+
     msgData(0) =  ShadowActorSubdomain_getTang;
     this->sendID(msgData);
     
@@ -1288,6 +1410,14 @@ ShadowSubdomain::getResistingForce(void)
   if (gotRemoteData == false && buildRemote == true)
     this->getRemoteData();
 
+    // the reply was posted in computeResidual()
+    if (residualPosted == true) {
+      residualPosted = false;
+      if (this->waitAll() < 0)
+	opserr << "ShadowSubdomain::getResistingForce() - failed to receive the residual\n";
+      return *theVector;
+    }
+
     msgData(0) = ShadowActorSubdomain_getResistingForce;
     this->sendID(msgData);
     
@@ -1303,28 +1433,23 @@ ShadowSubdomain::getResistingForce(void)
 }
 
 
+// int computeTang(void);
+//	the first ShadowSubdomain asked posts, for every ShadowSubdomain,
+//	the command to form the tangent, the command to return it and the
+//	receive for the reply. all the actors then work at the same time and
+//	the replies arrive as they complete; getTang() only waits for its
+//	own. the other ShadowSubdomains have nothing left to do when asked.
+
 int  	  
 ShadowSubdomain::computeTang(void)
 {
     count++;
 
-    if (count == 1) {
-      msgData(0) = ShadowActorSubdomain_computeTang;
-      msgData(1) = this->getTag();
-      this->sendID(msgData);
+    if (count == 1) 
+      for (int i = 0; i < numShadowSubdomains; i++)
+	theShadowSubdomains[i]->postTang();
 
-      for (int i = 0; i < numShadowSubdomains; i++) {
-	ShadowSubdomain *theShadow = theShadowSubdomains[i];
-	if (theShadow != this)
-	  theShadow->computeTang();
-      }
-    }
-    else if (count <= numShadowSubdomains) {
-      msgData(0) = ShadowActorSubdomain_computeTang;
-      msgData(1) = this->getTag();
-      this->sendID(msgData);
-    }
-    else if (count == 2*numShadowSubdomains - 1)
+    if (count == numShadowSubdomains)
       count = 0;
     
     return 0;
@@ -1335,26 +1460,79 @@ ShadowSubdomain::computeResidual(void)
 {
     count++;
 
-    if (count == 1) {
-      msgData(0) = ShadowActorSubdomain_computeResidual;
-      this->sendID(msgData);
+    if (count == 1) 
+      for (int i = 0; i < numShadowSubdomains; i++)
+	theShadowSubdomains[i]->postResidual();
 
-      for (int i = 0; i < numShadowSubdomains; i++) {
-	ShadowSubdomain *theShadow = theShadowSubdomains[i];
-	if (theShadow != this)
-	  theShadow->computeResidual();
-      }
-    }
-    else if (count <= numShadowSubdomains) {
-      msgData(0) = ShadowActorSubdomain_computeResidual;
-      this->sendID(msgData);
-    }
-    else if (count == 2*numShadowSubdomains - 1)
+    if (count == numShadowSubdomains)
       count = 0;
 
     return 0;
 }
 
+int
+ShadowSubdomain::postTang(void)
+{
+  // if the subdoamin was built remotly need to get it's data
+  if (gotRemoteData == false && buildRemote == true)
+    this->getRemoteData();
+
+  // the message buffers are reused, complete anything still posted
+  this->waitAll();
+  tangPosted = false;
+
+  if (theMatrix == 0)
+    theMatrix = new Matrix(numDOF,numDOF);
+  else if (theMatrix->noRows() != numDOF) {
+    delete theMatrix;
+    theMatrix = new Matrix(numDOF,numDOF);
+  }    
+
+  computeData(0) = ShadowActorSubdomain_computeTang;
+  computeData(1) = this->getTag();
+  replyData(0) = ShadowActorSubdomain_getTang;
+
+  if (this->postSendID(computeData) < 0 || this->postSendID(replyData) < 0 ||
+      this->postRecvMatrix(*theMatrix) < 0) {
+    opserr << "ShadowSubdomain::postTang() - failed to post the requests\n";
+    return -1;
+  }
+
+  tangPosted = true;
+  return 0;
+}
+
+int
+ShadowSubdomain::postResidual(void)
+{
+  // if the subdoamin was built remotly need to get it's data
+  if (gotRemoteData == false && buildRemote == true)
+    this->getRemoteData();
+
+  // the message buffers are reused, complete anything still posted
+  this->waitAll();
+  residualPosted = false;
+
+  if (theVector == 0)
+    theVector = new Vector(numDOF);
+  else if (theVector->Size() != numDOF) {
+    delete theVector;
+    theVector = new Vector(numDOF);
+  }    
+
+  computeData(0) = ShadowActorSubdomain_computeResidual;
+  replyData(0) = ShadowActorSubdomain_getResistingForce;
+
+  if (this->postSendID(computeData) < 0 || this->postSendID(replyData) < 0 ||
+      this->postRecvVector(*theVector) < 0) {
+    opserr << "ShadowSubdomain::postResidual() - failed to post the requests\n";
+    return -1;
+  }
+
+  residualPosted = true;
+  return 0;
+}
+
 
 
 const Vector &
@@ -1446,6 +1624,37 @@ ShadowSubdomain::getCost(void)
 }
 
 
+int
+ShadowSubdomain::setElementCostMeasurement(bool measure)
+{
+    msgData(0) = ShadowActorSubdomain_setElementCostMeasurement;
+    msgData(1) = (measure == true) ? 1 : 0;
+    this->sendID(msgData);
+
+    return 0;
+}
+
+
+int
+ShadowSubdomain::getElementCosts(ID &eleTags, Vector &costs, bool reset)
+{
+    msgData(0) = ShadowActorSubdomain_getElementCosts;
+    msgData(1) = (reset == true) ? 1 : 0;
+    this->sendID(msgData);
+    this->recvID(msgData);
+
+    int numEle = msgData(0);
+    if (numEle > 0) {
+      eleTags.resize(numEle);
+      costs.resize(numEle);
+      this->recvID(eleTags);
+      this->recvVector(costs);
+    }
+
+    return numEle;
+}
+
+
 int 
 ShadowSubdomain::sendSelf(int cTag, Channel &the_Channel)
 {
@@ -41,6 +41,9 @@
 #include <Shadow.h>
 #include <remote.h>
 
+class MemoryChannel;
+class MovableObject;
+
 class ShadowSubdomain: public Shadow, public Subdomain
 {
   public:
@@ -65,6 +68,8 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual  bool addElement(Element *);
     virtual  bool addNode(Node *);
     virtual  bool addExternalNode(Node *);
+    virtual  int startMigration(void);
+    virtual  int endMigration(void);
     virtual  bool addSP_Constraint(SP_Constraint *);
     virtual  int  addSP_Constraint(int axisDirn, double axisValue, 
 				   const ID &fixityCodes, double tol=1e-10);
@@ -134,6 +139,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int  addRecorder(Recorder &theRecorder);    	
     virtual int  removeRecorders(void);
     virtual int  removeRecorder(int tag);
+    virtual int  recordersDomainChanged(void);
 
     virtual void wipeAnalysis(void);
     virtual void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
@@ -166,6 +172,8 @@ class ShadowSubdomain: public Shadow, public Subdomain
 			 FEM_ObjectBroker &theBroker);    
 
     virtual double getCost(void);
+    virtual int setElementCostMeasurement(bool measure);
+    virtual int getElementCosts(ID &eleTags, Vector &costs, bool reset = true);
     
     virtual  void Print(OPS_Stream &s, int flag =0);
     virtual void Print(OPS_Stream &s, ID *nodeTags, ID *eleTags, int flag =0);
@@ -186,7 +194,22 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int buildNodeGraph(Graph *theNodeGraph);    
     
   private:
+    int postTang(void);
+    int postResidual(void);
+    int addToBatch(int action, MovableObject &theObject);
+    int sendBatch(void);
+
     ID msgData;
+    ID computeData;   // messages for the posted requests, see computeTang()
+    ID replyData;
+    bool tangPosted;
+    bool residualPosted;
+
+    // nodes and elements waiting to be sent, see startMigration()
+    MemoryChannel *theBatch;
+    ID batchData;
+    int numBatched;
+    bool migrating;
     ID theElements;
     ID theNodes;
     ID theExternalNodes;    
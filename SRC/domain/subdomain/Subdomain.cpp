@@ -438,6 +438,24 @@ Subdomain::getExternalNodeIter(void)
 }
 
 
+// int startMigration(void);
+// int endMigration(void);
+//	Methods invoked by the DomainPartitioner around the adding of the
+//	nodes and elements; nothing to do for a Subdomain in this process.
+
+int
+Subdomain::startMigration(void)
+{
+    return 0;
+}
+
+int
+Subdomain::endMigration(void)
+{
+    return 0;
+}
+
+
 
 void
 Subdomain::wipeAnalysis(void)
@@ -105,6 +105,11 @@ class Subdomain: public Element, public Domain
     virtual NodeIter &getExternalNodeIter(void);
     virtual bool addExternalNode(Node *);
 
+    // the nodes and elements added between these calls may be moved to
+    // the subdomain together when it is partitioned
+    virtual int startMigration(void);
+    virtual int endMigration(void);
+
     virtual void wipeAnalysis(void);
     virtual void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
     virtual int setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm);
@@ -0,0 +1,350 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/subdomain/ThreadedSubdomain.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// ThreadedSubdomain.
+//
+// What: "@(#) ThreadedSubdomain.cpp, revA"
+
+#include <ThreadedSubdomain.h>
+#include <ThreadPool.h>
+#include <MemoryChannel.h>
+#include <FEM_ObjectBroker.h>
+#include <MovableObject.h>
+#include <DomainDecompositionAnalysis.h>
+#include <EquiSolnAlgo.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <EigenSOE.h>
+#include <ConvergenceTest.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <OPS_Globals.h>
+
+double ThreadedSubdomain::newTime = 0.0;
+double ThreadedSubdomain::dT = 0.0;
+int ThreadedSubdomain::numThreadedSubdomains = 0;
+ThreadedSubdomain **ThreadedSubdomain::theThreadedSubdomains = 0;
+
+// performs one operation on a range of the ThreadedSubdomains
+class ThreadedSubdomainTask: public ThreadTask
+{
+ public:
+  ThreadedSubdomainTask(int op) :operation(op) {};
+
+  int execute(int start, int end, int threadID) {
+    for (int i=start; i<end; i++) {
+      ThreadedSubdomain *theSub = ThreadedSubdomain::theThreadedSubdomains[i];
+      theSub->results[operation] = theSub->perform(operation);
+      theSub->done[operation] = true;
+    }
+    return 0;
+  }
+
+ private:
+  int operation;
+};
+
+ThreadedSubdomain::ThreadedSubdomain(int tag, FEM_ObjectBroker &passedBroker)
+  :Subdomain(tag), theBroker(&passedBroker), theChannel(0)
+{
+  theChannel = new MemoryChannel();
+
+  for (int i=0; i<numOperations; i++) {
+    results[i] = 0;
+    done[i] = false;
+  }
+
+  numThreadedSubdomains++;
+
+  ThreadedSubdomain **theCopy = new ThreadedSubdomain *[numThreadedSubdomains];
+
+  for (int i = 0; i < numThreadedSubdomains-1; i++)
+    theCopy[i] = theThreadedSubdomains[i];
+
+  if (theThreadedSubdomains != 0)
+    delete [] theThreadedSubdomains;
+
+  theCopy[numThreadedSubdomains-1] = this;
+
+  theThreadedSubdomains = theCopy;
+}
+
+ThreadedSubdomain::~ThreadedSubdomain()
+{
+  // the analysis is wiped here, while the channel it remembers is valid
+  this->Subdomain::wipeAnalysis();
+
+  int loc = 0;
+  for (int i = 0; i < numThreadedSubdomains; i++)
+    if (theThreadedSubdomains[i] != this)
+      theThreadedSubdomains[loc++] = theThreadedSubdomains[i];
+
+  numThreadedSubdomains = loc;
+  if (numThreadedSubdomains == 0) {
+    delete [] theThreadedSubdomains;
+    theThreadedSubdomains = 0;
+  }
+
+  if (theChannel != 0)
+    delete theChannel;
+}
+
+void
+ThreadedSubdomain::setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis)
+{
+  DomainDecompositionAnalysis *theCopy =
+    theBroker->getNewDomainDecompAnalysis(theAnalysis.getClassTag(), *this);
+
+  if (theCopy == 0 || this->copyObject(theAnalysis, *theCopy) < 0) {
+    opserr << "ThreadedSubdomain::setDomainDecompAnalysis() - subdomain " << this->getTag();
+    opserr << " failed to copy the analysis\n";
+    if (theCopy != 0)
+      delete theCopy;
+    return;
+  }
+
+  this->Subdomain::wipeAnalysis();
+  this->Subdomain::setDomainDecompAnalysis(*theCopy);
+}
+
+int
+ThreadedSubdomain::setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm)
+{
+  EquiSolnAlgo *theCopy = theBroker->getNewEquiSolnAlgo(theAlgorithm.getClassTag());
+  if (theCopy == 0 || this->copyObject(theAlgorithm, *theCopy) < 0) {
+    opserr << "ThreadedSubdomain::setAnalysisAlgorithm() - failed to copy the algorithm\n";
+    if (theCopy != 0)
+      delete theCopy;
+    return -1;
+  }
+
+  int res = this->Subdomain::setAnalysisAlgorithm(*theCopy);
+  if (res < 0)
+    delete theCopy;
+  return res;
+}
+
+int
+ThreadedSubdomain::setAnalysisIntegrator(IncrementalIntegrator &theIntegrator)
+{
+  IncrementalIntegrator *theCopy = 
+    theBroker->getNewIncrementalIntegrator(theIntegrator.getClassTag());
+  if (theCopy == 0 || this->copyObject(theIntegrator, *theCopy) < 0) {
+    opserr << "ThreadedSubdomain::setAnalysisIntegrator() - failed to copy the integrator\n";
+    if (theCopy != 0)
+      delete theCopy;
+    return -1;
+  }
+
+  int res = this->Subdomain::setAnalysisIntegrator(*theCopy);
+  if (res < 0)
+    delete theCopy;
+  return res;
+}
+
+int
+ThreadedSubdomain::setAnalysisLinearSOE(LinearSOE &theSOE)
+{
+  LinearSOE *theCopy = theBroker->getNewLinearSOE(theSOE.getClassTag());
+  if (theCopy == 0 || this->copyObject(theSOE, *theCopy) < 0) {
+    opserr << "ThreadedSubdomain::setAnalysisLinearSOE() - failed to copy the system of equations\n";
+    if (theCopy != 0)
+      delete theCopy;
+    return -1;
+  }
+
+  int res = this->Subdomain::setAnalysisLinearSOE(*theCopy);
+  if (res < 0)
+    delete theCopy;
+  return res;
+}
+
+int
+ThreadedSubdomain::setAnalysisEigenSOE(EigenSOE &theSOE)
+{
+  EigenSOE *theCopy = theBroker->getNewEigenSOE(theSOE.getClassTag());
+  if (theCopy == 0 || this->copyObject(theSOE, *theCopy) < 0) {
+    opserr << "ThreadedSubdomain::setAnalysisEigenSOE() - failed to copy the eigen system\n";
+    if (theCopy != 0)
+      delete theCopy;
+    return -1;
+  }
+
+  int res = this->Subdomain::setAnalysisEigenSOE(*theCopy);
+  if (res < 0)
+    delete theCopy;
+  return res;
+}
+
+int
+ThreadedSubdomain::setAnalysisConvergenceTest(ConvergenceTest &theTest)
+{
+  ConvergenceTest *theCopy = theBroker->getNewConvergenceTest(theTest.getClassTag());
+  if (theCopy == 0 || this->copyObject(theTest, *theCopy) < 0) {
+    opserr << "ThreadedSubdomain::setAnalysisConvergenceTest() - failed to copy the test\n";
+    if (theCopy != 0)
+      delete theCopy;
+    return -1;
+  }
+
+  int res = this->Subdomain::setAnalysisConvergenceTest(*theCopy);
+  if (res < 0)
+    delete theCopy;
+  return res;
+}
+
+int
+ThreadedSubdomain::update(void)
+{
+  if (done[UPDATE] == false)
+    startOperation(UPDATE);
+
+  done[UPDATE] = false;
+  return results[UPDATE];
+}
+
+int
+ThreadedSubdomain::update(double time, double deltaT)
+{
+  if (done[UPDATE_TIME] == false) {
+    newTime = time;
+    dT = deltaT;
+    startOperation(UPDATE_TIME);
+  }
+
+  done[UPDATE_TIME] = false;
+  return results[UPDATE_TIME];
+}
+
+int
+ThreadedSubdomain::computeTang(void)
+{
+  if (done[COMPUTE_TANG] == false)
+    startOperation(COMPUTE_TANG);
+
+  done[COMPUTE_TANG] = false;
+  return results[COMPUTE_TANG];
+}
+
+int
+ThreadedSubdomain::computeResidual(void)
+{
+  if (done[COMPUTE_RESIDUAL] == false)
+    startOperation(COMPUTE_RESIDUAL);
+
+  done[COMPUTE_RESIDUAL] = false;
+  return results[COMPUTE_RESIDUAL];
+}
+
+int
+ThreadedSubdomain::computeNodalResponse(void)
+{
+  if (done[COMPUTE_NODAL_RESPONSE] == false)
+    startOperation(COMPUTE_NODAL_RESPONSE);
+
+  done[COMPUTE_NODAL_RESPONSE] = false;
+  return results[COMPUTE_NODAL_RESPONSE];
+}
+
+int
+ThreadedSubdomain::perform(int operation)
+{
+  switch (operation) {
+  case COMPUTE_TANG:
+    return this->Subdomain::computeTang();
+  case COMPUTE_RESIDUAL:
+    return this->Subdomain::computeResidual();
+  case COMPUTE_NODAL_RESPONSE:
+    return this->Subdomain::computeNodalResponse();
+  case UPDATE:
+    return this->Subdomain::update();
+  case UPDATE_TIME:
+    return this->Subdomain::update(newTime, dT);
+  default:
+    return -1;
+  }
+}
+
+int
+ThreadedSubdomain::copyObject(MovableObject &theObject, MovableObject &theCopy)
+{
+  theChannel->clear();
+  if (theObject.sendSelf(0, *theChannel) < 0)
+    return -1;
+
+  theChannel->rewind();
+  return theCopy.recvSelf(0, *theChannel, *theBroker);
+}
+
+// static bool canRunConcurrently(void);
+//	returns true if the ThreadedSubdomains may do their work at the
+//	same time. They may not yet: whatever their elements, they share
+//	the class wide tangent and unbalance objects of the DOF_Groups and
+//	TransformationDOF_Groups, and the static objects through which the
+//	DomainDecompositionAnalysis classes return their results, so two
+//	subdomains formed at once would write over each other's tangents
+//	and residuals. Until that storage is held per thread, as it is for
+//	the FE_Elements, the subdomains do their work in turn.
+
+bool
+ThreadedSubdomain::canRunConcurrently(void)
+{
+  return false;
+}
+
+// static int startOperation(int operation);
+//	performs the operation on all the ThreadedSubdomains, on the
+//	threads of the ThreadPool if there is one and canRunConcurrently()
+//	allows it, in turn otherwise; the other subdomains are
+//	then marked done so they return their result when asked. The
+//	global constants set by Domain::update() are set here, by the
+//	calling thread, as the subdomains on the pool leave them alone.
+
+int
+ThreadedSubdomain::startOperation(int operation)
+{
+  for (int i=0; i<numThreadedSubdomains; i++)
+    theThreadedSubdomains[i]->done[operation] = false;
+
+  ThreadedSubdomainTask theTask(operation);
+
+  ThreadPool *thePool = ThreadPool::getThreadPool();
+  if (thePool != 0 && numThreadedSubdomains > 1 && canRunConcurrently() == true) {
+    if (operation == UPDATE || operation == UPDATE_TIME) {
+      ThreadedSubdomain *theSub = theThreadedSubdomains[numThreadedSubdomains-1];
+      if (operation == UPDATE_TIME)
+	ops_Dt = dT;
+      else
+	ops_Dt = theSub->getCurrentTime() - theSub->getCommittedTime();
+      ops_TheActiveDomain = theSub;
+    }
+    thePool->run(theTask, numThreadedSubdomains);
+  } else
+    theTask.execute(0, numThreadedSubdomains, 0);
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/subdomain/ThreadedSubdomain.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// ThreadedSubdomain. A ThreadedSubdomain is a Subdomain whose work is
+// done on the threads of the ThreadPool, in the same address space as
+// the PartitionedDomain, rather than by an ActorSubdomain in another
+// process. As with the ShadowSubdomain the first subdomain asked to
+// computeTang(), computeResidual(), computeNodalResponse() or update()
+// starts the operation on every ThreadedSubdomain, the subdomains being
+// shared out over the threads of the pool, and each subdomain then
+// hands back its own result when it is asked for it in turn. The
+// condensed tangent and residual are returned by reference, nothing is
+// copied through a Channel. As for the ShadowSubdomain, every
+// ThreadedSubdomain must be asked in turn before the operation is next
+// started, as the PartitionedDomain and the FE_Elements do.
+//
+// The analysis objects given to setDomainDecompAnalysis() and the
+// setAnalysis methods are copied, through sendSelf() and recvSelf(), so
+// that each subdomain has its own, as an ActorSubdomain would.
+// Without a ThreadPool the subdomains do their work in turn; for now
+// they also do so with one, as they share the class wide storage of
+// the DOF_Groups and the DomainDecompositionAnalysis classes (see
+// canRunConcurrently()).
+//
+// What: "@(#) ThreadedSubdomain.h, revA"
+
+#ifndef ThreadedSubdomain_h
+#define ThreadedSubdomain_h
+
+#include <Subdomain.h>
+
+class FEM_ObjectBroker;
+class MemoryChannel;
+class MovableObject;
+
+class ThreadedSubdomain: public Subdomain
+{
+  public:
+    ThreadedSubdomain(int tag, FEM_ObjectBroker &theBroker);
+    ~ThreadedSubdomain();
+
+    virtual void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
+    virtual int setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm);
+    virtual int setAnalysisIntegrator(IncrementalIntegrator &theIntegrator);
+    virtual int setAnalysisLinearSOE(LinearSOE &theSOE);
+    virtual int setAnalysisEigenSOE(EigenSOE &theSOE);
+    virtual int setAnalysisConvergenceTest(ConvergenceTest &theTest);
+
+    virtual int update(void);
+    virtual int update(double newTime, double dT);
+    virtual int computeTang(void);
+    virtual int computeResidual(void);
+    virtual int computeNodalResponse(void);
+
+  protected:
+
+  private:
+    friend class ThreadedSubdomainTask;
+
+    enum {COMPUTE_TANG, COMPUTE_RESIDUAL, COMPUTE_NODAL_RESPONSE,
+	  UPDATE, UPDATE_TIME, numOperations};
+
+    int perform(int operation);
+    int copyObject(MovableObject &theObject, MovableObject &theCopy);
+
+    FEM_ObjectBroker *theBroker;
+    MemoryChannel *theChannel;       // kept, the analysis remembers it
+
+    int results[numOperations];
+    bool done[numOperations];
+
+    static bool canRunConcurrently(void);
+    static int startOperation(int operation);
+    static double newTime;
+    static double dT;
+    static int numThreadedSubdomains;
+    static ThreadedSubdomain **theThreadedSubdomains;
+};
+
+#endif
@@ -43,13 +43,79 @@
 #include <Matrix.h>
 #include <Node.h>
 #include <Domain.h>
+#include <ThreadWorkspace.h>
 
 Element  *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+// the matrix and vectors used to form the damping matrix and the
+// residuals in the base class, indexed by the number of dof; each
+// thread has its own set so the routines can be called concurrently
+class ElementWorkspace
+{
+ public:
+  ElementWorkspace() :size(0), theMatrices(0), theVectors1(0), theVectors2(0) {};
+  ~ElementWorkspace() {
+    for (int i=0; i<size; i++) {
+      if (theMatrices[i] != 0) {
+	delete theMatrices[i];
+	delete theVectors1[i];
+	delete theVectors2[i];
+      }
+    }
+    if (theMatrices != 0) {
+      delete [] theMatrices;
+      delete [] theVectors1;
+      delete [] theVectors2;
+    }
+  };
+
+  Matrix *getMatrix(int numDOF)  {this->setSize(numDOF); return theMatrices[numDOF];};
+  Vector *getVector1(int numDOF) {this->setSize(numDOF); return theVectors1[numDOF];};
+  Vector *getVector2(int numDOF) {this->setSize(numDOF); return theVectors2[numDOF];};
+
+ private:
+  void setSize(int numDOF) {
+    if (numDOF >= size) {
+      int newSize = numDOF+1;
+      Matrix **nextMatrices = new Matrix *[newSize];
+      Vector **nextVectors1 = new Vector *[newSize];
+      Vector **nextVectors2 = new Vector *[newSize];
+      for (int i=0; i<newSize; i++) {
+	if (i < size) {
+	  nextMatrices[i] = theMatrices[i];
+	  nextVectors1[i] = theVectors1[i];
+	  nextVectors2[i] = theVectors2[i];
+	} else {
+	  nextMatrices[i] = 0;
+	  nextVectors1[i] = 0;
+	  nextVectors2[i] = 0;
+	}
+      }
+      if (theMatrices != 0) {
+	delete [] theMatrices;
+	delete [] theVectors1;
+	delete [] theVectors2;
+      }
+      theMatrices = nextMatrices;
+      theVectors1 = nextVectors1;
+      theVectors2 = nextVectors2;
+      size = newSize;
+    }
+
+    if (theMatrices[numDOF] == 0) {
+      theMatrices[numDOF] = new Matrix(numDOF, numDOF);
+      theVectors1[numDOF] = new Vector(numDOF);
+      theVectors2[numDOF] = new Vector(numDOF);
+    }
+  };
+
+  int size;
+  Matrix **theMatrices; 
+  Vector **theVectors1; 
+  Vector **theVectors2; 
+};
+
+static ThreadWorkspace<ElementWorkspace> theWorkspace;
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -119,67 +185,10 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
+  // the work matrix & vectors used to compute/return the damping
+  // matrix & residual force are those sized for the element's dof
+  if (index == -1)
+    index = this->getNumDOF();
 
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
@@ -199,6 +208,14 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   return 0;
 }
 
+// hasRayleighDamping() returns true if any of the rayleigh factors
+// set on the element are not zero.
+bool
+Element::hasRayleighDamping(void)
+{
+  return (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0);
+}
+
 const Matrix &
 Element::getDamp(void) 
 {
@@ -207,7 +224,7 @@ Element::getDamp(void)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = theWorkspace.get().getMatrix(index); 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -232,7 +249,7 @@ Element::getMass(void)
   }
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = theWorkspace.get().getMatrix(index); 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -244,9 +261,10 @@ Element::getResistingForceIncInertia(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  ElementWorkspace &theWork = theWorkspace.get();
+  Matrix *theMatrix = theWork.getMatrix(index); 
+  Vector *theVector = theWork.getVector2(index);
+  Vector *theVector2 = theWork.getVector1(index);
 
   //
   // perform: R = P(U) - Pext(t);
@@ -311,9 +329,10 @@ Element::getRayleighDampingForces(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  ElementWorkspace &theWork = theWorkspace.get();
+  Matrix *theMatrix = theWork.getMatrix(index); 
+  Vector *theVector = theWork.getVector2(index);
+  Vector *theVector2 = theWork.getVector1(index);
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -407,6 +426,15 @@ Element::isSubdomain(void)
     return false;
 }
 
+// an element returns true only once its state determination has been
+// audited to touch no storage shared with other elements (statics); it
+// may then be updated and assembled by a ThreadPool.
+bool
+Element::isThreadSafe(void)
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -489,7 +517,7 @@ Element::getResistingForceSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = theWorkspace.get().getVector1(index);
   theVector->Zero();
 
   return *theVector;
@@ -502,7 +530,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = theWorkspace.get().getMatrix(index);
   theMatrix->Zero();
 
   return *theMatrix;
@@ -515,7 +543,7 @@ Element::getMassSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = theWorkspace.get().getMatrix(index);
   theMatrix->Zero();
 
   return *theMatrix;
@@ -546,7 +574,7 @@ Element::getDampSensitivity(int gradIndex)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = theWorkspace.get().getMatrix(index); 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
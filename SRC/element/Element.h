@@ -66,6 +66,7 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void);
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -81,6 +82,7 @@ class Element : public DomainComponent
 
     virtual int addInertiaLoadToUnbalance(const Vector &accel);
     virtual int setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
+    virtual bool hasRayleighDamping(void);
 
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce(void) =0;
@@ -119,11 +121,6 @@ class Element : public DomainComponent
 
   private:
     int index, nodeIndex;
-
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
 };
 
 
@@ -40,6 +40,7 @@
 #include <ErrorHandler.h>
 #include <Brick.h>
 #include <shp3d.h>
+#include <ThreadWorkspace.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <Parameter.h>
@@ -48,14 +49,6 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-//static data
-double  Brick::xl[3][8] ;
-
-Matrix  Brick::stiff(24,24) ;
-Vector  Brick::resid(24) ;
-Matrix  Brick::mass(24,24) ;
-
-    
 //quadrature data
 const double  Brick::root3 = sqrt(3.0) ;
 const double  Brick::one_over_root3 = 1.0 / root3 ;
@@ -66,16 +59,42 @@ const double  Brick::sg[] = { -one_over_root3,
 const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0, 
                               1.0, 1.0, 1.0, 1.0  } ;
 
-  
-static Matrix B(6,3) ;
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct BrickWorkspace {
+  BrickWorkspace()
+    :stiff(24,24), resid(24), mass(24,24), res(24), B(6,3),
+     BJ(6,3), BJtran(3,6), BK(6,3), BJtranD(3,6), stiffJK(3,3), dd(6,6),
+     strain(6), stress(6), residJ(3), momentum(3) {};
+
+  Matrix stiff;
+  Vector resid;
+  Matrix mass;
+  Vector res;
+
+  //local nodal coordinates, three coordinates for each of eight nodes
+  double xl[3][8];
+
+  Matrix B;
+  Matrix BJ;
+  Matrix BJtran;
+  Matrix BK;
+  Matrix BJtranD;
+  Matrix stiffJK;
+  Matrix dd;
+  Vector strain;
+  Vector stress;
+  Vector residJ;
+  Vector momentum;
+};
+
+static ThreadWorkspace<BrickWorkspace> theWorkspace;
 
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
  connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
 {
-  B.Zero();
-
   for (int i=0; i<8; i++ ) {
     materialPointers[i] = 0;
     nodePointers[i] = 0;
@@ -103,8 +122,6 @@ Brick::Brick(int tag,
   :Element(tag, ELE_TAG_Brick),
    connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
 {
-  B.Zero();
-
   connectedExternalNodes(0) = node1 ;
   connectedExternalNodes(1) = node2 ;
   connectedExternalNodes(2) = node3 ;
@@ -234,6 +251,16 @@ int  Brick::revertToStart( )
   return success ;
 }
 
+//true if the materials may be driven by several threads
+bool  Brick::isThreadSafe( )
+{
+  for (int i = 0; i < 8; i++)
+    if (materialPointers[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 //print out element data
 void  Brick::Print( OPS_Stream &s, int flag )
 {
@@ -313,6 +340,9 @@ void  Brick::Print( OPS_Stream &s, int flag )
 //return stiffness matrix 
 const Matrix&  Brick::getTangentStiff( ) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Matrix &stiff = theWork.stiff;
+
   int tang_flag = 1 ; //get the tangent 
 
   //do tangent and residual here
@@ -328,6 +358,10 @@ const Matrix&  Brick::getTangentStiff( )
 const Matrix&  Brick::getInitialStiff( ) 
 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Matrix &stiff = theWork.stiff;
+  double (*xl)[8] = theWork.xl;
+
   if (Ki != 0)
     return *Ki;
 
@@ -343,26 +377,24 @@ const Matrix&  Brick::getInitialStiff( )
   int jj, kk ;
 
   
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  double xsj ;  // determinant jacaobian matrix 
+  double dvol[numberGauss] ; //volume element
+  double gaussPoint[ndm] ;
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  Matrix &stiffJK = theWork.stiffJK ; //nodeJK stiffness 
+  Matrix &dd = theWork.dd ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    Matrix &BJ = theWork.BJ ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    Matrix &BJtran = theWork.BJtran ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    Matrix &BK = theWork.BK ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    Matrix &BJtranD = theWork.BJtranD ;
 
   //-------------------------------------------------------
 
@@ -376,7 +408,6 @@ const Matrix&  Brick::getInitialStiff( )
   //gauss loop to compute and save shape functions 
 
   int count = 0 ;
-  volume = 0.0 ;
 
   for ( i = 0; i < 2; i++ ) {
     for ( j = 0; j < 2; j++ ) {
@@ -468,6 +499,9 @@ const Matrix&  Brick::getInitialStiff( )
 //return mass matrix
 const Matrix&  Brick::getMass( ) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Matrix &mass = theWork.mass;
+
   int tangFlag = 1 ;
 
   formInertiaTerms( tangFlag ) ;
@@ -523,6 +557,10 @@ Brick::addLoad(ElementalLoad *theLoad, double loadFactor)
 int
 Brick::addInertiaLoadToUnbalance(const Vector &accel)
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+  Matrix &mass = theWork.mass;
+
   static const int numberNodes = 8 ;
   static const int numberGauss = 8 ;
   static const int ndf = 3 ; 
@@ -565,6 +603,9 @@ Brick::addInertiaLoadToUnbalance(const Vector &accel)
 //get residual
 const Vector&  Brick::getResistingForce( ) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+
   int tang_flag = 0 ; //don't get the tangent
 
   formResidAndTangent( tang_flag ) ;
@@ -579,7 +620,10 @@ const Vector&  Brick::getResistingForce( )
 //get residual with inertia terms
 const Vector&  Brick::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  BrickWorkspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+
+  Vector &res = theWork.res ;
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -606,6 +650,10 @@ const Vector&  Brick::getResistingForceIncInertia( )
 
 void   Brick::formInertiaTerms( int tangFlag ) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+  Matrix &mass = theWork.mass;
+  double (*xl)[8] = theWork.xl;
 
   static const int ndm = 3 ;
 
@@ -623,13 +671,13 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  double gaussPoint[ndm] ;
 
-  static Vector momentum(ndf) ;
+  Vector &momentum = theWork.momentum ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -745,15 +793,13 @@ void   Brick::formInertiaTerms( int tangFlag )
 int  
 Brick::update(void) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  double (*xl)[8] = theWork.xl;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
   static const int ndm = 3 ;
 
-  static const int ndf = 3 ; 
-
-  static const int nstress = 6 ;
- 
   static const int numberNodes = 8 ;
 
   static const int numberGauss = 8 ;
@@ -761,33 +807,16 @@ Brick::update(void)
   static const int nShape = 4 ;
 
   int i, j, k, p, q ;
-  int success ;
   
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static Vector strain(nstress) ;  //strain
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+  double xsj ;  // determinant jacaobian matrix 
 
-    static Matrix BJtran(ndf,nstress) ;
+  double gaussPoint[ndm] ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+  Vector &strain = theWork.strain ;  //strain
 
-    static Matrix BJtranD(ndf,nstress) ;
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  //-------------------------------------------------------
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
   
   //compute basis vectors and local nodal coordinates
@@ -796,7 +825,6 @@ Brick::update(void)
   //gauss loop to compute and save shape functions 
 
   int count = 0 ;
-  volume = 0.0 ;
 
   for ( i = 0; i < 2; i++ ) {
     for ( j = 0; j < 2; j++ ) {
@@ -816,11 +844,6 @@ Brick::update(void)
 	} // end for p
 
 
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
 	count++ ;
 
       } //end for k
@@ -900,7 +923,7 @@ Brick::update(void)
     } // end for j
     
     //send the strain to the material 
-    success = materialPointers[i]->setTrialStrain( strain ) ;
+    materialPointers[i]->setTrialStrain( strain ) ;
 
   } //end for i gauss loop 
 
@@ -912,6 +935,10 @@ Brick::update(void)
 //form residual and tangent
 void  Brick::formResidAndTangent( int tang_flag ) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Matrix &stiff = theWork.stiff;
+  Vector &resid = theWork.resid;
+  double (*xl)[8] = theWork.xl;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
@@ -930,36 +957,34 @@ void  Brick::formResidAndTangent( int tang_flag )
   int i, j, k, p, q ;
 
 
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  double gaussPoint[ndm] ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  Vector &residJ = theWork.residJ ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  Matrix &stiffJK = theWork.stiffJK ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress
+  Vector &stress = theWork.stress ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  Matrix &dd = theWork.dd ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    Matrix &BJ = theWork.BJ ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    Matrix &BJtran = theWork.BJtran ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    Matrix &BK = theWork.BK ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    Matrix &BJtranD = theWork.BJtranD ;
 
   //-------------------------------------------------------
 
@@ -974,7 +999,6 @@ void  Brick::formResidAndTangent( int tang_flag )
   //gauss loop to compute and save shape functions 
 
   int count = 0 ;
-  volume = 0.0 ;
 
   for ( i = 0; i < 2; i++ ) {
     for ( j = 0; j < 2; j++ ) {
@@ -1134,6 +1158,8 @@ void  Brick::formResidAndTangent( int tang_flag )
 
 void   Brick::computeBasis( ) 
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  double (*xl)[8] = theWork.xl;
 
   //nodal coordinates 
 
@@ -1156,6 +1182,8 @@ void   Brick::computeBasis( )
 const Matrix&   
 Brick::computeB( int node, const double shp[4][8] )
 {
+  BrickWorkspace &theWork = theWorkspace.get();
+  Matrix &B = theWork.B;
 
 //---B Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1528,7 +1556,7 @@ Brick::setResponse(const char **argv, int argc, OPS_Stream &output)
       output.tag("ResponseType",outputData);
     }
 
-    theResponse = new ElementResponse(this, 1, resid);
+    theResponse = new ElementResponse(this, 1, Vector(24));
   
   }   else if (strcmp(argv[0],"material") == 0 || strcmp(argv[0],"integrPoint") == 0) {
 
@@ -89,6 +89,7 @@ class Brick : public Element {
     
     //revert to start 
     int revertToStart( ) ;
+    bool isThreadSafe( ) ;
 
     // update
     int update(void);
@@ -144,23 +145,11 @@ class Brick : public Element {
     Vector *load;
     Matrix *Ki;
 
-    //
-    // static attributes
-    //
-
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
-
     //quadrature data
     static const double root3 ;
     static const double one_over_root3 ;    
     static const double sg[2] ;
     static const double wg[8] ;
-  
-    //local nodal coordinates, three coordinates for each of four nodes
-    static double xl[3][8] ; 
 
     //
     // private methods
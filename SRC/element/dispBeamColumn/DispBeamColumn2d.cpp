@@ -39,6 +39,7 @@
 #include <string.h>
 #include <Information.h>
 #include <Parameter.h>
+#include <ThreadWorkspace.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ElementResponse.h>
@@ -46,9 +47,31 @@
 #include <math.h>
 #include <ElementalLoad.h>
 
-Matrix DispBeamColumn2d::K(6,6);
-Vector DispBeamColumn2d::P(6);
-double DispBeamColumn2d::workArea[100];
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct DispBeamColumn2dWorkspace {
+  DispBeamColumn2dWorkspace()
+    :K(6,6), P(6), kb(3,3), ml(6,6), Raccel(6), accel(6), data(14), v1(3),
+     v2(3), vp(3), ve(3), dqdh(3), dp0dh(3), kbmine(3,3), dvdh(3) {};
+
+  Matrix K;
+  Vector P;
+  double workArea[100];
+  Matrix kb;
+  Matrix ml;
+  Vector Raccel;
+  Vector accel;
+  Vector data;
+  Vector v1;
+  Vector v2;
+  Vector vp;
+  Vector ve;
+  Vector dqdh;
+  Vector dp0dh;
+  Matrix kbmine;
+  Vector dvdh;
+};
+
+static ThreadWorkspace<DispBeamColumn2dWorkspace> theWorkspace;
 
 DispBeamColumn2d::DispBeamColumn2d(int tag, int nd1, int nd2,
 				   int numSec, SectionForceDeformation **s,
@@ -262,9 +285,25 @@ DispBeamColumn2d::revertToStart()
     return retVal;
 }
 
+bool
+DispBeamColumn2d::isThreadSafe(void)
+{
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 int
 DispBeamColumn2d::update(void)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   int err = 0;
 
   // Update the transformation
@@ -318,7 +357,11 @@ DispBeamColumn2d::update(void)
 const Matrix&
 DispBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3,3);
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+  double *workArea = theWork.workArea;
+
+  Matrix &kb = theWork.kb;
 
   // Zero for integral
   kb.Zero();
@@ -422,7 +465,10 @@ DispBeamColumn2d::getTangentStiff()
 const Matrix&
 DispBeamColumn2d::getInitialBasicStiff()
 {
-  static Matrix kb(3,3);
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
+  Matrix &kb = theWork.kb;
 
   // Zero for integral
   kb.Zero();
@@ -501,6 +547,9 @@ DispBeamColumn2d::getInitialBasicStiff()
 const Matrix&
 DispBeamColumn2d::getInitialStiff()
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
   const Matrix &kb = this->getInitialBasicStiff();
 
   // Transform to global stiffness
@@ -512,6 +561,9 @@ DispBeamColumn2d::getInitialStiff()
 const Matrix&
 DispBeamColumn2d::getMass()
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
   K.Zero();
 
   if (rho == 0.0)
@@ -524,7 +576,7 @@ DispBeamColumn2d::getMass()
     K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(6,6);
+    Matrix &ml = theWork.ml;
     double m = rho*L/420.0;
     ml(0,0) = ml(3,3) = m*140.0;
     ml(0,3) = ml(3,0) = m*70.0;
@@ -628,6 +680,8 @@ DispBeamColumn2d::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
 	// Check for a quick return
 	if (rho == 0.0) 
 		return 0;
@@ -653,7 +707,7 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
       Q(4) -= m*Raccel2(1);
     } else  {
       // use matrix vector multip. for consistent mass matrix
-      static Vector Raccel(6);
+      Vector &Raccel = theWork.Raccel;
       for (int i=0; i<3; i++)  {
         Raccel(i)   = Raccel1(i);
         Raccel(i+3) = Raccel2(i);
@@ -667,6 +721,9 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector&
 DispBeamColumn2d::getResistingForce()
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   double L = crdTransf->getInitialLength();
   
   double oneOverL = 1.0/L;
@@ -727,6 +784,9 @@ DispBeamColumn2d::getResistingForce()
 const Vector&
 DispBeamColumn2d::getResistingForceIncInertia()
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   P = this->getResistingForce();
   
   // Subtract other external nodal loads ... P_res = P_int - P_ext
@@ -747,7 +807,7 @@ DispBeamColumn2d::getResistingForceIncInertia()
     P(4) += m*accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    Vector &accel = theWork.accel;
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -772,13 +832,15 @@ DispBeamColumn2d::getResistingForceIncInertia()
 int
 DispBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
   // place the integer data into an ID
 
   int dbTag = this->getDbTag();
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  Vector &data = theWork.data;
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -866,13 +928,15 @@ int
 DispBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
 			   FEM_ObjectBroker &theBroker)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
   //
   // receive the integer data containing tag, numSections and coord transformation info
   //
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  Vector &data = theWork.data;
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn2d::recvSelf() - failed to recv data Vector\n";
@@ -1068,8 +1132,10 @@ DispBeamColumn2d::Print(OPS_Stream &s, int flag)
 int
 DispBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &v1 = theWork.v1;
+  Vector &v2 = theWork.v2;
 
   if (displayMode >= 0) {
 
@@ -1119,7 +1185,7 @@ DispBeamColumn2d::setResponse(const char **argv, int argc,
     output.tag("ResponseType","Py_2");
     output.tag("ResponseType","Mz_2");
 
-    theResponse =  new ElementResponse(this, 1, P);
+    theResponse =  new ElementResponse(this, 1, Vector(6));
   
   
   // local force -
@@ -1132,7 +1198,7 @@ DispBeamColumn2d::setResponse(const char **argv, int argc,
     output.tag("ResponseType","V2");
     output.tag("ResponseType","M2");
 
-    theResponse =  new ElementResponse(this, 2, P);
+    theResponse =  new ElementResponse(this, 2, Vector(6));
   
 
   // basic force -
@@ -1167,7 +1233,7 @@ DispBeamColumn2d::setResponse(const char **argv, int argc,
 	     strcmp(argv[0],"rayleighForces") == 0 ||
 	     strcmp(argv[0],"dampingForces") == 0) {
 
-    theResponse =  new ElementResponse(this, 12, P);
+    theResponse =  new ElementResponse(this, 12, Vector(6));
   }
 
   // section response -
@@ -1268,6 +1334,9 @@ DispBeamColumn2d::setResponse(const char **argv, int argc,
 int 
 DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   double V;
   double L = crdTransf->getInitialLength();
 
@@ -1300,8 +1369,8 @@ DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    Vector &vp = theWork.vp;
+    Vector &ve = theWork.ve;
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1480,6 +1549,9 @@ DispBeamColumn2d::activateParameter(int passedParameterID)
 const Matrix &
 DispBeamColumn2d::getKiSensitivity(int gradNumber)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
 	K.Zero();
 	return K;
 }
@@ -1487,6 +1559,9 @@ DispBeamColumn2d::getKiSensitivity(int gradNumber)
 const Matrix &
 DispBeamColumn2d::getMassSensitivity(int gradNumber)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
 	K.Zero();
 	return K;
 }
@@ -1496,6 +1571,10 @@ DispBeamColumn2d::getMassSensitivity(int gradNumber)
 const Vector &
 DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+  double *workArea = theWork.workArea;
+
   double L = crdTransf->getInitialLength();
   double oneOverL = 1.0/L;
   
@@ -1507,7 +1586,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(3);
+  Vector &dqdh = theWork.dqdh;
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1543,7 +1622,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(3);		// No distributed loads
+  Vector &dp0dh = theWork.dp0dh;		// No distributed loads
 
   P.Zero();
 
@@ -1553,7 +1632,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3,3);
+    Matrix &kbmine = theWork.kbmine;
     kbmine.Zero();
     q.Zero();
     
@@ -1646,10 +1725,13 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 int
 DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 {
+  DispBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(3);
+  Vector &dvdh = theWork.dvdh;
   dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = crdTransf->getInitialLength();
@@ -70,6 +70,7 @@ class DispBeamColumn2d : public Element
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void);
 
     // public methods to obtain stiffness, mass, damping and residual information    
     int update(void);
@@ -119,9 +120,6 @@ class DispBeamColumn2d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
-
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
     double q0[3];  // Fixed end forces in basic system
@@ -132,8 +130,6 @@ class DispBeamColumn2d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
-
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
@@ -45,11 +45,34 @@
 #include <ElementalLoad.h>
 #include <BeamIntegration.h>
 #include <Parameter.h>
+#include <ThreadWorkspace.h>
 #include <math.h>
 
-Matrix DispBeamColumn3d::K(12,12);
-Vector DispBeamColumn3d::P(12);
-double DispBeamColumn3d::workArea[200];
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct DispBeamColumn3dWorkspace {
+  DispBeamColumn3dWorkspace()
+    :K(12,12), P(12), kb(6,6), ml(12,12), Raccel(12), accel(12), data(14),
+     v1(3), v2(3), vp(6), ve(6), dqdh(6), dp0dh(6), kbmine(6,6), dvdh(6) {};
+
+  Matrix K;
+  Vector P;
+  double workArea[200];
+  Matrix kb;
+  Matrix ml;
+  Vector Raccel;
+  Vector accel;
+  Vector data;
+  Vector v1;
+  Vector v2;
+  Vector vp;
+  Vector ve;
+  Vector dqdh;
+  Vector dp0dh;
+  Matrix kbmine;
+  Vector dvdh;
+};
+
+static ThreadWorkspace<DispBeamColumn3dWorkspace> theWorkspace;
 
 DispBeamColumn3d::DispBeamColumn3d(int tag, int nd1, int nd2,
 				   int numSec, SectionForceDeformation **s,
@@ -275,9 +298,25 @@ DispBeamColumn3d::revertToStart()
     return retVal;
 }
 
+bool
+DispBeamColumn3d::isThreadSafe(void)
+{
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 int
 DispBeamColumn3d::update(void)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   int err = 0;
 
   // Update the transformation
@@ -338,7 +377,11 @@ DispBeamColumn3d::update(void)
 const Matrix&
 DispBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+  double *workArea = theWork.workArea;
+
+  Matrix &kb = theWork.kb;
   
   // Zero for integral
   kb.Zero();
@@ -470,7 +513,10 @@ DispBeamColumn3d::getTangentStiff()
 const Matrix&
 DispBeamColumn3d::getInitialBasicStiff()
 {
-  static Matrix kb(6,6);
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
+  Matrix &kb = theWork.kb;
   
   // Zero for integral
   kb.Zero();
@@ -569,6 +615,9 @@ DispBeamColumn3d::getInitialBasicStiff()
 const Matrix&
 DispBeamColumn3d::getInitialStiff()
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
   const Matrix &kb = this->getInitialBasicStiff();
 
   // Transform to global stiffness
@@ -580,6 +629,9 @@ DispBeamColumn3d::getInitialStiff()
 const Matrix&
 DispBeamColumn3d::getMass()
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
   K.Zero();
   
   if (rho == 0.0)
@@ -592,7 +644,7 @@ DispBeamColumn3d::getMass()
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    Matrix &ml = theWork.ml;
     double m = rho*L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
     ml(0,6) = ml(6,0) = m*70.0;
@@ -728,6 +780,8 @@ DispBeamColumn3d::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+
   // Check for a quick return
   if (rho == 0.0) 
     return 0;
@@ -755,7 +809,7 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m*Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    Vector &Raccel = theWork.Raccel;
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -769,6 +823,9 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector&
 DispBeamColumn3d::getResistingForce()
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   double L = crdTransf->getInitialLength();
 
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
@@ -834,6 +891,9 @@ DispBeamColumn3d::getResistingForce()
 const Vector&
 DispBeamColumn3d::getResistingForceIncInertia()
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   P = this->getResistingForce();
   
   // Subtract other external nodal loads ... P_res = P_int - P_ext
@@ -856,7 +916,7 @@ DispBeamColumn3d::getResistingForceIncInertia()
     P(8) += m*accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    Vector &accel = theWork.accel;
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -881,13 +941,15 @@ DispBeamColumn3d::getResistingForceIncInertia()
 int
 DispBeamColumn3d::sendSelf(int commitTag, Channel &theChannel)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+
   // place the integer data into an ID
 
   int dbTag = this->getDbTag();
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  Vector &data = theWork.data;
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -975,13 +1037,15 @@ int
 DispBeamColumn3d::recvSelf(int commitTag, Channel &theChannel,
 						FEM_ObjectBroker &theBroker)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+
   //
   // receive the integer data containing tag, numSections and coord transformation info
   //
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  Vector &data = theWork.data;
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn3d::recvSelf() - failed to recv data Vector\n";
@@ -1184,8 +1248,10 @@ DispBeamColumn3d::Print(OPS_Stream &s, int flag)
 int
 DispBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+
+  Vector &v1 = theWork.v1;
+  Vector &v2 = theWork.v2;
 
   if (displayMode >= 0) {
 
@@ -1245,7 +1311,7 @@ DispBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
       output.tag("ResponseType","Mz_2");
 
 
-      theResponse = new ElementResponse(this, 1, P);
+      theResponse = new ElementResponse(this, 1, Vector(12));
 
     // local force -
     }  else if (strcmp(argv[0],"localForce") == 0 || strcmp(argv[0],"localForces") == 0) {
@@ -1263,7 +1329,7 @@ DispBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
       output.tag("ResponseType","My_2");
       output.tag("ResponseType","Mz_2");
 
-      theResponse = new ElementResponse(this, 2, P);
+      theResponse = new ElementResponse(this, 2, Vector(12));
 
     // chord rotation -
     }  else if (strcmp(argv[0],"chordRotation") == 0 || strcmp(argv[0],"chordDeformation") == 0 
@@ -1293,7 +1359,7 @@ DispBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 
   } else if (strcmp(argv[0],"RayleighForces") == 0 || strcmp(argv[0],"rayleighForces") == 0) {
 
-    theResponse =  new ElementResponse(this, 12, P);
+    theResponse =  new ElementResponse(this, 12, Vector(12));
 
   }   
 
@@ -1381,6 +1447,9 @@ DispBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   double N, V, M1, M2, T;
   double L = crdTransf->getInitialLength();
   double oneOverL = 1.0/L;
@@ -1429,8 +1498,8 @@ DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    Vector &vp = theWork.vp;
+    Vector &ve = theWork.ve;
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1539,6 +1608,9 @@ DispBeamColumn3d::activateParameter(int passedParameterID)
 const Matrix &
 DispBeamColumn3d::getKiSensitivity(int gradNumber)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
 	K.Zero();
 	return K;
 }
@@ -1546,6 +1618,9 @@ DispBeamColumn3d::getKiSensitivity(int gradNumber)
 const Matrix &
 DispBeamColumn3d::getMassSensitivity(int gradNumber)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+
 	K.Zero();
 	return K;
 }
@@ -1555,6 +1630,10 @@ DispBeamColumn3d::getMassSensitivity(int gradNumber)
 const Vector &
 DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+  double *workArea = theWork.workArea;
+
   double L = crdTransf->getInitialLength();
   double oneOverL = 1.0/L;
   
@@ -1566,7 +1645,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  Vector &dqdh = theWork.dqdh;
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1609,7 +1688,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(6);		// No distributed loads
+  Vector &dp0dh = theWork.dp0dh;		// No distributed loads
 
   P.Zero();
 
@@ -1619,7 +1698,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6,6);
+    Matrix &kbmine = theWork.kbmine;
     kbmine.Zero();
     q.Zero();
     
@@ -1739,10 +1818,13 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
 int
 DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 {
+  DispBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(6);
+  Vector &dvdh = theWork.dvdh;
   dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = crdTransf->getInitialLength();
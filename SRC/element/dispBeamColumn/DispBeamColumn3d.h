@@ -70,6 +70,7 @@ class DispBeamColumn3d : public Element
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void);
 
     // public methods to obtain stiffness, mass, damping and residual information    
     int update(void);
@@ -119,9 +120,6 @@ class DispBeamColumn3d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
-
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
     double q0[5];  // Fixed end forces in basic system (no torsion)
@@ -133,8 +131,6 @@ class DispBeamColumn3d : public Element
 	int parameterID;
 
     enum {maxNumSections = 20};
-
-    static double workArea[];
 };
 
 #endif
@@ -42,6 +42,7 @@
 #include <CrdTransf.h>
 #include <Information.h>
 #include <Parameter.h>
+#include <ThreadWorkspace.h>
 #include <ElementResponse.h>
 #include <Renderer.h>
 
@@ -50,9 +51,26 @@
 #include <elementAPI.h>
 #include <string>
 
-Matrix ElasticBeam2d::K(6,6);
-Vector ElasticBeam2d::P(6);
-Matrix ElasticBeam2d::kb(3,3);
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct ElasticBeam2dWorkspace {
+  ElasticBeam2dWorkspace()
+    :K(6,6), P(6), kb(3,3), ml(6,6), Raccel(6), accel(6), data(16), v1(3),
+     v2(3), vp(3), delta(3) {};
+
+  Matrix K;
+  Vector P;
+  Matrix kb;
+  Matrix ml;
+  Vector Raccel;
+  Vector accel;
+  Vector data;
+  Vector v1;
+  Vector v2;
+  Vector vp;
+  Vector delta;
+};
+
+static ThreadWorkspace<ElasticBeam2dWorkspace> theWorkspace;
 
 void* OPS_ElasticBeam2d()
 {
@@ -269,6 +287,12 @@ ElasticBeam2d::revertToStart()
     return theCoordTransf->revertToStart();
 }
 
+bool
+ElasticBeam2d::isThreadSafe(void)
+{
+  return theCoordTransf->isThreadSafe();
+}
+
 int
 ElasticBeam2d::update(void)
 {
@@ -278,6 +302,9 @@ ElasticBeam2d::update(void)
 const Matrix &
 ElasticBeam2d::getTangentStiff(void)
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+  Matrix &kb = theWork.kb;
+
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -306,6 +333,9 @@ ElasticBeam2d::getTangentStiff(void)
 const Matrix &
 ElasticBeam2d::getInitialStiff(void)
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+  Matrix &kb = theWork.kb;
+
   double L = theCoordTransf->getInitialLength();
 
   double EoverL   = E/L;
@@ -323,6 +353,9 @@ ElasticBeam2d::getInitialStiff(void)
 const Matrix &
 ElasticBeam2d::getMass(void)
 { 
+    ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+    Matrix &K = theWork.K;
+
     K.Zero();
     
     if (rho > 0.0)  {
@@ -334,7 +367,7 @@ ElasticBeam2d::getMass(void)
             K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            Matrix &ml = theWork.ml;
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -466,6 +499,8 @@ ElasticBeam2d::addLoad(ElementalLoad *theLoad, double loadFactor)
 int
 ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+
   if (rho == 0.0)
     return 0;
 
@@ -491,7 +526,7 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    Vector &Raccel = theWork.Raccel;
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -505,6 +540,9 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ElasticBeam2d::getResistingForceIncInertia()
 {	
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   P = this->getResistingForce();
   
   // subtract external load P = P - Q
@@ -533,7 +571,7 @@ ElasticBeam2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    Vector &accel = theWork.accel;
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -548,6 +586,9 @@ ElasticBeam2d::getResistingForceIncInertia()
 const Vector &
 ElasticBeam2d::getResistingForce()
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   theCoordTransf->update();
   
   const Vector &v = theCoordTransf->getBasicTrialDisp();
@@ -578,9 +619,11 @@ ElasticBeam2d::getResistingForce()
 int
 ElasticBeam2d::sendSelf(int cTag, Channel &theChannel)
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+
   int res = 0;
 
-    static Vector data(16);
+    Vector &data = theWork.data;
     
     data(0) = A;
     data(1) = E; 
@@ -629,9 +672,11 @@ ElasticBeam2d::sendSelf(int cTag, Channel &theChannel)
 int
 ElasticBeam2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+    ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
 	
-    static Vector data(16);
+    Vector &data = theWork.data;
 
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -720,9 +765,11 @@ ElasticBeam2d::Print(OPS_Stream &s, int flag)
 int
 ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector vp(3);
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &v1 = theWork.v1;
+  Vector &v2 = theWork.v2;
+  Vector &vp = theWork.vp;
 
   theNodes[0]->getDisplayCrds(v1, fact);
   theNodes[1]->getDisplayCrds(v2, fact);
@@ -774,7 +821,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
 
       d1 = q(1);
       d2 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=20.;
+      Vector &delta = theWork.delta; delta = v2-v1; delta/=20.;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
 
@@ -782,7 +829,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
       d1 = q(0);
       d2 = q(1);
       d3 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      Vector &delta = theWork.delta; delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -795,7 +842,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
 
       d1 = vp(1);
       d2 = vp(2);
-      static Vector delta(3); delta = v2-v1; delta/=20.;
+      Vector &delta = theWork.delta; delta = v2-v1; delta/=20.;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
 
@@ -803,7 +850,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
       d1 = vp(0);
       d2 = vp(1);
       d3 = vp(2);
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      Vector &delta = theWork.delta; delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -812,7 +859,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
       d1 = 0.;
       d2 = 0.;
       d3 = 0.;
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      Vector &delta = theWork.delta; delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -826,6 +873,8 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
 Response*
 ElasticBeam2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
 
   Response *theResponse = 0;
 
@@ -878,6 +927,9 @@ ElasticBeam2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 ElasticBeam2d::getResponse (int responseID, Information &eleInfo)
 {
+  ElasticBeam2dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   double N, M1, M2, V;
   double L = theCoordTransf->getInitialLength();
   this->getResistingForce();
@@ -65,6 +65,7 @@ class ElasticBeam2d : public Element
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void);
     
     int update(void);
     const Matrix &getTangentStiff(void);
@@ -96,11 +97,8 @@ class ElasticBeam2d : public Element
     double rho;       // mass per unit length
     int cMass;        // consistent mass flag
 
-    static Matrix K;
-    static Vector P;
     Vector Q;
     
-    static Matrix kb;
     Vector q;
     double q0[3];  // Fixed end forces in basic system
     double p0[3];  // Reactions in basic system
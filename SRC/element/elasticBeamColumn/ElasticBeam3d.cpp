@@ -40,6 +40,7 @@
 #include <CrdTransf.h>
 #include <Information.h>
 #include <Parameter.h>
+#include <ThreadWorkspace.h>
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 #include <Renderer.h>
@@ -50,9 +51,29 @@
 #include <string>
 #include <elementAPI.h>
 
-Matrix ElasticBeam3d::K(12,12);
-Vector ElasticBeam3d::P(12);
-Matrix ElasticBeam3d::kb(6,6);
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct ElasticBeam3dWorkspace {
+  ElasticBeam3dWorkspace()
+    :K(12,12), P(12), kb(6,6), ml(12,12), Raccel(12), accel(12), data(17),
+     xAxis(3), yAxis(3), zAxis(3), v1(3), v2(3), delta(3), Res(12) {};
+
+  Matrix K;
+  Vector P;
+  Matrix kb;
+  Matrix ml;
+  Vector Raccel;
+  Vector accel;
+  Vector data;
+  Vector xAxis;
+  Vector yAxis;
+  Vector zAxis;
+  Vector v1;
+  Vector v2;
+  Vector delta;
+  Vector Res;
+};
+
+static ThreadWorkspace<ElasticBeam3dWorkspace> theWorkspace;
 
 void* OPS_ElasticBeam3d()
 {
@@ -359,6 +380,12 @@ ElasticBeam3d::revertToStart()
     return theCoordTransf->revertToStart();
 }
 
+bool
+ElasticBeam3d::isThreadSafe(void)
+{
+  return theCoordTransf->isThreadSafe();
+}
+
 int
 ElasticBeam3d::update(void)
 {
@@ -368,6 +395,9 @@ ElasticBeam3d::update(void)
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+  Matrix &kb = theWork.kb;
+
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -407,6 +437,9 @@ ElasticBeam3d::getTangentStiff(void)
 const Matrix &
 ElasticBeam3d::getInitialStiff(void)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+  Matrix &kb = theWork.kb;
+
   //  const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -432,6 +465,9 @@ ElasticBeam3d::getInitialStiff(void)
 const Matrix &
 ElasticBeam3d::getMass(void)
 { 
+    ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+    Matrix &K = theWork.K;
+
     K.Zero();
     
     if (rho > 0.0) {
@@ -448,7 +484,7 @@ ElasticBeam3d::getMass(void)
             K(8,8) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(12,12);
+            Matrix &ml = theWork.ml;
             double m = rho*L/420.0;
             ml(0,0) = ml(6,6) = m*140.0;
             ml(0,6) = ml(6,0) = m*70.0;
@@ -585,6 +621,8 @@ ElasticBeam3d::addLoad(ElementalLoad *theLoad, double loadFactor)
 int
 ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+
   if (rho == 0.0)
     return 0;
 
@@ -612,7 +650,7 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m * Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    Vector &Raccel = theWork.Raccel;
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -628,6 +666,9 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ElasticBeam3d::getResistingForceIncInertia()
 {	
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   P = this->getResistingForce(); 
   // subtract external load P = P - Q
   P.addVector(1.0, Q, -1.0);
@@ -657,7 +698,7 @@ ElasticBeam3d::getResistingForceIncInertia()
     P(8) += m * accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    Vector &accel = theWork.accel;
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -672,6 +713,9 @@ ElasticBeam3d::getResistingForceIncInertia()
 const Vector &
 ElasticBeam3d::getResistingForce()
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -711,9 +755,11 @@ ElasticBeam3d::getResistingForce()
 int
 ElasticBeam3d::sendSelf(int cTag, Channel &theChannel)
 {
+    ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+
     int res = 0;
 
-    static Vector data(17);
+    Vector &data = theWork.data;
     
     data(0) = A;
     data(1) = E; 
@@ -763,8 +809,10 @@ ElasticBeam3d::sendSelf(int cTag, Channel &theChannel)
 int
 ElasticBeam3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+
   int res = 0;
-  static Vector data(17);
+  Vector &data = theWork.data;
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -824,6 +872,7 @@ ElasticBeam3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBrok
 void
 ElasticBeam3d::Print(OPS_Stream &s, int flag)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
 
   this->getResistingForce(); 
 
@@ -865,9 +914,9 @@ ElasticBeam3d::Print(OPS_Stream &s, int flag)
    else if (flag == 2){
      this->getResistingForce(); // in case linear algo
 
-     static Vector xAxis(3);
-     static Vector yAxis(3);
-     static Vector zAxis(3);
+     Vector &xAxis = theWork.xAxis;
+     Vector &yAxis = theWork.yAxis;
+     Vector &zAxis = theWork.zAxis;
      
      theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
                         
@@ -939,8 +988,10 @@ ElasticBeam3d::Print(OPS_Stream &s, int flag)
 int
 ElasticBeam3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+
+    Vector &v1 = theWork.v1;
+    Vector &v2 = theWork.v2;
 
     theNodes[0]->getDisplayCrds(v1, fact);
     theNodes[1]->getDisplayCrds(v2, fact);
@@ -987,7 +1038,7 @@ ElasticBeam3d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
     } else if (strcmp(theMode, "endMoments") == 0) {
       d1 = q(1);
       d2 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=10;
+      Vector &delta = theWork.delta; delta = v2-v1; delta/=10;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
       
@@ -1000,6 +1051,8 @@ ElasticBeam3d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
 Response*
 ElasticBeam3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
 
   Response *theResponse = 0;
 
@@ -1068,10 +1121,13 @@ ElasticBeam3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 ElasticBeam3d::getResponse (int responseID, Information &eleInfo)
 {
+  ElasticBeam3dWorkspace &theWork = theWorkspace.get();
+  Vector &P = theWork.P;
+
   double N, V, M1, M2, T;
   double L = theCoordTransf->getInitialLength();
   double oneOverL = 1.0/L;
-  static Vector Res(12);
+  Vector &Res = theWork.Res;
   Res = this->getResistingForce();
 
   switch (responseID) {
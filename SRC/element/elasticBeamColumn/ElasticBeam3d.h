@@ -71,6 +71,7 @@ class ElasticBeam3d : public Element
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isThreadSafe(void);
     
     int update(void);
     const Matrix &getTangentStiff(void);
@@ -103,11 +104,8 @@ class ElasticBeam3d : public Element
     int cMass;
     int sectionTag;
 
-    static Matrix K;
-    static Vector P;
     Vector Q;
     
-    static Matrix kb;
     Vector q;
     double q0[5];  // Fixed end forces in basic system (no torsion)
     double p0[5];  // Reactions in basic system (no torsion)
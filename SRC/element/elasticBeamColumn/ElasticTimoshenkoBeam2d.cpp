@@ -43,6 +43,7 @@
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 #include <elementAPI.h>
+#include <MatrixND.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -326,12 +327,10 @@ int ElasticTimoshenkoBeam2d::update()
 
 const Matrix& ElasticTimoshenkoBeam2d::getTangentStiff()
 {
-    // zero the matrix
-    theMatrix.Zero();
-    
     if (nlGeo == 0)  {
-        // transform from local to global system
-        theMatrix.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+        // the local stiffness and the transformation do not change,
+        // so the global stiffness is the initial one
+        theMatrix = Ki;
         
     } else  {
         // initialize local stiffness matrix
@@ -357,8 +356,26 @@ const Matrix& ElasticTimoshenkoBeam2d::getTangentStiff()
         if (ql(0) != 0.0)
             klTot.addMatrix(1.0, klgeo, ql(0));
         
-        // transform from local to global system
-        theMatrix.addMatrixTripleProduct(0.0, Tgl, klTot, 1.0);
+        // transform from local to global system, by 3x3 blocks as Tgl
+        // is block diagonal in its rotation R
+        MatrixND<3,3> R, klij, kgij;
+        for (int i=0; i<3; i++)
+            for (int j=0; j<3; j++)
+                R(i,j) = Tgl(i,j);
+        
+        for (int bi=0; bi<6; bi+=3)  {
+            for (int bj=0; bj<6; bj+=3)  {
+                for (int i=0; i<3; i++)
+                    for (int j=0; j<3; j++)
+                        klij(i,j) = klTot(bi+i,bj+j);
+                
+                kgij.addMatrixTripleProduct(0.0, R, klij, 1.0);
+                
+                for (int i=0; i<3; i++)
+                    for (int j=0; j<3; j++)
+                        theMatrix(bi+i,bj+j) = kgij(i,j);
+            }
+        }
     }
     
     return theMatrix;
@@ -77,14 +77,61 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementResponse.h>
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
+#include <ThreadWorkspace.h>
+#include <MatrixND.h>
+
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct ForceBeamColumn2dWorkspace {
+  enum {nebd = ForceBeamColumn2d::NEBD};
+
+  ForceBeamColumn2dWorkspace()
+    :theMatrix(6,6), theVector(6), f(nebd,nebd),
+     kvInit(nebd,nebd), dv(nebd), vin(nebd), vr(nebd), dSe(nebd),
+     dvToDo(nebd), dvTrial(nebd), SeTrial(nebd), kvTrial(nebd,nebd),
+     ub(nebd), vp(3), fe(3,3), v1(3), v2(3), v0(3), d(2), dqdhTotal(3),
+     dqdh(3), dvpdh(3), fek(3,3), P(6), dvdh(3), dfedh(3,3) {};
+
+  Matrix theMatrix;
+  Vector theVector;
+  double workArea[200];
+  Vector vsSubdivide[ForceBeamColumn2d::maxNumSections];
+  Vector SsrSubdivide[ForceBeamColumn2d::maxNumSections];
+  Matrix fsSubdivide[ForceBeamColumn2d::maxNumSections];
+  Matrix f;
+  Matrix kvInit;
+  Vector dv;
+  Vector vin;
+  Vector vr;
+  Vector dSe;
+  Vector dvToDo;
+  Vector dvTrial;
+  Vector SeTrial;
+  Matrix kvTrial;
+  Vector Ss;
+  Vector dSs;
+  Vector dvs;
+  Matrix fb;
+  Vector sp;
+  Vector e;
+  Vector ub;
+  Vector vs;
+  Vector vp;
+  Matrix fe;
+  Vector v1;
+  Vector v2;
+  Vector v0;
+  Vector d;
+  Vector dqdhTotal;
+  Vector dqdh;
+  Vector dvpdh;
+  Matrix fek;
+  Vector P;
+  Vector dvdh;
+  Matrix dfedh;
+};
+
+static ThreadWorkspace<ForceBeamColumn2dWorkspace> theWorkspace;
 
-Matrix ForceBeamColumn2d::theMatrix(6,6);
-Vector ForceBeamColumn2d::theVector(6);
-double ForceBeamColumn2d::workArea[200];
-
-Vector *ForceBeamColumn2d::vsSubdivide = 0;
-Matrix *ForceBeamColumn2d::fsSubdivide = 0;
-Vector *ForceBeamColumn2d::SsrSubdivide = 0;
 
 void* OPS_ForceBeamColumn2d()
 {
@@ -176,16 +223,6 @@ ForceBeamColumn2d::ForceBeamColumn2d():
   theNodes[0] = 0;  
   theNodes[1] = 0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn2d::ForceBeamColumn2d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -227,16 +264,6 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
 
   this->setSectionPointers(numSec, sec);
   
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn2d::ForceBeamColumn2d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn2d():
@@ -467,10 +494,25 @@ int ForceBeamColumn2d::revertToStart()
   return err;
 }
 
+bool
+ForceBeamColumn2d::isThreadSafe(void)
+{
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (sections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 
 const Matrix &
 ForceBeamColumn2d::getInitialStiff(void)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
   // check for quick return
   if (Ki != 0)
     return *Ki;
@@ -480,25 +522,17 @@ ForceBeamColumn2d::getInitialStiff(void)
     Ki = new Matrix(this->getTangentStiff());
   */
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  Matrix &f = theWork.f;   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
-  /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
-  I.Zero();
-  for (int i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
-  
   // calculate element stiffness matrix
-  // invert3by3Matrix(f, kv);
-
-  static Matrix kvInit(NEBD, NEBD);
-  if (f.Solve(I, kvInit) < 0)
+  MatrixND<NEBD,NEBD> fInit, kvInv;
+  fInit = f;
+  Matrix &kvInit = theWork.kvInit;
+  if (fInit.Invert(kvInv) < 0)
     opserr << "ForceBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
-  */
-
-  static Matrix kvInit(NEBD, NEBD);
-  f.Invert(kvInit);
+  else
+    kvInv.copyTo(kvInit);
   Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
   return *Ki;
 }
@@ -643,6 +677,12 @@ ForceBeamColumn2d::initializeSectionHistoryVariables (void)
 int
 ForceBeamColumn2d::update()
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+  Vector *vsSubdivide = theWork.vsSubdivide;
+  Vector *SsrSubdivide = theWork.SsrSubdivide;
+  Matrix *fsSubdivide = theWork.fsSubdivide;
+
   // if have completed a recvSelf() - do a revertToLastCommit
   // to get Ssr, etc. set correctly
   if (initialFlag == 2)
@@ -654,14 +694,14 @@ ForceBeamColumn2d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  Vector &dv = theWork.dv;
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  Vector &vin = theWork.vin;
   vin = v;
   vin -= dv;
 
@@ -674,29 +714,25 @@ ForceBeamColumn2d::update()
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  Vector &vr = theWork.vr;       // element residual displacements
+  Matrix &f = theWork.f;   // element flexibility matrix
+  MatrixND<NEBD,NEBD> fTrial, kvInv;
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
-  
-  I.Zero();
-  for (i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  Vector &dSe = theWork.dSe;
+  Vector &dvToDo = theWork.dvToDo;
+  Vector &dvTrial = theWork.dvTrial;
+  Vector &SeTrial = theWork.SeTrial;
+  Matrix &kvTrial = theWork.kvTrial;
 
   dvToDo = dv;
   dvTrial = dvToDo;
 
-  static double factor = 10;
+  double factor = 10;
 
   maxSubdivisions = 4;
 
@@ -765,10 +801,10 @@ ForceBeamColumn2d::update()
 	    int order      = sections[i]->getOrder();
 	    const ID &code = sections[i]->getType();
 
-	    static Vector Ss;
-	    static Vector dSs;
-	    static Vector dvs;
-	    static Matrix fb;
+	    Vector &Ss = theWork.Ss;
+	    Vector &dSs = theWork.dSs;
+	    Vector &dvs = theWork.dvs;
+	    Matrix &fb = theWork.fb;
 	    
 	    Ss.setData(workArea, order);
 	    dSs.setData(&workArea[order], order);
@@ -943,9 +979,11 @@ ForceBeamColumn2d::update()
 	  }
 	  
 	  // calculate element stiffness matrix
-	  // invert3by3Matrix(f, kv);	  
-	  if (f.Solve(I, kvTrial) < 0)
+	  fTrial = f;
+	  if (fTrial.Invert(kvInv) < 0)
 	    opserr << "ForceBeamColumn2d::update() -- could not invert flexibility\n";
+	  else
+	    kvInv.copyTo(kvTrial);
 				    
 	  // dv = vin + dvTrial  - vr
 	  dv = vin;
@@ -1071,6 +1109,9 @@ void ForceBeamColumn2d::getDistrLoadInterpolatMatrix(double xi, Matrix &bp, cons
 const Matrix &
 ForceBeamColumn2d::getMass(void)
 { 
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &theMatrix = theWork.theMatrix;
+
   theMatrix.Zero();
   
   double L = crdTransf->getInitialLength();
@@ -1359,6 +1400,9 @@ ForceBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ForceBeamColumn2d::getResistingForceIncInertia()
 {	
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &theVector = theWork.theVector;
+
   // Compute the current resisting force
   theVector = this->getResistingForce();
 
@@ -1799,6 +1843,9 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 int
 ForceBeamColumn2d::getInitialFlexibility(Matrix &fe)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   fe.Zero();
   
   double L = crdTransf->getInitialLength();
@@ -1884,6 +1931,9 @@ ForceBeamColumn2d::getInitialFlexibility(Matrix &fe)
 int
 ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   v0.Zero();
   if (numEleLoads < 1)
     return 0;
@@ -1906,7 +1956,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
     double xL1 = xL-1.0;
     double wtL = wt[i]*L;
 
-    static Vector sp;
+    Vector &sp = theWork.sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -1914,7 +1964,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    Vector &e = theWork.e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -1944,8 +1994,10 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 
 void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
+   ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   Vector &ub = theWork.ub;
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -1966,7 +2018,7 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   Vector &vs = theWork.vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -2021,6 +2073,9 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
 void
 ForceBeamColumn2d::Print(OPS_Stream &s, int flag)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &theVector = theWork.theVector;
+
   if (flag == 2) {
 
     s << "#ForceBeamColumn2D\n";
@@ -2050,8 +2105,8 @@ ForceBeamColumn2d::Print(OPS_Stream &s, int flag)
     s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << endln;
 
     // plastic hinge rotation
-    static Vector vp(3);
-    static Matrix fe(3,3);
+    Vector &vp = theWork.vp;
+    Matrix &fe = theWork.fe;
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2193,8 +2248,10 @@ ForceBeamColumn2d::setSectionPointers(int numSec, SectionForceDeformation **secP
 int
 ForceBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &v1 = theWork.v1;
+  Vector &v2 = theWork.v2;
 
   if (displayMode >= 0) {
 
@@ -2245,7 +2302,7 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
     output.tag("ResponseType","Py_2");
     output.tag("ResponseType","Mz_2");
 
-    theResponse =  new ElementResponse(this, 1, theVector);
+    theResponse =  new ElementResponse(this, 1, Vector(6));
   
   // local force -
   } else if (strcmp(argv[0],"localForce") == 0 || strcmp(argv[0],"localForces") == 0) {
@@ -2257,7 +2314,7 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
     output.tag("ResponseType","V_2");
     output.tag("ResponseType","M_2");
 
-    theResponse =  new ElementResponse(this, 2, theVector);
+    theResponse =  new ElementResponse(this, 2, Vector(6));
 
   // basic force -
   } else if (strcmp(argv[0],"basicForce") == 0 || strcmp(argv[0],"basicForces") == 0) {
@@ -2344,7 +2401,7 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
     output.tag("ResponseType","Py_2");
     output.tag("ResponseType","Mz_2");
 
-    theResponse =  new ElementResponse(this, 13, theVector);
+    theResponse =  new ElementResponse(this, 13, Vector(6));
   
     // section response -
   } else if (strstr(argv[0],"sectionX") != 0) {
@@ -2450,8 +2507,11 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(3);
-  static Matrix fe(3,3);
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Vector &theVector = theWork.theVector;
+
+  Vector &vp = theWork.vp;
+  Matrix &fe = theWork.fe;
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2484,7 +2544,7 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
-    static Vector v0(3);
+    Vector &v0 = theWork.v0;
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return eleInfo.setVector(vp);
@@ -2554,7 +2614,7 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     
     d3 += beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-    static Vector d(2);
+    Vector &d = theWork.d;
     d(0) = d2;
     d(1) = d3;
 
@@ -2613,6 +2673,8 @@ int
 ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 					  Information &eleInfo)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
   // Basic deformation sensitivity
   if (responseID == 3) {  
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
@@ -2621,7 +2683,7 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(3);
+    Vector &dqdh = theWork.dqdhTotal;
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -2646,7 +2708,7 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC2d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(3);
+    Vector &dqdh = theWork.dqdhTotal;
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -2724,14 +2786,14 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(3);
+    Vector &dvpdh = theWork.dvpdh;
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(3,3);
+    Matrix &fe = theWork.fe;
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -2739,7 +2801,7 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(3,3);
+    Matrix &fek = theWork.fek;
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -2869,6 +2931,9 @@ ForceBeamColumn2d::activateParameter(int passedParameterID)
 const Matrix&
 ForceBeamColumn2d::getKiSensitivity(int gradNumber)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &theMatrix = theWork.theMatrix;
+
   theMatrix.Zero();
   return theMatrix;
 }
@@ -2876,6 +2941,9 @@ ForceBeamColumn2d::getKiSensitivity(int gradNumber)
 const Matrix&
 ForceBeamColumn2d::getMassSensitivity(int gradNumber)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  Matrix &theMatrix = theWork.theMatrix;
+
   theMatrix.Zero();
   return theMatrix;
 }
@@ -2883,7 +2951,9 @@ ForceBeamColumn2d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(3);
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+
+  Vector &dqdh = theWork.dqdhTotal;
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -2891,7 +2961,7 @@ ForceBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(6);
+  Vector &P = theWork.P;
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -2911,6 +2981,9 @@ ForceBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 int
 ForceBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   int err = 0;
 
   double L = crdTransf->getInitialLength();
@@ -2929,7 +3002,7 @@ ForceBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(3);
+  Vector &dqdh = theWork.dqdhTotal;
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3007,6 +3080,9 @@ ForceBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 const Vector &
 ForceBeamColumn2d::computedqdh(int gradNumber)
 {
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
   //opserr << "FBC2d::computedqdh " << gradNumber << endln;
 
   double L = crdTransf->getInitialLength();
@@ -3028,7 +3104,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(3);
+  Vector &dvdh = theWork.dvdh;
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3123,7 +3199,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(3,3);
+  Matrix &dfedh = theWork.dfedh;
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3131,7 +3207,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(3);
+  Vector &dqdh = theWork.dqdh;
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3142,7 +3218,10 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn2d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(3,3);
+  ForceBeamColumn2dWorkspace &theWork = theWorkspace.get();
+  double *workArea = theWork.workArea;
+
+  Matrix &dfedh = theWork.dfedh;
 
   dfedh.Zero();
 
@@ -97,6 +97,7 @@ class ForceBeamColumn2d: public Element
   int commitState(void);
   int revertToLastCommit(void);        
   int revertToStart(void);
+  bool isThreadSafe(void);
   int update(void);    
   
   const Matrix &getTangentStiff(void);
@@ -190,19 +191,13 @@ class ForceBeamColumn2d: public Element
 
   Matrix *Ki;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
-  
+  friend struct ForceBeamColumn2dWorkspace;
+
   enum {maxNumSections = 30};
   enum {maxSectionOrder = 5};
 
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
-  
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
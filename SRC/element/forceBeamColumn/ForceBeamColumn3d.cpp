@@ -82,6 +82,8 @@ using std::ifstream;
 #include <CompositeResponse.h>
 
 #include <ElementalLoad.h>
+#include <ThreadWorkspace.h>
+#include <MatrixND.h>
 
 #define  NDM   3         // dimension of the problem (3d)
 #define  NND   6         // number of nodal dof's
@@ -90,13 +92,51 @@ using std::ifstream;
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3d::theMatrix(12,12);
-Vector ForceBeamColumn3d::theVector(12);
-double ForceBeamColumn3d::workArea[200];
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct ForceBeamColumn3dWorkspace {
+  ForceBeamColumn3dWorkspace()
+    :theMatrix(12,12), theVector(12), f(NEBD,NEBD),
+     kvInit(NEBD,NEBD), dv(NEBD), vin(NEBD), vr(NEBD), dSe(NEBD),
+     dvToDo(NEBD), dvTrial(NEBD), SeTrial(NEBD), kvTrial(NEBD,NEBD),
+     ub(NEBD), xAxis(3), yAxis(3), zAxis(3), vp(6), fe(6,6), v1(3), v2(3),
+     LI(2), d(4), result8(2) {};
+
+  Matrix theMatrix;
+  Vector theVector;
+  double workArea[200];
+  Vector vsSubdivide[ForceBeamColumn3d::maxNumSections];
+  Vector SsrSubdivide[ForceBeamColumn3d::maxNumSections];
+  Matrix fsSubdivide[ForceBeamColumn3d::maxNumSections];
+  Matrix f;
+  Matrix kvInit;
+  Vector dv;
+  Vector vin;
+  Vector vr;
+  Vector dSe;
+  Vector dvToDo;
+  Vector dvTrial;
+  Vector SeTrial;
+  Matrix kvTrial;
+  Vector Ss;
+  Vector dSs;
+  Vector dvs;
+  Matrix fb;
+  Vector ub;
+  Vector vs;
+  Vector xAxis;
+  Vector yAxis;
+  Vector zAxis;
+  Vector vp;
+  Matrix fe;
+  Vector v1;
+  Vector v2;
+  Vector LI;
+  Vector d;
+  Vector result8;
+};
+
+static ThreadWorkspace<ForceBeamColumn3dWorkspace> theWorkspace;
 
-Vector *ForceBeamColumn3d::vsSubdivide = 0;
-Matrix *ForceBeamColumn3d::fsSubdivide = 0;
-Vector *ForceBeamColumn3d::SsrSubdivide = 0;
 
 void* OPS_ForceBeamColumn3d()
 {
@@ -198,16 +238,6 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   v0[3] = 0.0;
   v0[4] = 0.0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0) 
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -260,16 +290,6 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
   v0[3] = 0.0;
   v0[4] = 0.0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn3d():
@@ -495,32 +515,46 @@ int ForceBeamColumn3d::revertToStart()
   return err;
 }
 
+bool
+ForceBeamColumn3d::isThreadSafe(void)
+{
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (sections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 
 const Matrix &
 ForceBeamColumn3d::getInitialStiff(void)
 {
+  ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+
   // check for quick return
   if (Ki != 0)
     return *Ki;
 
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix  
+  Matrix &f = theWork.f;   // element flexibility matrix  
   this->getInitialFlexibility(f);
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
-  I.Zero();
-  for (int i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
-  
   // calculate element stiffness matrix
-  // invert3by3Matrix(f, kv);
-  static Matrix kvInit(NEBD, NEBD);
-  if (f.Solve(I, kvInit) < 0)
+  MatrixND<NEBD,NEBD> fInit, kvInv;
+  fInit = f;
+  Matrix &kvInit = theWork.kvInit;
+  if (fInit.Invert(kvInv) < 0) {
     opserr << "ForceBeamColumn3d::getInitialStiff() -- could not invert flexibility";
+  } else {
+    kvInv.copyTo(kvInit);
+  }
 
-    Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
+  Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
 
-    return *Ki;
-  }
+  return *Ki;
+}
 
   const Matrix &
   ForceBeamColumn3d::getTangentStiff(void)
@@ -559,6 +593,12 @@ ForceBeamColumn3d::getInitialStiff(void)
   int
   ForceBeamColumn3d::update()
   {
+    ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+    double *workArea = theWork.workArea;
+    Vector *vsSubdivide = theWork.vsSubdivide;
+    Vector *SsrSubdivide = theWork.SsrSubdivide;
+    Matrix *fsSubdivide = theWork.fsSubdivide;
+
     // if have completed a recvSelf() - do a revertToLastCommit
     // to get Ssr, etc. set correctly
     if (initialFlag == 2)
@@ -570,13 +610,13 @@ ForceBeamColumn3d::getInitialStiff(void)
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    Vector &dv = theWork.dv;
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    Vector &vin = theWork.vin;
     vin = v;
     vin -= dv;
     double L = crdTransf->getInitialLength();
@@ -588,29 +628,25 @@ ForceBeamColumn3d::getInitialStiff(void)
     double wt[maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    Vector &vr = theWork.vr;       // element residual displacements
+    Matrix &f = theWork.f;   // element flexibility matrix
+    MatrixND<NEBD,NEBD> fTrial, kvInv;
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm 
     int i, j;
 
-    I.Zero();
-    for (i=0; i<NEBD; i++)
-      I(i,i) = 1.0;
-
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    Vector &dSe = theWork.dSe;
+    Vector &dvToDo = theWork.dvToDo;
+    Vector &dvTrial = theWork.dvTrial;
+    Vector &SeTrial = theWork.SeTrial;
+    Matrix &kvTrial = theWork.kvTrial;
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions = 10;
@@ -680,10 +716,10 @@ ForceBeamColumn3d::getInitialStiff(void)
 	      int order      = sections[i]->getOrder();
 	      const ID &code = sections[i]->getType();
 
-	      static Vector Ss;
-	      static Vector dSs;
-	      static Vector dvs;
-	      static Matrix fb;
+	      Vector &Ss = theWork.Ss;
+	      Vector &dSs = theWork.dSs;
+	      Vector &dvs = theWork.dvs;
+	      Matrix &fb = theWork.fb;
 
 	      Ss.setData(workArea, order);
 	      dSs.setData(&workArea[order], order);
@@ -950,11 +986,11 @@ ForceBeamColumn3d::getInitialStiff(void)
 	    }
 
 	    // calculate element stiffness matrix
-	    // invert3by3Matrix(f, kv);	  
-	    // FRANK
-	    //	  if (f.SolveSVD(I, kvTrial, 1.0e-12) < 0)
-	    if (f.Solve(I, kvTrial) < 0)
+	    fTrial = f;
+	    if (fTrial.Invert(kvInv) < 0)
 	      opserr << "ForceBeamColumn3d::update() -- could not invert flexibility\n";
+	    else
+	      kvInv.copyTo(kvTrial);
 	    
 
 	    // dv = vin + dvTrial  - vr
@@ -1111,6 +1147,9 @@ ForceBeamColumn3d::getInitialStiff(void)
   const Matrix &
   ForceBeamColumn3d::getMass(void)
   { 
+    ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+    Matrix &theMatrix = theWork.theMatrix;
+
     theMatrix.Zero();
 
     double L = crdTransf->getInitialLength();
@@ -1279,6 +1318,9 @@ ForceBeamColumn3d::getInitialStiff(void)
   const Vector &
   ForceBeamColumn3d::getResistingForceIncInertia()
   {	
+    ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+    Vector &theVector = theWork.theVector;
+
     // Compute the current resisting force
     theVector = this->getResistingForce();
 
@@ -1722,6 +1764,9 @@ ForceBeamColumn3d::getInitialStiff(void)
   int
   ForceBeamColumn3d::getInitialFlexibility(Matrix &fe)
   {
+    ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+    double *workArea = theWork.workArea;
+
     fe.Zero();
 
     double L = crdTransf->getInitialLength();
@@ -1855,8 +1900,10 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
   ForceBeamColumn3d::compSectionDisplacements(Vector sectionCoords[],
 					      Vector sectionDispls[]) const
   {
+     ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+
      // get basic displacements and increments
-     static Vector ub(NEBD);
+     Vector &ub = theWork.ub;
      ub = crdTransf->getBasicTrialDisp();    
 
      double L = crdTransf->getInitialLength();
@@ -1876,7 +1923,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      // get section curvatures
      Vector kappa_y(numSections);  // curvature
      Vector kappa_z(numSections);  // curvature
-     static Vector vs;                // section deformations 
+     Vector &vs = theWork.vs;                // section deformations 
 
      for (i=0; i<numSections; i++) {
 	 // THIS IS VERY INEFFICIENT ... CAN CHANGE IF RUNS TOO SLOW
@@ -1946,6 +1993,9 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
   void
   ForceBeamColumn3d::Print(OPS_Stream &s, int flag)
   {
+    ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+    Vector &theVector = theWork.theVector;
+
     // flags with negative values are used by GSA
     if (flag == -1) { 
       int eleTag = this->getTag();
@@ -1983,9 +2033,9 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer  
      else if (flag == 2) {
-       static Vector xAxis(3);
-       static Vector yAxis(3);
-       static Vector zAxis(3);
+       Vector &xAxis = theWork.xAxis;
+       Vector &yAxis = theWork.yAxis;
+       Vector &zAxis = theWork.zAxis;
 
 
        crdTransf->getLocalAxes(xAxis, yAxis, zAxis);
@@ -2025,8 +2075,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 	 << T << ' ' << MY2 << ' '  <<  MZ2 << endln;
 
        // plastic hinge rotation
-       static Vector vp(6);
-       static Matrix fe(6,6);
+       Vector &vp = theWork.vp;
+       Matrix &fe = theWork.fe;
        this->getInitialFlexibility(fe);
        vp = crdTransf->getBasicTrialDisp();
        vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2117,9 +2167,10 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
   int
   ForceBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes, int numModes)
   {
+    ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
 
-    static Vector v1(3);
-    static Vector v2(3);
+    Vector &v1 = theWork.v1;
+    Vector &v2 = theWork.v2;
 
     if (displayMode >= 0) {
 
@@ -2179,7 +2230,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
       output.tag("ResponseType","Mz_2");
 
 
-      theResponse = new ElementResponse(this, 1, theVector);
+      theResponse = new ElementResponse(this, 1, Vector(12));
 
     // local force -
     }  else if (strcmp(argv[0],"localForce") == 0 || strcmp(argv[0],"localForces") == 0) {
@@ -2197,7 +2248,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
       output.tag("ResponseType","My_2");
       output.tag("ResponseType","Mz_2");
       
-      theResponse = new ElementResponse(this, 2, theVector);
+      theResponse = new ElementResponse(this, 2, Vector(12));
       
     // chord rotation -
     }  else if (strcmp(argv[0],"chordRotation") == 0 || strcmp(argv[0],"chordDeformation") == 0 
@@ -2238,7 +2289,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
     } else if (strcmp(argv[0],"getRemCriteria2") == 0) {
       theResponse = new ElementResponse(this, 8, Vector(2), ID(6));
 
-    } else if (strcmp(argv[0],"RayleighForces") == 0 || strcmp(argv[0],"rayleighForces") == 0) {theResponse = new ElementResponse(this, 12, theVector);
+    } else if (strcmp(argv[0],"RayleighForces") == 0 || strcmp(argv[0],"rayleighForces") == 0) {theResponse = new ElementResponse(this, 12, Vector(12));
 
       // section response -
     } else if (strcmp(argv[0],"section") ==0) { 
@@ -2296,8 +2347,11 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 int 
 ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
+  ForceBeamColumn3dWorkspace &theWork = theWorkspace.get();
+  Vector &theVector = theWork.theVector;
+
+  Vector &vp = theWork.vp;
+  Matrix &fe = theWork.fe;
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2358,7 +2412,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    Vector &LI = theWork.LI;
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -2448,7 +2502,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static Vector d(4);
+    Vector &d = theWork.d;
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -2562,7 +2616,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 	indata.close();
       }
 
-      static Vector result8(2);
+      Vector &result8 = theWork.result8;
       result8(0) = value;
       result8(1) = checkvalue1;      
       
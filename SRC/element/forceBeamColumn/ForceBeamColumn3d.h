@@ -96,6 +96,7 @@ class ForceBeamColumn3d: public Element
   int commitState(void);
   int revertToLastCommit(void);        
   int revertToStart(void);
+  bool isThreadSafe(void);
   int update(void);    
   
   const Matrix &getTangentStiff(void);
@@ -169,18 +170,12 @@ class ForceBeamColumn3d: public Element
 
   bool isTorsion;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
-  
+  friend struct ForceBeamColumn3dWorkspace;
+
   enum {maxNumSections = 10};
   
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
-  
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
   //static int maxNumSections;
 };
 
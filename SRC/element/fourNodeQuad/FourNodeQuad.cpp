@@ -43,12 +43,20 @@
 #include <FEM_ObjectBroker.h>
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
+#include <ThreadWorkspace.h>
 
+// matrix, vector and shape functions shared by all FourNodeQuad
+// objects, one copy for each thread
+struct FourNodeQuadWorkspace {
+  FourNodeQuadWorkspace() :K(matrixData, 8, 8), P(8) {};
+  double matrixData[64];  // array data for matrix
+  Matrix K;		  // Element stiffness, damping, and mass Matrix
+  Vector P;		  // Element resisting force vector
+  double shp[3][4];	  // Stores shape functions and derivatives (overwritten)
+};
+
+static ThreadWorkspace<FourNodeQuadWorkspace> theWorkspace;
 
-double FourNodeQuad::matrixData[64];
-Matrix FourNodeQuad::K(matrixData, 8, 8);
-Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
 double FourNodeQuad::pts[4][2];
 double FourNodeQuad::wts[4];
 
@@ -264,6 +272,16 @@ FourNodeQuad::revertToStart()
     return retVal;
 }
 
+bool
+FourNodeQuad::isThreadSafe(void)
+{
+  for (int i = 0; i < 4; i++)
+    if (theMaterial[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 
 int
 FourNodeQuad::update()
@@ -273,7 +291,7 @@ FourNodeQuad::update()
 	const Vector &disp3 = theNodes[2]->getTrialDisp();
 	const Vector &disp4 = theNodes[3]->getTrialDisp();
 	
-	static double u[2][4];
+	double u[2][4];
 
 	u[0][0] = disp1(0);
 	u[1][0] = disp1(1);
@@ -284,7 +302,10 @@ FourNodeQuad::update()
 	u[0][3] = disp4(0);
 	u[1][3] = disp4(1);
 
-	static Vector eps(3);
+	double epsData[3];
+	Vector eps(epsData, 3);
+
+	double (*shp)[4] = theWorkspace.get().shp;
 
 	int ret = 0;
 
@@ -292,7 +313,7 @@ FourNodeQuad::update()
 	for (int i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		this->shapeFunction(pts[i][0], pts[i][1]);
+		this->shapeFunction(pts[i][0], pts[i][1], shp);
 
 		// Interpolate strains
 		//eps = B*u;
@@ -315,6 +336,9 @@ FourNodeQuad::update()
 const Matrix&
 FourNodeQuad::getTangentStiff()
 {
+	FourNodeQuadWorkspace &theWork = theWorkspace.get();
+	Matrix &K = theWork.K;
+	double (*shp)[4] = theWork.shp;
 
 	K.Zero();
 
@@ -325,7 +349,7 @@ FourNodeQuad::getTangentStiff()
 	for (int i = 0; i < 4; i++) {
 
 	  // Determine Jacobian for this integration point
-	  dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+	  dvol = this->shapeFunction(pts[i][0], pts[i][1], shp);
 	  dvol *= (thickness*wts[i]);
 	  
 	  // Get the material tangent
@@ -377,6 +401,11 @@ FourNodeQuad::getInitialStiff()
   if (Ki != 0)
     return *Ki;
 
+  FourNodeQuadWorkspace &theWork = theWorkspace.get();
+  Matrix &K = theWork.K;
+  double *matrixData = theWork.matrixData;
+  double (*shp)[4] = theWork.shp;
+
   K.Zero();
   
   double dvol;
@@ -386,7 +415,7 @@ FourNodeQuad::getInitialStiff()
   for (int i = 0; i < 4; i++) {
     
     // Determine Jacobian for this integration point
-    dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+    dvol = this->shapeFunction(pts[i][0], pts[i][1], shp);
     dvol *= (thickness*wts[i]);
     
     // Get the material tangent
@@ -427,10 +456,14 @@ FourNodeQuad::getInitialStiff()
 const Matrix&
 FourNodeQuad::getMass()
 {
+	FourNodeQuadWorkspace &theWork = theWorkspace.get();
+	Matrix &K = theWork.K;
+	double (*shp)[4] = theWork.shp;
+
 	K.Zero();
 
 	int i;
-	static double rhoi[4];
+	double rhoi[4];
 	double sum = 0.0;
 	for (i = 0; i < 4; i++) {
 	  if (rho == 0)
@@ -449,7 +482,7 @@ FourNodeQuad::getMass()
 	for (i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		rhodvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		rhodvol = this->shapeFunction(pts[i][0], pts[i][1], shp);
 
 		// Element plus material density ... MAY WANT TO REMOVE ELEMENT DENSITY
 		rhodvol *= (rhoi[i]*thickness*wts[i]);
@@ -502,7 +535,7 @@ int
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -524,7 +557,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
   
-  static double ra[8];
+  double ra[8];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -536,7 +569,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
   ra[7] = Raccel4(1);
   
   // Compute mass matrix
-  this->getMass();
+  const Matrix &K = this->getMass();
   
   // Want to add ( - fact * M R * accel ) to unbalance
   // Take advantage of lumped mass matrix
@@ -549,6 +582,10 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector&
 FourNodeQuad::getResistingForce()
 {
+	FourNodeQuadWorkspace &theWork = theWorkspace.get();
+	Vector &P = theWork.P;
+	double (*shp)[4] = theWork.shp;
+
 	P.Zero();
 
 	double dvol;
@@ -557,7 +594,7 @@ FourNodeQuad::getResistingForce()
 	for (int i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		dvol = this->shapeFunction(pts[i][0], pts[i][1], shp);
 		dvol *= (thickness*wts[i]);
 
 		// Get material stress response
@@ -602,13 +639,17 @@ const Vector&
 FourNodeQuad::getResistingForceIncInertia()
 {
 	int i;
-	static double rhoi[4];
+	double rhoi[4];
 	double sum = 0.0;
 	for (i = 0; i < 4; i++) {
 	  rhoi[i] = theMaterial[i]->getRho();
 	  sum += rhoi[i];
 	}
 
+	FourNodeQuadWorkspace &theWork = theWorkspace.get();
+	Matrix &K = theWork.K;
+	Vector &P = theWork.P;
+
 	// if no mass terms .. just add damping terms
 	if (sum == 0.0) {
 	  this->getResistingForce();
@@ -625,7 +666,7 @@ FourNodeQuad::getResistingForceIncInertia()
 	const Vector &accel3 = theNodes[2]->getTrialAccel();
 	const Vector &accel4 = theNodes[3]->getTrialAccel();
 	
-	static double a[8];
+	double a[8];
 
 	a[0] = accel1(0);
 	a[1] = accel1(1);
@@ -974,7 +1015,7 @@ FourNodeQuad::setResponse(const char **argv, int argc,
       output.tag("ResponseType",dataOut);
     }
     
-    theResponse =  new ElementResponse(this, 1, P);
+    theResponse =  new ElementResponse(this, 1, Vector(8));
   }   
 
   else if (strcmp(argv[0],"material") == 0 || strcmp(argv[0],"integrPoint") == 0) {
@@ -1165,7 +1206,7 @@ FourNodeQuad::updateParameter(int parameterID, Information &info)
   }
 }
 
-double FourNodeQuad::shapeFunction(double xi, double eta)
+double FourNodeQuad::shapeFunction(double xi, double eta, double shp[3][4])
 {
 	const Vector &nd1Crds = theNodes[0]->getCrds();
 	const Vector &nd2Crds = theNodes[1]->getCrds();
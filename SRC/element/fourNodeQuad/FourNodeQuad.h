@@ -68,6 +68,7 @@ class FourNodeQuad : public Element
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void);
     int update(void);
 
     // public methods to obtain stiffness, mass, damping and residual information    
@@ -113,9 +114,6 @@ class FourNodeQuad : public Element
 
     Node *theNodes[4];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
     Vector Q;		        // Applied nodal loads
     double b[2];		// Body forces
 
@@ -128,12 +126,11 @@ class FourNodeQuad : public Element
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
     double rho;
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
     static double pts[4][2];	// Stores quadrature points
     static double wts[4];		// Stores quadrature weights
 
     // private member functions - only objects of this class can call these
-    double shapeFunction(double xi, double eta);
+    double shapeFunction(double xi, double eta, double shp[3][4]);
     void setPressureLoadAtNodes(void);
 
     Matrix *Ki;
@@ -42,6 +42,7 @@
 #include <Domain.h>
 #include <ErrorHandler.h>
 #include <ShellMITC4.h>
+#include <ThreadWorkspace.h>
 #include <R3vectors.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
@@ -92,10 +93,60 @@ OPS_NewShellMITC4(void)
 }
 
 
-//static data
-Matrix  ShellMITC4::stiff(24,24) ;
-Vector  ShellMITC4::resid(24) ;
-Matrix  ShellMITC4::mass(24,24) ;
+// scratch storage, one copy for each thread (see ThreadWorkspace)
+struct ShellMITC4Workspace {
+  ShellMITC4Workspace()
+    :stiff(24,24), resid(24), mass(24,24), eig(3), ddMembrane(3,3),
+     stresses(32), strains(32), stiffJK(6,6), dd(8,8),
+     BJ(8,6), BJtran(6,8),
+     BK(8,6), BJtranD(6,8), Bbend(3,3), BbendNode(3,2),
+     Bshear(2,3), Bmembrane(3,2), BmembraneNode(3,2), r(24), res(24),
+     momentum(6), strain(8), residJ(6), stress(8), temp(3),
+     v1(3), v2(3), v3(3), B(8,6), BmembraneShell(3,3), BbendShell(3,3),
+     BshearShell(2,6), Gmem(2,3), Gshear(3,6), vectData(5), coords(4,3),
+     values(4) {};
+
+  Matrix stiff;
+  Vector resid;
+  Matrix mass;
+  Vector eig;
+  Matrix ddMembrane;
+  Vector stresses;
+  Vector strains;
+  Matrix stiffJK;
+  Matrix dd;
+  Matrix BJ;
+  Matrix BJtran;
+  Matrix BK;
+  Matrix BJtranD;
+  Matrix Bbend;
+  Matrix BbendNode;
+  Matrix Bshear;
+  Matrix Bmembrane;
+  Matrix BmembraneNode;
+  Vector r;
+  Vector res;
+  Vector momentum;
+  Vector strain;
+  Vector residJ;
+  Vector stress;
+  Vector temp;
+  Vector v1;
+  Vector v2;
+  Vector v3;
+  Matrix B;
+  Matrix BmembraneShell;
+  Matrix BbendShell;
+  Matrix BshearShell;
+  Matrix Gmem;
+  Matrix Gshear;
+  Vector vectData;
+  Matrix coords;
+  Vector values;
+  double Bdrill[6];
+};
+
+static ThreadWorkspace<ShellMITC4Workspace> theWorkspace;
 
 //quadrature data
 const double  ShellMITC4::root3 = sqrt(3.0) ;
@@ -203,9 +254,11 @@ ShellMITC4::~ShellMITC4( )
 //set domain
 void  ShellMITC4::setDomain( Domain *theDomain ) 
 {  
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+
   int i, j ;
-  static Vector eig(3) ;
-  static Matrix ddMembrane(3,3) ;
+  Vector &eig = theWork.eig;
+  Matrix &ddMembrane = theWork.ddMembrane;
 
   //node pointers
   for ( i = 0; i < 4; i++ ) {
@@ -315,6 +368,16 @@ int  ShellMITC4::revertToStart( )
   return success ;
 }
 
+//true if the materials may be driven by several threads
+bool  ShellMITC4::isThreadSafe( )
+{
+  for (int i = 0; i < 4; i++)
+    if (materialPointers[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 //print out element data
 void  ShellMITC4::Print( OPS_Stream &s, int flag )
 {
@@ -468,9 +531,11 @@ ShellMITC4::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 ShellMITC4::getResponse(int responseID, Information &eleInfo)
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+
   int cnt = 0;
-  static Vector stresses(32);
-  static Vector strains(32);
+  Vector &stresses = theWork.stresses;
+  Vector &strains = theWork.strains;
 
   switch (responseID) {
   case 1: // global forces
@@ -521,6 +586,9 @@ ShellMITC4::getResponse(int responseID, Information &eleInfo)
 //return stiffness matrix 
 const Matrix&  ShellMITC4::getTangentStiff( ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Matrix &stiff = theWork.stiff;
+
   int tang_flag = 1 ; //get the tangent 
 
   //do tangent and residual here
@@ -532,6 +600,9 @@ const Matrix&  ShellMITC4::getTangentStiff( )
 //return secant matrix 
 const Matrix&  ShellMITC4::getInitialStiff( ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Matrix &stiff = theWork.stiff;
+
   if (Ki != 0)
     return *Ki;
 
@@ -548,47 +619,43 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 
   double volume = 0.0 ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  double dvol[ngauss] ; //volume element
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  double shp[3][numnodes] ;  //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  Matrix &stiffJK = theWork.stiffJK; //nodeJK stiffness 
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-  static Matrix J0(2,2) ;  //Jacobian at center
- 
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  Matrix &dd = theWork.dd;  //material tangent
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    Matrix &BJ = theWork.BJ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    Matrix &BJtran = theWork.BJtran;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    Matrix &BK = theWork.BK;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    Matrix &BJtranD = theWork.BJtranD;
 
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    Matrix &Bbend = theWork.Bbend;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    Matrix &Bshear = theWork.Bshear; // shear B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    Matrix &Bmembrane = theWork.Bmembrane; // membrane B matrix
 
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    double BdrillK[ndf] ;  
 
     double *drillPointer ;
 
-    static double saveB[nstress][ndf][numnodes] ;
+    double saveB[nstress][ndf][numnodes] ;
 
   //-------------------------------------------------------
 
@@ -811,6 +878,9 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 //return mass matrix
 const Matrix&  ShellMITC4::getMass( ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Matrix &mass = theWork.mass;
+
   int tangFlag = 1 ;
 
   formInertiaTerms( tangFlag ) ;
@@ -840,8 +910,11 @@ ShellMITC4::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Matrix &mass = theWork.mass;
+
   int tangFlag = 1 ;
-  static Vector r(24);
+  Vector &r = theWork.r;
 
   int i;
 
@@ -876,6 +949,9 @@ ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
 //get residual
 const Vector&  ShellMITC4::getResistingForce( ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+
   int tang_flag = 0 ; //don't get the tangent
 
   formResidAndTangent( tang_flag ) ;
@@ -891,7 +967,10 @@ const Vector&  ShellMITC4::getResistingForce( )
 //get residual with inertia terms
 const Vector&  ShellMITC4::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+
+  Vector &res = theWork.res;
   int tang_flag = 0 ; //don't get the tangent
 
   //do tangent and residual here 
@@ -917,6 +996,9 @@ const Vector&  ShellMITC4::getResistingForceIncInertia( )
 void   
 ShellMITC4::formInertiaTerms( int tangFlag ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Vector &resid = theWork.resid;
+  Matrix &mass = theWork.mass;
 
   //translational mass only
   //rotational inertia terms are neglected
@@ -936,9 +1018,9 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  Vector &momentum = theWork.momentum;
 
 
   int i, j, k, p;
@@ -1013,6 +1095,10 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 void  
 ShellMITC4::formResidAndTangent( int tang_flag ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+  Matrix &stiff = theWork.stiff;
+  Vector &resid = theWork.resid;
+
   //
   //  six(6) nodal dof's ordered :
   //
@@ -1063,31 +1149,26 @@ ShellMITC4::formResidAndTangent( int tang_flag )
   int i,  j,  k, p, q ;
   int jj, kk ;
 
-  int success ;
   
   double volume = 0.0 ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  double dvol[ngauss] ; //volume element
 
-  static Vector strain(nstress) ;  //strain
+  Vector &strain = theWork.strain;  //strain
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  double shp[3][numnodes] ;  //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  Vector &residJ = theWork.residJ; //nodeJ residual 
 
-  static Vector stress(nstress) ;  //stress resultants
+  Matrix &stiffJK = theWork.stiffJK; //nodeJK stiffness 
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  Vector &stress = theWork.stress;  //stress resultants
 
-  static Matrix J0(2,2) ;  //Jacobian at center
- 
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  Matrix &dd = theWork.dd;  //material tangent
 
   double epsDrill = 0.0 ;  //drilling "strain"
 
@@ -1095,29 +1176,29 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    Matrix &BJ = theWork.BJ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    Matrix &BJtran = theWork.BJtran;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    Matrix &BK = theWork.BK;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    Matrix &BJtranD = theWork.BJtranD;
 
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    Matrix &Bbend = theWork.Bbend;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    Matrix &Bshear = theWork.Bshear; // shear B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    Matrix &Bmembrane = theWork.Bmembrane; // membrane B matrix
 
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    double BdrillK[ndf] ;  
 
     double *drillPointer ;
 
-    static double saveB[nstress][ndf][numnodes] ;
+    double saveB[nstress][ndf][numnodes] ;
 
   //------------------------------------------------------- 
 
@@ -1275,7 +1356,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
   
 
     //send the strain to the material 
-    success = materialPointers[i]->setTrialSectionDeformation( strain ) ;
+    materialPointers[i]->setTrialSectionDeformation( strain ) ;
 
     //compute the stress
     stress = materialPointers[i]->getStressResultant( ) ;
@@ -1384,16 +1465,18 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 void   
 ShellMITC4::computeBasis( ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+
   //could compute derivatives \frac{ \partial {\bf x} }{ \partial L_1 } 
   //                     and  \frac{ \partial {\bf x} }{ \partial L_2 }
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  Vector &temp = theWork.temp;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  Vector &v1 = theWork.v1;
+  Vector &v2 = theWork.v2;
+  Vector &v3 = theWork.v3;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1472,16 +1555,18 @@ ShellMITC4::computeBasis( )
 void   
 ShellMITC4::updateBasis( ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+
   //could compute derivatives \frac{ \partial {\bf x} }{ \partial L_1 } 
   //                     and  \frac{ \partial {\bf x} }{ \partial L_2 }
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  Vector &temp = theWork.temp;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  Vector &v1 = theWork.v1;
+  Vector &v2 = theWork.v2;
+  Vector &v3 = theWork.v3;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1561,12 +1646,13 @@ ShellMITC4::updateBasis( )
 double*
 ShellMITC4::computeBdrill( int node, const double shp[3][4] )
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
 
   //static Matrix Bdrill(1,6) ;
-  static double Bdrill[6] ;
-  static double B1 ;
-  static double B2 ;
-  static double B6 ;
+  double *Bdrill = theWork.Bdrill ;
+  double B1 ;
+  double B2 ;
+  double B6 ;
 
 
 //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
@@ -1613,6 +1699,7 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
                                const Matrix &Bbend, 
                                const Matrix &Bshear ) 
 {
+    ShellMITC4Workspace &theWork = theWorkspace.get();
 
   //Matrix Bbend(3,3) ;  // plate bending B matrix
 
@@ -1621,17 +1708,17 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
 
-    static Matrix B(8,6) ;
+    Matrix &B = theWork.B;
 
-    static Matrix BmembraneShell(3,3) ; 
+    Matrix &BmembraneShell = theWork.BmembraneShell; 
     
-    static Matrix BbendShell(3,3) ; 
+    Matrix &BbendShell = theWork.BbendShell; 
 
-    static Matrix BshearShell(2,6) ;
+    Matrix &BshearShell = theWork.BshearShell;
  
-    static Matrix Gmem(2,3) ;
+    Matrix &Gmem = theWork.Gmem;
 
-    static Matrix Gshear(3,6) ;
+    Matrix &Gshear = theWork.Gshear;
 
     int p, q ;
     int pp ;
@@ -1737,8 +1824,9 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
 const Matrix&   
 ShellMITC4::computeBmembrane( int node, const double shp[3][4] ) 
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
 
-  static Matrix Bmembrane(3,2) ;
+  Matrix &Bmembrane = theWork.BmembraneNode;
 
 //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1768,8 +1856,9 @@ ShellMITC4::computeBmembrane( int node, const double shp[3][4] )
 const Matrix&   
 ShellMITC4::computeBbend( int node, const double shp[3][4] )
 {
+    ShellMITC4Workspace &theWork = theWorkspace.get();
 
-    static Matrix Bbend(3,2) ;
+    Matrix &Bbend = theWork.BbendNode;
 
 //---Bbend Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1812,8 +1901,8 @@ ShellMITC4::shape2d( double ss, double tt,
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static double xs[2][2] ;
-  static double sx[2][2] ;
+  double xs[2][2] ;
+  double sx[2][2] ;
 
   for ( i = 0; i < 4; i++ ) {
       shp[2][i] = ( 0.5 + s[i]*ss )*( 0.5 + t[i]*tt ) ;
@@ -1880,6 +1969,8 @@ ShellMITC4::transpose( int dim1,
 
 int  ShellMITC4::sendSelf (int commitTag, Channel &theChannel)
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+
   int res = 0;
 
   // note: we don't check for dataTag == 0 for Element
@@ -1919,7 +2010,7 @@ int  ShellMITC4::sendSelf (int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(5);
+  Vector &vectData = theWork.vectData;
   vectData(0) = Ktt;
   vectData(1) = alphaM;
   vectData(2) = betaK;
@@ -1948,6 +2039,8 @@ int  ShellMITC4::recvSelf (int commitTag,
 		       Channel &theChannel, 
 		       FEM_ObjectBroker &theBroker)
 {
+  ShellMITC4Workspace &theWork = theWorkspace.get();
+
   int res = 0;
   
   int dataTag = this->getDbTag();
@@ -1966,7 +2059,7 @@ int  ShellMITC4::recvSelf (int commitTag,
   connectedExternalNodes(2) = idData(11);
   connectedExternalNodes(3) = idData(12);
 
-  static Vector vectData(5);
+  Vector &vectData = theWork.vectData;
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellMITC4::sendSelf() - " << this->getTag() << " failed to send ID\n";
@@ -2032,6 +2125,8 @@ int  ShellMITC4::recvSelf (int commitTag,
 int
 ShellMITC4::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
+    ShellMITC4Workspace &theWork = theWorkspace.get();
+
     // first determine the end points of the quad based on
     // the display factor (a measure of the distorted image)
     // store this information in 4 3d vectors v1 through v4
@@ -2040,9 +2135,8 @@ ShellMITC4::displaySelf(Renderer &theViewer, int displayMode, float fact, const
     const Vector &end3Crd = nodePointers[2]->getCrds();	
     const Vector &end4Crd = nodePointers[3]->getCrds();	
 
-    static Matrix coords(4,3);
-    static Vector values(4);
-    static Vector P(24) ;
+    Matrix &coords = theWork.coords;
+    Vector &values = theWork.values;
 
     for (int j=0; j<4; j++)
 		values(j) = 0.0;
@@ -79,6 +79,7 @@ class ShellMITC4 : public Element {
     
     //revert to start 
     int revertToStart( ) ;
+    bool isThreadSafe( ) ;
 
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
@@ -114,9 +115,6 @@ class ShellMITC4 : public Element {
   private : 
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
     static Matrix damping ;
 
     //quadrature data
@@ -941,6 +941,9 @@ Truss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   doRayleighDamping = (int)data(7);
   cMass = (int)data(8);
 
+  // a snapshot may be received more than once
+  if (initialDisp != 0)
+    delete [] initialDisp;
   initialDisp = new double[dimension];
   for (int i=0; i<dimension; i++)
     initialDisp[i] = 0.0;
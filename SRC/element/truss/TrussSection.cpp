@@ -849,6 +849,9 @@ TrussSection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &the
   doRayleighDamping = (int)data(6);
   cMass = (int)data(7);
 
+  // a snapshot may be received more than once
+  if (initialDisp != 0)
+    delete [] initialDisp;
   initialDisp = new double[dimension];
   for (int i=0; i<dimension; i++)
     initialDisp[i] = 0.0;
@@ -0,0 +1,202 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/graph/CSR_Graph.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for CSR_Graph.
+//
+// What: "@(#) CSR_Graph.cpp, revA"
+
+#include <CSR_Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+
+CSR_Graph::CSR_Graph(int numV, int *theRowStart, int *theAdjacency,
+		     int *refs, int *colors)
+  :Graph(), numVertex(numV), rowStart(theRowStart), adjacency(theAdjacency),
+   vertexRefs(refs), vertexColors(colors), haveVertices(false)
+{
+
+}
+
+CSR_Graph::~CSR_Graph()
+{
+  this->clearRows();
+}
+
+void
+CSR_Graph::clearRows(void)
+{
+  if (rowStart != 0)
+    delete [] rowStart;
+  if (adjacency != 0)
+    delete [] adjacency;
+  if (vertexRefs != 0)
+    delete [] vertexRefs;
+  if (vertexColors != 0)
+    delete [] vertexColors;
+
+  rowStart = 0;
+  adjacency = 0;
+  vertexRefs = 0;
+  vertexColors = 0;
+}
+
+// void buildVertices(void);
+//	Method to create the Vertex objects and add the edges to them, only
+//	done the first time the vertices of the graph are asked for.
+
+void
+CSR_Graph::buildVertices(void)
+{
+  if (haveVertices == true)
+    return;
+  haveVertices = true;
+
+  if (rowStart == 0)
+    return;
+
+  for (int i=0; i<numVertex; i++) {
+    int tag = START_VERTEX_NUM + i;
+    int ref = (vertexRefs != 0) ? vertexRefs[i] : tag;
+    int color = (vertexColors != 0) ? vertexColors[i] : 0;
+    Vertex *vertexPtr = new Vertex(tag, ref, 0, color);
+    if (this->Graph::addVertex(vertexPtr, false) == false) {
+      opserr << "WARNING CSR_Graph::buildVertices() - failed to add vertex " << tag << endln;
+      delete vertexPtr;
+    }
+  }
+
+  for (int i=0; i<numVertex; i++) {
+    int tag = START_VERTEX_NUM + i;
+    for (int j=rowStart[i]; j<rowStart[i+1]; j++)
+      if (adjacency[j] > tag)
+	this->Graph::addEdge(tag, adjacency[j]);
+  }
+}
+
+bool
+CSR_Graph::addVertex(Vertex *vertexPtr, bool checkAdjacency)
+{
+  this->buildVertices();
+  this->clearRows();
+  return this->Graph::addVertex(vertexPtr, checkAdjacency);
+}
+
+int
+CSR_Graph::addEdge(int vertexTag, int otherVertexTag)
+{
+  this->buildVertices();
+  this->clearRows();
+  return this->Graph::addEdge(vertexTag, otherVertexTag);
+}
+
+Vertex *
+CSR_Graph::getVertexPtr(int vertexTag)
+{
+  this->buildVertices();
+  return this->Graph::getVertexPtr(vertexTag);
+}
+
+VertexIter &
+CSR_Graph::getVertices(void)
+{
+  this->buildVertices();
+  return this->Graph::getVertices();
+}
+
+int
+CSR_Graph::getNumVertex(void) const
+{
+  if (rowStart != 0)
+    return numVertex;
+
+  return this->Graph::getNumVertex();
+}
+
+int
+CSR_Graph::getNumEdge(void) const
+{
+  if (rowStart != 0)
+    return rowStart[numVertex]/2;
+
+  return this->Graph::getNumEdge();
+}
+
+int
+CSR_Graph::getFreeTag(void)
+{
+  this->buildVertices();
+  return this->Graph::getFreeTag();
+}
+
+Vertex *
+CSR_Graph::removeVertex(int tag, bool removeEdgeFlag)
+{
+  this->buildVertices();
+  this->clearRows();
+  return this->Graph::removeVertex(tag, removeEdgeFlag);
+}
+
+int
+CSR_Graph::merge(Graph &other)
+{
+  this->buildVertices();
+  this->clearRows();
+  return this->Graph::merge(other);
+}
+
+const int *
+CSR_Graph::getCSR_RowStart(void)
+{
+  return rowStart;
+}
+
+const int *
+CSR_Graph::getCSR_Adjacency(void)
+{
+  return adjacency;
+}
+
+void
+CSR_Graph::Print(OPS_Stream &s, int flag)
+{
+  this->buildVertices();
+  this->Graph::Print(s, flag);
+}
+
+int
+CSR_Graph::sendSelf(int commitTag, Channel &theChannel)
+{
+  this->buildVertices();
+  return this->Graph::sendSelf(commitTag, theChannel);
+}
+
+int
+CSR_Graph::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  this->buildVertices();
+  this->clearRows();
+  return this->Graph::recvSelf(commitTag, theChannel, theBroker);
+}
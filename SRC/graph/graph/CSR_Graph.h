@@ -0,0 +1,90 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/graph/CSR_Graph.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for CSR_Graph.
+// A CSR_Graph is a Graph whose edges are held in compressed sparse rows:
+// the vertices have the tags START_VERTEX_NUM through
+// START_VERTEX_NUM+numVertex-1 and the vertices adjacent to vertex i are
+// stored, sorted, in adjacency[rowStart[i]] through
+// adjacency[rowStart[i+1]-1]. The arrays are available to the numberers
+// and the SysOfEqn through getCSR_RowStart() and getCSR_Adjacency().
+//
+// The Vertex objects are only created if they are asked for, so a
+// CSR_Graph can be used wherever a Graph is used. Once the graph is
+// modified the compressed rows are discarded and the CSR_Graph behaves
+// as a Graph.
+//
+// What: "@(#) CSR_Graph.h, revA"
+
+#ifndef CSR_Graph_h
+#define CSR_Graph_h
+
+#include <Graph.h>
+
+class CSR_Graph: public Graph
+{
+  public:
+    // the CSR_Graph takes ownership of the arrays; the refs and colors of
+    // the vertices are optional, a vertex has a ref equal to its tag and
+    // a color of 0 if they are not given
+    CSR_Graph(int numVertex, int *rowStart, int *adjacency,
+	      int *refs = 0, int *colors = 0);
+    ~CSR_Graph();
+
+    bool addVertex(Vertex *vertexPtr, bool checkAdjacency = true);
+    int addEdge(int vertexTag, int otherVertexTag);
+
+    Vertex *getVertexPtr(int vertexTag);
+    VertexIter &getVertices(void);
+    int getNumVertex(void) const;
+    int getNumEdge(void) const;
+    int getFreeTag(void);
+    Vertex *removeVertex(int tag, bool removeEdgeFlag = true);
+
+    int merge(Graph &other);
+
+    const int *getCSR_RowStart(void);
+    const int *getCSR_Adjacency(void);
+
+    void Print(OPS_Stream &s, int flag =0);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    void buildVertices(void);
+    void clearRows(void);
+
+    int numVertex;
+    int *rowStart;
+    int *adjacency;
+    int *vertexRefs;
+    int *vertexColors;
+    bool haveVertices;   // true once the Vertex objects have been created
+};
+
+#endif
@@ -253,6 +253,18 @@ Graph::getFreeTag(void)
   return nextFreeTag;
 }
 
+const int *
+Graph::getCSR_RowStart(void)
+{
+  return 0;
+}
+
+const int *
+Graph::getCSR_Adjacency(void)
+{
+  return 0;
+}
+
 Vertex *
 Graph::removeVertex(int tag, bool flag)
 {
@@ -66,9 +66,16 @@ class Graph
 
     virtual int merge(Graph &other);
     
+    // the edges in compressed rows, the vertices adjacent to the vertex
+    // with tag START_VERTEX_NUM+i being adjacency[rowStart[i]] through
+    // adjacency[rowStart[i+1]-1] in increasing order; both return 0 if
+    // the graph does not hold its edges in this form (see CSR_Graph)
+    virtual const int *getCSR_RowStart(void);
+    virtual const int *getCSR_Adjacency(void);
+
     virtual void Print(OPS_Stream &s, int flag =0);
-    int sendSelf(int commitTag, Channel &theChannel);
-    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
     friend OPS_Stream &operator<<(OPS_Stream &s, Graph &M);    
     
@@ -63,6 +63,21 @@ AMD::number(Graph &theGraph, int startVertex)
 
   theResult.resize(numVertex);
 
+  // if the graph holds its edges in compressed rows these are the
+  // column pointers and row indices wanted by amd_order()
+  const int *rowStart = theGraph.getCSR_RowStart();
+  const int *adjacency = theGraph.getCSR_Adjacency();
+  if (rowStart != 0 && adjacency != 0) {
+    int *P = new int[numVertex];
+    amd_order(numVertex, rowStart, adjacency, P, (double *)NULL, (double *)NULL);
+
+    for (int i=0; i<numVertex; i++)
+      theResult[i] = P[i];
+
+    delete [] P;
+    return theResult;
+  }
+
   int nnz = 0;
   Vertex *vertexPtr;
   VertexIter &vertexIter = theGraph.getVertices();
@@ -95,6 +95,12 @@ RCM::number(Graph &theGraph, int startVertex)
     if (numVertex == 0) 
 	return *theRefResult;
 	    
+    // if the graph holds its edges in compressed rows number it
+    // directly from the arrays
+    const int *rowStart = theGraph.getCSR_RowStart();
+    const int *adjacency = theGraph.getCSR_Adjacency();
+    if (rowStart != 0 && adjacency != 0 && GPS == false)
+	return this->numberCSR(rowStart, adjacency, startVertex);
 
     // we first set the Tmp of all vertices to -1, indicating
     // they have not yet been added.
@@ -272,6 +278,67 @@ RCM::number(Graph &theGraph, int startVertex)
 }
 
 
+// const ID &numberCSR(const int *rowStart, const int *adjacency,
+//                     int startVertexTag);
+//    Method to perform the numbering on a graph held in compressed rows,
+// the vertices being visited in the same order as by number() so the
+// same numbering results; the Tmp values of the vertices are not set.
+
+const ID &
+RCM::numberCSR(const int *rowStart, const int *adjacency, int startVertexTag)
+{
+    // mark[i] is the location in the result of vertex START_VERTEX_NUM+i
+    int *mark = new int[numVertex];
+    for (int i=0; i<numVertex; i++)
+	mark[i] = -1;
+
+    if (startVertexTag != -1 && (startVertexTag < START_VERTEX_NUM ||
+				 startVertexTag >= START_VERTEX_NUM+numVertex)) {
+	opserr << "WARNING:  RCM::number - No vertex with tag ";
+	opserr << startVertexTag << "Exists - using first come from iter\n";
+	startVertexTag = -1;
+    }	
+
+    if (startVertexTag == -1)
+	startVertexTag = START_VERTEX_NUM;
+
+    int currentMark = numVertex-1;  // marks current vertex visiting.
+    int nextMark = currentMark -1;  // indiactes where to put next Tag in ID.
+    int nextUnmarked = 0;           // where to look for a vertex when disconnected
+    (*theRefResult)(currentMark) = startVertexTag;
+    mark[startVertexTag-START_VERTEX_NUM] = currentMark;
+
+    // we continue till the ID is full
+    while (nextMark >= 0) {
+	// go through the current vertex adjacency and add vertices which
+	// have not yet been marked to the (*theRefResult)
+	int vertex = (*theRefResult)(currentMark) - START_VERTEX_NUM;
+	for (int i=rowStart[vertex]; i<rowStart[vertex+1]; i++) {
+	    int vertexTag = adjacency[i];
+	    if (mark[vertexTag-START_VERTEX_NUM] == -1) {
+		mark[vertexTag-START_VERTEX_NUM] = nextMark;
+		(*theRefResult)(nextMark--) = vertexTag;
+	    }
+	}
+
+	// go to the next vertex
+	//  we decrement because we are doing reverse Cuthill-McKee
+	currentMark--;
+
+	// check to see if graph is disconneted
+	if ((currentMark == nextMark) && (currentMark >= 0)) {
+	    while (mark[nextUnmarked] != -1)
+		nextUnmarked++;
+
+	    nextMark--;
+	    mark[nextUnmarked] = currentMark;
+	    (*theRefResult)(currentMark) = nextUnmarked + START_VERTEX_NUM;
+	}
+    }
+
+    delete [] mark;
+    return *theRefResult;
+}
 
 int
 RCM::sendSelf(int commitTag, Channel &theChannel)
@@ -35,7 +35,9 @@
 // number() method with the Graph to be numbered.
 //
 // Side effects: numberer() changes the Tmp values of the vertices to
-// the number assigned to that vertex.
+// the number assigned to that vertex, unless the Graph holds its edges
+// in compressed rows and GPS is not used, in which case the numbering
+// is done directly on the arrays of the Graph.
 //
 // What: "@(#) RCM.h, revA"
 
@@ -64,6 +66,7 @@ class RCM: public GraphNumberer
   protected:
     
   private:
+    const ID &numberCSR(const int *rowStart, const int *adjacency, int startVertexTag);
     
     int numVertex;
     ID *theRefResult;
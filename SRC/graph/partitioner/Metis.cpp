@@ -211,7 +211,7 @@ Metis::partition(Graph &theGraph, int numPart)
     int *vwgts = 0;
     int *ewgts = 0;
     int numbering = 0;
-    int weightflag = 0; // no weights on our graphs yet
+    int weightflag = 0; // no weights unless the vertices have been given some
 
     if (START_VERTEX_NUM == 0)
 	numbering = 0;	
@@ -263,6 +263,26 @@ Metis::partition(Graph &theGraph, int numPart)
 	
 	xadj[vertex+1] = indexEdge;
     }
+
+    // if the vertices carry weights, e.g. the measured cost of the
+    // elements, metis balances the weights; they are scaled to integers
+    double maxWeight = 0.0;
+    for (int vertex =0; vertex<numVertex; vertex++) {
+	double weight = theGraph.getVertexPtr(vertex+START_VERTEX_NUM)->getWeight();
+	if (weight > maxWeight)
+	    maxWeight = weight;
+    }
+
+    if (maxWeight > 0.0) {
+	vwgts = new int [numVertex];
+	for (int vertex =0; vertex<numVertex; vertex++) {
+	    double weight = theGraph.getVertexPtr(vertex+START_VERTEX_NUM)->getWeight();
+	    if (weight < 0.0)
+		weight = 0.0;
+	    vwgts[vertex] = 1 + (int)(1000.0*weight/maxWeight);
+	}
+	weightflag = 2;
+    }
     
     
     if (defaultOptions == true) 
@@ -315,6 +335,8 @@ Metis::partition(Graph &theGraph, int numPart)
     delete [] partition;
     delete [] xadj;
     delete [] adjncy;
+    if (vwgts != 0)
+	delete [] vwgts;
     
     return 0;
 }
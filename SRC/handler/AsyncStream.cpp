@@ -0,0 +1,512 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/AsyncStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of AsyncStream.
+//
+// What: "@(#) AsyncStream.cpp, revA"
+
+#include <AsyncStream.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+
+AsyncStream **AsyncStream::theStreams = 0;
+int AsyncStream::numStreams = 0;
+
+AsyncStream::AsyncStream(OPS_Stream *theS, int nSlots)
+  :OPS_Stream(theS->getClassTag()), 
+   theStream(theS), async(false), writeError(0),
+   numSlots(nSlots), theSlots(0), first(0), numFull(0)
+{
+  if (numSlots < 2)
+    numSlots = 2;
+
+  theSlots = new Vector *[numSlots];
+  for (int i=0; i<numSlots; i++)
+    theSlots[i] = new Vector();
+
+#ifndef _WIN32
+  shutdown = false;
+  pthread_mutex_init(&theMutex, 0);
+  pthread_cond_init(&fullCond, 0);
+  pthread_cond_init(&emptyCond, 0);
+
+  if (pthread_create(&theThread, 0, AsyncStream::writer, this) == 0)
+    async = true;
+  else
+    opserr << "WARNING AsyncStream::AsyncStream() - could not start writer thread, output will be written synchronously\n";
+#endif
+
+  this->addStream();
+}
+
+AsyncStream::~AsyncStream()
+{
+  this->removeStream();
+  this->stopWriter();
+
+#ifndef _WIN32
+  pthread_cond_destroy(&emptyCond);
+  pthread_cond_destroy(&fullCond);
+  pthread_mutex_destroy(&theMutex);
+#endif
+
+  for (int i=0; i<numSlots; i++)
+    delete theSlots[i];
+  delete [] theSlots;
+
+  if (theStream != 0)
+    delete theStream;
+}
+
+int
+AsyncStream::flush(void)
+{
+  int result = 0;
+
+#ifndef _WIN32
+  if (async == true) {
+    pthread_mutex_lock(&theMutex);
+    while (numFull > 0)
+      pthread_cond_wait(&emptyCond, &theMutex);
+    result = writeError;
+    writeError = 0;
+    pthread_mutex_unlock(&theMutex);
+  }
+#endif
+
+  return result;
+}
+
+// the list of streams is only changed by the thread creating and
+// deleting the recorders, so it needs no lock
+int
+AsyncStream::addStream(void)
+{
+  AsyncStream **newStreams = new AsyncStream *[numStreams+1];
+  for (int i=0; i<numStreams; i++)
+    newStreams[i] = theStreams[i];
+  newStreams[numStreams] = this;
+
+  if (theStreams != 0)
+    delete [] theStreams;
+  theStreams = newStreams;
+  numStreams++;
+
+  return 0;
+}
+
+int
+AsyncStream::removeStream(void)
+{
+  int loc = 0;
+  for (int i=0; i<numStreams; i++)
+    if (theStreams[i] != this)
+      theStreams[loc++] = theStreams[i];
+
+  numStreams = loc;
+  if (numStreams == 0) {
+    delete [] theStreams;
+    theStreams = 0;
+  }
+
+  return 0;
+}
+
+// resetAfterFork() is called in a child process created by fork(),
+// which has none of the writer threads. Each stream is made to write
+// synchronously and its ring emptied, the data in it being written by
+// the parent; the mutex and conditions, which may have been held by a
+// writer when the process was copied, are created afresh.
+void
+AsyncStream::resetAfterFork(void)
+{
+  for (int i=0; i<numStreams; i++) {
+    AsyncStream *theStream = theStreams[i];
+    theStream->async = false;
+    theStream->writeError = 0;
+    theStream->first = 0;
+    theStream->numFull = 0;
+#ifndef _WIN32
+    theStream->shutdown = false;
+    pthread_mutex_init(&theStream->theMutex, 0);
+    pthread_cond_init(&theStream->fullCond, 0);
+    pthread_cond_init(&theStream->emptyCond, 0);
+#endif
+  }
+}
+
+int
+AsyncStream::stopWriter(void)
+{
+  int result = this->flush();
+
+#ifndef _WIN32
+  if (async == true) {
+    pthread_mutex_lock(&theMutex);
+    shutdown = true;
+    pthread_cond_signal(&fullCond);
+    pthread_mutex_unlock(&theMutex);
+
+    pthread_join(theThread, 0);
+    async = false;
+  }
+#endif
+
+  return result;
+}
+
+#ifndef _WIN32
+void *
+AsyncStream::writer(void *data)
+{
+  AsyncStream *self = (AsyncStream *)data;
+
+  pthread_mutex_lock(&self->theMutex);
+
+  while (true) {
+    while (self->numFull == 0 && self->shutdown == false)
+      pthread_cond_wait(&self->fullCond, &self->theMutex);
+
+    // only stop once every filled slot has been written
+    if (self->numFull == 0)
+      break;
+
+    Vector *theData = self->theSlots[self->first];
+    pthread_mutex_unlock(&self->theMutex);
+
+    int result = self->theStream->write(*theData);
+
+    pthread_mutex_lock(&self->theMutex);
+    if (result < 0)
+      self->writeError = result;
+    self->first = (self->first+1) % self->numSlots;
+    self->numFull--;
+    pthread_cond_signal(&self->emptyCond);
+  }
+
+  pthread_mutex_unlock(&self->theMutex);
+  return 0;
+}
+#endif
+
+int 
+AsyncStream::write(Vector &data)
+{
+#ifndef _WIN32
+  if (async == true) {
+
+    // wait for a free slot; the slot is not touched by the writer
+    // until numFull has been incremented below
+    pthread_mutex_lock(&theMutex);
+    while (numFull == numSlots)
+      pthread_cond_wait(&emptyCond, &theMutex);
+    int last = (first + numFull) % numSlots;
+    int result = writeError;
+    writeError = 0;
+    pthread_mutex_unlock(&theMutex);
+
+    *(theSlots[last]) = data;
+
+    pthread_mutex_lock(&theMutex);
+    numFull++;
+    pthread_cond_signal(&fullCond);
+    pthread_mutex_unlock(&theMutex);
+
+    return result;
+  }
+#endif
+
+  return theStream->write(data);
+}
+
+int 
+AsyncStream::setFile(const char *fileName, openMode mode)
+{
+  this->flush();
+  return theStream->setFile(fileName, mode);
+}
+
+int 
+AsyncStream::setPrecision(int prec)
+{
+  this->flush();
+  return theStream->setPrecision(prec);
+}
+
+int 
+AsyncStream::setFloatField(floatField field)
+{
+  this->flush();
+  return theStream->setFloatField(field);
+}
+
+int 
+AsyncStream::precision(int prec)
+{
+  this->flush();
+  return theStream->precision(prec);
+}
+
+int 
+AsyncStream::width(int w)
+{
+  this->flush();
+  return theStream->width(w);
+}
+
+int 
+AsyncStream::tag(const char *tagName)
+{
+  this->flush();
+  return theStream->tag(tagName);
+}
+
+int 
+AsyncStream::tag(const char *tagName, const char *value)
+{
+  this->flush();
+  return theStream->tag(tagName, value);
+}
+
+int 
+AsyncStream::endTag()
+{
+  this->flush();
+  return theStream->endTag();
+}
+
+int 
+AsyncStream::attr(const char *name, int value)
+{
+  this->flush();
+  return theStream->attr(name, value);
+}
+
+int 
+AsyncStream::attr(const char *name, double value)
+{
+  this->flush();
+  return theStream->attr(name, value);
+}
+
+int 
+AsyncStream::attr(const char *name, const char *value)
+{
+  this->flush();
+  return theStream->attr(name, value);
+}
+
+OPS_Stream& 
+AsyncStream::write(const char *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const unsigned char *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const signed char *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const void *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const double *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(char c)
+{
+  this->flush();
+  (*theStream) << c;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned char c)
+{
+  this->flush();
+  (*theStream) << c;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(signed char c)
+{
+  this->flush();
+  (*theStream) << c;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const char *s)
+{
+  this->flush();
+  (*theStream) << s;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const unsigned char *s)
+{
+  this->flush();
+  (*theStream) << s;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const signed char *s)
+{
+  this->flush();
+  (*theStream) << s;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const void *p)
+{
+  this->flush();
+  (*theStream) << p;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(int n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned int n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(long n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned long n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(short n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned short n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(bool b)
+{
+  this->flush();
+  (*theStream) << b;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(double n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(float n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+int 
+AsyncStream::setOrder(const ID &order)
+{
+  this->flush();
+  return theStream->setOrder(order);
+}
+
+int 
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  // the parallel streams exchange data inside write(), which must then
+  // be called by the thread that owns the channels
+  this->stopWriter();
+  return theStream->sendSelf(commitTag, theChannel);
+}
+
+int 
+AsyncStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  this->stopWriter();
+  return theStream->recvSelf(commitTag, theChannel, theBroker);
+}
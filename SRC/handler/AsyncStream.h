@@ -0,0 +1,142 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/AsyncStream.h,v $
+
+// Created: 10/26
+//
+// Description: AsyncStream wraps another OPS_Stream so that the data
+// written by a recorder on each commit is formatted and written by a
+// background thread. write(Vector &) only copies the data into a ring
+// of numSlots buffers; the writer thread passes the buffers, in order,
+// to the wrapped stream's write(Vector &). When all slots are in use
+// write() blocks until the writer has emptied one. Every other method
+// first waits until the ring is empty (flush()) and then calls the
+// wrapped stream, so tags, attributes and text keep their position in
+// the output. The destructor flushes, stops the writer and deletes the
+// wrapped stream, so the output is complete once the recorder owning
+// the stream is removed.
+//
+// The stream takes the class tag of the stream it wraps: a recorder
+// sent to another process recreates the wrapped stream there, which
+// then writes synchronously. Once sendSelf() has been called the data
+// is also written synchronously on this process.
+//
+// A process created by fork() has none of the writer threads; it must
+// call AsyncStream::resetAfterFork(), after which every AsyncStream in
+// it writes synchronously. The data still waiting in the ring is left
+// to the parent's writer.
+//
+// What: "@(#) AsyncStream.h, revA"
+
+#ifndef _AsyncStream
+#define _AsyncStream
+
+#include <OPS_Stream.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class AsyncStream : public OPS_Stream
+{
+ public:
+  AsyncStream(OPS_Stream *theStream, int numSlots = 64);
+  ~AsyncStream();
+
+  int flush(void);
+  static void resetAfterFork(void);
+
+  // output format
+  int setFile(const char *fileName, openMode mode = OVERWRITE);
+  int setPrecision(int precision);
+  int setFloatField(floatField);
+  int precision(int precision);
+  int width(int width);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  // parallel stuff
+  int setOrder(const ID &order);
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int stopWriter(void);
+  int addStream(void);
+  int removeStream(void);
+
+  OPS_Stream *theStream;
+  bool async;               // false if no writer thread is running
+  int writeError;           // result of the last failed write by the writer
+
+  int numSlots;
+  Vector **theSlots;
+  int first;                // next slot to be written by the writer
+  int numFull;              // number of slots waiting to be written
+
+#ifndef _WIN32
+  static void *writer(void *);
+
+  pthread_t theThread;
+  pthread_mutex_t theMutex;
+  pthread_cond_t fullCond;  // signalled when a slot has been filled
+  pthread_cond_t emptyCond; // signalled when a slot has been written
+  bool shutdown;
+#endif
+
+  // every AsyncStream in the process, for resetAfterFork()
+  static AsyncStream **theStreams;
+  static int numStreams;
+};
+
+#endif
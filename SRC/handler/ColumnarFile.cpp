@@ -0,0 +1,169 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFile.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the encoding and decoding of the
+// blocks of a columnar results file.
+//
+// What: "@(#) ColumnarFile.cpp, revA"
+
+#include <ColumnarFile.h>
+#include <string.h>
+
+// the xor/rle encoding: each value is xor'ed with the value before it,
+// which for a slowly varying response leaves mostly zero bits in the
+// exponent and leading mantissa bytes. the xor'ed values are split into
+// 8 byte planes, most significant byte first, and the planes are run
+// length encoded: a control byte c < 128 is followed by c+1 literal
+// bytes, a control byte c >= 128 stands for c-127 zero bytes.
+
+static void
+xorPlanes(const double *values, int n, std::vector<unsigned char> &planes)
+{
+  planes.resize(8*(long long)n);
+
+  unsigned long long last = 0;
+  for (int i=0; i<n; i++) {
+    unsigned long long bits;
+    memcpy(&bits, &values[i], 8);
+    unsigned long long x = bits ^ last;
+    last = bits;
+    for (int b=0; b<8; b++)
+      planes[(long long)b*n + i] = (unsigned char)(x >> (8*(7-b)));
+  }
+}
+
+static void
+runLengthEncode(const std::vector<unsigned char> &in, std::vector<unsigned char> &out)
+{
+  out.clear();
+  long long n = in.size();
+  long long i = 0;
+
+  while (i < n) {
+    if (in[i] == 0) {
+      long long j = i;
+      while (j < n && in[j] == 0 && j-i < 128)
+	j++;
+      out.push_back((unsigned char)(127 + (j-i)));
+      i = j;
+    } else {
+      // literal run, stopped by a pair of zeros worth encoding as a run
+      long long j = i;
+      while (j < n && j-i < 128 && !(in[j] == 0 && j+1 < n && in[j+1] == 0))
+	j++;
+      out.push_back((unsigned char)(j-i-1));
+      for (long long k=i; k<j; k++)
+	out.push_back(in[k]);
+      i = j;
+    }
+  }
+}
+
+int
+encodeColumnarBlock(const double *values, int n, bool compress,
+		    std::vector<unsigned char> &bytes)
+{
+  if (compress == true && n > 0) {
+
+    bool constant = true;
+    for (int i=1; i<n && constant == true; i++)
+      if (memcmp(&values[i], &values[0], 8) != 0)
+	constant = false;
+    if (constant == true) {
+      bytes.resize(8);
+      memcpy(&bytes[0], values, 8);
+      return COLUMNAR_CONSTANT;
+    }
+
+    std::vector<unsigned char> planes;
+    xorPlanes(values, n, planes);
+    runLengthEncode(planes, bytes);
+    if (bytes.size() < 8*(unsigned long long)n)
+      return COLUMNAR_XOR_RLE;
+  }
+
+  bytes.resize(8*(long long)n);
+  if (n > 0)
+    memcpy(&bytes[0], values, 8*(long long)n);
+  return COLUMNAR_RAW;
+}
+
+int
+decodeColumnarBlock(int encoding, const unsigned char *bytes,
+		    long long numBytes, int n, double *values)
+{
+  if (encoding == COLUMNAR_RAW) {
+    if (numBytes != 8*(long long)n)
+      return -1;
+    memcpy(values, bytes, numBytes);
+    return 0;
+  }
+
+  if (encoding == COLUMNAR_CONSTANT) {
+    if (numBytes != 8)
+      return -1;
+    for (int i=0; i<n; i++)
+      memcpy(&values[i], bytes, 8);
+    return 0;
+  }
+
+  if (encoding == COLUMNAR_XOR_RLE) {
+    long long numPlaneBytes = 8*(long long)n;
+    std::vector<unsigned char> planes(numPlaneBytes);
+    long long i = 0, j = 0;
+    while (i < numBytes) {
+      int c = bytes[i++];
+      if (c >= 128) {
+	long long num = c - 127;
+	if (j + num > numPlaneBytes)
+	  return -1;
+	memset(&planes[j], 0, num);
+	j += num;
+      } else {
+	long long num = c + 1;
+	if (j + num > numPlaneBytes || i + num > numBytes)
+	  return -1;
+	memcpy(&planes[j], &bytes[i], num);
+	i += num;
+	j += num;
+      }
+    }
+    if (j != numPlaneBytes)
+      return -1;
+
+    unsigned long long last = 0;
+    for (int k=0; k<n; k++) {
+      unsigned long long x = 0;
+      for (int b=0; b<8; b++)
+	x = (x << 8) | planes[(long long)b*n + k];
+      last ^= x;
+      memcpy(&values[k], &last, 8);
+    }
+    return 0;
+  }
+
+  return -1;
+}
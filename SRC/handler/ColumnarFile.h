@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFile.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the layout of the columnar results
+// files written by ColumnarFileStream and read by ColumnarFileReader,
+// and the functions used to encode and decode a column of a chunk.
+//
+// All values are stored in the byte order of the machine that wrote the
+// file; the byteOrder field of the header allows a reader to detect a
+// file written on a machine with the other byte order.
+//
+//   header   char magic[8] = "OPSCOL01", int version, int byteOrder (=1)
+//
+//   chunks   for each chunk, one block for the time axis (if the file
+//            has one) followed by one block for each column. Every block
+//            starts on a multiple of 8 bytes, so an uncompressed block
+//            can be used in place from a memory mapped file.
+//
+//   footer   int numColumns, int hasTime, int numChunks, int 0,
+//            long long numRows,
+//            for each column: int nameLength, char name[nameLength],
+//            padded to a multiple of 8 bytes,
+//            for each chunk: long long firstRow, int numRows, int 0,
+//            double tMin, double tMax, and for each block
+//            int encoding, int 0, long long offset, long long numBytes
+//
+//   trailer  long long footerOffset, long long footerBytes,
+//            char magic[8] = "OPSCOLIX"
+//
+// A reader therefore reads the trailer and footer only, and then the
+// blocks of the columns and chunks it needs. tMin and tMax of a chunk
+// are the smallest and largest times in the chunk, which need not be the
+// first and last as the time of a domain can be reset, or the first and
+// last row numbers if the file has no time axis.
+//
+// What: "@(#) ColumnarFile.h, revA"
+
+#ifndef _ColumnarFile
+#define _ColumnarFile
+
+#include <vector>
+
+#define COLUMNAR_MAGIC         "OPSCOL01"
+#define COLUMNAR_INDEX_MAGIC   "OPSCOLIX"
+#define COLUMNAR_VERSION       1
+#define COLUMNAR_HEADER_SIZE   16
+#define COLUMNAR_TRAILER_SIZE  24
+
+enum ColumnarEncoding {
+  COLUMNAR_RAW      = 0,   // n doubles
+  COLUMNAR_CONSTANT = 1,   // a single double repeated n times
+  COLUMNAR_XOR_RLE  = 2    // xor with previous value, byte planes, run length
+};
+
+// encodes the n values; with compress true the constant and xor/rle
+// encodings are tried and the shortest encoding kept. returns the
+// encoding used, the encoded values are in bytes.
+int encodeColumnarBlock(const double *values, int n, bool compress,
+			std::vector<unsigned char> &bytes);
+
+// decodes a block of n values; returns 0 if ok, -1 if the block is corrupt
+int decodeColumnarBlock(int encoding, const unsigned char *bytes,
+			long long numBytes, int n, double *values);
+
+#endif
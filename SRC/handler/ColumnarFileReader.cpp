@@ -0,0 +1,313 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFileReader.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ColumnarFileReader.
+//
+// What: "@(#) ColumnarFileReader.cpp, revA"
+
+#include <ColumnarFileReader.h>
+#include <ColumnarFile.h>
+
+#include <string.h>
+using std::ios;
+
+// reads the fields of the footer out of a buffer
+class ColumnarFooter
+{
+ public:
+  ColumnarFooter(const std::vector<char> &b) :buffer(b), pos(0), ok(true) {};
+
+  template <class T> T get(void) {
+    T value = 0;
+    if (pos + sizeof(T) > buffer.size())
+      ok = false;
+    else {
+      memcpy(&value, &buffer[pos], sizeof(T));
+      pos += sizeof(T);
+    }
+    return value;
+  }
+
+  std::string getString(int length) {
+    if (length < 0 || pos + length > buffer.size()) {
+      ok = false;
+      return std::string();
+    }
+    std::string value(&buffer[pos], length);
+    pos += length;
+    return value;
+  }
+
+  void pad(void) {pos = (pos + 7)/8*8;}
+
+  const std::vector<char> &buffer;
+  size_t pos;
+  bool ok;
+};
+
+ColumnarFileReader::ColumnarFileReader()
+  :fileOpen(false), numColumns(0), numBlocks(0), timeAxis(false), numRows(0)
+{
+
+}
+
+ColumnarFileReader::~ColumnarFileReader()
+{
+  this->close();
+}
+
+int
+ColumnarFileReader::open(const char *fileName)
+{
+  this->close();
+
+  theFile.open(fileName, ios::in | ios::binary);
+  if (!theFile.is_open())
+    return -1;
+  fileOpen = true;
+
+  // check the header
+  char magic[8];
+  int version = 0, byteOrder = 0;
+  theFile.read(magic, 8);
+  theFile.read((char *)&version, sizeof(int));
+  theFile.read((char *)&byteOrder, sizeof(int));
+  if (!theFile || memcmp(magic, COLUMNAR_MAGIC, 8) != 0 ||
+      version != COLUMNAR_VERSION || byteOrder != 1) {
+    this->close();
+    return -1;
+  }
+
+  // the trailer gives the position of the footer
+  long long footerOffset = 0, footerBytes = 0;
+  theFile.seekg(-COLUMNAR_TRAILER_SIZE, ios::end);
+  theFile.read((char *)&footerOffset, sizeof(long long));
+  theFile.read((char *)&footerBytes, sizeof(long long));
+  theFile.read(magic, 8);
+  if (!theFile || memcmp(magic, COLUMNAR_INDEX_MAGIC, 8) != 0 ||
+      footerOffset < COLUMNAR_HEADER_SIZE || footerBytes < 24) {
+    this->close();
+    return -1;
+  }
+
+  std::vector<char> buffer(footerBytes);
+  theFile.seekg(footerOffset, ios::beg);
+  theFile.read(&buffer[0], footerBytes);
+  if (!theFile) {
+    this->close();
+    return -1;
+  }
+
+  ColumnarFooter footer(buffer);
+  numColumns = footer.get<int>();
+  timeAxis = (footer.get<int>() != 0);
+  int numChunks = footer.get<int>();
+  footer.get<int>();
+  numRows = footer.get<long long>();
+  numBlocks = numColumns + (timeAxis ? 1 : 0);
+
+  if (numColumns < 0 || numChunks < 0) {
+    this->close();
+    return -1;
+  }
+
+  for (int i=0; i<numColumns && footer.ok; i++) {
+    int length = footer.get<int>();
+    columnNames.push_back(footer.getString(length));
+  }
+  footer.pad();
+
+  for (int i=0; i<numChunks && footer.ok; i++) {
+    chunkFirstRow.push_back(footer.get<long long>());
+    chunkNumRows.push_back(footer.get<int>());
+    footer.get<int>();
+    chunkMinTime.push_back(footer.get<double>());
+    chunkMaxTime.push_back(footer.get<double>());
+    for (int j=0; j<numBlocks; j++) {
+      blockEncoding.push_back(footer.get<int>());
+      footer.get<int>();
+      blockOffset.push_back(footer.get<long long>());
+      blockBytes.push_back(footer.get<long long>());
+    }
+  }
+
+  if (footer.ok == false) {
+    this->close();
+    return -1;
+  }
+
+  return 0;
+}
+
+void
+ColumnarFileReader::close(void)
+{
+  if (fileOpen == true)
+    theFile.close();
+  theFile.clear();
+  fileOpen = false;
+
+  numColumns = 0;
+  numBlocks = 0;
+  timeAxis = false;
+  numRows = 0;
+  columnNames.clear();
+  chunkFirstRow.clear();
+  chunkNumRows.clear();
+  chunkMinTime.clear();
+  chunkMaxTime.clear();
+  blockEncoding.clear();
+  blockOffset.clear();
+  blockBytes.clear();
+}
+
+int
+ColumnarFileReader::getNumColumns(void) const
+{
+  return numColumns;
+}
+
+int
+ColumnarFileReader::getNumChunks(void) const
+{
+  return chunkFirstRow.size();
+}
+
+long long
+ColumnarFileReader::getNumRows(void) const
+{
+  return numRows;
+}
+
+bool
+ColumnarFileReader::hasTime(void) const
+{
+  return timeAxis;
+}
+
+const char *
+ColumnarFileReader::getColumnName(int column) const
+{
+  if (column < 0 || column >= numColumns)
+    return 0;
+
+  return columnNames[column].c_str();
+}
+
+int
+ColumnarFileReader::findColumn(const char *name) const
+{
+  for (int i=0; i<numColumns; i++)
+    if (columnNames[i] == name)
+      return i;
+
+  return -1;
+}
+
+int
+ColumnarFileReader::readBlock(int chunk, int block, std::vector<double> &values)
+{
+  int index = chunk*numBlocks + block;
+  int n = chunkNumRows[chunk];
+  long long numBytes = blockBytes[index];
+
+  std::vector<unsigned char> bytes(numBytes);
+  theFile.clear();
+  theFile.seekg(blockOffset[index], ios::beg);
+  if (numBytes != 0)
+    theFile.read((char *)&bytes[0], numBytes);
+  if (!theFile)
+    return -1;
+
+  values.resize(n);
+  if (n == 0)
+    return 0;
+
+  return decodeColumnarBlock(blockEncoding[index], 
+			     (numBytes != 0) ? &bytes[0] : 0, numBytes, n, &values[0]);
+}
+
+int
+ColumnarFileReader::readColumn(int column, double tStart, double tEnd,
+			       std::vector<double> &values, std::vector<double> *time)
+{
+  values.clear();
+  if (time != 0)
+    time->clear();
+
+  if (fileOpen == false || column < -1 || column >= numColumns)
+    return -1;
+
+  std::vector<double> chunkTime, chunkValues;
+
+  int numChunks = chunkFirstRow.size();
+  for (int i=0; i<numChunks; i++) {
+
+    // only the chunks overlapping the window are read
+    if (chunkMaxTime[i] < tStart || chunkMinTime[i] > tEnd)
+      continue;
+
+    bool inside = (chunkMinTime[i] >= tStart && chunkMaxTime[i] <= tEnd);
+    int n = chunkNumRows[i];
+
+    if (column >= 0) {
+      int block = timeAxis ? column+1 : column;
+      if (this->readBlock(i, block, chunkValues) < 0)
+	return -1;
+    }
+
+    // the times are needed to trim a chunk at the ends of the window
+    if (inside == false || time != 0 || column < 0) {
+      if (timeAxis == true) {
+	if (this->readBlock(i, 0, chunkTime) < 0)
+	  return -1;
+      } else {
+	chunkTime.resize(n);
+	for (int k=0; k<n; k++)
+	  chunkTime[k] = chunkFirstRow[i] + k;
+      }
+    }
+
+    if (column < 0)
+      chunkValues = chunkTime;
+
+    for (int k=0; k<n; k++) {
+      if (inside == false && (chunkTime[k] < tStart || chunkTime[k] > tEnd))
+	continue;
+      values.push_back(chunkValues[k]);
+      if (time != 0)
+	time->push_back(chunkTime[k]);
+    }
+  }
+
+  return 0;
+}
+
+int
+ColumnarFileReader::readTime(double tStart, double tEnd, std::vector<double> &time)
+{
+  return this->readColumn(-1, tStart, tEnd, time);
+}
@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFileReader.h,v $
+
+// Created: 10/26
+//
+// Description: ColumnarFileReader reads the columnar results files
+// written by ColumnarFileStream (see ColumnarFile.h). open() reads the
+// index at the end of the file only; readColumn() then reads, for the
+// chunks that overlap the requested time window, the blocks of the
+// requested column and of the time axis. The class does not depend on
+// the rest of the framework so that it can be used by external tools;
+// the methods return -1 if the file cannot be read.
+//
+// What: "@(#) ColumnarFileReader.h, revA"
+
+#ifndef _ColumnarFileReader
+#define _ColumnarFileReader
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+class ColumnarFileReader
+{
+ public:
+  ColumnarFileReader();
+  ~ColumnarFileReader();
+
+  int open(const char *fileName);
+  void close(void);
+
+  int getNumColumns(void) const;
+  int getNumChunks(void) const;
+  long long getNumRows(void) const;
+  bool hasTime(void) const;
+  const char *getColumnName(int column) const;
+  int findColumn(const char *name) const;
+
+  // the values of a column, and optionally the times, for the rows with
+  // tStart <= t <= tEnd. without a time axis t is the row number;
+  // column -1 returns the time axis itself.
+  int readColumn(int column, double tStart, double tEnd,
+		 std::vector<double> &values, std::vector<double> *time = 0);
+  int readTime(double tStart, double tEnd, std::vector<double> &time);
+
+ private:
+  int readBlock(int chunk, int block, std::vector<double> &values);
+
+  std::ifstream theFile;
+  bool fileOpen;
+
+  int numColumns;
+  int numBlocks;            // numColumns, plus 1 if the file has a time axis
+  bool timeAxis;
+  long long numRows;
+  std::vector<std::string> columnNames;
+
+  std::vector<long long> chunkFirstRow;
+  std::vector<int> chunkNumRows;
+  std::vector<double> chunkMinTime;
+  std::vector<double> chunkMaxTime;
+  std::vector<int> blockEncoding;
+  std::vector<long long> blockOffset;
+  std::vector<long long> blockBytes;
+};
+
+#endif
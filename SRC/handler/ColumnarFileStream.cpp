@@ -0,0 +1,529 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFileStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ColumnarFileStream.
+//
+// What: "@(#) ColumnarFileStream.cpp, revA"
+
+#include <ColumnarFileStream.h>
+#include <ColumnarFile.h>
+#include <Vector.h>
+#include <classTags.h>
+#include <OPS_Globals.h>
+
+#include <string.h>
+#include <stdio.h>
+using std::ios;
+
+static void
+writeInt(ofstream &theFile, int value)
+{
+  theFile.write((const char *)&value, sizeof(int));
+}
+
+static void
+writeLong(ofstream &theFile, long long value)
+{
+  theFile.write((const char *)&value, sizeof(long long));
+}
+
+static void
+writeDouble(ofstream &theFile, double value)
+{
+  theFile.write((const char *)&value, sizeof(double));
+}
+
+ColumnarFileStream::ColumnarFileStream()
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarFileStream), 
+   fileOpen(0), fileName(0), compress(false), chunkSize(4096),
+   timeColumn(-1), numColumns(-1), chunk(0), numChunkRows(0), numRows(0)
+{
+
+}
+
+ColumnarFileStream::ColumnarFileStream(const char *file, bool comp, int size)
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarFileStream), 
+   fileOpen(0), fileName(0), compress(comp), chunkSize(size),
+   timeColumn(-1), numColumns(-1), chunk(0), numChunkRows(0), numRows(0)
+{
+  if (chunkSize < 1)
+    chunkSize = 4096;
+
+  this->setFile(file);
+}
+
+ColumnarFileStream::~ColumnarFileStream()
+{
+  this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+  if (chunk != 0)
+    delete [] chunk;
+}
+
+int 
+ColumnarFileStream::setFile(const char *name, openMode mode)
+{
+  if (name == 0) {
+    opserr << "ColumnarFileStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  if (mode == APPEND)
+    opserr << "WARNING ColumnarFileStream::setFile() - APPEND not supported, file " << name << " will be overwritten\n";
+
+  // first check if we are already writing a file
+  if (fileOpen == 1)
+    this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  return 0;
+}
+
+int 
+ColumnarFileStream::open(void)
+{
+  // check setFile has been called
+  if (fileName == 0) {
+    opserr << "ColumnarFileStream::open(void) - no file name has been set\n";
+    return -1;
+  }
+
+  // if file already open, return
+  if (fileOpen == 1)
+    return 0;
+
+  theFile.open(fileName, ios::out | ios::binary | ios::trunc);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING - ColumnarFileStream::open()";
+    opserr << " - could not open file " << fileName << endln;
+    fileOpen = 0;
+    return -1;
+  }
+  fileOpen = 1;
+
+  theFile.write(COLUMNAR_MAGIC, 8);
+  writeInt(theFile, COLUMNAR_VERSION);
+  writeInt(theFile, 1);
+
+  return 0;
+}
+
+int 
+ColumnarFileStream::close(void)
+{
+  if (fileOpen == 0)
+    return 0;
+
+  this->writeChunk();
+
+  //
+  // write the index
+  //
+
+  long long footerOffset = theFile.tellp();
+  int numChunks = chunkFirstRow.size();
+  int numBlocks = (numChunks != 0) ? blockEncoding.size()/numChunks : 0;
+  int numOut = (numColumns < 0) ? 0 : numColumns;
+  if (timeColumn >= 0)
+    numOut--;
+
+  writeInt(theFile, numOut);
+  writeInt(theFile, (timeColumn >= 0) ? 1 : 0);
+  writeInt(theFile, numChunks);
+  writeInt(theFile, 0);
+  writeLong(theFile, numRows);
+
+  for (int i=0; i<numColumns; i++) {
+    if (i == timeColumn)
+      continue;
+    int length = columnNames[i].size();
+    writeInt(theFile, length);
+    theFile.write(columnNames[i].c_str(), length);
+  }
+  this->pad();
+
+  for (int i=0; i<numChunks; i++) {
+    writeLong(theFile, chunkFirstRow[i]);
+    writeInt(theFile, chunkNumRows[i]);
+    writeInt(theFile, 0);
+    writeDouble(theFile, chunkMinTime[i]);
+    writeDouble(theFile, chunkMaxTime[i]);
+    for (int j=i*numBlocks; j<(i+1)*numBlocks; j++) {
+      writeInt(theFile, blockEncoding[j]);
+      writeInt(theFile, 0);
+      writeLong(theFile, blockOffset[j]);
+      writeLong(theFile, blockBytes[j]);
+    }
+  }
+
+  long long footerBytes = (long long)theFile.tellp() - footerOffset;
+  writeLong(theFile, footerOffset);
+  writeLong(theFile, footerBytes);
+  theFile.write(COLUMNAR_INDEX_MAGIC, 8);
+
+  if (theFile.bad())
+    opserr << "WARNING ColumnarFileStream::close() - error writing file " << fileName << endln;
+
+  theFile.close();
+  fileOpen = 0;
+
+  return 0;
+}
+
+void
+ColumnarFileStream::pad(void)
+{
+  long long pos = theFile.tellp();
+  static const char zeros[8] = {0,0,0,0,0,0,0,0};
+  if (pos % 8 != 0)
+    theFile.write(zeros, 8 - pos % 8);
+}
+
+int
+ColumnarFileStream::writeBlock(const double *values, int n)
+{
+  std::vector<unsigned char> bytes;
+  int encoding = encodeColumnarBlock(values, n, compress, bytes);
+
+  blockEncoding.push_back(encoding);
+  blockOffset.push_back(theFile.tellp());
+  blockBytes.push_back(bytes.size());
+
+  if (bytes.size() != 0)
+    theFile.write((const char *)&bytes[0], bytes.size());
+  this->pad();
+
+  return 0;
+}
+
+int
+ColumnarFileStream::writeChunk(void)
+{
+  if (numChunkRows == 0)
+    return 0;
+
+  long long firstRow = numRows - numChunkRows;
+  chunkFirstRow.push_back(firstRow);
+  chunkNumRows.push_back(numChunkRows);
+
+  // the time axis goes first
+  if (timeColumn >= 0) {
+    // the time need not increase (loadConst -time resets it), so the
+    // chunk is indexed by the smallest and largest time in it
+    const double *time = &chunk[timeColumn*chunkSize];
+    double tMin = time[0];
+    double tMax = time[0];
+    for (int i=1; i<numChunkRows; i++) {
+      if (time[i] < tMin)
+	tMin = time[i];
+      else if (time[i] > tMax)
+	tMax = time[i];
+    }
+    chunkMinTime.push_back(tMin);
+    chunkMaxTime.push_back(tMax);
+    this->writeBlock(time, numChunkRows);
+  } else {
+    chunkMinTime.push_back(firstRow);
+    chunkMaxTime.push_back(firstRow + numChunkRows - 1);
+  }
+
+  for (int i=0; i<numColumns; i++)
+    if (i != timeColumn)
+      this->writeBlock(&chunk[i*chunkSize], numChunkRows);
+
+  numChunkRows = 0;
+
+  if (theFile.bad()) {
+    opserr << "WARNING ColumnarFileStream::writeChunk() - error writing file " << fileName << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+int 
+ColumnarFileStream::tag(const char *tagName)
+{
+  openTags.push_back(tagName);
+  return 0;
+}
+
+int 
+ColumnarFileStream::tag(const char *tagName, const char *value)
+{
+  // a column is named after the enclosing tags and its response type
+  if (numColumns < 0 && strcmp(tagName, "ResponseType") == 0) {
+    std::string name;
+    for (unsigned int i=0; i<openTags.size(); i++) {
+      name += openTags[i];
+      name += "/";
+    }
+    name += value;
+
+    if (timeColumn < 0 && openTags.size() != 0 && openTags.back() == "TimeOutput")
+      timeColumn = columnNames.size();
+    columnNames.push_back(name);
+  }
+
+  return 0;
+}
+
+int 
+ColumnarFileStream::endTag()
+{
+  if (openTags.size() != 0)
+    openTags.pop_back();
+
+  return 0;
+}
+
+int 
+ColumnarFileStream::attr(const char *name, int value)
+{
+  char buffer[32];
+  sprintf(buffer, "%d", value);
+  return this->attr(name, buffer);
+}
+
+int 
+ColumnarFileStream::attr(const char *name, double value)
+{
+  // coordinates and the like are not part of the column names
+  return 0;
+}
+
+int 
+ColumnarFileStream::attr(const char *name, const char *value)
+{
+  if (openTags.size() == 0)
+    return 0;
+
+  std::string &theTag = openTags.back();
+  if (theTag[theTag.size()-1] == ')') {
+    theTag[theTag.size()-1] = ',';
+  } else
+    theTag += "(";
+  theTag += name;
+  theTag += "=";
+  theTag += value;
+  theTag += ")";
+
+  return 0;
+}
+
+int 
+ColumnarFileStream::write(Vector &data)
+{
+  if (fileOpen == 0)
+    if (this->open() < 0)
+      return -1;
+
+  int size = data.Size();
+
+  // the first row fixes the number of columns
+  if (numColumns < 0) {
+    numColumns = size;
+    if ((int)columnNames.size() != numColumns) {
+      columnNames.clear();
+      timeColumn = -1;
+      for (int i=0; i<numColumns; i++) {
+	char buffer[32];
+	sprintf(buffer, "column%d", i+1);
+	columnNames.push_back(buffer);
+      }
+    }
+    if (numColumns > 0)
+      chunk = new double[numColumns*chunkSize];
+  }
+
+  if (size != numColumns) {
+    opserr << "WARNING ColumnarFileStream::write() - row of size " << size;
+    opserr << " does not match the " << numColumns << " columns of file " << fileName << endln;
+    return -1;
+  }
+
+  if (numColumns == 0)
+    return 0;
+
+  for (int i=0; i<numColumns; i++)
+    chunk[i*chunkSize + numChunkRows] = data(i);
+  numChunkRows++;
+  numRows++;
+
+  if (numChunkRows == chunkSize)
+    return this->writeChunk();
+
+  return 0;
+}
+
+OPS_Stream& 
+ColumnarFileStream::write(const char *s,int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::write(const unsigned char *s,int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::write(const signed char *s,int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::write(const void *s, int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::write(const double *s, int n)
+{
+  Vector data((double *)s, n);
+  this->write(data);
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(char c)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(unsigned char c)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(signed char c)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(const char *s)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(const unsigned char *s)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(const signed char *s)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(const void *p)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(unsigned int n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(long n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(unsigned long n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(short n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(unsigned short n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(bool b)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(double n)
+{
+  return *this;
+}
+
+OPS_Stream& 
+ColumnarFileStream::operator<<(float n)
+{
+  return *this;
+}
+
+int 
+ColumnarFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "ColumnarFileStream::sendSelf() - not available in a parallel analysis\n";
+  return -1;
+}
+
+int 
+ColumnarFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "ColumnarFileStream::recvSelf() - not available in a parallel analysis\n";
+  return -1;
+}
@@ -0,0 +1,135 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFileStream.h,v $
+
+// Created: 10/26
+//
+// Description: ColumnarFileStream writes the output of a recorder to a
+// columnar results file (see ColumnarFile.h). The rows passed to
+// write(Vector &) are collected into chunks of chunkSize rows which are
+// written a column at a time, optionally compressed; an index of the
+// chunks and the column names is written at the end of the file when
+// the stream is closed. The column names are built from the tags and
+// attributes the recorder writes during its initialization, e.g.
+// NodeOutput(nodeTag=3)/UX1. The time column of a recorder created with
+// -time is written as the time axis of the file rather than as a column.
+// A file can be read with ColumnarFileReader or the readColumnar tool.
+//
+// What: "@(#) ColumnarFileStream.h, revA"
+
+#ifndef _ColumnarFileStream
+#define _ColumnarFileStream
+
+#include <OPS_Stream.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+using std::ofstream;
+
+class ColumnarFileStream : public OPS_Stream
+{
+ public:
+  ColumnarFileStream();
+  ColumnarFileStream(const char *fileName, bool compress = false, int chunkSize = 4096);
+  ~ColumnarFileStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE);
+  int open(void);
+  int close(void);
+  int setPrecision(int precision) {return 0;};
+  int setFloatField(floatField) {return 0;};
+  int precision(int precision) {return 0;};
+  int width(int width) {return 0;};
+  const char *getFileName(void) {return fileName;}
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  // parallel stuff
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int writeChunk(void);
+  int writeBlock(const double *values, int n);
+  void pad(void);
+
+  ofstream theFile;
+  int fileOpen;
+  char *fileName;
+  bool compress;
+  int chunkSize;
+
+  // column names, built from the tags before the first row is written
+  std::vector<std::string> openTags;
+  std::vector<std::string> columnNames;
+  int timeColumn;
+
+  // the rows of the current chunk, stored column by column
+  int numColumns;
+  double *chunk;
+  int numChunkRows;
+  long long numRows;
+
+  // the index written in the footer
+  std::vector<long long> chunkFirstRow;
+  std::vector<int> chunkNumRows;
+  std::vector<double> chunkMinTime;
+  std::vector<double> chunkMaxTime;
+  std::vector<int> blockEncoding;
+  std::vector<long long> blockOffset;
+  std::vector<long long> blockBytes;
+};
+
+#endif
@@ -0,0 +1,269 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ThreadedStream.cpp,v $
+
+#include <ThreadedStream.h>
+#include <ThreadPool.h>
+#include <Vector.h>
+#include <classTags.h>
+
+#include <string>
+
+ThreadedStream::ThreadedStream(int numThreads)
+  :OPS_Stream(OPS_STREAM_TAGS_ThreadedStream), 
+   numBuffers(numThreads), theBuffers(0)
+{
+  if (numBuffers < 1)
+    numBuffers = 1;
+  theBuffers = new ostringstream[numBuffers];
+}
+
+ThreadedStream::~ThreadedStream()
+{
+  if (theBuffers != 0)
+    delete [] theBuffers;
+}
+
+ostringstream &
+ThreadedStream::buffer(void)
+{
+  int threadID = ThreadPool::getThreadID();
+  if (threadID < 0 || threadID >= numBuffers)
+    threadID = 0;
+
+  return theBuffers[threadID];
+}
+
+int
+ThreadedStream::flush(OPS_Stream &theStream)
+{
+  for (int i=0; i<numBuffers; i++) {
+    std::string theString = theBuffers[i].str();
+    if (theString.length() != 0) {
+      theStream << theString.c_str();
+      theBuffers[i].str("");
+    }
+  }
+
+  return 0;
+}
+
+int 
+ThreadedStream::tag(const char *tagName)
+{
+  buffer() << tagName << "\n";
+  return 0;
+}
+
+int
+ThreadedStream::tag(const char *tagName, const char *value)
+{
+  buffer() << tagName << " " << value << "\n";
+  return 0;
+}
+
+int 
+ThreadedStream::endTag()
+{
+  return 0;
+}
+
+int 
+ThreadedStream::attr(const char *name, int value)
+{
+  buffer() << name << " = " << value << "\n";
+  return 0;
+}
+
+int 
+ThreadedStream::attr(const char *name, double value)
+{
+  buffer() << name << " = " << value << "\n";
+  return 0;
+}
+
+int 
+ThreadedStream::attr(const char *name, const char *value)
+{
+  buffer() << name << " = " << value << "\n";
+  return 0;
+}
+
+int 
+ThreadedStream::write(Vector &data)
+{
+  (*this) << data;  
+  return 0;
+}
+
+OPS_Stream& 
+ThreadedStream::write(const char *s, int n)
+{
+  buffer().write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::write(const unsigned char *s, int n)
+{
+  buffer().write((const char *)s, n);
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::write(const signed char *s, int n)
+{
+  buffer().write((const char *)s, n);
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::write(const void *s, int n)
+{
+  buffer().write((const char *)s, n);
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(char c)
+{
+  buffer() << c;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(unsigned char c)
+{
+  buffer() << c;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(signed char c)
+{
+  buffer() << c;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(const char *s)
+{
+  buffer() << s;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(const unsigned char *s)
+{
+  buffer() << (const char *)s;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(const signed char *s)
+{
+  buffer() << (const char *)s;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(const void *p)
+{
+  buffer() << p;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(int n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(unsigned int n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(long n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(unsigned long n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(short n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(unsigned short n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(bool b)
+{
+  buffer() << b;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(double n)
+{
+  buffer() << n;
+  return *this;
+}
+
+OPS_Stream& 
+ThreadedStream::operator<<(float n)
+{
+  buffer() << n;
+  return *this;
+}
+
+int 
+ThreadedStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int 
+ThreadedStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
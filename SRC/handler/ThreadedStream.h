@@ -0,0 +1,87 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ThreadedStream.h,v $
+
+// Description: ThreadedStream is the error stream installed by a
+// ThreadPool while a task is running. Output is appended to a buffer
+// owned by the calling thread (ThreadPool::getThreadID()); flush()
+// writes the buffers in thread order to another stream and empties them.
+
+#ifndef _ThreadedStream
+#define _ThreadedStream
+
+#include <OPS_Stream.h>
+
+#include <sstream>
+using std::ostringstream;
+
+class ThreadedStream : public OPS_Stream
+{
+ public:
+  ThreadedStream(int numThreads);
+  ~ThreadedStream();
+
+  int flush(OPS_Stream &theStream);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  ostringstream &buffer(void);
+
+  int numBuffers;
+  ostringstream *theBuffers;
+};
+
+#endif
@@ -0,0 +1,113 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/readColumnar.cpp,v $
+
+// Created: 10/26
+//
+// Description: readColumnar is a standalone program to look at the
+// columnar results files written by recorders with the -columnar option.
+//
+//   readColumnar fileName
+//       lists the columns, the number of rows and the time range
+//   readColumnar fileName column1 <column2 ...> <-time tStart tEnd>
+//       writes the time and the given columns, one row per line; a
+//       column is given by its name or by its index (from 1)
+//
+// What: "@(#) readColumnar.cpp, revA"
+
+#include <ColumnarFileReader.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+int
+main(int argc, char **argv)
+{
+  if (argc < 2) {
+    fprintf(stderr, "usage: readColumnar fileName <column ...> <-time tStart tEnd>\n");
+    return -1;
+  }
+
+  ColumnarFileReader theReader;
+  if (theReader.open(argv[1]) < 0) {
+    fprintf(stderr, "readColumnar - could not read columnar file %s\n", argv[1]);
+    return -1;
+  }
+
+  double tStart = -DBL_MAX;
+  double tEnd = DBL_MAX;
+  std::vector<int> columns;
+
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i], "-time") == 0 && i+2 < argc) {
+      tStart = atof(argv[i+1]);
+      tEnd = atof(argv[i+2]);
+      i += 2;
+    } else {
+      int column = theReader.findColumn(argv[i]);
+      if (column < 0) {
+	char *end = 0;
+	long index = strtol(argv[i], &end, 10);
+	if (end != argv[i] && *end == 0)
+	  column = index-1;
+      }
+      if (column < 0 || column >= theReader.getNumColumns()) {
+	fprintf(stderr, "readColumnar - no column %s in file %s\n", argv[i], argv[1]);
+	return -1;
+      }
+      columns.push_back(column);
+    }
+  }
+
+  // no columns given, describe the file
+  if (columns.size() == 0) {
+    std::vector<double> time;
+    theReader.readTime(tStart, tEnd, time);
+    printf("rows: %lld chunks: %d time axis: %s\n", theReader.getNumRows(),
+	   theReader.getNumChunks(), theReader.hasTime() ? "yes" : "no");
+    if (time.size() != 0)
+      printf("range: %.10g %.10g\n", time[0], time[time.size()-1]);
+    for (int i=0; i<theReader.getNumColumns(); i++)
+      printf("%d %s\n", i+1, theReader.getColumnName(i));
+    return 0;
+  }
+
+  std::vector<double> time;
+  std::vector< std::vector<double> > values(columns.size());
+  for (unsigned int j=0; j<columns.size(); j++)
+    if (theReader.readColumn(columns[j], tStart, tEnd, values[j], (j == 0) ? &time : 0) < 0) {
+      fprintf(stderr, "readColumnar - error reading file %s\n", argv[1]);
+      return -1;
+    }
+
+  for (unsigned int i=0; i<time.size(); i++) {
+    printf("%.10g", time[i]);
+    for (unsigned int j=0; j<columns.size(); j++)
+      printf(" %.10g", values[j][i]);
+    printf("\n");
+  }
+
+  return 0;
+}
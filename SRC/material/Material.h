@@ -59,6 +59,10 @@ class Material : public TaggedObject, public MovableObject
     // method for this material to update itself according to its new parameters
     virtual void update(void) {return;}
 
+    // true if the state determination of this material touches no storage
+    // shared with other objects, so that several threads may call it
+    virtual bool isThreadSafe(void) {return false;}
+
   protected:
     
   private:
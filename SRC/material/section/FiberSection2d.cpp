@@ -44,8 +44,75 @@
 #include <MaterialResponse.h>
 #include <UniaxialMaterial.h>
 #include <SectionIntegration.h>
+#include <ThreadWorkspace.h>
 #include <elementAPI.h>
 
+// scratch storage, one copy for each thread (see ThreadWorkspace); the
+// fiber arrays grow to the largest section seen, so there is no limit
+// on the number of fibers in a section
+struct FiberSection2dWorkspace {
+  FiberSection2dWorkspace()
+    :size(0), fiberLocs(0), fiberArea(0), locsDeriv(0), areaDeriv(0),
+     strain(0), stress(0), tangent(0), fiberStress(0), fiberTangent(0),
+     kInitialMatrix(kInitial, 2, 2) {};
+
+  ~FiberSection2dWorkspace() {
+    if (size != 0) {
+      delete [] fiberLocs;
+      delete [] fiberArea;
+      delete [] locsDeriv;
+      delete [] areaDeriv;
+      delete [] strain;
+      delete [] stress;
+      delete [] tangent;
+      delete [] fiberStress;
+      delete [] fiberTangent;
+    }
+  };
+
+  void setSize(int n) {
+    if (n > size) {
+      if (size != 0) {
+	delete [] fiberLocs;
+	delete [] fiberArea;
+	delete [] locsDeriv;
+	delete [] areaDeriv;
+	delete [] strain;
+	delete [] stress;
+	delete [] tangent;
+	delete [] fiberStress;
+	delete [] fiberTangent;
+      }
+      fiberLocs = new double[n];
+      fiberArea = new double[n];
+      locsDeriv = new double[n];
+      areaDeriv = new double[n];
+      strain = new double[n];
+      stress = new double[n];
+      tangent = new double[n];
+      fiberStress = new double[n];
+      fiberTangent = new double[n];
+      size = n;
+    }
+  };
+
+  int size;
+  double *fiberLocs;
+  double *fiberArea;
+  double *locsDeriv;
+  double *areaDeriv;
+  double *strain;        // fiber response, ordered by batch
+  double *stress;
+  double *tangent;
+  double *fiberStress;   // fiber response, in section order
+  double *fiberTangent;
+
+  double kInitial[4];
+  Matrix kInitialMatrix;
+};
+
+static ThreadWorkspace<FiberSection2dWorkspace> theWorkspace;
+
 ID FiberSection2d::code(2);
 
 void* OPS_FiberSection2d()
@@ -68,7 +135,9 @@ void* OPS_FiberSection2d()
 FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
+  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers > 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -125,7 +194,9 @@ FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers):
 FiberSection2d::FiberSection2d(int tag, int num): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
+  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(2), s(0), ks(0), dedh(2)
 {
     if(sizeFibers > 0) {
 	theMaterials = new UniaxialMaterial *[sizeFibers];
@@ -168,7 +239,9 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si):
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
+  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers != 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -191,10 +264,13 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double fiberLocs[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
   sectionIntegr->getFiberLocations(numFibers, fiberLocs);
   
-  static double fiberArea[10000];
+  double *fiberArea = theWork.fiberArea;
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
 
   for (int i = 0; i < numFibers; i++) {
@@ -231,7 +307,9 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 FiberSection2d::FiberSection2d():
   SectionForceDeformation(0, SEC_TAG_FiberSection2d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
-  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
+  QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(2), s(0), ks(0), dedh(2)
 {
   s = new Vector(sData, 2);
   ks = new Matrix(kData, 2, 2);
@@ -305,6 +383,8 @@ FiberSection2d::addFiber(Fiber &newFiber)
 
   numFibers++;
 
+  this->clearBatches();
+
   // Recompute centroid
   ABar += Area;
   QzBar += yLoc*Area;
@@ -317,6 +397,8 @@ FiberSection2d::addFiber(Fiber &newFiber)
 // destructor:
 FiberSection2d::~FiberSection2d()
 {
+  this->clearBatches();
+
   if (theMaterials != 0) {
     for (int i = 0; i < numFibers; i++)
       if (theMaterials[i] != 0)
@@ -338,6 +420,61 @@ FiberSection2d::~FiberSection2d()
     delete sectionIntegr;
 }
 
+void
+FiberSection2d::formBatches(void)
+{
+  this->clearBatches();
+
+  if (numFibers == 0)
+    return;
+
+  batchMaterials = new UniaxialMaterial *[numFibers];
+  batchFibers = new int[numFibers];
+  batchStart = new int[numFibers+1];
+
+  // the fibers of each class in turn, the classes in the order they
+  // first appear and the fibers of a class in section order
+  int *fiberBatch = new int[numFibers];
+  for (int i = 0; i < numFibers; i++)
+    fiberBatch[i] = -1;
+
+  int count = 0;
+  for (int i = 0; i < numFibers; i++) {
+    if (fiberBatch[i] != -1)
+      continue;
+    int classTag = theMaterials[i]->getClassTag();
+    batchStart[numBatches] = count;
+    for (int j = i; j < numFibers; j++) {
+      if (fiberBatch[j] == -1 && theMaterials[j]->getClassTag() == classTag) {
+	fiberBatch[j] = numBatches;
+	batchMaterials[count] = theMaterials[j];
+	batchFibers[count] = j;
+	count++;
+      }
+    }
+    numBatches++;
+  }
+  batchStart[numBatches] = count;
+
+  delete [] fiberBatch;
+}
+
+void
+FiberSection2d::clearBatches(void)
+{
+  if (batchMaterials != 0)
+    delete [] batchMaterials;
+  if (batchFibers != 0)
+    delete [] batchFibers;
+  if (batchStart != 0)
+    delete [] batchStart;
+
+  batchMaterials = 0;
+  batchFibers = 0;
+  batchStart = 0;
+  numBatches = 0;
+}
+
 int
 FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
 {
@@ -351,8 +488,11 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   double d0 = deforms(0);
   double d1 = deforms(1);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -365,23 +505,46 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
     }
   }
   
+  if (batchMaterials == 0)
+    this->formBatches();
+
+  double *strain = theWork.strain;
+  double *stress = theWork.stress;
+  double *tangent = theWork.tangent;
+  double *fiberStress = theWork.fiberStress;
+  double *fiberTangent = theWork.fiberTangent;
+
+  // determine material strains, ordered by batch
+  for (int k = 0; k < numFibers; k++) {
+    int i = batchFibers[k];
+    double y = fiberLocs[i] - yBar;
+    strain[k] = d0 - y*d1;
+  }
+
+  // and set them, the materials of each class in one call
+  for (int j = 0; j < numBatches; j++) {
+    int start = batchStart[j];
+    UniaxialMaterial **theMats = &batchMaterials[start];
+    res += theMats[0]->setTrialBatch(batchStart[j+1]-start, theMats, &strain[start],
+				     &stress[start], &tangent[start]);
+  }
+
+  for (int k = 0; k < numFibers; k++) {
+    fiberStress[batchFibers[k]] = stress[k];
+    fiberTangent[batchFibers[k]] = tangent[k];
+  }
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = fiberLocs[i] - yBar;
     double A = fiberArea[i];
 
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
-
-    double ks0 = tangent * A;
+    double ks0 = fiberTangent[i] * A;
     double ks1 = ks0 * -y;
     kData[0] += ks0;
     kData[1] += ks1;
     kData[3] += ks1 * -y;
 
-    double fs0 = stress * A;
+    double fs0 = fiberStress[i] * A;
     sData[0] += fs0;
     sData[1] += fs0 * -y;
   }
@@ -400,12 +563,15 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *kInitial = theWork.kInitial;
+  Matrix &kInitialMatrix = theWork.kInitialMatrix;
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -537,8 +703,11 @@ FiberSection2d::revertToLastCommit(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -587,8 +756,11 @@ FiberSection2d::revertToStart(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -628,6 +800,18 @@ FiberSection2d::revertToStart(void)
   return err;
 }
 
+bool
+FiberSection2d::isThreadSafe(void)
+{
+  // the section keeps its scratch storage in a ThreadWorkspace, so it is
+  // safe as long as every fiber material is
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 int
 FiberSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -702,6 +886,8 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 
   // recv data about materials objects, classTag and dbTag
   if (data(1) != 0) {
+    this->clearBatches();
+
     ID materialData(2*data(1));
     res += theChannel.recvID(dbTag, commitTag, materialData);
     if (res < 0) {
@@ -1078,8 +1264,11 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double tangent = 0.0;
   double sig_dAdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1092,8 +1281,8 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = theWork.locsDeriv;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1154,8 +1343,11 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
   double tangent = 0.0;
   double dtangentdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1168,8 +1360,8 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = theWork.locsDeriv;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1212,7 +1404,10 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double fiberLocs[10000];
+  FiberSection2dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *fiberLocs = theWork.fiberLocs;
 
   if (sectionIntegr != 0)
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1221,8 +1416,8 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
       fiberLocs[i] = matData[2*i];
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = theWork.locsDeriv;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
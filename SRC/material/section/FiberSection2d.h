@@ -64,6 +64,7 @@ class FiberSection2d : public SectionForceDeformation
     int   commitState(void);
     int   revertToLastCommit(void);    
     int   revertToStart(void);
+    bool  isThreadSafe(void);
  
     SectionForceDeformation *getCopy(void);
     const ID &getType (void);
@@ -103,6 +104,15 @@ class FiberSection2d : public SectionForceDeformation
   
     SectionIntegration *sectionIntegr;
 
+    // the materials ordered by class, so that those of a class are set
+    // with one call to UniaxialMaterial::setTrialBatch()
+    void formBatches(void);
+    void clearBatches(void);
+    UniaxialMaterial **batchMaterials;
+    int *batchFibers;                // fiber of each entry of batchMaterials
+    int *batchStart;                 // first entry of each batch
+    int numBatches;
+
     static ID code;
 
     Vector e;          // trial section deformations 
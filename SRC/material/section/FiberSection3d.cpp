@@ -43,9 +43,84 @@
 #include <MaterialResponse.h>
 #include <UniaxialMaterial.h>
 #include <SectionIntegration.h>
+#include <ThreadWorkspace.h>
 #include <elementAPI.h>
 #include <string.h>
 
+// scratch storage, one copy for each thread (see ThreadWorkspace); the
+// fiber arrays grow to the largest section seen, so there is no limit
+// on the number of fibers in a section
+struct FiberSection3dWorkspace {
+  FiberSection3dWorkspace()
+    :size(0), yLocs(0), zLocs(0), fiberArea(0), dydh(0), dzdh(0), areaDeriv(0),
+     strain(0), stress(0), tangent(0), fiberStress(0), fiberTangent(0),
+     kInitial(kInitialData, 3, 3) {};
+
+  ~FiberSection3dWorkspace() {
+    if (size != 0) {
+      delete [] yLocs;
+      delete [] zLocs;
+      delete [] fiberArea;
+      delete [] dydh;
+      delete [] dzdh;
+      delete [] areaDeriv;
+      delete [] strain;
+      delete [] stress;
+      delete [] tangent;
+      delete [] fiberStress;
+      delete [] fiberTangent;
+    }
+  };
+
+  void setSize(int n) {
+    if (n > size) {
+      if (size != 0) {
+	delete [] yLocs;
+	delete [] zLocs;
+	delete [] fiberArea;
+	delete [] dydh;
+	delete [] dzdh;
+	delete [] areaDeriv;
+	delete [] strain;
+	delete [] stress;
+	delete [] tangent;
+	delete [] fiberStress;
+	delete [] fiberTangent;
+      }
+      yLocs = new double[n];
+      zLocs = new double[n];
+      fiberArea = new double[n];
+      dydh = new double[n];
+      dzdh = new double[n];
+      areaDeriv = new double[n];
+      strain = new double[n];
+      stress = new double[n];
+      tangent = new double[n];
+      fiberStress = new double[n];
+      fiberTangent = new double[n];
+      size = n;
+    }
+  };
+
+  int size;
+  double *yLocs;
+  double *zLocs;
+  double *fiberArea;
+  double *dydh;
+  double *dzdh;
+  double *areaDeriv;
+  double *strain;        // fiber response, ordered by batch
+  double *stress;
+  double *tangent;
+  double *fiberStress;   // fiber response, in section order
+  double *fiberTangent;
+
+  double kInitialData[9];
+  Matrix kInitial;
+};
+
+static ThreadWorkspace<FiberSection3dWorkspace> theWorkspace;
+
 ID FiberSection3d::code(3);
 
 void* OPS_FiberSection3d()
@@ -68,7 +143,9 @@ void* OPS_FiberSection3d()
 FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
+  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(3), s(0), ks(0)
 {
   if (numFibers != 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -129,7 +206,9 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers):
 FiberSection3d::FiberSection3d(int tag, int num): 
     SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
     numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
-    QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
+    QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0),
+    batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+    e(3), s(0), ks(0)
 {
     if(sizeFibers != 0) {
 	theMaterials = new UniaxialMaterial *[sizeFibers];
@@ -173,7 +252,9 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si):
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
-  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
+  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(3), s(0), ks(0)
 {
   if (numFibers != 0) {
     theMaterials = new UniaxialMaterial *[numFibers];
@@ -196,11 +277,14 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
   sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
   
-  static double fiberArea[10000];
+  double *fiberArea = theWork.fiberArea;
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
   
   for (int i = 0; i < numFibers; i++) {
@@ -238,7 +322,9 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 FiberSection3d::FiberSection3d():
   SectionForceDeformation(0, SEC_TAG_FiberSection3d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
-  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
+  QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0),
+  batchMaterials(0), batchFibers(0), batchStart(0), numBatches(0),
+  e(3), s(0), ks(0)
 {
   s = new Vector(sData, 3);
   ks = new Matrix(kData, 3, 3);
@@ -313,6 +399,8 @@ FiberSection3d::addFiber(Fiber &newFiber)
 
   numFibers++;
 
+  this->clearBatches();
+
   // Recompute centroid
   Abar  += Area;
   QzBar += yLoc*Area;
@@ -329,6 +417,8 @@ FiberSection3d::addFiber(Fiber &newFiber)
 // destructor:
 FiberSection3d::~FiberSection3d()
 {
+  this->clearBatches();
+
   if (theMaterials != 0) {
     for (int i = 0; i < numFibers; i++)
       if (theMaterials[i] != 0)
@@ -350,6 +440,61 @@ FiberSection3d::~FiberSection3d()
     delete sectionIntegr;
 }
 
+void
+FiberSection3d::formBatches(void)
+{
+  this->clearBatches();
+
+  if (numFibers == 0)
+    return;
+
+  batchMaterials = new UniaxialMaterial *[numFibers];
+  batchFibers = new int[numFibers];
+  batchStart = new int[numFibers+1];
+
+  // the fibers of each class in turn, the classes in the order they
+  // first appear and the fibers of a class in section order
+  int *fiberBatch = new int[numFibers];
+  for (int i = 0; i < numFibers; i++)
+    fiberBatch[i] = -1;
+
+  int count = 0;
+  for (int i = 0; i < numFibers; i++) {
+    if (fiberBatch[i] != -1)
+      continue;
+    int classTag = theMaterials[i]->getClassTag();
+    batchStart[numBatches] = count;
+    for (int j = i; j < numFibers; j++) {
+      if (fiberBatch[j] == -1 && theMaterials[j]->getClassTag() == classTag) {
+	fiberBatch[j] = numBatches;
+	batchMaterials[count] = theMaterials[j];
+	batchFibers[count] = j;
+	count++;
+      }
+    }
+    numBatches++;
+  }
+  batchStart[numBatches] = count;
+
+  delete [] fiberBatch;
+}
+
+void
+FiberSection3d::clearBatches(void)
+{
+  if (batchMaterials != 0)
+    delete [] batchMaterials;
+  if (batchFibers != 0)
+    delete [] batchFibers;
+  if (batchStart != 0)
+    delete [] batchStart;
+
+  batchMaterials = 0;
+  batchFibers = 0;
+  batchStart = 0;
+  numBatches = 0;
+}
+
 int
 FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 {
@@ -365,9 +510,12 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   double d1 = deforms(1);
   double d2 = deforms(2);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -381,18 +529,42 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     }
   }
 
+  if (batchMaterials == 0)
+    this->formBatches();
+
+  double *strain = theWork.strain;
+  double *stress = theWork.stress;
+  double *tangent = theWork.tangent;
+  double *fiberStress = theWork.fiberStress;
+  double *fiberTangent = theWork.fiberTangent;
+
+  // determine material strains, ordered by batch
+  for (int k = 0; k < numFibers; k++) {
+    int i = batchFibers[k];
+    double y = yLocs[i] - yBar;
+    double z = zLocs[i] - zBar;
+    strain[k] = d0 - y*d1 + z*d2;
+  }
+
+  // and set them, the materials of each class in one call
+  for (int j = 0; j < numBatches; j++) {
+    int start = batchStart[j];
+    UniaxialMaterial **theMats = &batchMaterials[start];
+    res += theMats[0]->setTrialBatch(batchStart[j+1]-start, theMats, &strain[start],
+				     &stress[start], &tangent[start]);
+  }
+
+  for (int k = 0; k < numFibers; k++) {
+    fiberStress[batchFibers[k]] = stress[k];
+    fiberTangent[batchFibers[k]] = tangent[k];
+  }
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
 
-    // determine material strain and set it
-    double strain = d0 - y*d1 + z*d2;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
-
-    double value = tangent * A;
+    double value = fiberTangent[i] * A;
     double vas1 = -y*value;
     double vas2 = z*value;
     double vas1as2 = vas1*z;
@@ -406,7 +578,7 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     
     kData[8] += vas2 * z; 
 
-    double fs0 = stress * A;
+    double fs0 = fiberStress[i] * A;
 
     sData[0] += fs0;
     sData[1] += fs0 * -y;
@@ -423,8 +595,11 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[9];
-  static Matrix kInitial(kInitialData, 3, 3);
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *kInitialData = theWork.kInitialData;
+  Matrix &kInitial = theWork.kInitial;
   
   kInitialData[0] = 0.0; kInitialData[1] = 0.0; 
   kInitialData[2] = 0.0; kInitialData[3] = 0.0;
@@ -432,9 +607,9 @@ FiberSection3d::getInitialTangent(void)
   kInitialData[6] = 0.0; kInitialData[7] = 0.0;
   kInitialData[8] = 0.0; 
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -589,9 +764,12 @@ FiberSection3d::revertToLastCommit(void)
   kData[8] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; 
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -656,9 +834,12 @@ FiberSection3d::revertToStart(void)
   kData[8] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; 
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -711,6 +892,18 @@ FiberSection3d::revertToStart(void)
   return err;
 }
 
+bool
+FiberSection3d::isThreadSafe(void)
+{
+  // the section keeps its scratch storage in a ThreadWorkspace, so it is
+  // safe as long as every fiber material is
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 int
 FiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -786,6 +979,8 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 
   // recv data about materials objects, classTag and dbTag
   if (data(1) != 0) {
+    this->clearBatches();
+
     ID materialData(2*data(1));
     res += theChannel.recvID(dbTag, commitTag, materialData);
     if (res < 0) {
@@ -1258,9 +1453,12 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double sig_dAdh = 0;
   double tangent = 0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -1274,9 +1472,9 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  double *dydh = theWork.dydh;
+  double *dzdh = theWork.dzdh;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1359,8 +1557,11 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  FiberSection3dWorkspace &theWork = theWorkspace.get();
+  theWork.setSize(numFibers);
+
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
 
   if (sectionIntegr != 0)
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -1371,8 +1572,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  double *dydh = theWork.dydh;
+  double *dzdh = theWork.dzdh;
 
   if (sectionIntegr != 0)
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
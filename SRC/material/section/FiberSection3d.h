@@ -64,6 +64,7 @@ class FiberSection3d : public SectionForceDeformation
     int   commitState(void);
     int   revertToLastCommit(void);    
     int   revertToStart(void);
+    bool  isThreadSafe(void);
  
     SectionForceDeformation *getCopy(void);
     const ID &getType (void);
@@ -107,6 +108,15 @@ class FiberSection3d : public SectionForceDeformation
   
     SectionIntegration *sectionIntegr;
 
+    // the materials ordered by class, so that those of a class are set
+    // with one call to UniaxialMaterial::setTrialBatch()
+    void formBatches(void);
+    void clearBatches(void);
+    UniaxialMaterial **batchMaterials;
+    int *batchFibers;                // fiber of each entry of batchMaterials
+    int *batchStart;                 // first entry of each batch
+    int numBatches;
+
     static ID code;
 
     Vector e;          // trial section deformations 
@@ -276,6 +276,20 @@ Concrete01::setTrial (double strain, double &stress, double &tangent, double str
   return 0;
 }
 
+// the materials are all Concrete01, so the calls to setTrial() are
+// bound, and can be inlined, here
+int
+Concrete01::setTrialBatch (int n, UniaxialMaterial **theMaterials, const double *strain,
+			   double *stress, double *tangent)
+{
+  for (int i=0; i<n; i++) {
+    Concrete01 *theMat = (Concrete01 *)theMaterials[i];
+    theMat->Concrete01::setTrial(strain[i], stress[i], tangent[i]);
+  }
+
+  return 0;
+}
+
 void Concrete01::determineTrialState (double dStrain)
 {  
   TminStrain = CminStrain;
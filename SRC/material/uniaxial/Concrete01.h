@@ -52,6 +52,8 @@ class Concrete01 : public UniaxialMaterial
   
   int setTrialStrain(double strain, double strainRate = 0.0); 
   int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
+  int setTrialBatch (int n, UniaxialMaterial **theMaterials, const double *strain,
+		     double *stress, double *tangent);
   double getStrain(void);      
   double getStress(void);
   double getTangent(void);
@@ -60,6 +62,7 @@ class Concrete01 : public UniaxialMaterial
   int commitState(void);
   int revertToLastCommit(void);    
   int revertToStart(void);        
+  bool isThreadSafe(void) {return true;}
   
   UniaxialMaterial *getCopy(void);
   
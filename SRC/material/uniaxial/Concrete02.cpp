@@ -238,6 +238,23 @@ Concrete02::getStrain(void)
   return eps;
 }
 
+// the materials are all Concrete02, so the calls to setTrialStrain() are
+// bound, and can be inlined, here
+int
+Concrete02::setTrialBatch(int n, UniaxialMaterial **theMaterials, const double *strain,
+		       double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<n; i++) {
+    Concrete02 *theMat = (Concrete02 *)theMaterials[i];
+    res += theMat->Concrete02::setTrialStrain(strain[i]);
+    stress[i] = theMat->sig;
+    tangent[i] = theMat->e;
+  }
+
+  return res;
+}
+
 double 
 Concrete02::getStress(void)
 {
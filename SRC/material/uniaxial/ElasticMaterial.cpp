@@ -161,6 +161,23 @@ ElasticMaterial::setTrial(double strain, double &stress, double &tangent, double
 }
 
 
+int 
+ElasticMaterial::setTrialBatch(int n, UniaxialMaterial **theMaterials, const double *strain,
+			       double *stress, double *tangent)
+{
+    for (int i=0; i<n; i++) {
+        ElasticMaterial *theMat = (ElasticMaterial *)theMaterials[i];
+        double E = (strain[i] >= 0.0) ? theMat->Epos : theMat->Eneg;
+        theMat->trialStrain = strain[i];
+        theMat->trialStrainRate = 0.0;
+        stress[i] = E*strain[i];
+        tangent[i] = E;
+    }
+
+    return 0;
+}
+
+
 double 
 ElasticMaterial::getStress(void)
 {
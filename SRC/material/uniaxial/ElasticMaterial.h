@@ -50,6 +50,8 @@ class ElasticMaterial : public UniaxialMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
+    int setTrialBatch (int n, UniaxialMaterial **theMaterials, const double *strain,
+		       double *stress, double *tangent);
     double getStrain(void) {return trialStrain;};
     double getStrainRate(void) {return trialStrainRate;};
     double getStress(void);
@@ -60,6 +62,7 @@ class ElasticMaterial : public UniaxialMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+    bool isThreadSafe(void) {return true;}
 
     UniaxialMaterial *getCopy(void);
     
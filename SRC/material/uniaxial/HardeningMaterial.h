@@ -55,6 +55,7 @@ class HardeningMaterial : public UniaxialMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+    bool isThreadSafe(void) {return true;}
 
     UniaxialMaterial *getCopy(void);
     
@@ -210,6 +210,19 @@ int Steel01::setTrial (double strain, double &stress, double &tangent, double st
    return 0;
 }
 
+// the materials are all Steel01, so the calls to setTrial() are bound,
+// and can be inlined, here
+int Steel01::setTrialBatch (int n, UniaxialMaterial **theMaterials, const double *strain,
+			    double *stress, double *tangent)
+{
+   for (int i=0; i<n; i++) {
+     Steel01 *theMat = (Steel01 *)theMaterials[i];
+     theMat->Steel01::setTrial(strain[i], stress[i], tangent[i]);
+   }
+
+   return 0;
+}
+
 void Steel01::determineTrialState (double dStrain)
 {
       double fyOneMinusB = fy * (1.0 - b);
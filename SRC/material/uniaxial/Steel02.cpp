@@ -370,6 +370,23 @@ Steel02::getStrain(void)
   return eps;
 }
 
+// the materials are all Steel02, so the calls to setTrialStrain() are
+// bound, and can be inlined, here
+int
+Steel02::setTrialBatch(int n, UniaxialMaterial **theMaterials, const double *strain,
+		       double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<n; i++) {
+    Steel02 *theMat = (Steel02 *)theMaterials[i];
+    res += theMat->Steel02::setTrialStrain(strain[i]);
+    stress[i] = theMat->sig;
+    tangent[i] = theMat->e;
+  }
+
+  return res;
+}
+
 double 
 Steel02::getStress(void)
 {
@@ -103,6 +103,18 @@ UniaxialMaterial::setTrial(double strain, double &stress, double &tangent, doubl
 }
 
 
+int
+UniaxialMaterial::setTrialBatch(int n, UniaxialMaterial **theMaterials, const double *strain,
+				double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<n; i++)
+    res += theMaterials[i]->setTrial(strain[i], stress[i], tangent[i]);
+
+  return res;
+}
+
+
 int
 UniaxialMaterial::setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate)
 {
@@ -60,6 +60,14 @@ class UniaxialMaterial : public Material
     virtual int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
     virtual int setTrial (double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
 
+    // sets the trial strain of n materials, all of the same class as
+    // this one, and returns their stress and tangent; a subclass can
+    // override it to process the batch without a virtual call per
+    // material. the state stays in each material object, an override
+    // binds the per-material calls statically, it does not vectorize
+    virtual int setTrialBatch (int n, UniaxialMaterial **theMaterials, const double *strain,
+			       double *stress, double *tangent);
+
     virtual double getStrain (void) = 0;
     virtual double getStrainRate (void);
     virtual double getStress (void) = 0;
@@ -0,0 +1,286 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/MatrixND.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for MatrixND.
+// MatrixND is an NR x NC matrix of fixed size, held by value, for the
+// small matrices of the element and coordinate transformation kernels
+// (3x3 rotations, 6x6 basic stiffness and flexibility, 12x12 element
+// matrices). The products and the LU and Cholesky solves are inline
+// with loops of fixed length, which the compiler unrolls, and use no
+// work storage, so unlike Matrix::Solve() and Matrix::Invert() they
+// need neither LAPACK nor the shared static work arrays. The data is
+// stored by column as in Matrix, so a Matrix view of it is given by
+// Matrix(&m.values[0][0], NR, NC).
+//
+// What: "@(#) MatrixND.h, revA"
+
+#ifndef MatrixND_h
+#define MatrixND_h
+
+#include <Matrix.h>
+#include <VectorND.h>
+#include <math.h>
+
+template <int NR, int NC>
+class MatrixND
+{
+  public:
+    double values[NC][NR];
+
+    inline double &operator()(int row, int col) {return values[col][row];}
+    inline double operator()(int row, int col) const {return values[col][row];}
+
+    inline void Zero(void) {
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++)
+	  values[j][i] = 0.0;
+    }
+
+    inline int noRows(void) const {return NR;}
+    inline int noCols(void) const {return NC;}
+
+    // copies to and from a Matrix of size NR x NC
+    inline MatrixND &operator=(const Matrix &M) {
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++)
+	  values[j][i] = M(i,j);
+      return *this;
+    }
+    inline void copyTo(Matrix &M) const {
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++)
+	  M(i,j) = values[j][i];
+    }
+
+    inline MatrixND &operator*=(double fact) {
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++)
+	  values[j][i] *= fact;
+      return *this;
+    }
+
+    // this = thisFact*this + otherFact*other
+    inline int addMatrix(double thisFact, const MatrixND &other, double otherFact) {
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++)
+	  values[j][i] = thisFact*values[j][i] + otherFact*other.values[j][i];
+      return 0;
+    }
+
+    // this = thisFact*this + otherFact*A*B
+    template <int K>
+    inline int addMatrixProduct(double thisFact, const MatrixND<NR,K> &A,
+				const MatrixND<K,NC> &B, double otherFact) {
+      this->scale(thisFact);
+      for (int j = 0; j < NC; j++)
+	for (int k = 0; k < K; k++) {
+	  double bkj = otherFact*B.values[j][k];
+	  for (int i = 0; i < NR; i++)
+	    values[j][i] += A.values[k][i]*bkj;
+	}
+      return 0;
+    }
+
+    // this = thisFact*this + otherFact*A'*B
+    template <int K>
+    inline int addMatrixTransposeProduct(double thisFact, const MatrixND<K,NR> &A,
+					 const MatrixND<K,NC> &B, double otherFact) {
+      this->scale(thisFact);
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++) {
+	  double sum = 0.0;
+	  for (int k = 0; k < K; k++)
+	    sum += A.values[i][k]*B.values[j][k];
+	  values[j][i] += otherFact*sum;
+	}
+      return 0;
+    }
+
+    // this = thisFact*this + otherFact*T'*B*T
+    template <int K>
+    inline int addMatrixTripleProduct(double thisFact, const MatrixND<K,NR> &T,
+				      const MatrixND<K,K> &B, double otherFact) {
+      MatrixND<K,NC> BT;
+      BT.Zero();
+      BT.addMatrixProduct(0.0, B, T, 1.0);
+      return this->addMatrixTransposeProduct(thisFact, T, BT, otherFact);
+    }
+
+    // solves this*x = b by LU factorization with partial pivoting;
+    // returns -1 if the matrix is singular
+    inline int Solve(const VectorND<NR> &b, VectorND<NR> &x) const {
+      double a[NC][NR];
+      int piv[NR];
+      if (this->factorLU(a, piv) < 0)
+	return -1;
+      x = b;
+      solveLU(a, piv, x.values);
+      return 0;
+    }
+
+    // solves this*X = B
+    template <int M>
+    inline int Solve(const MatrixND<NR,M> &B, MatrixND<NR,M> &X) const {
+      double a[NC][NR];
+      int piv[NR];
+      if (this->factorLU(a, piv) < 0)
+	return -1;
+      X = B;
+      for (int j = 0; j < M; j++)
+	solveLU(a, piv, X.values[j]);
+      return 0;
+    }
+
+    inline int Invert(MatrixND &theInverse) const {
+      double a[NC][NR];
+      int piv[NR];
+      if (this->factorLU(a, piv) < 0)
+	return -1;
+      theInverse.Zero();
+      for (int j = 0; j < NC; j++) {
+	theInverse.values[j][j] = 1.0;
+	solveLU(a, piv, theInverse.values[j]);
+      }
+      return 0;
+    }
+
+    // solves this*x = b by Cholesky factorization, this being symmetric
+    // positive definite; returns -1 if it is not
+    inline int SolveCholesky(const VectorND<NR> &b, VectorND<NR> &x) const {
+      double l[NC][NR];
+      if (this->factorCholesky(l) < 0)
+	return -1;
+      x = b;
+      solveCholesky(l, x.values);
+      return 0;
+    }
+
+    // solves this*X = B
+    template <int M>
+    inline int SolveCholesky(const MatrixND<NR,M> &B, MatrixND<NR,M> &X) const {
+      double l[NC][NR];
+      if (this->factorCholesky(l) < 0)
+	return -1;
+      X = B;
+      for (int j = 0; j < M; j++)
+	solveCholesky(l, X.values[j]);
+      return 0;
+    }
+
+  private:
+    inline void scale(double thisFact) {
+      if (thisFact == 0.0)
+	this->Zero();
+      else if (thisFact != 1.0)
+	*this *= thisFact;
+    }
+
+    // LU factors of this, rows swapped as in LAPACK dgetrf
+    inline int factorLU(double (&a)[NC][NR], int (&piv)[NR]) const {
+      for (int j = 0; j < NC; j++)
+	for (int i = 0; i < NR; i++)
+	  a[j][i] = values[j][i];
+      for (int k = 0; k < NR; k++) {
+	int p = k;
+	double max = fabs(a[k][k]);
+	for (int i = k+1; i < NR; i++)
+	  if (fabs(a[k][i]) > max) {
+	    max = fabs(a[k][i]);
+	    p = i;
+	  }
+	piv[k] = p;
+	if (max == 0.0)
+	  return -1;
+	if (p != k)
+	  for (int j = 0; j < NC; j++) {
+	    double tmp = a[j][k];
+	    a[j][k] = a[j][p];
+	    a[j][p] = tmp;
+	  }
+	double invPivot = 1.0/a[k][k];
+	for (int i = k+1; i < NR; i++)
+	  a[k][i] *= invPivot;
+	for (int j = k+1; j < NC; j++) {
+	  double akj = a[j][k];
+	  for (int i = k+1; i < NR; i++)
+	    a[j][i] -= a[k][i]*akj;
+	}
+      }
+      return 0;
+    }
+
+    static inline void solveLU(const double (&a)[NC][NR], const int (&piv)[NR], double *x) {
+      for (int k = 0; k < NR; k++)
+	if (piv[k] != k) {
+	  double tmp = x[k];
+	  x[k] = x[piv[k]];
+	  x[piv[k]] = tmp;
+	}
+      for (int k = 0; k < NR; k++)
+	for (int i = k+1; i < NR; i++)
+	  x[i] -= a[k][i]*x[k];
+      for (int k = NR-1; k >= 0; k--) {
+	x[k] /= a[k][k];
+	for (int i = 0; i < k; i++)
+	  x[i] -= a[k][i]*x[k];
+      }
+    }
+
+    // lower triangular factor l of this = l*l'
+    inline int factorCholesky(double (&l)[NC][NR]) const {
+      for (int j = 0; j < NC; j++) {
+	double d = values[j][j];
+	for (int k = 0; k < j; k++)
+	  d -= l[k][j]*l[k][j];
+	if (d <= 0.0)
+	  return -1;
+	d = sqrt(d);
+	l[j][j] = d;
+	for (int i = j+1; i < NR; i++) {
+	  double sum = values[j][i];
+	  for (int k = 0; k < j; k++)
+	    sum -= l[k][i]*l[k][j];
+	  l[j][i] = sum/d;
+	}
+      }
+      return 0;
+    }
+
+    static inline void solveCholesky(const double (&l)[NC][NR], double *x) {
+      for (int j = 0; j < NC; j++) {
+	x[j] /= l[j][j];
+	for (int i = j+1; i < NR; i++)
+	  x[i] -= l[j][i]*x[j];
+      }
+      for (int j = NC-1; j >= 0; j--) {
+	for (int i = j+1; i < NR; i++)
+	  x[j] -= l[j][i]*x[i];
+	x[j] /= l[j][j];
+      }
+    }
+};
+
+#endif
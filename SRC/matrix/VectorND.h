@@ -0,0 +1,139 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/VectorND.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for VectorND.
+// VectorND is a vector of fixed size N, held by value, for the small
+// vectors of the element and coordinate transformation kernels. All
+// the operations are inline with loops of fixed length, which the
+// compiler unrolls; no memory is allocated. A Vector view of the data
+// is given by Vector(v.values, N).
+//
+// What: "@(#) VectorND.h, revA"
+
+#ifndef VectorND_h
+#define VectorND_h
+
+#include <Vector.h>
+#include <math.h>
+
+template <int NR, int NC> class MatrixND;
+
+template <int N>
+class VectorND
+{
+  public:
+    double values[N];
+
+    inline double &operator()(int x) {return values[x];}
+    inline double operator()(int x) const {return values[x];}
+
+    inline void Zero(void) {
+      for (int i = 0; i < N; i++)
+	values[i] = 0.0;
+    }
+
+    inline int Size(void) const {return N;}
+
+    // copies to and from a Vector of size N
+    inline VectorND &operator=(const Vector &V) {
+      for (int i = 0; i < N; i++)
+	values[i] = V(i);
+      return *this;
+    }
+    inline void copyTo(Vector &V) const {
+      for (int i = 0; i < N; i++)
+	V(i) = values[i];
+    }
+
+    // dot product
+    inline double operator^(const VectorND &V) const {
+      double sum = 0.0;
+      for (int i = 0; i < N; i++)
+	sum += values[i]*V.values[i];
+      return sum;
+    }
+
+    inline double Norm(void) const {
+      return sqrt(*this ^ *this);
+    }
+
+    inline VectorND &operator*=(double fact) {
+      for (int i = 0; i < N; i++)
+	values[i] *= fact;
+      return *this;
+    }
+
+    // this = thisFact*this + otherFact*other
+    inline int addVector(double thisFact, const VectorND &other, double otherFact) {
+      if (thisFact == 1.0) {
+	for (int i = 0; i < N; i++)
+	  values[i] += otherFact*other.values[i];
+      } else {
+	for (int i = 0; i < N; i++)
+	  values[i] = thisFact*values[i] + otherFact*other.values[i];
+      }
+      return 0;
+    }
+
+    // this = thisFact*this + otherFact*M*v
+    template <int NC>
+    inline int addMatrixVector(double thisFact, const MatrixND<N,NC> &M,
+			       const VectorND<NC> &v, double otherFact) {
+      if (thisFact == 0.0)
+	this->Zero();
+      else if (thisFact != 1.0)
+	*this *= thisFact;
+      for (int j = 0; j < NC; j++) {
+	double vj = otherFact*v.values[j];
+	for (int i = 0; i < N; i++)
+	  values[i] += M.values[j][i]*vj;
+      }
+      return 0;
+    }
+
+    // this = thisFact*this + otherFact*M'*v
+    template <int NR>
+    inline int addMatrixTransposeVector(double thisFact, const MatrixND<NR,N> &M,
+					const VectorND<NR> &v, double otherFact) {
+      for (int j = 0; j < N; j++) {
+	double sum = 0.0;
+	for (int i = 0; i < NR; i++)
+	  sum += M.values[j][i]*v.values[i];
+	values[j] = (thisFact == 0.0) ? otherFact*sum : thisFact*values[j] + otherFact*sum;
+      }
+      return 0;
+    }
+
+    // this = a x b, for N = 3 only
+    inline VectorND &cross(const VectorND &a, const VectorND &b) {
+      values[0] = a.values[1]*b.values[2] - a.values[2]*b.values[1];
+      values[1] = a.values[2]*b.values[0] - a.values[0]*b.values[2];
+      values[2] = a.values[0]*b.values[1] - a.values[1]*b.values[0];
+      return *this;
+    }
+};
+
+#endif
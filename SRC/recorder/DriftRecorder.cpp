@@ -175,6 +175,23 @@ DriftRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the nodes may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; they are looked up, and the output
+//	described, again before the next record.
+
+int
+DriftRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    theOutputHandler->endTag(); // Data
+    theOutputHandler->endTag(); // OpenSeesOutput
+    initializationDone = false;
+  }
+
+  return 0;
+}
+
 int 
 DriftRecorder::setDomain(Domain &theDom)
 {
@@ -58,6 +58,7 @@ class DriftRecorder: public Recorder
 
   int record(int commitTag, double timeStamp);
   int restart(void);    
+  int domainChanged(void);
 
   int setDomain(Domain &theDomain);
   int sendSelf(int commitTag, Channel &theChannel);  
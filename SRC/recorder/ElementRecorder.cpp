@@ -43,13 +43,15 @@
 #include <Message.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <ResponseGather.h>
 
 ElementRecorder::ElementRecorder()
 :Recorder(RECORDER_TAGS_ElementRecorder),
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
  theDomain(0), theOutputHandler(0),
  echoTimeFlag(true), deltaT(0), nextTimeStampToRecord(0.0), data(0), 
- initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
+ initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0),
+ theGather(0), gatherTag(0), gatherIndex(0)
 {
 
 }
@@ -66,7 +68,8 @@ ElementRecorder::ElementRecorder(const ID *ele,
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
  theDomain(&theDom), theOutputHandler(&theOutputHandler),
  echoTimeFlag(echoTime), deltaT(dT), nextTimeStampToRecord(0.0), data(0),
- initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
+ initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0),
+ theGather(0), gatherTag(0), gatherIndex(0)
 {
 
   if (ele != 0) {
@@ -130,6 +133,9 @@ ElementRecorder::~ElementRecorder()
 
   if (data != 0)
     delete data;
+
+  if (gatherIndex != 0)
+    delete gatherIndex;
   
   // 
   // invoke destructor on response args
@@ -165,6 +171,9 @@ ElementRecorder::record(int commitTag, double timeStamp)
     int loc = 0;
     if (echoTimeFlag == true) 
       (*data)(loc++) = timeStamp;
+
+    // responses fetched by the domain's gather plan are not asked for again
+    bool gathered = (theGather != 0 && theGather->isGathered(gatherTag));
     
     //
     // for each element if responses exist, put them in response vector
@@ -172,11 +181,18 @@ ElementRecorder::record(int commitTag, double timeStamp)
     for (int i=0; i< numEle; i++) {
       if (theResponses[i] != 0) {
 	// ask the element for the reponse
+	Response *theResponse = theResponses[i];
 	int res;
-	if (( res = theResponses[i]->getResponse()) < 0)
+	if (gathered == true && (*gatherIndex)(i) >= 0) {
+	  theResponse = theGather->getElementResponse((*gatherIndex)(i));
+	  res = theGather->getElementResult((*gatherIndex)(i));
+	} else
+	  res = theResponse->getResponse();
+
+	if (res < 0)
 	  result += res;
 	else {
-	  Information &eleInfo = theResponses[i]->getInformation();
+	  Information &eleInfo = theResponse->getInformation();
 	  const Vector &eleData = eleInfo.getData();
 	  if (numDOF == 0) {
 	    for (int j=0; j<eleData.Size(); j++)
@@ -213,6 +229,63 @@ ElementRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the elements may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; the responses are set up, and the output
+//	described, again before the next record.
+
+int
+ElementRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    theOutputHandler->endTag(); // Data
+    initializationDone = false;
+  }
+
+  if (data != 0) {
+    delete data;
+    data = 0;
+  }
+
+  return 0;
+}
+
+int
+ElementRecorder::addToGather(ResponseGather &thePlan)
+{
+  theGather = 0;
+
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "ElementRecorder::addToGather() - failed to initialize\n";
+      return -1;
+    }
+  }
+
+  // without the element tags the responses cannot be shared
+  if (eleID == 0)
+    return 0;
+
+  int client = thePlan.addClient(&deltaT, &nextTimeStampToRecord);
+
+  if (gatherIndex != 0)
+    delete gatherIndex;
+  gatherIndex = new ID(numEle);
+
+  for (int i=0; i<numEle; i++) {
+    if (theResponses[i] != 0)
+      (*gatherIndex)(i) = thePlan.addElementResponse(client, (*eleID)(i), (const char **)responseArgs, 
+						     numArgs, theResponses[i]);
+    else
+      (*gatherIndex)(i) = -1;
+  }
+
+  theGather = &thePlan;
+  gatherTag = thePlan.getPlanTag();
+
+  return 0;
+}
+
 
 int 
 ElementRecorder::setDomain(Domain &theDom)
@@ -506,6 +579,13 @@ ElementRecorder::initialize(void)
   if (theDomain == 0)
     return 0;
 
+  // the responses may be shared through the gather plan by other
+  // recorders, the plan must be rebuilt by the domain
+  if (theGather != 0) {
+    theGather->clear();
+    theGather = 0;
+  }
+
   if (theResponses != 0) {
     for (int i = 0; i < numEle; i++)
       delete theResponses[i];
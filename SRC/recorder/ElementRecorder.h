@@ -47,6 +47,7 @@ class Matrix;
 class Element;
 class Response;
 class FE_Datastore;
+class ResponseGather;
 
 class ElementRecorder: public Recorder
 {
@@ -65,6 +66,8 @@ class ElementRecorder: public Recorder
 
     int record(int commitTag, double timeStamp);
     int restart(void);    
+    int domainChanged(void);
+    int addToGather(ResponseGather &thePlan);
 
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
@@ -99,6 +102,11 @@ class ElementRecorder: public Recorder
     int numArgs;
 
     int addColumnInfo;
+
+    // the responses fetched by the Domain's gather plan
+    ResponseGather *theGather;
+    int gatherTag;
+    ID *gatherIndex;
 };
 
 
@@ -41,7 +41,7 @@
 
 EnvelopeDriftRecorder::EnvelopeDriftRecorder()
   :Recorder(RECORDER_TAGS_EnvelopeDriftRecorder),
-   ndI(0), ndJ(0), dof(0), perpDirn(0), oneOverL(0), currentData(0),
+   ndI(0), ndJ(0), dof(0), perpDirn(0), oneOverL(0), currentData(0), data(0),
    theDomain(0), theOutputHandler(0),
    initializationDone(false), numNodes(0), echoTimeFlag(false)
 {
@@ -57,7 +57,7 @@ EnvelopeDriftRecorder::EnvelopeDriftRecorder(int ni,
 					     OPS_Stream &theCurrentDataOutputHandler,
 					     bool timeFlag)
   :Recorder(RECORDER_TAGS_EnvelopeDriftRecorder),
-   ndI(0), ndJ(0), theNodes(0), dof(df), perpDirn(dirn), oneOverL(0), currentData(0),
+   ndI(0), ndJ(0), theNodes(0), dof(df), perpDirn(dirn), oneOverL(0), currentData(0), data(0),
    theDomain(&theDom), theOutputHandler(&theCurrentDataOutputHandler),
    initializationDone(false), numNodes(0), echoTimeFlag(timeFlag)
 {
@@ -79,7 +79,7 @@ EnvelopeDriftRecorder::EnvelopeDriftRecorder(const ID &nI,
 					     OPS_Stream &theDataOutputHandler,
 					     bool timeFlag)
   :Recorder(RECORDER_TAGS_EnvelopeDriftRecorder),
-   ndI(0), ndJ(0), theNodes(0), dof(df), perpDirn(dirn), oneOverL(0), currentData(0),
+   ndI(0), ndJ(0), theNodes(0), dof(df), perpDirn(dirn), oneOverL(0), currentData(0), data(0),
    theDomain(&theDom), theOutputHandler(&theDataOutputHandler),
    initializationDone(false), numNodes(0), echoTimeFlag(timeFlag)
 {
@@ -92,18 +92,7 @@ EnvelopeDriftRecorder::~EnvelopeDriftRecorder()
   //
   // write the data
   //
-  if (theOutputHandler != 0 && currentData != 0) {
-
-    theOutputHandler->tag("Data"); // Data
-    for (int i=0; i<3; i++) {
-      int size = currentData->Size();
-      for (int j=0; j<size; j++)
-	(*currentData)(j) = (*data)(i,j);
-      theOutputHandler->write(*currentData);
-    }
-    theOutputHandler->endTag(); // Data
-    theOutputHandler->endTag(); // OpenSeesOutput
-  }
+  this->writeEnvelope();
 
 
 
@@ -247,6 +236,50 @@ EnvelopeDriftRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the nodes may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; the envelope recorded so far is written out,
+//	as at the end of the analysis, and a new one is started for the
+//	nodes found when next recording.
+
+int
+EnvelopeDriftRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    this->writeEnvelope();
+    initializationDone = false;
+  }
+
+  if (data != 0) {
+    delete data;
+    data = 0;
+  }
+  if (currentData != 0) {
+    delete currentData;
+    currentData = 0;
+  }
+  first = true;
+
+  return 0;
+}
+
+void
+EnvelopeDriftRecorder::writeEnvelope(void)
+{
+  if (theOutputHandler == 0 || currentData == 0)
+    return;
+
+  theOutputHandler->tag("Data"); // Data
+  for (int i=0; i<3; i++) {
+    int size = currentData->Size();
+    for (int j=0; j<size; j++)
+      (*currentData)(j) = (*data)(i,j);
+    theOutputHandler->write(*currentData);
+  }
+  theOutputHandler->endTag(); // Data
+  theOutputHandler->endTag(); // OpenSeesOutput
+}
+
 int 
 EnvelopeDriftRecorder::setDomain(Domain &theDom)
 {
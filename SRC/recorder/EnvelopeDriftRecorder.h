@@ -56,6 +56,7 @@ class EnvelopeDriftRecorder: public Recorder
   
   int record(int commitTag, double timeStamp);
   int restart(void);    
+  int domainChanged(void);
   
   int setDomain(Domain &theDomain);
   int sendSelf(int commitTag, Channel &theChannel);  
@@ -66,6 +67,7 @@ class EnvelopeDriftRecorder: public Recorder
   
  private:	
   int initialize(void);
+  void writeEnvelope(void);
 
   ID *ndI;
   ID *ndJ;
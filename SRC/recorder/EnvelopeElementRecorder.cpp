@@ -112,19 +112,7 @@ EnvelopeElementRecorder::~EnvelopeElementRecorder()
   if (eleID != 0)
     delete eleID;
 
-  if (theHandler != 0 && currentData != 0) {
-
-    theHandler->tag("Data"); // Data
-
-    for (int i=0; i<3; i++) {
-      int numResponse = currentData->Size();
-      for (int j=0; j<numResponse; j++)
-	(*currentData)(j) = (*data)(i,j);
-      theHandler->write(*currentData);
-    }
-
-    theHandler->endTag(); // Data
-  }
+  this->writeEnvelope();
 
   if (theHandler != 0)
     delete theHandler;
@@ -293,6 +281,51 @@ EnvelopeElementRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the elements may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; the envelope recorded so far is written out,
+//	as at the end of the analysis, and a new one is started for the
+//	elements found when next recording.
+
+int
+EnvelopeElementRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    this->writeEnvelope();
+    initializationDone = false;
+  }
+
+  if (data != 0) {
+    delete data;
+    data = 0;
+  }
+  if (currentData != 0) {
+    delete currentData;
+    currentData = 0;
+  }
+  first = true;
+
+  return 0;
+}
+
+void
+EnvelopeElementRecorder::writeEnvelope(void)
+{
+  if (theHandler == 0 || currentData == 0)
+    return;
+
+  theHandler->tag("Data"); // Data
+
+  for (int i=0; i<3; i++) {
+    int numResponse = currentData->Size();
+    for (int j=0; j<numResponse; j++)
+      (*currentData)(j) = (*data)(i,j);
+    theHandler->write(*currentData);
+  }
+
+  theHandler->endTag(); // Data
+}
+
 int 
 EnvelopeElementRecorder::setDomain(Domain &theDom)
 {
@@ -181,20 +181,7 @@ EnvelopeNodeRecorder::~EnvelopeNodeRecorder()
   // write the data
   //
 
-  if (theHandler != 0 && data != 0) {
-    
-    theHandler->tag("Data"); // Data
-    
-    int numResponse = data->noCols();
-    
-    for (int i=0; i<3; i++) {
-      for (int j=0; j<numResponse; j++)
-	(*currentData)(j) = (*data)(i,j);
-      theHandler->write(*currentData);
-    }
-      
-    theHandler->endTag(); // Data
-  }
+  this->writeEnvelope();
 
   //
   // clean up the memory
@@ -519,6 +506,52 @@ EnvelopeNodeRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the nodes may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; the envelope recorded so far is written out,
+//	as at the end of the analysis, and a new one is started for the
+//	nodes found when next recording.
+
+int
+EnvelopeNodeRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    this->writeEnvelope();
+    initializationDone = false;
+  }
+
+  if (data != 0) {
+    delete data;
+    data = 0;
+  }
+  if (currentData != 0) {
+    delete currentData;
+    currentData = 0;
+  }
+  first = true;
+
+  return 0;
+}
+
+void
+EnvelopeNodeRecorder::writeEnvelope(void)
+{
+  if (theHandler == 0 || data == 0)
+    return;
+
+  theHandler->tag("Data"); // Data
+
+  int numResponse = data->noCols();
+
+  for (int i=0; i<3; i++) {
+    for (int j=0; j<numResponse; j++)
+      (*currentData)(j) = (*data)(i,j);
+    theHandler->write(*currentData);
+  }
+
+  theHandler->endTag(); // Data
+}
+
 
 int 
 EnvelopeNodeRecorder::setDomain(Domain &theDom)
@@ -65,6 +65,7 @@ class EnvelopeNodeRecorder: public Recorder
 
     int record(int commitTag, double timeStamp);
     int restart(void);    
+    int domainChanged(void);
 
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
@@ -75,6 +76,7 @@ class EnvelopeNodeRecorder: public Recorder
     
   private:	
     int initialize(void);
+    void writeEnvelope(void);
 
     ID *theDofs;
     ID *theNodalTags;
@@ -36,6 +36,7 @@
 #include <Matrix.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <ResponseGather.h>
 
 #include <string.h>
 #include <stdlib.h>
@@ -48,7 +49,8 @@ NodeRecorder::NodeRecorder()
  echoTimeFlag(true), dataFlag(0), 
  deltaT(0), nextTimeStampToRecord(0.0), 
  sensitivity(0),
- initializationDone(false), numValidNodes(0), addColumnInfo(0), theTimeSeries(0), timeSeriesValues(0)
+ initializationDone(false), numValidNodes(0), addColumnInfo(0), theTimeSeries(0), timeSeriesValues(0),
+ theGather(0), gatherTag(0), gatherIndex(0)
 {
 
 }
@@ -68,7 +70,8 @@ NodeRecorder::NodeRecorder(const ID &dofs,
  echoTimeFlag(timeFlag), dataFlag(0), 
  deltaT(dT), nextTimeStampToRecord(0.0), 
  sensitivity(psensitivity), 
- initializationDone(false), numValidNodes(0), addColumnInfo(0), theTimeSeries(theSeries), timeSeriesValues(0)
+ initializationDone(false), numValidNodes(0), addColumnInfo(0), theTimeSeries(theSeries), timeSeriesValues(0),
+ theGather(0), gatherTag(0), gatherIndex(0)
 {
 
   //
@@ -204,6 +207,9 @@ NodeRecorder::~NodeRecorder()
   if (theNodes != 0)
     delete [] theNodes;
 
+  if (gatherIndex != 0)
+    delete gatherIndex;
+
   if (theTimeSeries != 0) {
     for (int i=0; i<numDOF; i++)
       delete theTimeSeries[i];
@@ -238,17 +244,26 @@ NodeRecorder::record(int commitTag, double timeStamp)
     if (deltaT != 0.0) 
       nextTimeStampToRecord = timeStamp + deltaT;
 
+    //
+    // if the responses have been fetched by the domain's gather plan
+    // use those, otherwise ask the nodes
+    //
+
+    bool gathered = (theGather != 0 && theGather->isGathered(gatherTag));
+
     //
     // if need nodal reactions get the domain to calculate them
     // before we iterate over the nodes
     //
 
-    if (dataFlag == 7)
-      theDomain->calculateNodalReactions(0);
-    else if (dataFlag == 8)
-      theDomain->calculateNodalReactions(1);
-    if (dataFlag == 9)
-      theDomain->calculateNodalReactions(2);
+    if (gathered == false) {
+      if (dataFlag == 7)
+	theDomain->calculateNodalReactions(0);
+      else if (dataFlag == 8)
+	theDomain->calculateNodalReactions(1);
+      if (dataFlag == 9)
+	theDomain->calculateNodalReactions(2);
+    }
 
     //
     // add time information if requested
@@ -287,7 +302,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	if (dataFlag == 0) {
 	  // AddingSensitivity:BEGIN ///////////////////////////////////
 	  if (sensitivity==0) {
-	    const Vector &theResponse = theNode->getTrialDisp();
+	    const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getTrialDisp();
 	    for (int j=0; j<numDOF; j++) {
 
 	      if (theTimeSeries != 0) {
@@ -315,7 +330,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	  
 	  // AddingSensitivity:END /////////////////////////////////////
 	} else if (dataFlag == 1) {
-	  const Vector &theResponse = theNode->getTrialVel();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getTrialVel();
 	  for (int j=0; j<numDOF; j++) {
 
 	    if (theTimeSeries != 0) {
@@ -333,7 +348,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 
 
 	} else if (dataFlag == 10000) {
-	  const Vector &theResponse = theNode->getTrialDisp();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getTrialDisp();
 	  double sum = 0.0;
 
 	  for (int j=0; j<numDOF; j++) {
@@ -354,7 +369,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 
 	} else if (dataFlag == 2) {
 
-	  const Vector &theResponse = theNode->getTrialAccel();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getTrialAccel();
 	  for (int j=0; j<numDOF; j++) {
 
 	    if (theTimeSeries != 0) {
@@ -370,7 +385,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	    cnt++;
 	  }
 	} else if (dataFlag == 3) {
-	  const Vector &theResponse = theNode->getIncrDisp();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getIncrDisp();
 	  for (int j=0; j<numDOF; j++) {
 
 	    if (theTimeSeries != 0) {
@@ -386,7 +401,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	    cnt++;
 	  }
 	} else if (dataFlag == 4) {
-	  const Vector &theResponse = theNode->getIncrDeltaDisp();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getIncrDeltaDisp();
 	  for (int j=0; j<numDOF; j++) {
 	    int dof = (*theDofs)(j);
 	    if (theResponse.Size() > dof) {
@@ -397,7 +412,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	    cnt++;
 	  }
 	} else if (dataFlag == 5) {
-	  const Vector &theResponse = theNode->getUnbalancedLoad();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getUnbalancedLoad();
 	  for (int j=0; j<numDOF; j++) {
 	    int dof = (*theDofs)(j);
 	    if (theResponse.Size() > dof) {
@@ -409,7 +424,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	  }
 	  
 	} else if (dataFlag == 6) {
-	  const Vector &theResponse = theNode->getUnbalancedLoadIncInertia();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getUnbalancedLoadIncInertia();
 	  for (int j=0; j<numDOF; j++) {
 	    int dof = (*theDofs)(j);
 	    if (theResponse.Size() > dof) {
@@ -422,7 +437,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	  
 	  
 	} else if (dataFlag == 7 || dataFlag == 8 || dataFlag == 9) {
-	  const Vector &theResponse = theNode->getReaction();
+	  const Vector &theResponse = gathered ? theGather->getNodeResponse((*gatherIndex)(i)) : theNode->getReaction();
 	  for (int j=0; j<numDOF; j++) {
 	    int dof = (*theDofs)(j);
 	    if (theResponse.Size() > dof) {
@@ -764,9 +779,55 @@ NodeRecorder::recvSelf(int commitTag, Channel &theChannel,
   return 0;
 }
 
+// int domainChanged(void);
+//	the nodes may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; they are looked up, and the output
+//	described, again before the next record.
+
 int
 NodeRecorder::domainChanged(void)
 {
+  if (initializationDone == true) {
+    theOutputHandler->endTag(); // Data
+    initializationDone = false;
+  }
+
+  theGather = 0;
+
+  return 0;
+}
+
+int
+NodeRecorder::addToGather(ResponseGather &thePlan)
+{
+  theGather = 0;
+
+  // only the responses obtained directly from the nodes are gathered
+  if ((dataFlag < 0 || dataFlag > 9) && dataFlag != 10000)
+    return 0;
+  if (dataFlag == 0 && sensitivity != 0)
+    return 0;
+
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "NodeRecorder::addToGather() - failed in initialize()\n";
+      return -1;
+    }
+  }
+
+  int quantity = (dataFlag == 10000) ? ResponseGather::Disp : dataFlag;
+  int client = thePlan.addClient(&deltaT, &nextTimeStampToRecord);
+
+  if (gatherIndex != 0)
+    delete gatherIndex;
+  gatherIndex = new ID(numValidNodes);
+
+  for (int i=0; i<numValidNodes; i++)
+    (*gatherIndex)(i) = thePlan.addNodeResponse(client, theNodes[i], quantity);
+
+  theGather = &thePlan;
+  gatherTag = thePlan.getPlanTag();
+
   return 0;
 }
 
@@ -782,6 +843,9 @@ NodeRecorder::initialize(void)
   // create & set nodal array pointer
   //
 
+  // the gather plan refers to the old nodal array
+  theGather = 0;
+
   if (theNodes != 0) 
     delete [] theNodes;
 
@@ -44,6 +44,7 @@
 class Domain;
 class FE_Datastore;
 class Node;
+class ResponseGather;
 
 class NodeRecorder: public Recorder
 {
@@ -64,6 +65,7 @@ class NodeRecorder: public Recorder
     int record(int commitTag, double timeStamp);
 
     int domainChanged(void);    
+    int addToGather(ResponseGather &thePlan);
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -99,6 +101,11 @@ class NodeRecorder: public Recorder
 
     TimeSeries **theTimeSeries;
     double *timeSeriesValues;
+
+    // the responses fetched by the Domain's gather plan
+    ResponseGather *theGather;
+    int gatherTag;
+    ID *gatherIndex;
 };
 
 #endif
@@ -216,6 +216,27 @@ NormElementRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the elements may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; the responses are set up, and the output
+//	described, again before the next record.
+
+int
+NormElementRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    theOutputHandler->endTag(); // Data
+    initializationDone = false;
+  }
+
+  if (data != 0) {
+    delete data;
+    data = 0;
+  }
+
+  return 0;
+}
+
 
 int 
 NormElementRecorder::setDomain(Domain &theDom)
@@ -65,6 +65,7 @@ class NormElementRecorder: public Recorder
 
     int record(int commitTag, double timeStamp);
     int restart(void);    
+    int domainChanged(void);
 
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
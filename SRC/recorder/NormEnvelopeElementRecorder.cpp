@@ -119,18 +119,7 @@ NormEnvelopeElementRecorder::~NormEnvelopeElementRecorder()
   if (dof != 0)
     delete dof;
 
-  if (theHandler != 0 && currentData != 0) {
-    theHandler->tag("Data"); // Data
-
-    for (int i=0; i<3; i++) {
-      int numResponse = currentData->Size();
-      for (int j=0; j<numResponse; j++)
-	(*currentData)(j) = (*data)(i,j);
-      theHandler->write(*currentData);
-    }
-
-    theHandler->endTag(); // Data
-  }
+  this->writeEnvelope();
 
   if (theHandler != 0)
     delete theHandler;
@@ -272,6 +261,51 @@ NormEnvelopeElementRecorder::restart(void)
   return 0;
 }
 
+// int domainChanged(void);
+//	the elements may have been moved or deleted, as when a partitioned
+//	domain is rebalanced; the envelope recorded so far is written out,
+//	as at the end of the analysis, and a new one is started for the
+//	elements found when next recording.
+
+int
+NormEnvelopeElementRecorder::domainChanged(void)
+{
+  if (initializationDone == true) {
+    this->writeEnvelope();
+    initializationDone = false;
+  }
+
+  if (data != 0) {
+    delete data;
+    data = 0;
+  }
+  if (currentData != 0) {
+    delete currentData;
+    currentData = 0;
+  }
+  first = true;
+
+  return 0;
+}
+
+void
+NormEnvelopeElementRecorder::writeEnvelope(void)
+{
+  if (theHandler == 0 || currentData == 0)
+    return;
+
+  theHandler->tag("Data"); // Data
+
+  for (int i=0; i<3; i++) {
+    int numResponse = currentData->Size();
+    for (int j=0; j<numResponse; j++)
+      (*currentData)(j) = (*data)(i,j);
+    theHandler->write(*currentData);
+  }
+
+  theHandler->endTag(); // Data
+}
+
 int 
 NormEnvelopeElementRecorder::setDomain(Domain &theDom)
 {
@@ -60,6 +60,7 @@ class NormEnvelopeElementRecorder: public Recorder
 
     int record(int commitTag, double timeStamp);
     int restart(void);    
+    int domainChanged(void);
 
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
@@ -70,6 +71,7 @@ class NormEnvelopeElementRecorder: public Recorder
     
   private:	
     int initialize(void);
+    void writeEnvelope(void);
 
     int numEle;
     int numDOF;
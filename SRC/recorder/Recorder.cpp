@@ -59,6 +59,13 @@ Recorder::domainChanged(void)
   return 0;
 }
 
+int 
+Recorder::addToGather(ResponseGather &thePlan)
+{
+  // by default a recorder fetches its own responses
+  return 0;
+}
+
 int 
 Recorder::setDomain(Domain &theDomain)
 {
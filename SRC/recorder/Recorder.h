@@ -37,6 +37,7 @@
 // What: "@(#) Recorder.h, revA"
 
 class Domain;
+class ResponseGather;
 #include <MovableObject.h>
 #include <TaggedObject.h>
 
@@ -51,6 +52,7 @@ class Recorder: public MovableObject, public TaggedObject
     
     virtual int restart(void);
     virtual int domainChanged(void);
+    virtual int addToGather(ResponseGather &thePlan);
     virtual int setDomain(Domain &theDomain);
     virtual int sendSelf(int commitTag, Channel &theChannel);  
     virtual int recvSelf(int commitTag, Channel &theChannel, 
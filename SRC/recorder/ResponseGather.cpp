@@ -0,0 +1,321 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/recorder/ResponseGather.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ResponseGather.
+//
+// What: "@(#) ResponseGather.cpp, revA"
+
+#include <ResponseGather.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <Response.h>
+#include <ThreadPool.h>
+#include <OPS_Globals.h>
+
+#include <stdio.h>
+
+static Vector gatherDummy(0);
+
+// ThreadTask fetching the responses of the plan; the items are the
+// nodal responses followed by the element responses
+class ResponseGatherTask : public ThreadTask
+{
+ public:
+  ResponseGatherTask(std::vector<Node *> &nodes, std::vector<int> &quantity,
+		     std::vector<Vector *> &data, std::vector<char> &nodesNeeded,
+		     std::vector<Response *> &responses, std::vector<int> &results,
+		     std::vector<char> &elesNeeded)
+    :theNodes(nodes), nodeQuantity(quantity), nodeData(data), nodeNeeded(nodesNeeded),
+     theResponses(responses), eleResults(results), eleNeeded(elesNeeded) {};
+
+  int execute(int start, int end, int threadID) {
+    int numNodes = theNodes.size();
+    int ok = 0;
+    for (int i=start; i<end; i++) {
+      if (i < numNodes) {
+	if (nodeNeeded[i] != 0 && nodeQuantity[i] < ResponseGather::Reaction)
+	  this->fetch(i);
+      } else {
+	int j = i - numNodes;
+	if (eleNeeded[j] != 0) {
+	  eleResults[j] = theResponses[j]->getResponse();
+	  if (eleResults[j] < 0)
+	    ok += eleResults[j];
+	}
+      }
+    }
+    return ok;
+  };
+
+  void fetch(int i) {
+    Node *theNode = theNodes[i];
+    switch (nodeQuantity[i]) {
+    case ResponseGather::Disp:
+      *nodeData[i] = theNode->getTrialDisp(); break;
+    case ResponseGather::Vel:
+      *nodeData[i] = theNode->getTrialVel(); break;
+    case ResponseGather::Accel:
+      *nodeData[i] = theNode->getTrialAccel(); break;
+    case ResponseGather::IncrDisp:
+      *nodeData[i] = theNode->getIncrDisp(); break;
+    case ResponseGather::IncrDeltaDisp:
+      *nodeData[i] = theNode->getIncrDeltaDisp(); break;
+    case ResponseGather::Unbalance:
+      *nodeData[i] = theNode->getUnbalancedLoad(); break;
+    case ResponseGather::UnbalanceInertia:
+      *nodeData[i] = theNode->getUnbalancedLoadIncInertia(); break;
+    default:
+      *nodeData[i] = theNode->getReaction(); break;
+    }
+  };
+
+ private:
+  std::vector<Node *> &theNodes;
+  std::vector<int> &nodeQuantity;
+  std::vector<Vector *> &nodeData;
+  std::vector<char> &nodeNeeded;
+  std::vector<Response *> &theResponses;
+  std::vector<int> &eleResults;
+  std::vector<char> &eleNeeded;
+};
+
+ResponseGather::ResponseGather()
+  :planTag(0), gathered(false)
+{
+
+}
+
+ResponseGather::~ResponseGather()
+{
+  this->clear();
+}
+
+int
+ResponseGather::clear(void)
+{
+  for (unsigned int i=0; i<nodeData.size(); i++)
+    delete nodeData[i];
+
+  clientDeltaT.clear();
+  clientNextTime.clear();
+  nodeMap.clear();
+  theNodes.clear();
+  nodeQuantity.clear();
+  nodeData.clear();
+  eleMap.clear();
+  theResponses.clear();
+  eleResults.clear();
+  requests.clear();
+  nodeNeeded.clear();
+  eleNeeded.clear();
+
+  // recorders holding indices into the old plan no longer use them
+  planTag++;
+  gathered = false;
+
+  return 0;
+}
+
+int
+ResponseGather::getPlanTag(void) const
+{
+  return planTag;
+}
+
+int
+ResponseGather::addClient(const double *deltaT, const double *nextTimeStamp)
+{
+  clientDeltaT.push_back(deltaT);
+  clientNextTime.push_back(nextTimeStamp);
+  return clientDeltaT.size()-1;
+}
+
+int
+ResponseGather::addNodeResponse(int client, Node *theNode, int quantity)
+{
+  if (theNode == 0 || quantity < 0 || quantity >= numQuantities ||
+      client < 0 || client >= (int)clientDeltaT.size())
+    return -1;
+
+  std::pair<Node *, int> key(theNode, quantity);
+  std::map<std::pair<Node *, int>, int>::iterator it = nodeMap.find(key);
+
+  int index;
+  if (it != nodeMap.end()) 
+    index = it->second;
+  else {
+    index = theNodes.size();
+    nodeMap[key] = index;
+    theNodes.push_back(theNode);
+    nodeQuantity.push_back(quantity);
+    nodeData.push_back(new Vector(0));
+  }
+
+  requests.push_back(std::pair<int,int>(index, client));
+  return index;
+}
+
+int
+ResponseGather::addElementResponse(int client, int eleTag, const char **argv, int argc,
+				   Response *theResponse)
+{
+  if (theResponse == 0 || client < 0 || client >= (int)clientDeltaT.size())
+    return -1;
+
+  // the key is the element tag followed by the arguments
+  char buffer[32];
+  sprintf(buffer, "%d", eleTag);
+  std::string key(buffer);
+  for (int i=0; i<argc; i++) {
+    key += '\0';
+    key += argv[i];
+  }
+
+  std::map<std::string, int>::iterator it = eleMap.find(key);
+
+  int index;
+  if (it != eleMap.end()) 
+    index = it->second;
+  else {
+    index = theResponses.size();
+    eleMap[key] = index;
+    theResponses.push_back(theResponse);
+    eleResults.push_back(0);
+  }
+
+  requests.push_back(std::pair<int,int>(-index-1, client));
+  return index;
+}
+
+int
+ResponseGather::gather(Domain &theDomain, double timeStamp)
+{
+  gathered = false;
+
+  int numNodes = theNodes.size();
+  int numEles = theResponses.size();
+  if (numNodes + numEles == 0)
+    return 0;
+
+  //
+  // determine the responses of the clients recording at this time
+  //
+
+  int numClients = clientDeltaT.size();
+  std::vector<char> due(numClients);
+  for (int i=0; i<numClients; i++)
+    due[i] = (*clientDeltaT[i] == 0.0 || timeStamp >= *clientNextTime[i]) ? 1 : 0;
+
+  nodeNeeded.assign(numNodes, 0);
+  eleNeeded.assign(numEles, 0);
+  for (unsigned int i=0; i<requests.size(); i++) {
+    if (due[requests[i].second] == 0)
+      continue;
+    int index = requests[i].first;
+    if (index >= 0)
+      nodeNeeded[index] = 1;
+    else
+      eleNeeded[-index-1] = 1;
+  }
+
+  ResponseGatherTask theTask(theNodes, nodeQuantity, nodeData, nodeNeeded,
+			     theResponses, eleResults, eleNeeded);
+
+  //
+  // the reactions: all of one type are computed and copied before the next
+  //
+
+  for (int type=Reaction; type<=ReactionRayleigh; type++) {
+    bool computed = false;
+    for (int i=0; i<numNodes; i++) {
+      if (nodeNeeded[i] != 0 && nodeQuantity[i] == type) {
+	if (computed == false) {
+	  theDomain.calculateNodalReactions(type-Reaction);
+	  computed = true;
+	}
+	theTask.fetch(i);
+      }
+    }
+  }
+
+  //
+  // the rest of the nodal responses are independent of each other; the
+  // element responses are fetched by this thread, as Response::getResponse()
+  // ends in element and material code that may use static storage
+  //
+
+  int result = 0;
+  ThreadPool *thePool = ThreadPool::getThreadPool();
+  if (thePool != 0) {
+    result = thePool->run(theTask, numNodes);
+    result += theTask.execute(numNodes, numNodes + numEles, 0);
+  } else
+    result = theTask.execute(0, numNodes + numEles, 0);
+
+  gathered = true;
+
+  return result;
+}
+
+void
+ResponseGather::release(void)
+{
+  gathered = false;
+}
+
+bool
+ResponseGather::isGathered(int tag) const
+{
+  return (gathered == true && tag == planTag);
+}
+
+const Vector &
+ResponseGather::getNodeResponse(int index) const
+{
+  if (index < 0 || index >= (int)nodeData.size())
+    return gatherDummy;
+
+  return *nodeData[index];
+}
+
+Response *
+ResponseGather::getElementResponse(int index) const
+{
+  if (index < 0 || index >= (int)theResponses.size())
+    return 0;
+
+  return theResponses[index];
+}
+
+int
+ResponseGather::getElementResult(int index) const
+{
+  if (index < 0 || index >= (int)eleResults.size())
+    return -1;
+
+  return eleResults[index];
+}
@@ -0,0 +1,112 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/recorder/ResponseGather.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// ResponseGather. A ResponseGather is the plan used by the Domain to
+// fetch the responses of all its recorders in one pass on each commit.
+// When the plan is built each recorder adds, through
+// Recorder::addToGather(), the nodal and element responses it records;
+// a response requested by several recorders (the same quantity of the
+// same node, or the same response arguments for the same element) is
+// fetched only once. gather() then fetches the responses of the
+// recorders that will record at the given time, the nodal ones using the
+// threads of the ThreadPool if any, and the recorders read them from the plan
+// while isGathered() holds, i.e. until release() is called by the
+// Domain once all recorders have recorded.
+//
+// The nodal quantities are the dataFlag values 0 through 9 of a
+// NodeRecorder; the nodal reactions are computed once for each of the
+// three reaction types requested.
+//
+// What: "@(#) ResponseGather.h, revA"
+
+#ifndef ResponseGather_h
+#define ResponseGather_h
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Domain;
+class Node;
+class Response;
+class Vector;
+
+class ResponseGather
+{
+  public:
+    enum {Disp=0, Vel=1, Accel=2, IncrDisp=3, IncrDeltaDisp=4,
+	  Unbalance=5, UnbalanceInertia=6, Reaction=7, 
+	  ReactionInertia=8, ReactionRayleigh=9, numQuantities=10};
+
+    ResponseGather();
+    ~ResponseGather();
+
+    // building the plan
+    int clear(void);
+    int getPlanTag(void) const;
+    int addClient(const double *deltaT, const double *nextTimeStamp);
+    int addNodeResponse(int client, Node *theNode, int quantity);
+    int addElementResponse(int client, int eleTag, const char **argv, int argc,
+			   Response *theResponse);
+
+    // executing the plan
+    int gather(Domain &theDomain, double timeStamp);
+    void release(void);
+    bool isGathered(int planTag) const;
+
+    const Vector &getNodeResponse(int index) const;
+    Response *getElementResponse(int index) const;
+    int getElementResult(int index) const;
+
+  private:
+    int planTag;
+    bool gathered;
+
+    // the clients, i.e. the recorders, and whether each records now
+    std::vector<const double *> clientDeltaT;
+    std::vector<const double *> clientNextTime;
+
+    // the distinct nodal responses and the copies fetched
+    std::map<std::pair<Node *, int>, int> nodeMap;
+    std::vector<Node *> theNodes;
+    std::vector<int> nodeQuantity;
+    std::vector<Vector *> nodeData;
+
+    // the distinct element responses and their results
+    std::map<std::string, int> eleMap;
+    std::vector<Response *> theResponses;
+    std::vector<int> eleResults;
+
+    // the (response, client) pairs; a nodal response i is stored as i,
+    // an element response j as -j-1
+    std::vector< std::pair<int,int> > requests;
+    std::vector<char> nodeNeeded;
+    std::vector<char> eleNeeded;
+};
+
+#endif
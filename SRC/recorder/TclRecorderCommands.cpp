@@ -72,6 +72,8 @@
  #include <DatabaseStream.h>
  #include <DummyStream.h>
  #include <TCP_Stream.h>
+ #include <AsyncStream.h>
+ #include <ColumnarFileStream.h>
 
  #include <packages.h>
  #include <elementAPI.h>
@@ -98,7 +100,7 @@
 
  static ExternalRecorderCommand *theExternalRecorderCommands = NULL;
 
- enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM};
+ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, COLUMNAR_STREAM};
 
 
  #include <EquiSolnAlgo.h>
@@ -160,6 +162,8 @@
        const char *inetAddr = 0;
        int inetPort;
        bool closeOnWrite = false;
+       bool asyncOutput = false;
+       bool compressOutput = false;
        int writeBufferSize = 0;
        bool doScientific = false;
 
@@ -339,6 +343,11 @@
 	   closeOnWrite = true;
 	   loc +=1;
 	 }
+
+	 else if (strcmp(argv[loc],"-async") == 0) {
+	   asyncOutput = true;
+	   loc +=1;
+	 }
      
 	 else if (strcmp(argv[loc],"-buffer") == 0 ||
        strcmp(argv[loc],"-bufferSize") == 0)  {
@@ -396,6 +405,19 @@
 	   loc += 2;
 	 }	    
 
+	 else if ((strcmp(argv[loc],"-columnar") == 0)) {
+	   fileName = argv[loc+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   loc += 2;
+	 }	    
+
+	 else if (strcmp(argv[loc],"-compress") == 0) {
+	   compressOutput = true;
+	   loc += 1;
+	 }
+
 	 else {
 	   // first unknown string then is assumed to start 
 	   // element response request starts
@@ -427,6 +449,8 @@
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM && fileName != 0) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM && fileName != 0) {
+	 theOutputStream = new ColumnarFileStream(fileName, compressOutput);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
        } else 
@@ -434,6 +458,10 @@
 
        theOutputStream->setPrecision(precision);
 
+       // format and write the output on a separate thread
+       if (asyncOutput == true)
+	 theOutputStream = new AsyncStream(theOutputStream);
+
        if (strcmp(argv[1],"Element") == 0) {
 
 	 (*theRecorder) = new ElementRecorder(eleIDs, 
@@ -1058,6 +1086,8 @@
        int inetPort;
 
        bool closeOnWrite = false;
+       bool asyncOutput = false;
+       bool compressOutput = false;
        int writeBufferSize = 0;
 
 
@@ -1093,6 +1123,11 @@
 	   pos += 1;
 	 }
 
+	 else if (strcmp(argv[pos],"-async") == 0)  {
+	   asyncOutput = true;
+	   pos += 1;
+	 }
+
 	 else if (strcmp(argv[pos],"-buffer") == 0 ||
        strcmp(argv[pos],"-bufferSize") == 0)  {
        pos++;
@@ -1149,6 +1184,19 @@
 	   pos += 2;
 	 }	    
 
+	 else if ((strcmp(argv[pos],"-columnar") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   pos += 2;
+	 }	    
+
+	 else if (strcmp(argv[pos],"-compress") == 0) {
+	   compressOutput = true;
+	   pos += 1;
+	 }
+
 
 	 else if (strcmp(argv[pos],"-dT") == 0) {
 	   pos ++;
@@ -1321,6 +1369,8 @@
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM && fileName != 0) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM && fileName != 0) {
+	 theOutputStream = new ColumnarFileStream(fileName, compressOutput);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
        } else {
@@ -1329,6 +1379,10 @@
 
        theOutputStream->setPrecision(precision);
 
+       // format and write the output on a separate thread
+       if (asyncOutput == true)
+	 theOutputStream = new AsyncStream(theOutputStream);
+
        if (theTimeSeries != 0 && theTimeSeriesID.Size() < theDofs.Size()) {
 	 opserr << "ERROR: recorder Node/EnvelopNode # TimeSeries must equal # dof - IGNORING TimeSeries OPTION\n";
 	 for (int i=0; i<theTimeSeriesID.Size(); i++) {
@@ -1405,6 +1459,8 @@
        int precision = 6;
        bool doScientific = false;
        bool closeOnWrite = false;
+       bool asyncOutput = false;
+       bool compressOutput = false;
 
        while (pos < argc) {
 
@@ -1453,6 +1509,19 @@
 	   pos += 2;
 	 }	    
 
+	 else if ((strcmp(argv[pos],"-columnar") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   pos += 2;
+	 }	    
+
+	 else if (strcmp(argv[pos],"-compress") == 0) {
+	   compressOutput = true;
+	   pos += 1;
+	 }
+
 	 else if ((strcmp(argv[pos],"-nees") == 0) || (strcmp(argv[pos],"-xml") == 0)) {
 	   // allow user to specify load pattern other than current
 	   fileName = argv[pos+1];
@@ -1467,6 +1536,11 @@
 	   pos ++;
 	 }
 
+	 else if (strcmp(argv[pos],"-async") == 0) {
+	   asyncOutput = true;
+	   pos ++;
+	 }
+
 	 else if (strcmp(argv[pos],"-scientific") == 0) {
 	   doScientific = true;
 	   pos ++;
@@ -1560,9 +1634,15 @@
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM) {
+	 theOutputStream = new ColumnarFileStream(fileName, compressOutput);
        } else
 	 theOutputStream = new StandardStream();
 
+       // format and write the output on a separate thread
+       if (asyncOutput == true)
+	 theOutputStream = new AsyncStream(theOutputStream);
+
        // Subtract one from dof and perpDirn for C indexing
        if (strcmp(argv[1],"Drift") == 0) 
 	 (*theRecorder) = new DriftRecorder(iNodes, jNodes, dof-1, perpDirn-1,
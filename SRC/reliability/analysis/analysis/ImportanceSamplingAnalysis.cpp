@@ -38,6 +38,7 @@
 #include <ProbabilityTransformation.h>
 #include <FunctionEvaluator.h>
 #include <RandomNumberGenerator.h>
+#include <ParallelSampler.h>
 #include <RandomVariable.h>
 #include <NormalRV.h>
 #include <Vector.h>
@@ -80,6 +81,7 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+	theSampler = 0;
 }
 
 
@@ -87,7 +89,19 @@ theOpenSeesDomain(passedOpenSeesDomain)
 
 ImportanceSamplingAnalysis::~ImportanceSamplingAnalysis()
 {
+	if (theSampler != 0)
+		delete theSampler;
+}
+
+
+int
+ImportanceSamplingAnalysis::setParallelSampler(ParallelSampler *passedSampler)
+{
+	if (theSampler != 0)
+		delete theSampler;
+	theSampler = passedSampler;
 
+	return 0;
 }
 
 
@@ -212,6 +226,16 @@ ImportanceSamplingAnalysis::analyze(void)
 	// Prepare output file
 	ofstream resultsOutputFile( fileName, ios::out );
 
+	// Start the sampler; the samples from k on are evaluated ahead
+	// and returned in order
+	Vector g_values(numLsf);
+	if (theSampler != 0) {
+		if (theSampler->start(startPointY, samplingStdv, k) < 0) {
+			opserr << "ImportanceSamplingAnalysis::analyze() - could not start the sampler" << endln;
+			return -1;
+		}
+	}
+
 
 	bool isFirstSimulation = true;
 	while( ( k <= numberOfSimulations && govCov > targetCOV || k <= 2 ) ) {
@@ -223,58 +247,70 @@ ImportanceSamplingAnalysis::analyze(void)
 		}
 
 		
-		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+		if (theSampler != 0) {
+			long sample;
+			if (theSampler->getNext(sample, u, g_values, FEconvergence) < 0) {
+				opserr << "ImportanceSamplingAnalysis::analyze() - could not evaluate sample " << (int)k << endln;
+				theSampler->stop();
+				return -1;
+			}
+			if (!FEconvergence)
+				opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
 		}
 		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-		}
-		seed = theRandomNumberGenerator->getSeed();
-		if (result < 0) {
-			opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
-				<< " random numbers for simulation." << endln;
-			return -1;
-		}
-		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
-
-		// Compute the point in standard normal space
-		//u = startPointY + chol_covariance * randomArray;
-        u = startPointY;
-		u.addVector(1.0, randomArray, samplingStdv);
-
-		// Transform into original space
-		result = theProbabilityTransformation->transform_u_to_x(u, x);
-		if (result < 0) {
-		  opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
-		  return -1;
-		}
+			// Create array of standard normal random numbers
+			if (isFirstSimulation) {
+				result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+			}
+			else {
+				result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+			}
+			seed = theRandomNumberGenerator->getSeed();
+			if (result < 0) {
+				opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
+					<< " random numbers for simulation." << endln;
+				return -1;
+			}
+			randomArray = theRandomNumberGenerator->getGeneratedNumbers();
+
+			// Compute the point in standard normal space
+			//u = startPointY + chol_covariance * randomArray;
+            u = startPointY;
+			u.addVector(1.0, randomArray, samplingStdv);
+
+			// Transform into original space
+			result = theProbabilityTransformation->transform_u_to_x(u, x);
+			if (result < 0) {
+			  opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
+			  return -1;
+			}
         
-        // update domain with new x values
-        for (int j = 0; j < numRV; j++) {
-            RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
-            int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
-            Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+            // update domain with new x values
+            for (int j = 0; j < numRV; j++) {
+                RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
+                int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+                Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
             
-            // now we should update the parameter value
-            theParam->update( x(j) );
-        }
+                // now we should update the parameter value
+                theParam->update( x(j) );
+            }
 		
         
-        // set values in the variable namespace
-        if (theGFunEvaluator->setVariables() < 0) {
-            opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
-                << " could not set variables in namespace. " << endln;
-            return -1;
-        }
+            // set values in the variable namespace
+            if (theGFunEvaluator->setVariables() < 0) {
+                opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
+                    << " could not set variables in namespace. " << endln;
+                return -1;
+            }
         
-		// Evaluate limit-state function
-		FEconvergence = true;
-		if (theGFunEvaluator -> runAnalysis() < 0) {
-			// In this case a failure happened during the analysis
-			// Hence, register this as failure
-            opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
-			FEconvergence = false;
+			// Evaluate limit-state function
+			FEconvergence = true;
+			if (theGFunEvaluator -> runAnalysis() < 0) {
+				// In this case a failure happened during the analysis
+				// Hence, register this as failure
+                opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
+				FEconvergence = false;
+			}
 		}
 
 
@@ -290,10 +326,15 @@ ImportanceSamplingAnalysis::analyze(void)
 			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
 
             // set and evaluate LSF
-            const char *lsfExpression = theLimitStateFunction->getExpression();
-            theGFunEvaluator->setExpression(lsfExpression);
+            if (theSampler != 0) {
+                gFunctionValue = g_values(lsf);
+            }
+            else {
+                const char *lsfExpression = theLimitStateFunction->getExpression();
+                theGFunEvaluator->setExpression(lsfExpression);
             
-            gFunctionValue = theGFunEvaluator->evaluateExpression();
+                gFunctionValue = theGFunEvaluator->evaluateExpression();
+            }
             if (!FEconvergence) {
 				gFunctionValue = -1.0;
 			}
@@ -471,8 +512,11 @@ ImportanceSamplingAnalysis::analyze(void)
 
 	}
 
-	// Step 'k' back a step now that we went out
+	// Step 'k' back a step now that we went out; samples evaluated
+	// beyond k are not used
 	k--;
+	if (theSampler != 0)
+		theSampler->stop();
 	opserr << endln;
 
 
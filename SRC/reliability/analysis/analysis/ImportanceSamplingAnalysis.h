@@ -40,6 +40,8 @@
 #include <RandomNumberGenerator.h>
 #include <FunctionEvaluator.h>
 
+class ParallelSampler;
+
 #include <fstream>
 #include <tcl.h>
 using std::ofstream;
@@ -65,6 +67,9 @@ public:
 	
 	int analyze(void);
 
+	// samples are then evaluated by the sampler, deleted with the analysis
+	int setParallelSampler(ParallelSampler *theSampler);
+
 protected:
 	
 private:
@@ -80,6 +85,7 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+	ParallelSampler *theSampler;
 };
 
 #endif
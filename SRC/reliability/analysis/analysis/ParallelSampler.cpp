@@ -0,0 +1,298 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/analysis/analysis/ParallelSampler.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ParallelSampler.
+// The parent writes the number k of the sample to evaluate down a pipe
+// to the worker (see WorkerProcesses), which stops when the pipe is
+// closed; the worker returns (k, flag, u, g) as doubles, flag
+// being 1 if the finite element analysis converged, 0 if it did not
+// and -1 if the sample could not be evaluated.
+//
+// What: "@(#) ParallelSampler.cpp, revA"
+
+#include <ParallelSampler.h>
+#include <ReliabilityDomain.h>
+#include <LimitStateFunction.h>
+#include <ProbabilityTransformation.h>
+#include <FunctionEvaluator.h>
+#include <RandomNumberGenerator.h>
+#include <Domain.h>
+#include <Parameter.h>
+
+ParallelSampler::ParallelSampler(ReliabilityDomain *passedReliabilityDomain,
+				 Domain *passedOpenSeesDomain,
+				 ProbabilityTransformation *passedProbabilityTransformation,
+				 FunctionEvaluator *passedGFunEvaluator,
+				 RandomNumberGenerator *passedRandomNumberGenerator,
+				 int passedNumProcesses, int passedSeed)
+  :theReliabilityDomain(passedReliabilityDomain), theOpenSeesDomain(passedOpenSeesDomain),
+   theProbabilityTransformation(passedProbabilityTransformation),
+   theGFunEvaluator(passedGFunEvaluator),
+   theRandomNumberGenerator(passedRandomNumberGenerator),
+   numProcesses(passedNumProcesses), seed(passedSeed),
+   stdv(1.0), numRV(0), numLsf(0), nextSample(1), nextResult(1), running(false),
+   theWorkers(0), workerSample(0)
+{
+  if (numProcesses < 1)
+    numProcesses = 1;
+}
+
+ParallelSampler::~ParallelSampler()
+{
+  this->stop();
+}
+
+int
+ParallelSampler::getNumProcesses(void) const
+{
+  return numProcesses;
+}
+
+int
+ParallelSampler::getSampleSeed(long k) const
+{
+  // splitmix64 of the seed and sample number, so that neighbouring
+  // samples get unrelated seeds
+  unsigned long long z = ((unsigned long long)(unsigned int)seed << 32) ^ (unsigned long long)k;
+  z += 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= z >> 31;
+
+  int sampleSeed = (int)(z & 0x7fffffff);
+  if (sampleSeed == 0)
+    sampleSeed = 1;
+
+  return sampleSeed;
+}
+
+int
+ParallelSampler::evaluate(long k, Vector &u, Vector &g, bool &FEconvergence)
+{
+  // the point in standard normal space, from stream k of the seed if
+  // the generator has streams
+  int res;
+  if (theRandomNumberGenerator->setStream(seed, k) == 0)
+    res = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+  else
+    res = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV, this->getSampleSeed(k));
+  if (res < 0) {
+    opserr << "ParallelSampler::evaluate() - could not generate random numbers for sample " << (int)k << endln;
+    return -1;
+  }
+  u = startPoint;
+  u.addVector(1.0, theRandomNumberGenerator->getGeneratedNumbers(), stdv);
+
+  // transform into original space and update the domain
+  Vector x(numRV);
+  if (theProbabilityTransformation->transform_u_to_x(u, x) < 0) {
+    opserr << "ParallelSampler::evaluate() - could not transform u to x for sample " << (int)k << endln;
+    return -1;
+  }
+
+  for (int j = 0; j < numRV; j++) {
+    int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+    Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+    theParam->update(x(j));
+  }
+
+  if (theGFunEvaluator->setVariables() < 0) {
+    opserr << "ParallelSampler::evaluate() - could not set variables in namespace for sample " << (int)k << endln;
+    return -1;
+  }
+
+  FEconvergence = true;
+  if (theGFunEvaluator->runAnalysis() < 0)
+    FEconvergence = false;
+
+  // evaluate the limit-state functions
+  for (int lsf = 0; lsf < numLsf; lsf++) {
+    LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+    theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
+    theGFunEvaluator->setExpression(theLimitStateFunction->getExpression());
+    g(lsf) = theGFunEvaluator->evaluateExpression();
+  }
+
+  return 0;
+}
+
+int
+ParallelSampler::start(const Vector &passedStartPoint, double passedStdv, long firstSample)
+{
+  this->stop();
+
+  startPoint = passedStartPoint;
+  stdv = passedStdv;
+  numRV = theReliabilityDomain->getNumberOfRandomVariables();
+  numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+  nextSample = firstSample;
+  nextResult = firstSample;
+  running = true;
+
+  if (numProcesses > 1) {
+    theWorkers = new WorkerProcesses(theOpenSeesDomain, numProcesses);
+    workerSample = new long[numProcesses];
+
+    for (int i = 0; i < numProcesses; i++) {
+      workerSample[i] = -1;
+      if (theWorkers->start(*this) < 0) {
+	opserr << "WARNING ParallelSampler::start() - could only start " << i << " processes\n";
+	break;
+      }
+    }
+
+    // keep every worker busy
+    for (int i = 0; i < numProcesses; i++)
+      if (theWorkers->isRunning(i) == true && this->dispatch(i) < 0)
+	return -1;
+  }
+
+  return 0;
+}
+
+int
+ParallelSampler::dispatch(int worker)
+{
+  long k = nextSample;
+  int workerPid = theWorkers->getPid(worker);
+  if (theWorkers->send(worker, &k, sizeof(long)) < 0) {
+    opserr << "ParallelSampler::dispatch() - could not send sample to worker process " << workerPid << endln;
+    return -1;
+  }
+  workerSample[worker] = k;
+  nextSample++;
+
+  return 0;
+}
+
+int
+ParallelSampler::runWorker(int fromParent, int toParent)
+{
+  Vector theResult(2+numRV+numLsf);
+  Vector u(numRV);
+  Vector g(numLsf);
+  double *data = &theResult(0);
+
+  long k;
+  while (WorkerProcesses::readAll(fromParent, &k, sizeof(long)) == 0 && k >= 0) {
+    bool FEconvergence = false;
+    theResult.Zero();
+    theResult(0) = k;
+    if (this->evaluate(k, u, g, FEconvergence) < 0)
+      theResult(1) = -1.0;
+    else {
+      theResult(1) = (FEconvergence == true) ? 1.0 : 0.0;
+      for (int i = 0; i < numRV; i++)
+	theResult(2+i) = u(i);
+      for (int i = 0; i < numLsf; i++)
+	theResult(2+numRV+i) = g(i);
+    }
+    if (WorkerProcesses::writeAll(toParent, data, theResult.Size()*sizeof(double)) < 0)
+      return -1;
+  }
+
+  return 0;
+}
+
+int
+ParallelSampler::getNext(long &k, Vector &u, Vector &g, bool &FEconvergence)
+{
+  if (running == false) {
+    opserr << "ParallelSampler::getNext() - start() has not been called\n";
+    return -1;
+  }
+
+  if (theWorkers == 0 || theWorkers->getNumWorkers() == 0) {
+    k = nextResult++;
+    return this->evaluate(k, u, g, FEconvergence);
+  }
+
+  // wait for the next sample in order, keeping the early ones
+  while (theResults.find(nextResult) == theResults.end()) {
+    int i = theWorkers->waitForReply();
+    if (i < 0) {
+      opserr << "ParallelSampler::getNext() - no worker process is evaluating sample " << (int)nextResult << endln;
+      return -1;
+    }
+
+    Vector *theResult = new Vector(2+numRV+numLsf);
+    if (theWorkers->receive(i, &(*theResult)(0), theResult->Size()*sizeof(double)) < 0) {
+      opserr << "ParallelSampler::getNext() - worker process " << theWorkers->getPid(i) << " died evaluating sample " << (int)workerSample[i] << endln;
+      delete theResult;
+      workerSample[i] = -1;
+      return -1;
+    }
+    theResults[(long)(*theResult)(0)] = theResult;
+    workerSample[i] = -1;
+    if (this->dispatch(i) < 0)
+      return -1;
+  }
+
+  std::map<long, Vector *>::iterator theEntry = theResults.find(nextResult);
+  Vector &theResult = *(theEntry->second);
+  k = nextResult++;
+
+  int res = 0;
+  if (theResult(1) < 0.0) {
+    opserr << "ParallelSampler::getNext() - sample " << (int)k << " could not be evaluated\n";
+    res = -1;
+  } else {
+    FEconvergence = (theResult(1) > 0.0);
+    for (int i = 0; i < numRV; i++)
+      u(i) = theResult(2+i);
+    for (int i = 0; i < numLsf; i++)
+      g(i) = theResult(2+numRV+i);
+  }
+
+  delete theEntry->second;
+  theResults.erase(theEntry);
+
+  return res;
+}
+
+int
+ParallelSampler::stop(void)
+{
+  // workers still evaluating a sample are not needed any more
+  if (theWorkers != 0) {
+    delete theWorkers;
+    delete [] workerSample;
+  }
+  theWorkers = 0;
+  workerSample = 0;
+
+  std::map<long, Vector *>::iterator theEntry;
+  for (theEntry = theResults.begin(); theEntry != theResults.end(); theEntry++)
+    delete theEntry->second;
+  theResults.clear();
+
+  running = false;
+  return 0;
+}
@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/analysis/analysis/ParallelSampler.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// ParallelSampler. A ParallelSampler evaluates the limit-state functions
+// for a sequence of samples u_k = startPoint + stdv*z_k, k = 1, 2, ...,
+// on a number of worker processes. Each worker is a fork() of the
+// running program and so has its own copy of the domain, the
+// interpreter and the function evaluator; the parent hands out one
+// sample at a time to whichever worker is idle and collects the
+// results. getNext() returns the results in sample order, so a sampling
+// analysis can update its estimates as the results stream in and stop
+// as soon as its target coefficient of variation is reached; samples
+// still running then are discarded by stop().
+//
+// z_k is taken from stream k of the seed given if the random number
+// generator has independent streams (see PhiloxRandGenerator), and from
+// a seed mixed from the seed given and k otherwise, so the results are
+// the same whatever the number of processes. With one process, or
+// where fork() is not available, the samples are evaluated in the
+// calling process. The workers are started by a WorkerProcesses, which
+// makes them run serially and detaches the recorders of the domain.
+//
+// What: "@(#) ParallelSampler.h, revA"
+
+#ifndef ParallelSampler_h
+#define ParallelSampler_h
+
+#include <Vector.h>
+#include <WorkerProcesses.h>
+#include <map>
+
+class ReliabilityDomain;
+class Domain;
+class ProbabilityTransformation;
+class FunctionEvaluator;
+class RandomNumberGenerator;
+
+class ParallelSampler : public WorkerTask
+{
+  public:
+    ParallelSampler(ReliabilityDomain *theReliabilityDomain,
+		    Domain *theOpenSeesDomain,
+		    ProbabilityTransformation *theProbabilityTransformation,
+		    FunctionEvaluator *theGFunEvaluator,
+		    RandomNumberGenerator *theRandomNumberGenerator,
+		    int numProcesses, int seed);
+    ~ParallelSampler();
+
+    int start(const Vector &startPoint, double stdv, long firstSample);
+    int getNext(long &k, Vector &u, Vector &g, bool &FEconvergence);
+    int stop(void);
+
+    int getNumProcesses(void) const;
+    int getSampleSeed(long k) const;
+
+  protected:
+    int runWorker(int fromParent, int toParent);
+
+  private:
+    int evaluate(long k, Vector &u, Vector &g, bool &FEconvergence);
+    int dispatch(int worker);
+
+    ReliabilityDomain *theReliabilityDomain;
+    Domain *theOpenSeesDomain;
+    ProbabilityTransformation *theProbabilityTransformation;
+    FunctionEvaluator *theGFunEvaluator;
+    RandomNumberGenerator *theRandomNumberGenerator;
+    int numProcesses;
+    int seed;
+
+    Vector startPoint;
+    double stdv;
+    int numRV;
+    int numLsf;
+
+    long nextSample;      // next sample to hand out
+    long nextResult;      // next sample to be returned by getNext()
+    bool running;
+
+    // results received ahead of nextResult: k, convergence, u, g
+    std::map<long, Vector *> theResults;
+
+    WorkerProcesses *theWorkers;
+    long *workerSample;   // sample being evaluated, -1 if idle
+};
+
+#endif
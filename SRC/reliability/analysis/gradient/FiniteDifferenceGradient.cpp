@@ -45,7 +45,8 @@ FiniteDifferenceGradient::FiniteDifferenceGradient(FunctionEvaluator *passedGFun
 						   Domain *passedOpenSeesDomain)
 
 :GradientEvaluator(passedReliabilityDomain, passedGFunEvaluator), 
-theOpenSeesDomain(passedOpenSeesDomain)
+theOpenSeesDomain(passedOpenSeesDomain), numProcesses(1),
+theWorkers(0), workerDomainStamp(-1), workerNumParams(0)
 {
 	
 	int nparam = theOpenSeesDomain->getNumParameters();
@@ -59,6 +60,9 @@ FiniteDifferenceGradient::~FiniteDifferenceGradient()
 	if (grad_g != 0) 
 		delete grad_g;
 	
+	if (theWorkers != 0)
+		delete theWorkers;
+	
 }
 
 
@@ -69,6 +73,36 @@ FiniteDifferenceGradient::getGradient()
 }
 
 
+int
+FiniteDifferenceGradient::setNumProcesses(int passedNumProcesses)
+{
+	numProcesses = (passedNumProcesses < 1) ? 1 : passedNumProcesses;
+
+	// the workers are started again with the new number
+	if (theWorkers != 0) {
+		delete theWorkers;
+		theWorkers = 0;
+	}
+
+#ifdef _WIN32
+	if (numProcesses > 1) {
+		opserr << "WARNING FiniteDifferenceGradient::setNumProcesses() - processes not available on this machine" << endln;
+		numProcesses = 1;
+		return -1;
+	}
+#endif
+
+	return 0;
+}
+
+
+int
+FiniteDifferenceGradient::getNumProcesses(void) const
+{
+	return numProcesses;
+}
+
+
 int
 FiniteDifferenceGradient::computeGradient(double g)
 {
@@ -87,6 +121,9 @@ FiniteDifferenceGradient::computeGradient(double g)
 	// get parameters created in the domain
 	int nparam = theOpenSeesDomain->getNumParameters();
 
+	// parameters without an analytic gradient, done by finite differences
+	ID perturbed(0, nparam);
+	int numPerturbed = 0;
     
 	// now loop through to create gradient vector
 	// note this is a for loop because there may be some conflict from a nested iterator already 
@@ -95,7 +132,6 @@ FiniteDifferenceGradient::computeGradient(double g)
 		// get parameter tag
 		Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
 		int tag = theParam->getTag();
-		double result = 0;
 
 		// check for analytic gradient first
 		const char *gradExpression = theLimitStateFunction->getGradientExpression(tag);
@@ -107,49 +143,224 @@ FiniteDifferenceGradient::computeGradient(double g)
 				return -1;
 			}
 			
-			result = theFunctionEvaluator->evaluateExpression();
+			(*grad_g)(i) = theFunctionEvaluator->evaluateExpression();
 
 			// Reset limit state function in evaluator -- subsequent calls could receive gradient expression
 			theFunctionEvaluator->setExpression(lsfExpression);
 		}
 		
 		// if no analytic gradient automatically do finite differences
-		else {
-			// use parameter defined perturbation
-			double h = theParam->getPerturbation();
-            double original = theParam->getValue();
-            theParam->update(original+h);
+		else
+			perturbed[numPerturbed++] = i;
+		
+	}
 
-			// set perturbed values in the variable namespace
-			if (theFunctionEvaluator->setVariables() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
-				return -1;
-			}
-			
-			// run analysis
-			if (theFunctionEvaluator->runAnalysis() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error running analysis" << endln;
+	if (numProcesses > 1 && numPerturbed > 1)
+		return this->computePerturbations(perturbed, g);
+
+	for (int j = 0; j < numPerturbed; j++) {
+		int i = perturbed(j);
+		if (this->computePerturbation(i, g, (*grad_g)(i)) < 0)
+			return -1;
+	}
+
+	return 0;
+	
+}
+
+
+int
+FiniteDifferenceGradient::computePerturbation(int i, double g, double &result)
+{
+	Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
+
+	int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
+	LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtr(lsf);
+	const char *lsfExpression = theLimitStateFunction->getExpression();
+
+	// use parameter defined perturbation
+	double h = theParam->getPerturbation();
+	double original = theParam->getValue();
+	theParam->update(original+h);
+
+	// set perturbed values in the variable namespace
+	if (theFunctionEvaluator->setVariables() < 0) {
+		opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
+		return -1;
+	}
+	
+	// run analysis
+	if (theFunctionEvaluator->runAnalysis() < 0) {
+		opserr << "ERROR FiniteDifferenceGradient -- error running analysis" << endln;
+		return -1;
+	}
+	
+	// evaluate LSF and obtain result
+	theFunctionEvaluator->setExpression(lsfExpression);
+	
+	// Add gradient contribution
+	double g_perturbed = theFunctionEvaluator->evaluateExpression();
+	result = (g_perturbed-g)/h;
+	
+	// return values to previous state
+	theParam->update(original);
+
+	//opserr << "g_pert " << g_perturbed << ", g0 = " << g << endln;
+
+	return 0;
+}
+
+
+int
+FiniteDifferenceGradient::startWorkers(void)
+{
+	int nparam = theOpenSeesDomain->getNumParameters();
+	int stamp = theOpenSeesDomain->hasDomainChanged();
+
+	// workers started for another model can not be used
+	if (theWorkers != 0 && (stamp != workerDomainStamp || nparam != workerNumParams)) {
+		delete theWorkers;
+		theWorkers = 0;
+	}
+
+	if (theWorkers == 0) {
+		theWorkers = new WorkerProcesses(theOpenSeesDomain, numProcesses);
+		workerDomainStamp = stamp;
+		workerNumParams = nparam;
+	}
+
+	// replace any worker that has been lost
+	while (theWorkers->getNumWorkers() < numProcesses) {
+		if (theWorkers->start(*this) < 0) {
+			opserr << "WARNING FiniteDifferenceGradient::computeGradient() - could only start "
+			       << theWorkers->getNumWorkers() << " processes" << endln;
+			break;
+		}
+	}
+
+	return theWorkers->getNumWorkers();
+}
+
+
+int
+FiniteDifferenceGradient::computePerturbations(const ID &perturbed, double g)
+{
+	// the parent sends the index of the parameter to perturb, the tag of
+	// the active limit-state function, g and the values of the parameters;
+	// the worker returns (index, flag, result) as doubles, flag being -1
+	// if it failed
+	int numPerturbed = perturbed.Size();
+	int numStarted = this->startWorkers();
+
+	// the rest, if the processes could not be started
+	if (numStarted == 0) {
+		for (int j = 0; j < numPerturbed; j++) {
+			int i = perturbed(j);
+			if (this->computePerturbation(i, g, (*grad_g)(i)) < 0)
 				return -1;
+		}
+		return 0;
+	}
+
+	Vector request(3+workerNumParams);
+	request(1) = theReliabilityDomain->getTagOfActiveLimitStateFunction();
+	request(2) = g;
+	for (int i = 0; i < workerNumParams; i++)
+		request(3+i) = theOpenSeesDomain->getParameterFromIndex(i)->getValue();
+	long numBytes = request.Size()*sizeof(double);
+
+	int maxNumWorkers = theWorkers->getMaxNumWorkers();
+	int *workerParam = new int[maxNumWorkers];
+
+	// hand out the parameters one at a time to whichever worker is idle
+	int next = 0;
+	int numDone = 0;
+	int res = 0;
+
+	for (int i = 0; i < maxNumWorkers && next < numPerturbed; i++) {
+		workerParam[i] = -1;
+		if (theWorkers->isRunning(i) == false)
+			continue;
+		request(0) = perturbed(next);
+		if (theWorkers->send(i, &request(0), numBytes) < 0) {
+			res = -1;
+			break;
+		}
+		workerParam[i] = perturbed(next);
+		next++;
+	}
+
+	while (res == 0 && numDone < next) {
+		int i = theWorkers->waitForReply();
+		if (i < 0) {
+			res = -1;
+			break;
+		}
+
+		double theResult[3];
+		if (theWorkers->receive(i, theResult, 3*sizeof(double)) < 0 || theResult[1] < 0.0) {
+			opserr << "ERROR FiniteDifferenceGradient -- could not evaluate perturbation of parameter "
+			       << workerParam[i] << " on process " << theWorkers->getPid(i) << endln;
+			res = -1;
+			break;
+		}
+		(*grad_g)((int)theResult[0]) = theResult[2];
+		workerParam[i] = -1;
+		numDone++;
+
+		if (next < numPerturbed) {
+			request(0) = perturbed(next);
+			if (theWorkers->send(i, &request(0), numBytes) < 0) {
+				res = -1;
+				break;
 			}
-			
-            // evaluate LSF and obtain result
-			theFunctionEvaluator->setExpression(lsfExpression);
-			
-			// Add gradient contribution
-			double g_perturbed = theFunctionEvaluator->evaluateExpression();
-			result = (g_perturbed-g)/h;
-            
-            // return values to previous state
-			theParam->update(original);
-
-			//opserr << "g_pert " << g_perturbed << ", g0 = " << g << endln;
+			workerParam[i] = perturbed(next);
+			next++;
 		}
-		
-		(*grad_g)(i) = result;
-		
 	}
 
-	return 0;
-	
+	if (res == 0 && next < numPerturbed)
+		res = -1;
+
+	// after an error the workers may be part way through a perturbation
+	if (res < 0) {
+		delete theWorkers;
+		theWorkers = 0;
+	}
+
+	delete [] workerParam;
+
+	return (res < 0) ? -1 : 0;
 }
 
+
+int
+FiniteDifferenceGradient::runWorker(int fromParent, int toParent)
+{
+	Vector request(3+workerNumParams);
+	long numBytes = request.Size()*sizeof(double);
+
+	while (WorkerProcesses::readAll(fromParent, &request(0), numBytes) == 0) {
+		int index = (int)request(0);
+		double g = request(2);
+
+		// the point of the parent
+		theReliabilityDomain->setTagOfActiveLimitStateFunction((int)request(1));
+		for (int i = 0; i < workerNumParams; i++) {
+			Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
+			if (theParam->getValue() != request(3+i))
+				theParam->update(request(3+i));
+		}
+
+		double theResult[3];
+		theResult[0] = index;
+		theResult[1] = 0.0;
+		theResult[2] = 0.0;
+		if (this->computePerturbation(index, g, theResult[2]) < 0)
+			theResult[1] = -1.0;
+		if (WorkerProcesses::writeAll(toParent, theResult, 3*sizeof(double)) < 0)
+			return -1;
+	}
+
+	return 0;
+}
@@ -31,17 +31,29 @@
 // Kevin Mackie (kmackie@mail.ucf.edu)
 // Michael Scott (mhscott@engr.orst.edu)
 //
+// With more than one process set the perturbed analyses are run on
+// fork()ed copies of the program (see WorkerProcesses), one parameter
+// at a time to whichever process is idle, each copy having its own
+// domain and function evaluator; the gradient is assembled in the
+// calling process. The copies are kept from one gradient to the next:
+// each parameter sent to a copy comes with the values of all the
+// parameters and the active limit-state function, so the copy perturbs
+// the same point as the calling process would. The copies are made
+// again if the domain or its parameters have changed since.
+//
 
 #ifndef FiniteDifferenceGradient_h
 #define FiniteDifferenceGradient_h
 
 #include <GradientEvaluator.h>
 #include <Vector.h>
+#include <ID.h>
 #include <ReliabilityDomain.h>
 #include <Domain.h>
 #include <FunctionEvaluator.h>
+#include <WorkerProcesses.h>
 
-class FiniteDifferenceGradient : public GradientEvaluator
+class FiniteDifferenceGradient : public GradientEvaluator, public WorkerTask
 {
 	
 public:
@@ -53,11 +65,25 @@ public:
 	int		computeGradient(double gFunValue);
 	Vector	getGradient();
 	
+	// number of processes the perturbed analyses are shared out to
+	int		setNumProcesses(int numProcesses);
+	int		getNumProcesses(void) const;
+	
 protected:
+	int		runWorker(int fromParent, int toParent);
 	
 private:
+	int		computePerturbation(int paramIndex, double g, double &result);
+	int		computePerturbations(const ID &paramIndices, double g);
+	int		startWorkers(void);
+	
 	Domain *theOpenSeesDomain;
 	Vector *grad_g;
+	int numProcesses;
+	
+	WorkerProcesses *theWorkers;
+	int workerDomainStamp;	// domain and number of parameters the
+	int workerNumParams;	// workers were started with
 	
 };
 
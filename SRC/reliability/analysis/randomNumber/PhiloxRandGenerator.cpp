@@ -0,0 +1,266 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/analysis/randomNumber/PhiloxRandGenerator.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// PhiloxRandGenerator.
+//
+// What: "@(#) PhiloxRandGenerator.cpp, revA"
+
+#include <PhiloxRandGenerator.h>
+#include <Vector.h>
+#include <math.h>
+#include <time.h>
+
+// number of blocks computed together
+#define PHILOX_BATCH 64
+
+static const unsigned int PHILOX_M0 = 0xD2511F53;
+static const unsigned int PHILOX_M1 = 0xCD9E8D57;
+static const unsigned int PHILOX_W0 = 0x9E3779B9;
+static const unsigned int PHILOX_W1 = 0xBB67AE85;
+
+// computes blocks first, first+1, ... first+numBlocks-1 of the stream;
+// out holds 4 words for each block
+static void
+philox4x32(unsigned int key0, unsigned int key1, unsigned long long stream,
+	   unsigned long long first, int numBlocks, unsigned int *out)
+{
+	unsigned int c0[PHILOX_BATCH], c1[PHILOX_BATCH], c2[PHILOX_BATCH], c3[PHILOX_BATCH];
+
+	for (int start = 0; start < numBlocks; start += PHILOX_BATCH) {
+		int num = numBlocks - start;
+		if (num > PHILOX_BATCH)
+			num = PHILOX_BATCH;
+
+		for (int j = 0; j < num; j++) {
+			unsigned long long i = first + start + j;
+			c0[j] = (unsigned int)i;
+			c1[j] = (unsigned int)(i >> 32);
+			c2[j] = (unsigned int)stream;
+			c3[j] = (unsigned int)(stream >> 32);
+		}
+
+		unsigned int k0 = key0;
+		unsigned int k1 = key1;
+		for (int round = 0; round < 10; round++) {
+			for (int j = 0; j < num; j++) {
+				unsigned long long p0 = (unsigned long long)PHILOX_M0 * c0[j];
+				unsigned long long p1 = (unsigned long long)PHILOX_M1 * c2[j];
+				unsigned int n0 = (unsigned int)(p1 >> 32) ^ c1[j] ^ k0;
+				unsigned int n2 = (unsigned int)(p0 >> 32) ^ c3[j] ^ k1;
+				c1[j] = (unsigned int)p1;
+				c3[j] = (unsigned int)p0;
+				c0[j] = n0;
+				c2[j] = n2;
+			}
+			k0 += PHILOX_W0;
+			k1 += PHILOX_W1;
+		}
+
+		unsigned int *o = out + 4*start;
+		for (int j = 0; j < num; j++) {
+			o[4*j] = c0[j];
+			o[4*j+1] = c1[j];
+			o[4*j+2] = c2[j];
+			o[4*j+3] = c3[j];
+		}
+	}
+}
+
+// a uniform number in (0,1) from 53 bits of two words
+static inline double
+toUniform(unsigned int a, unsigned int b)
+{
+	return ((double)(a >> 5) * 67108864.0 + (double)(b >> 6) + 0.5) * (1.0/9007199254740992.0);
+}
+
+
+PhiloxRandGenerator::PhiloxRandGenerator(int passedSeed)
+:RandomNumberGenerator()
+{
+	generatedNumbers = 0;
+	setSeed(passedSeed);
+}
+
+
+PhiloxRandGenerator::~PhiloxRandGenerator()
+{
+	if (generatedNumbers != 0)
+		delete generatedNumbers;
+}
+
+
+int
+PhiloxRandGenerator::generateUniform(int n, double *u)
+{
+	// two numbers per block, an odd one out is dropped so that the
+	// position in the stream depends only on the counts requested
+	int numBlocks = (n+1)/2;
+	unsigned int *words = new unsigned int[4*numBlocks];
+	if (words == 0) {
+		opserr << "PhiloxRandGenerator::generateUniform() - ran out of memory\n";
+		return -1;
+	}
+
+	philox4x32((unsigned int)seed, 0x5EED5EED, (unsigned long long)stream, counter, numBlocks, words);
+	counter += numBlocks;
+
+	for (int i = 0; i < n; i++)
+		u[i] = toUniform(words[2*i], words[2*i+1]);
+
+	delete [] words;
+	return 0;
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+{
+	if (seedIn != 0)
+		setSeed(seedIn);
+
+	if (generatedNumbers == 0) {
+		generatedNumbers = new Vector(n);
+	}
+	else if (generatedNumbers->Size() != n) {
+		delete generatedNumbers;
+		generatedNumbers = new Vector(n);
+	}
+	if (n == 0)
+		return 0;
+
+	Vector &randomArray = *generatedNumbers;
+	double *u = &randomArray(0);
+	if (generateUniform(n, u) < 0)
+		return -1;
+
+	for (int j = 0; j < n; j++)
+		u[j] = (upper-lower)*u[j] + lower;
+
+	return 0;
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+{
+	if (seedIn != 0)
+		setSeed(seedIn);
+
+	if (generatedNumbers == 0) {
+		generatedNumbers = new Vector(n);
+	}
+	else if (generatedNumbers->Size() != n) {
+		delete generatedNumbers;
+		generatedNumbers = new Vector(n);
+	}
+	if (n == 0)
+		return 0;
+
+	// uniform numbers in pairs, the last pair padded if n is odd
+	int numPairs = (n+1)/2;
+	double *u = new double[2*numPairs];
+	if (u == 0 || generateUniform(2*numPairs, u) < 0) {
+		opserr << "PhiloxRandGenerator::generate_nIndependentStdNormalNumbers() - could not generate numbers\n";
+		if (u != 0)
+			delete [] u;
+		return -1;
+	}
+
+	// Box-Muller transformation of each pair
+	static const double twopi = 2.0*acos(-1.0);
+	Vector &randomArray = *generatedNumbers;
+	double *z = &randomArray(0);
+	for (int j = 0; j < n/2; j++) {
+		double r = sqrt(-2.0*log(u[2*j]));
+		double theta = twopi*u[2*j+1];
+		z[2*j] = r*cos(theta);
+		z[2*j+1] = r*sin(theta);
+	}
+	if (n%2 == 1)
+		z[n-1] = sqrt(-2.0*log(u[n-1]))*cos(twopi*u[n]);
+
+	delete [] u;
+	return 0;
+}
+
+
+const Vector&
+PhiloxRandGenerator::getGeneratedNumbers()
+{
+	return (*generatedNumbers);
+}
+
+
+int
+PhiloxRandGenerator::getSeed()
+{
+	return seed;
+}
+
+
+void
+PhiloxRandGenerator::setSeed(int passedSeed)
+{
+	if (passedSeed != 0)
+		seed = passedSeed;
+	else
+		seed = time(NULL);
+
+	stream = 0;
+	counter = 0;
+}
+
+
+int
+PhiloxRandGenerator::setStream(int passedSeed, long streamIndex)
+{
+	seed = passedSeed;
+	stream = streamIndex;
+	counter = 0;
+
+	return 0;
+}
+
+
+double 
+PhiloxRandGenerator::generate_singleUniformNumber(double lower, double upper)
+{
+	generate_nIndependentUniformNumbers(1, lower, upper);
+	return (*generatedNumbers)(0);
+}
+
+
+double
+PhiloxRandGenerator::generate_singleStdNormalNumber(void)
+{
+	generate_nIndependentStdNormalNumbers(1);
+	return (*generatedNumbers)(0);
+}
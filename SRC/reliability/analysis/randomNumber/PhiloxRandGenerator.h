@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/analysis/randomNumber/PhiloxRandGenerator.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// PhiloxRandGenerator. PhiloxRandGenerator is a counter based random
+// number generator using the Philox4x32-10 bijection of Salmon et al.
+// (SC11): the i'th block of four 32 bit words of a stream is the
+// encryption of the counter (i, stream) under a key made from the seed.
+// There is no state beyond the counter, so a stream can be positioned
+// anywhere with setStream(seed, streamIndex) and the numbers of, say,
+// sample k do not depend on which thread or process generates them, nor
+// on what was generated before. Each block gives two uniform numbers
+// with 53 random bits, or two standard normal numbers by the Box-Muller
+// transformation; blocks are computed in batches so that the compiler
+// can vectorize the rounds.
+//
+// What: "@(#) PhiloxRandGenerator.h, revA"
+
+#ifndef PhiloxRandGenerator_h
+#define PhiloxRandGenerator_h
+
+#include <RandomNumberGenerator.h>
+
+class PhiloxRandGenerator : public RandomNumberGenerator
+{
+
+public:
+	PhiloxRandGenerator(int seed=0);
+	~PhiloxRandGenerator();
+
+	int		generate_nIndependentStdNormalNumbers(int n, int seed=0);
+	int     generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+	const   Vector& getGeneratedNumbers();
+	int     getSeed();
+    
+ 	double  generate_singleStdNormalNumber();		
+ 	double  generate_singleUniformNumber(double lower=0.0, double upper=1.0);		
+ 	void    setSeed(int passedSeed=0);
+
+	int     setStream(int seed, long streamIndex);
+
+protected:
+
+private:
+	int     generateUniform(int n, double *u);
+
+	Vector *generatedNumbers;
+	int seed;
+	long stream;
+	unsigned long long counter;   // next block of the stream
+};
+
+#endif
@@ -41,4 +41,10 @@ RandomNumberGenerator::~RandomNumberGenerator()
 {
 }
 
+int
+RandomNumberGenerator::setStream(int seed, long streamIndex)
+{
+	return -1;
+}
+
 
@@ -53,6 +53,10 @@ public:
 	virtual double  generate_singleUniformNumber(double lower=0.0, double upper=1.0)=0;		
 	virtual void setSeed(int)=0;
 
+	// position the generator at the start of stream streamIndex of the
+	// seed; returns -1 if the generator does not have independent streams
+	virtual int setStream(int seed, long streamIndex);
+
 
 protected:
 
@@ -100,6 +100,7 @@ using std::setiosflags;
 #include <SearchWithStepSizeAndStepDirection.h>
 #include <RandomNumberGenerator.h>
 #include <CStdLibRandGenerator.h>
+#include <PhiloxRandGenerator.h>
 #include <FindCurvatures.h>
 #include <FirstPrincipalCurvature.h>
 #include <CurvaturesBySearchAlgorithm.h>
@@ -122,6 +123,7 @@ using std::setiosflags;
 #include <GFunVisualizationAnalysis.h>
 #include <OutCrossingAnalysis.h>
 #include <ImportanceSamplingAnalysis.h>
+#include <ParallelSampler.h>
 #include <SORMAnalysis.h>
 #include <SystemAnalysis.h>
 #include <PCM.h>
@@ -2169,6 +2171,17 @@ TclReliabilityModelBuilder_addRandomNumberGenerator(ClientData clientData, Tcl_I
   if (strcmp(argv[1],"CStdLib") == 0) {
 	  theRandomNumberGenerator = new CStdLibRandGenerator();
   }
+  // randomNumberGenerator Philox <-seed seed>
+  else if (strcmp(argv[1],"Philox") == 0) {
+	  int seed = 0;
+	  if (argc > 3 && strcmp(argv[2],"-seed") == 0) {
+		  if (Tcl_GetInt(interp, argv[3], &seed) != TCL_OK) {
+			  opserr << "ERROR: invalid input: seed \n";
+			  return TCL_ERROR;
+		  }
+	  }
+	  theRandomNumberGenerator = new PhiloxRandGenerator(seed);
+  }
   else {
 	opserr << "ERROR: unrecognized type of RandomNumberGenerator \n";
 	return TCL_ERROR;
@@ -3069,46 +3082,45 @@ TclReliabilityModelBuilder_addGradientEvaluator(ClientData clientData, Tcl_Inter
 			return TCL_ERROR;
 		}
 
-		// Possibly read perturbation factor
-		if (argc>2) {
-			int numExtras;
-			if (argc==3 || argc==4) {
-				numExtras = 1;
-			}
-			else if (argc==5) {
-				numExtras = 2;
-			}
-			else {
-				opserr << "ERROR: Wrong number of arguments to FiniteDifferenceGradient. " << endln;
-				return TCL_ERROR;
-			}
-
-			int counter = 2;
+		// Possibly read perturbation factor and number of processes
+		int numProcesses = 1;
+		int counter = 2;
 
-			for (int i=1; i<=numExtras; i++) {
+		while (counter < argc) {
 
-				if (strcmp(argv[counter],"-pert") == 0) {
-					counter ++;
+			if (strcmp(argv[counter],"-pert") == 0 && counter+1 < argc) {
+				counter ++;
 
-					if (Tcl_GetDouble(interp, argv[counter], &perturbationFactor) != TCL_OK) {
-						opserr << "ERROR: invalid input: perturbationFactor \n";
-						return TCL_ERROR;
-					}
-					counter++;
-				}
-				else if (strcmp(argv[counter],"-check") == 0) {
-					counter++;
-					doGradientCheck = true;
+				if (Tcl_GetDouble(interp, argv[counter], &perturbationFactor) != TCL_OK) {
+					opserr << "ERROR: invalid input: perturbationFactor \n";
+					return TCL_ERROR;
 				}
-				else {
-					opserr << "ERROR: Error in input to FiniteDifferenceGradient. " << endln;
+				counter++;
+			}
+			else if (strcmp(argv[counter],"-check") == 0) {
+				counter++;
+				doGradientCheck = true;
+			}
+			else if (strcmp(argv[counter],"-numProcesses") == 0 && counter+1 < argc) {
+				counter++;
+
+				if (Tcl_GetInt(interp, argv[counter], &numProcesses) != TCL_OK || numProcesses < 1) {
+					opserr << "ERROR: invalid input: numProcesses \n";
 					return TCL_ERROR;
 				}
+				counter++;
+			}
+			else {
+				opserr << "ERROR: Error in input to FiniteDifferenceGradient. " << endln;
+				return TCL_ERROR;
 			}
 		}
 
-		theGradientEvaluator = new FiniteDifferenceGradient(theFunctionEvaluator, theReliabilityDomain, 
-								    theStructuralDomain);
+		FiniteDifferenceGradient *theFDGradient = new FiniteDifferenceGradient(theFunctionEvaluator, theReliabilityDomain, 
+										       theStructuralDomain);
+		if (numProcesses > 1)
+			theFDGradient->setNumProcesses(numProcesses);
+		theGradientEvaluator = theFDGradient;
 	}
 
 	else if (strcmp(argv[1],"OpenSees") == 0 || strcmp(argv[1],"Implicit") == 0) {
@@ -4120,8 +4132,11 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	//     -print 1   (print to screen)
 	//     -print 2   (print to restart file)
 	//
+	//     -numProcesses 4  ..................... evaluate the samples on 4 processes
+	//     -seed 1  ............................. seed of the per sample random numbers
+	//
 
-	if (argc!=2 && argc!=4 && argc!=6 && argc!=8 && argc!=10 && argc!=12) {
+	if (argc < 2 || argc%2 != 0) {
 		opserr << "ERROR: Wrong number of arguments to Sampling analysis" << endln;
 		return TCL_ERROR;
 	}
@@ -4133,6 +4148,8 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	double samplingVariance	= 1.0;
 	int printFlag			= 0;
 	int analysisTypeTag		= 1;
+	int numProcesses		= 0;
+	int samplingSeed		= 1;
 
 
 	for (int i=2; i<argc; i=i+2) {
@@ -4202,6 +4219,20 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 				return TCL_ERROR;
 			}
 		}
+		else if (strcmp(argv[i],"-numProcesses") == 0) {
+			// GET INPUT PARAMETER (integer)
+			if (Tcl_GetInt(interp, argv[i+1], &numProcesses) != TCL_OK || numProcesses < 1) {
+				opserr << "ERROR: invalid input: numProcesses \n";
+				return TCL_ERROR;
+			}
+		}
+		else if (strcmp(argv[i],"-seed") == 0) {
+			// GET INPUT PARAMETER (integer)
+			if (Tcl_GetInt(interp, argv[i+1], &samplingSeed) != TCL_OK) {
+				opserr << "ERROR: invalid input: seed \n";
+				return TCL_ERROR;
+			}
+		}
 		else {
 			opserr << "ERROR: invalid input to sampling analysis. " << endln;
 			return TCL_ERROR;
@@ -4232,6 +4263,16 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 		return TCL_ERROR;
 	}
 
+	// Evaluate the samples on worker processes, each with its own copy of the model
+	if (numProcesses > 0) {
+		ParallelSampler *theSampler = new ParallelSampler(theReliabilityDomain, theStructuralDomain,
+								  theProbabilityTransformation,
+								  theFunctionEvaluator,
+								  theRandomNumberGenerator,
+								  numProcesses, samplingSeed);
+		theImportanceSamplingAnalysis->setParallelSampler(theSampler);
+	}
+
 	// Now run analysis
 	theImportanceSamplingAnalysis->analyze();
 
@@ -32,6 +32,7 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<OPS_Globals.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -103,3 +104,10 @@ int
 LinearSOE::addColA(const Vector &col, int colIndex, double fact) {
   return -1;
 }
+
+
+void
+LinearSOE::Print(OPS_Stream &s, int flag)
+{
+  s << this->getClassType() << ": size: " << this->getNumEqn() << endln;
+}
@@ -47,6 +47,7 @@ class Matrix;
 class Vector;
 class ID;
 class AnalysisModel;
+class OPS_Stream;
 
 class LinearSOE : public MovableObject
 {
@@ -69,6 +70,10 @@ class LinearSOE : public MovableObject
     virtual int addA(const Matrix &);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
 
+    // true if addA() and addB() may be invoked by several threads at once,
+    // provided the ID's passed in the concurrent calls share no equation
+    virtual bool canAddConcurrently(void) {return false;};
+
     virtual void zeroA(void) =0;
     virtual void zeroB(void) =0;
 
@@ -82,6 +87,8 @@ class LinearSOE : public MovableObject
     virtual void setX(const Vector &X) =0;
     
     LinearSOESolver *getSolver(void);
+
+    virtual void Print(OPS_Stream &s, int flag = 0);
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
@@ -0,0 +1,190 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/SparseScatterMap.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of SparseScatterMap.
+//
+// What: "@(#) SparseScatterMap.cpp, revA"
+
+#include <SparseScatterMap.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+
+#include <new>
+using std::nothrow;
+
+SparseScatterMap::SparseScatterMap()
+  :theIDs(0), theStarts(0), theLocations(0),
+   tableSize(0), numLocations(0), numFE(0)
+{
+
+}
+
+SparseScatterMap::~SparseScatterMap()
+{
+  this->clear();
+}
+
+void
+SparseScatterMap::clear(void)
+{
+  if (theIDs != 0)
+    delete [] theIDs;
+  if (theStarts != 0)
+    delete [] theStarts;
+  if (theLocations != 0)
+    delete [] theLocations;
+
+  theIDs = 0;
+  theStarts = 0;
+  theLocations = 0;
+  tableSize = 0;
+  numLocations = 0;
+  numFE = 0;
+}
+
+int
+SparseScatterMap::hashID(const ID *id) const
+{
+  // the low bits of a heap address carry no information
+  unsigned long key = (unsigned long)id >> 4;
+  key ^= key >> 16;
+  key *= 2654435761UL;
+  return (int)(key & (unsigned long)(tableSize-1));
+}
+
+int
+SparseScatterMap::setSize(AnalysisModel *theModel, int numEqn,
+			  const int *start, const int *index, bool byColumn)
+{
+  this->clear();
+
+  if (theModel == 0 || numEqn == 0)
+    return 0;
+
+  // count the FE_Elements and the entries of their matrices
+  FE_Element *elePtr;
+  FE_EleIter &theEles1 = theModel->getFEs();
+  while ((elePtr = theEles1()) != 0) {
+    int idSize = (elePtr->getID()).Size();
+    numLocations += idSize*idSize;
+    numFE++;
+  }
+
+  // keep the table at most half full
+  tableSize = 16;
+  while (tableSize < 2*numFE)
+    tableSize *= 2;
+
+  theIDs = new (nothrow) const ID *[tableSize];
+  theStarts = new (nothrow) int[tableSize];
+  theLocations = new (nothrow) int[numLocations+1];
+
+  if (theIDs == 0 || theStarts == 0 || theLocations == 0) {
+    opserr << "WARNING SparseScatterMap::setSize() - ran out of memory for ";
+    opserr << numLocations << " locations, assembly will search A\n";
+    this->clear();
+    return -1;
+  }
+
+  for (int i=0; i<tableSize; i++)
+    theIDs[i] = 0;
+
+  int loc = 0;
+  FE_EleIter &theEles2 = theModel->getFEs();
+  while ((elePtr = theEles2()) != 0) {
+    const ID &id = elePtr->getID();
+    int idSize = id.Size();
+
+    int slot = this->hashID(&id);
+    while (theIDs[slot] != 0 && theIDs[slot] != &id)
+      slot = (slot+1) & (tableSize-1);
+
+    if (theIDs[slot] == &id) { // ID shared by two FE_Elements, cannot map it
+      theStarts[slot] = -1;
+      loc += idSize*idSize;
+      continue;
+    }
+
+    theIDs[slot] = &id;
+    theStarts[slot] = loc;
+
+    for (int j=0; j<idSize; j++) {
+      int col = id(j);
+      for (int i=0; i<idSize; i++) {
+	int row = id(i);
+	int location = -1;
+	if (row >= 0 && row < numEqn && col >= 0 && col < numEqn) {
+	  int major = byColumn ? col : row;
+	  int minor = byColumn ? row : col;
+	  int endLoc = start[major+1];
+	  for (int k=start[major]; k<endLoc; k++)
+	    if (index[k] == minor) {
+	      location = k;
+	      k = endLoc;
+	    }
+	}
+	theLocations[loc++] = location;
+      }
+    }
+  }
+
+  return 0;
+}
+
+const int *
+SparseScatterMap::getLocations(const ID &id) const
+{
+  if (tableSize == 0)
+    return 0;
+
+  int slot = this->hashID(&id);
+  while (theIDs[slot] != 0) {
+    if (theIDs[slot] == &id) {
+      if (theStarts[slot] < 0)
+	return 0;
+      return &theLocations[theStarts[slot]];
+    }
+    slot = (slot+1) & (tableSize-1);
+  }
+
+  return 0;
+}
+
+int
+SparseScatterMap::getNumFE_Eles(void) const
+{
+  return numFE;
+}
+
+double
+SparseScatterMap::getMemory(void) const
+{
+  return (double)tableSize*(sizeof(const ID *) + sizeof(int)) + 
+    (double)numLocations*sizeof(int);
+}
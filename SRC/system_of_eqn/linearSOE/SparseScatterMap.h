@@ -0,0 +1,76 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/SparseScatterMap.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for SparseScatterMap.
+// A SparseScatterMap is used by the compressed row and compressed column
+// LinearSOEs to avoid searching for the location in A of each entry of an
+// FE_Element matrix every time addA() is invoked. When the SOE is sized,
+// the location of every entry of every FE_Element matrix is found once
+// and stored; addA() then looks up the FE_Element's locations by the
+// address of its ID and adds the matrix directly. Matrices passed with
+// an ID that is not in the map (DOF_Groups, temporaries) return 0 from
+// getLocations() and the SOE falls back to searching.
+//
+// What: "@(#) SparseScatterMap.h, revA"
+
+#ifndef SparseScatterMap_h
+#define SparseScatterMap_h
+
+class AnalysisModel;
+class ID;
+
+class SparseScatterMap
+{
+ public:
+  SparseScatterMap();
+  ~SparseScatterMap();
+
+  // find the locations for the FE_Elements of theModel; if byColumn is true
+  // start holds the start of each column in index, which holds the row of
+  // each entry, otherwise start holds the row starts and index the columns
+  int setSize(AnalysisModel *theModel, int numEqn, 
+	      const int *start, const int *index, bool byColumn);
+  void clear(void);
+
+  // locations in A of the entries of the matrix for id, stored by column
+  // as in Matrix, -1 for entries not in A; 0 if id is not in the map
+  const int *getLocations(const ID &id) const;
+
+  int getNumFE_Eles(void) const;
+  double getMemory(void) const;  // bytes used by the map
+
+ private:
+  int hashID(const ID *id) const;
+
+  const ID **theIDs;  // hash table of the FE_Element ID addresses
+  int *theStarts;     // location in theLocations of each ID in theIDs
+  int *theLocations;
+  int tableSize;      // size of theIDs, a power of 2
+  int numLocations;
+  int numFE;
+};
+
+#endif
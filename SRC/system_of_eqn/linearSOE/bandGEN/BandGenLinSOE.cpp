@@ -419,6 +419,13 @@ BandGenLinSOE::addB(const Vector &v, const ID &id, double fact)
     return 0;
 }
 
+bool
+BandGenLinSOE::canAddConcurrently(void)
+{
+    // addA() and addB() only write the entries of the equations in the ID
+    return true;
+}
+
 
 int
 BandGenLinSOE::setB(const Vector &v, double fact)
@@ -60,6 +60,7 @@ class BandGenLinSOE : public LinearSOE
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
+    virtual bool canAddConcurrently(void);
 
     virtual void zeroA(void);
     virtual void zeroB(void);
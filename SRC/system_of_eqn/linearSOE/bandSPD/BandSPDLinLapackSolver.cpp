@@ -34,23 +34,37 @@
 #include <BandSPDLinSOE.h>
 //#include <f2c.h>
 #include <math.h>
+#include <float.h>
+#include <elementAPI.h>
+#include <string>
 
 void* OPS_BandSPDLinLapack()
 {
-    BandSPDLinSolver *theSolver = new BandSPDLinLapackSolver();
+    bool mixedPrecision = false;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	std::string type = OPS_GetString();
+	if (type == "-mixedPrecision")
+	    mixedPrecision = true;
+    }
+
+    BandSPDLinSolver *theSolver = new BandSPDLinLapackSolver(mixedPrecision);
     BandSPDLinSOE *theSOE = new BandSPDLinSOE(*theSolver);
     return theSOE;
 }
 
-BandSPDLinLapackSolver::BandSPDLinLapackSolver()
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinLapackSolver)
+BandSPDLinLapackSolver::BandSPDLinLapackSolver(bool mixed)
+:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinLapackSolver),
+ mixedPrecision(mixed), singleFactored(false), Af(0), work(0), R(0),
+ normA(0.0), sizeAf(0), sizeR(0)
 {
     
 }
 
 BandSPDLinLapackSolver::~BandSPDLinLapackSolver()
 {
-    
+    if (Af != 0) delete [] Af;
+    if (work != 0) delete [] work;
+    if (R != 0) delete [] R;
 }
 
 
@@ -86,6 +100,19 @@ BandSPDLinLapackSolver::solve(void)
 	return -1;
     }
 
+    // try the single precision factor first, if that fails A is still
+    // intact and is factored below
+    if (mixedPrecision == true && theSOE->size > 0) {
+	if (theSOE->factored == false)
+	    singleFactored = (this->factorSingle() == 0);
+	if (singleFactored == true) {
+	    if (this->solveSingle() == 0)
+		return 0;
+	    singleFactored = false;
+	    theSOE->factored = false;
+	}
+    }
+
     int n = theSOE->size;
     int kd = theSOE->half_band -1;
     int ldA = kd +1;
@@ -141,10 +168,204 @@ BandSPDLinLapackSolver::solve(void)
 int
 BandSPDLinLapackSolver::setSize()
 {
-  // nothing to do    
+  singleFactored = false;
+  if (mixedPrecision == false || theSOE == 0)
+    return 0;
+
+  // space for the single precision factor
+  int n = theSOE->size;
+  int ldA = theSOE->half_band;
+  if (n*ldA > sizeAf) {
+    if (Af != 0) delete [] Af;
+    Af = new float[n*ldA];
+    sizeAf = n*ldA;
+  }
+  if (n > sizeR || ldA > sizeR) {
+    if (work != 0) delete [] work;
+    if (R != 0) delete [] R;
+    sizeR = (n > ldA) ? n : ldA;
+    work = new float[sizeR];
+    R = new double[sizeR];
+  }
+
+  if (Af == 0 || work == 0 || R == 0) {
+    opserr << "WARNING BandSPDLinLapackSolver::setSize() - ";
+    opserr << " ran out of memory for the single precision factor\n";
+    sizeAf = 0; sizeR = 0;
+    return -1;
+  }
+
+  return 0;
+}
+
+
+// factorSingle: Cholesky factorization U^t U of a single precision copy
+// of A, in the Lapack upper band storage used by dpbsv, leaving A
+// unchanged. returns -2 if A is not positive definite or does not fit
+// in single precision.
+
+int
+BandSPDLinLapackSolver::factorSingle(void)
+{
+  int n = theSOE->size;
+  int kd = theSOE->half_band -1;
+  int ldA = kd +1;
+  double *A = theSOE->A;
+
+  for (int k=0; k<n*ldA; k++) {
+    double aij = A[k];
+    if (!(fabs(aij) < FLT_MAX))
+      return -2;
+    Af[k] = (float)aij;
+  }
+
+  // infinity norm of A, used in the convergence test of the refinement
+  for (int i=0; i<n; i++)
+    R[i] = 0.0;
+  for (int j=0; j<n; j++) {
+    int i0 = (j > kd) ? j-kd : 0;
+    double *colj = A + j*ldA + kd - j;
+    for (int i=i0; i<j; i++) {
+      double aij = fabs(colj[i]);
+      R[i] += aij;
+      R[j] += aij;
+    }
+    R[j] += fabs(colj[j]);
+  }
+  normA = 0.0;
+  for (int i=0; i<n; i++)
+    if (R[i] > normA)
+      normA = R[i];
+
+  for (int j=0; j<n; j++) {
+    float *colj = Af + j*ldA;
+    float ujj = colj[kd];
+    if (!(ujj > 0.0f))
+      return -2;
+    ujj = sqrt(ujj);
+    colj[kd] = ujj;
+
+    // row j of U, u(j,j+m) being stored at Af[(j+m)*ldA + kd-m]
+    int kn = (kd < n-1-j) ? kd : n-1-j;
+    float rujj = 1.0f/ujj;
+    for (int m=1; m<=kn; m++) {
+      float *ujm = Af + (j+m)*ldA + kd - m;
+      *ujm *= rujj;
+      work[m] = *ujm;
+    }
+
+    // update the trailing block, one column at a time
+    for (int m2=1; m2<=kn; m2++) {
+      float *colm2 = Af + (j+m2)*ldA + kd - m2;
+      float ujm2 = work[m2];
+      for (int m1=1; m1<=m2; m1++)
+	colm2[m1] -= work[m1] * ujm2;
+    }
+  }
+
+  theSOE->factored = true;
   return 0;
 }
 
+
+// substituteSingle: overwrites x with the solution of the system
+// using the single precision factor.
+
+void
+BandSPDLinLapackSolver::substituteSingle(double *x)
+{
+  int n = theSOE->size;
+  int kd = theSOE->half_band -1;
+  int ldA = kd +1;
+
+  // solve U^t y = x
+  for (int j=0; j<n; j++) {
+    int i0 = (j > kd) ? j-kd : 0;
+    float *colj = Af + j*ldA + kd - j;
+    double tmp = x[j];
+    for (int i=i0; i<j; i++)
+      tmp -= colj[i] * x[i];
+    x[j] = tmp / colj[j];
+  }
+
+  // solve U x = y
+  for (int j=n-1; j>=0; j--) {
+    int i0 = (j > kd) ? j-kd : 0;
+    float *colj = Af + j*ldA + kd - j;
+    double xj = x[j] / colj[j];
+    x[j] = xj;
+    for (int i=i0; i<j; i++)
+      x[i] -= colj[i] * xj;
+  }
+}
+
+
+// solveSingle: solves with the single precision factor and refines X
+// against A until the residual is at the level of double precision
+// roundoff, as in the Lapack routine dsposv. returns -1 if the residual
+// fails to halve in an iteration or maxIter is reached.
+
+int
+BandSPDLinLapackSolver::solveSingle(void)
+{
+  static const int maxIter = 30;
+
+  int n = theSOE->size;
+  int kd = theSOE->half_band -1;
+  int ldA = kd +1;
+  double *A = theSOE->A;
+  double *B = theSOE->B;
+  double *X = theSOE->X;
+  double tol = normA * DBL_EPSILON * sqrt((double)n);
+  double lastNorm = 0.0;
+
+  for (int i=0; i<n; i++)
+    X[i] = B[i];
+  this->substituteSingle(X);
+
+  for (int iter=0; iter<=maxIter; iter++) {
+
+    // R = B - A X
+    for (int i=0; i<n; i++)
+      R[i] = B[i];
+    for (int j=0; j<n; j++) {
+      int i0 = (j > kd) ? j-kd : 0;
+      double *colj = A + j*ldA + kd - j;
+      double xj = X[j];
+      double tmp = 0.0;
+      for (int i=i0; i<j; i++) {
+	R[i] -= colj[i] * xj;
+	tmp += colj[i] * X[i];
+      }
+      R[j] -= tmp + colj[j] * xj;
+    }
+
+    double normR = 0.0;
+    double normX = 0.0;
+    for (int i=0; i<n; i++) {
+      double ri = fabs(R[i]);
+      double xi = fabs(X[i]);
+      if (!(ri <= DBL_MAX && xi <= DBL_MAX)) // inf or nan
+	return -1;
+      if (ri > normR) normR = ri;
+      if (xi > normX) normX = xi;
+    }
+
+    if (normR <= normX * tol)
+      return 0;
+    if (iter == maxIter || (iter > 0 && normR > 0.5*lastNorm))
+      return -1;
+    lastNorm = normR;
+
+    // X += A^-1 R
+    this->substituteSingle(R);
+    for (int i=0; i<n; i++)
+      X[i] += R[i];
+  }
+
+  return -1;
+}
+
 int
 BandSPDLinLapackSolver::sendSelf(int cTag,
 				 Channel &theChannel)
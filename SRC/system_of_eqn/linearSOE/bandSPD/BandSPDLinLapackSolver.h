@@ -33,6 +33,12 @@
 // BandSPDLinLapackSolver. It solves the BandSPDLinSOE object by calling
 // Lapack routines.
 //
+// With the mixedPrecision option A is factored in single precision on a
+// copy of A, and the solution is brought to double precision by
+// iterative refinement against A, which is left intact. If the single
+// precision factorization breaks down or the refinement stalls, A is
+// factored in double precision by Lapack as usual.
+//
 // What: "@(#) BandSPDLinLapackSolver.h, revA"
 
 
@@ -41,7 +47,7 @@
 class BandSPDLinLapackSolver : public BandSPDLinSolver
 {
   public:
-    BandSPDLinLapackSolver();    
+    BandSPDLinLapackSolver(bool mixedPrecision = false);    
     ~BandSPDLinLapackSolver();
 
     int solve(void);
@@ -54,7 +60,17 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
   protected:
 
   private:
+    int factorSingle(void);
+    int solveSingle(void);
+    void substituteSingle(double *x);
 
+    bool mixedPrecision;  // factor in single precision and refine
+    bool singleFactored;  // true if the current factor is the single one
+    float *Af;            // single precision factor, Lapack band storage
+    float *work;          // one row of the factor
+    double *R;            // residual
+    double normA;         // infinity norm of A
+    int sizeAf, sizeR;
 };
 
 #endif
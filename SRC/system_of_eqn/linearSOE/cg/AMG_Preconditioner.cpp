@@ -0,0 +1,498 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/AMG_Preconditioner.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of AMG_Preconditioner.
+//
+// What: "@(#) AMG_Preconditioner.cpp, revA"
+
+#include <AMG_Preconditioner.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <math.h>
+#include <stdlib.h>
+
+// largest coarsest level factored with dense Cholesky; should the
+// aggregation stall above it the coarsest level is smoothed instead
+#define AMG_MAX_DENSE 2000
+
+static int
+compareInt(const void *a, const void *b)
+{
+    return *((const int *)a) - *((const int *)b);
+}
+
+AMG_Preconditioner::AMG_Preconditioner(double t, int maxL, int maxC)
+:CG_Preconditioner(), theta(t), maxLevels(maxL), maxCoarse(maxC), numLevels(0),
+ coarseL(0)
+{
+    if (maxLevels < 1)
+	maxLevels = 1;
+    if (maxCoarse < 1)
+	maxCoarse = 1;
+
+    size = new int[maxLevels];
+    rowStart = new const int *[maxLevels];
+    col = new const int *[maxLevels];
+    A = new const double *[maxLevels];
+    invDiag = new double *[maxLevels];
+    aggregate = new int *[maxLevels];
+    x = new double *[maxLevels];
+    b = new double *[maxLevels];
+
+    for (int l=0; l<maxLevels; l++) {
+	size[l] = 0;
+	rowStart[l] = 0;
+	col[l] = 0;
+	A[l] = 0;
+	invDiag[l] = 0;
+	aggregate[l] = 0;
+	x[l] = 0;
+	b[l] = 0;
+    }
+}
+
+AMG_Preconditioner::~AMG_Preconditioner()
+{
+    this->clearLevels();
+
+    if (invDiag[0] != 0) delete [] invDiag[0];
+    if (x[0] != 0) delete [] x[0];
+    if (b[0] != 0) delete [] b[0];
+
+    delete [] size;
+    delete [] rowStart;
+    delete [] col;
+    delete [] A;
+    delete [] invDiag;
+    delete [] aggregate;
+    delete [] x;
+    delete [] b;
+}
+
+void
+AMG_Preconditioner::clearLevels(void)
+{
+    // the coarse levels; level 0 is resized in setSize()
+    for (int l=1; l<maxLevels; l++) {
+	if (rowStart[l] != 0) delete [] rowStart[l];
+	if (col[l] != 0) delete [] col[l];
+	if (A[l] != 0) delete [] A[l];
+	if (invDiag[l] != 0) delete [] invDiag[l];
+	if (x[l] != 0) delete [] x[l];
+	if (b[l] != 0) delete [] b[l];
+	rowStart[l] = 0;
+	col[l] = 0;
+	A[l] = 0;
+	invDiag[l] = 0;
+	x[l] = 0;
+	b[l] = 0;
+	size[l] = 0;
+    }
+    for (int l=0; l<maxLevels; l++) {
+	if (aggregate[l] != 0) delete [] aggregate[l];
+	aggregate[l] = 0;
+    }
+
+    if (coarseL != 0) delete [] coarseL;
+    coarseL = 0;
+    numLevels = 0;
+}
+
+int
+AMG_Preconditioner::setSize(int n, const int *rowStartA, const int *colA)
+{
+    if (rowStartA == 0 || colA == 0) {
+	opserr << "WARNING AMG_Preconditioner::setSize() - ";
+	opserr << "the structure of A is needed\n";
+	return -1;
+    }
+
+    this->clearLevels();
+
+    if (n != size[0]) {
+	if (invDiag[0] != 0) delete [] invDiag[0];
+	if (x[0] != 0) delete [] x[0];
+	if (b[0] != 0) delete [] b[0];
+	invDiag[0] = new double[n];
+	x[0] = new double[n];
+	b[0] = new double[n];
+	size[0] = n;
+    }
+
+    rowStart[0] = rowStartA;
+    col[0] = colA;
+
+    return 0;
+}
+
+int
+AMG_Preconditioner::formPreconditioner(const double *theA, const double *diagA)
+{
+    if (theA == 0) {
+	opserr << "WARNING AMG_Preconditioner::formPreconditioner() - ";
+	opserr << "A has not been assembled\n";
+	return -1;
+    }
+
+    // the aggregates depend on the values of A, so the hierarchy is
+    // formed again each time A changes
+    this->clearLevels();
+    A[0] = theA;
+
+    int n = size[0];
+    for (int i=0; i<n; i++) {
+	if (diagA[i] <= 0.0) {
+	    opserr << "WARNING AMG_Preconditioner::formPreconditioner() - ";
+	    opserr << "diagonal " << diagA[i] << " at equation " << i << " not positive\n";
+	    return -1;
+	}
+	invDiag[0][i] = 1.0/diagA[i];
+    }
+
+    numLevels = 1;
+    while (numLevels < maxLevels && size[numLevels-1] > maxCoarse) {
+	int result = this->coarsen(numLevels-1);
+	if (result < 0)
+	    return result;
+	if (result == 0)  // aggregation stalled
+	    break;
+	numLevels++;
+    }
+
+    if (size[numLevels-1] <= AMG_MAX_DENSE)
+	this->factorCoarsest();
+
+    return 0;
+}
+
+int
+AMG_Preconditioner::coarsen(int level)
+{
+    int n = size[level];
+    const int *rs = rowStart[level];
+    const int *c = col[level];
+    const double *a = A[level];
+    const double *d = invDiag[level];
+    double theta2 = theta*theta;
+
+    int *agg = new int[n];
+    for (int i=0; i<n; i++)
+	agg[i] = -1;
+
+    // is a_ij a strong connection: a_ij^2 >= theta^2 a_ii a_jj
+#define AMG_STRONG(i,p) (c[p] != i && a[p]*a[p]*d[i]*d[c[p]] >= theta2)
+
+    // pass 1: equations with no aggregated strong neighbour start a new
+    // aggregate with their strong neighbours
+    int nc = 0;
+    for (int i=0; i<n; i++) {
+	if (agg[i] != -1)
+	    continue;
+	bool free = true;
+	bool isolated = true;
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	    if (AMG_STRONG(i,p)) {
+		isolated = false;
+		if (agg[c[p]] != -1) {
+		    free = false;
+		    break;
+		}
+	    }
+	if (free == false || isolated == true)
+	    continue;
+	agg[i] = nc;
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	    if (AMG_STRONG(i,p))
+		agg[c[p]] = nc;
+	nc++;
+    }
+
+    // pass 2: the rest join the aggregate of their strongest aggregated
+    // neighbour; marked -2-agg so they are not joined themselves
+    for (int i=0; i<n; i++) {
+	if (agg[i] != -1)
+	    continue;
+	double strongest = 0.0;
+	for (int p=rs[i]; p<rs[i+1]; p++) {
+	    int j = c[p];
+	    if (AMG_STRONG(i,p) && agg[j] >= 0) {
+		double s = a[p]*a[p]*d[j];
+		if (s > strongest) {
+		    strongest = s;
+		    agg[i] = -2 - agg[j];
+		}
+	    }
+	}
+    }
+    for (int i=0; i<n; i++)
+	if (agg[i] < -1)
+	    agg[i] = -2 - agg[i];
+
+    // pass 3: what is left forms aggregates of its own
+    for (int i=0; i<n; i++) {
+	if (agg[i] != -1)
+	    continue;
+	agg[i] = nc;
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	    if (AMG_STRONG(i,p) && agg[c[p]] == -1)
+		agg[c[p]] = nc;
+	nc++;
+    }
+
+#undef AMG_STRONG
+
+    if (nc > 0.9*n) {
+	delete [] agg;
+	return 0;
+    }
+    aggregate[level] = agg;
+
+    // the members of each aggregate
+    int *memberStart = new int[nc+1];
+    int *members = new int[n];
+    for (int I=0; I<=nc; I++)
+	memberStart[I] = 0;
+    for (int i=0; i<n; i++)
+	memberStart[agg[i]+1]++;
+    for (int I=0; I<nc; I++)
+	memberStart[I+1] += memberStart[I];
+    for (int i=0; i<n; i++)
+	members[memberStart[agg[i]]++] = i;
+    for (int I=nc; I>0; I--)
+	memberStart[I] = memberStart[I-1];
+    memberStart[0] = 0;
+
+    // Ac = P^T A P: the entries of Ac(I,J) are the sums of the a_ij with i
+    // in aggregate I and j in aggregate J, so Ac has at most as many
+    // entries as A
+    int nnz = rs[n];
+    int *rsC = new int[nc+1];
+    int *cC = new int[nnz];
+    double *aC = new double[nnz];
+    int *marker = new int[nc];
+    double *sum = new double[nc];
+    for (int I=0; I<nc; I++)
+	marker[I] = -1;
+
+    int nnzC = 0;
+    rsC[0] = 0;
+    for (int I=0; I<nc; I++) {
+	int startI = nnzC;
+	for (int m=memberStart[I]; m<memberStart[I+1]; m++) {
+	    int i = members[m];
+	    for (int p=rs[i]; p<rs[i+1]; p++) {
+		int J = agg[c[p]];
+		if (marker[J] != I) {
+		    marker[J] = I;
+		    sum[J] = 0.0;
+		    cC[nnzC++] = J;
+		}
+		sum[J] += a[p];
+	    }
+	}
+	qsort(&cC[startI], nnzC-startI, sizeof(int), compareInt);
+	for (int p=startI; p<nnzC; p++)
+	    aC[p] = sum[cC[p]];
+	rsC[I+1] = nnzC;
+    }
+
+    delete [] marker;
+    delete [] sum;
+    delete [] members;
+    delete [] memberStart;
+
+    double *dC = new double[nc];
+    for (int I=0; I<nc; I++) {
+	dC[I] = 0.0;
+	for (int p=rsC[I]; p<rsC[I+1]; p++)
+	    if (cC[p] == I)
+		dC[I] = aC[p];
+	if (dC[I] <= 0.0) {
+	    opserr << "WARNING AMG_Preconditioner::coarsen() - ";
+	    opserr << "coarse diagonal " << dC[I] << " not positive on level " << level+1 << endln;
+	    delete [] dC;
+	    delete [] rsC;
+	    delete [] cC;
+	    delete [] aC;
+	    return -1;
+	}
+	dC[I] = 1.0/dC[I];
+    }
+
+    size[level+1] = nc;
+    rowStart[level+1] = rsC;
+    col[level+1] = cC;
+    A[level+1] = aC;
+    invDiag[level+1] = dC;
+    x[level+1] = new double[nc];
+    b[level+1] = new double[nc];
+
+    return nc;
+}
+
+int
+AMG_Preconditioner::factorCoarsest(void)
+{
+    int level = numLevels-1;
+    int n = size[level];
+    const int *rs = rowStart[level];
+    const int *c = col[level];
+    const double *a = A[level];
+
+    // lower triangle stored by rows
+    double *L = new double[n*n];
+    for (int i=0; i<n*n; i++)
+	L[i] = 0.0;
+    for (int i=0; i<n; i++)
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	    if (c[p] <= i)
+		L[i*n+c[p]] = a[p];
+
+    for (int j=0; j<n; j++) {
+	double *Lj = &L[j*n];
+	for (int i=j; i<n; i++) {
+	    double *Li = &L[i*n];
+	    double s = Li[j];
+	    for (int k=0; k<j; k++)
+		s -= Li[k]*Lj[k];
+	    if (i == j) {
+		if (s <= 0.0) {
+		    // singular coarse level, fall back on smoothing it
+		    delete [] L;
+		    return -1;
+		}
+		Lj[j] = sqrt(s);
+	    } else
+		Li[j] = s/Lj[j];
+	}
+    }
+
+    coarseL = L;
+    return 0;
+}
+
+void
+AMG_Preconditioner::smooth(int level, bool forward)
+{
+    int n = size[level];
+    const int *rs = rowStart[level];
+    const int *c = col[level];
+    const double *a = A[level];
+    const double *d = invDiag[level];
+    double *xl = x[level];
+    const double *bl = b[level];
+
+    for (int k=0; k<n; k++) {
+	int i = (forward == true) ? k : n-1-k;
+	double s = bl[i];
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	    if (c[p] != i)
+		s -= a[p]*xl[c[p]];
+	xl[i] = s*d[i];
+    }
+}
+
+void
+AMG_Preconditioner::vcycle(int level)
+{
+    int n = size[level];
+    double *xl = x[level];
+    const double *bl = b[level];
+
+    if (level == numLevels-1) {
+	if (coarseL != 0) {
+	    for (int i=0; i<n; i++) {
+		double s = bl[i];
+		const double *Li = &coarseL[i*n];
+		for (int k=0; k<i; k++)
+		    s -= Li[k]*xl[k];
+		xl[i] = s/Li[i];
+	    }
+	    for (int i=n-1; i>=0; i--) {
+		double s = xl[i];
+		for (int k=i+1; k<n; k++)
+		    s -= coarseL[k*n+i]*xl[k];
+		xl[i] = s/coarseL[i*n+i];
+	    }
+	} else {
+	    for (int i=0; i<n; i++)
+		xl[i] = 0.0;
+	    for (int k=0; k<2; k++) {
+		this->smooth(level, true);
+		this->smooth(level, false);
+	    }
+	}
+	return;
+    }
+
+    const int *rs = rowStart[level];
+    const int *c = col[level];
+    const double *a = A[level];
+    const int *agg = aggregate[level];
+    int nc = size[level+1];
+    double *xc = x[level+1];
+    double *bc = b[level+1];
+
+    for (int i=0; i<n; i++)
+	xl[i] = 0.0;
+    this->smooth(level, true);
+
+    // restrict the residual
+    for (int I=0; I<nc; I++)
+	bc[I] = 0.0;
+    for (int i=0; i<n; i++) {
+	double s = bl[i];
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	    s -= a[p]*xl[c[p]];
+	bc[agg[i]] += s;
+    }
+
+    this->vcycle(level+1);
+
+    // prolongate the correction
+    for (int i=0; i<n; i++)
+	xl[i] += xc[agg[i]];
+
+    this->smooth(level, false);
+}
+
+int
+AMG_Preconditioner::solve(const Vector &theR, Vector &z)
+{
+    if (numLevels == 0)
+	return -1;
+
+    int n = size[0];
+    for (int i=0; i<n; i++)
+	b[0][i] = theR(i);
+
+    this->vcycle(0);
+
+    for (int i=0; i<n; i++)
+	z(i) = x[0][i];
+
+    return 0;
+}
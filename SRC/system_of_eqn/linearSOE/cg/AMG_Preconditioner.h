@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/AMG_Preconditioner.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// AMG_Preconditioner. AMG_Preconditioner is a CG_Preconditioner that
+// applies one V-cycle of an unsmoothed aggregation algebraic multigrid.
+// The equations of each level are grouped into aggregates of strongly
+// connected equations, a_ij^2 >= theta^2 |a_ii a_jj|, each aggregate
+// becoming one equation of the next level, whose matrix is the Galerkin
+// product P^T A P for the piecewise constant prolongation P. Levels are
+// added until a level has no more than maxCoarse equations, maxLevels
+// is reached or the aggregation stalls. The V-cycle uses a forward
+// Gauss-Seidel sweep before and a backward sweep after the coarse
+// correction, which keeps the preconditioner symmetric, and a dense
+// Cholesky factorization on the coarsest level.
+//
+// What: "@(#) AMG_Preconditioner.h, revA"
+
+#ifndef AMG_Preconditioner_h
+#define AMG_Preconditioner_h
+
+#include <CG_Preconditioner.h>
+
+class AMG_Preconditioner : public CG_Preconditioner
+{
+  public:
+    AMG_Preconditioner(double theta = 0.08, int maxLevels = 10, int maxCoarse = 200);
+    ~AMG_Preconditioner();
+
+    int setSize(int n, const int *rowStartA, const int *colA);
+    int formPreconditioner(const double *A, const double *diagA);
+    int solve(const Vector &r, Vector &z);
+
+  protected:
+
+  private:
+    int coarsen(int level);
+    int factorCoarsest(void);
+    void vcycle(int level);
+    void smooth(int level, bool forward);
+    void clearLevels(void);
+
+    double theta;
+    int maxLevels, maxCoarse;
+    int numLevels;
+
+    // for each level: size, matrix in compressed rows (level 0 is the
+    // matrix of the PCGLinSOE), diagonal and the aggregate of each
+    // equation, the equation of the next level it belongs to
+    int *size;
+    const int **rowStart, **col;
+    const double **A;
+    double **invDiag;
+    int **aggregate;
+    double **x, **b;       // work vectors of the V-cycle
+
+    double *coarseL;       // Cholesky factor of the coarsest level
+};
+
+#endif
@@ -0,0 +1,47 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/CG_Preconditioner.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of CG_Preconditioner.
+//
+// What: "@(#) CG_Preconditioner.cpp, revA"
+
+#include <CG_Preconditioner.h>
+
+CG_Preconditioner::CG_Preconditioner()
+{
+
+}
+
+CG_Preconditioner::~CG_Preconditioner()
+{
+
+}
+
+bool
+CG_Preconditioner::needsMatrix(void)
+{
+    return true;
+}
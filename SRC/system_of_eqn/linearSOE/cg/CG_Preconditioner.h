@@ -0,0 +1,64 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/CG_Preconditioner.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// CG_Preconditioner. CG_Preconditioner is an abstract base class for
+// the preconditioners used by the PCGLinSolver. A preconditioner is
+// given the structure of A in setSize(), A itself each time it changes
+// in formPreconditioner(), and is then asked for z = M^-1 r once per
+// iteration in solve().
+//
+// A is passed in compressed row storage with all of A stored (not a
+// triangle) and the column indices of each row sorted. When the
+// PCGLinSOE is matrix free only the diagonal of A is available: the
+// structure and values of A are then 0 and only preconditioners for
+// which needsMatrix() is false can be used.
+//
+// What: "@(#) CG_Preconditioner.h, revA"
+
+#ifndef CG_Preconditioner_h
+#define CG_Preconditioner_h
+
+class Vector;
+
+class CG_Preconditioner
+{
+  public:
+    CG_Preconditioner();
+    virtual ~CG_Preconditioner();
+
+    virtual int setSize(int n, const int *rowStartA, const int *colA) = 0;
+    virtual int formPreconditioner(const double *A, const double *diagA) = 0;
+    virtual int solve(const Vector &r, Vector &z) = 0;
+
+    virtual bool needsMatrix(void);
+
+  protected:
+
+  private:
+};
+
+#endif
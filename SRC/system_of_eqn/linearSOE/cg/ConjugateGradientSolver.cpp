@@ -36,11 +36,12 @@
 
 ConjugateGradientSolver::ConjugateGradientSolver(int classtag, 
 						 LinearSOE *theSOE,
-						 double tol)
+						 double tol,
+						 int maxI)
 :LinearSOESolver(classtag),
- r(0),p(0),Ap(0),x(0), 
+ r(0),p(0),Ap(0),x(0),z(0), 
  theLinearSOE(theSOE), 
- tolerance(tol)
+ tolerance(tol), maxIter(maxI), numIter(0)
 {
     
 }
@@ -55,12 +56,19 @@ ConjugateGradientSolver::~ConjugateGradientSolver()
 	delete Ap;
     if (x != 0)
 	delete x;    
+    if (z != 0)
+	delete z;    
 }
 
 
 int 
 ConjugateGradientSolver::setSize(void)
 {
+    if (theLinearSOE == 0) {
+	opserr << "ConjugateGradientSolver::setSize() - no LinearSOE set\n";
+	return -1;
+    }
+
     int n = theLinearSOE->getNumEqn();
     if (n <= 0) {
 	opserr << "ConjugateGradientSolver::setSize() - n < 0 \n";
@@ -74,10 +82,12 @@ ConjugateGradientSolver::setSize(void)
 	    delete p;
 	    delete Ap;	
 	    delete x;		    
+	    delete z;		    
 	    r = 0;
 	    p = 0;
 	    Ap = 0;
 	    x = 0;	    
+	    z = 0;	    
 	}
     }
 
@@ -87,7 +97,8 @@ ConjugateGradientSolver::setSize(void)
 	p = new Vector(n);
 	Ap = new Vector(n);
 	x = new Vector(n);	
-	if (r == 0 || p == 0 || Ap == 0 || x == 0) {
+	z = new Vector(n);	
+	if (r == 0 || p == 0 || Ap == 0 || x == 0 || z == 0) {
 	    opserr << "ConjugateGradientSolver::setSize() - out of memory\n";
 	    if (r != 0)
 		delete r;
@@ -97,10 +108,13 @@ ConjugateGradientSolver::setSize(void)
 		delete Ap;
 	    if (x != 0)
 		delete x;    	    
+	    if (z != 0)
+		delete z;    	    
 	    r = 0;
 	    p = 0;
 	    Ap = 0;
 	    x = 0;	    	    
+	    z = 0;	    	    
 	    return -2;
 	    
 	}
@@ -120,14 +134,44 @@ ConjugateGradientSolver::solve(void)
     // initialize
     x->Zero();    
     *r = theLinearSOE->getB();
-    *p = *r;
-    double rdotr = *r ^ *r;
+    double normB = r->Norm();
+    double tol = tolerance * normB;
+    int numIterMax = maxIter;
+    if (numIterMax <= 0)
+	numIterMax = r->Size();
+
+    numIter = 0;
+    if (normB == 0.0) {
+	theLinearSOE->setX(*x);
+	return 0;
+    }
+
+    if (this->formZ(*r, *z) < 0)
+	return -1;
+    *p = *z;
+    double rdotz = *r ^ *z;
     
     // lopp till convergence
-    while (r->Norm() > tolerance) {
+    while (r->Norm() > tol) {
+
+	if (numIter == numIterMax) {
+	    opserr << "WARNING ConjugateGradientSolver::solve() - no convergence in ";
+	    opserr << numIter << " iterations, |r|/|b|: " << r->Norm()/normB << endln;
+	    theLinearSOE->setX(*x);
+	    return -2;
+	}
+	numIter++;
+
 	this->formAp(*p, *Ap);
 
-	double alpha = rdotr/(*p ^ *Ap);
+	double pdotAp = *p ^ *Ap;
+	if (pdotAp <= 0.0) {
+	    opserr << "WARNING ConjugateGradientSolver::solve() - ";
+	    opserr << "A is not positive definite\n";
+	    return -3;
+	}
+
+	double alpha = rdotz/pdotAp;
 
 	// *x += *p * alpha;
 	x->addVector(1.0, *p, alpha);
@@ -135,25 +179,42 @@ ConjugateGradientSolver::solve(void)
 	// *r -= *Ap * alpha;
 	r->addVector(1.0, *Ap, -alpha);
 
-	double oldrdotr = rdotr;
+	if (this->formZ(*r, *z) < 0)
+	    return -1;
+
+	double oldrdotz = rdotz;
 
-	rdotr = *r ^ *r;
+	rdotz = *r ^ *z;
 
-	double beta = rdotr / oldrdotr;
+	double beta = rdotz / oldrdotz;
 
-	// *p = *r + *p * beta;
-	p->addVector(beta, *r, 1.0);
+	// *p = *z + *p * beta;
+	p->addVector(beta, *z, 1.0);
     }
+
+    theLinearSOE->setX(*x);
     return 0;
 }
 
 
+int
+ConjugateGradientSolver::formZ(const Vector &theR, Vector &theZ)
+{
+    // no preconditioning
+    theZ = theR;
+    return 0;
+}
 
 
+int
+ConjugateGradientSolver::getNumIterations(void) const
+{
+    return numIter;
+}
 
 
-
-
-
-
-
+void
+ConjugateGradientSolver::setLinearSOE(LinearSOE *theSOE)
+{
+    theLinearSOE = theSOE;
+}
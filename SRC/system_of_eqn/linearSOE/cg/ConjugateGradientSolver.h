@@ -32,7 +32,11 @@
 // Description: This file contains the class definition for 
 // ConjugateGradientSolver. ConjugateGradientSolver is an abstract 
 // that implements the method solve and which declares a method
-// formAp to be pure virtual.
+// formAp to be pure virtual. Subclasses may also override the method
+// formZ to precondition the iterations, the default being no
+// preconditioning. The iterations stop when the norm of the residual
+// falls below tol times the norm of B, or after maxIter iterations
+// (the number of equations if maxIter is 0).
 //
 // What: "@(#) ConjugateGradientSolver.h, revA"
 
@@ -46,20 +50,27 @@ class Vector;
 class ConjugateGradientSolver : public LinearSOESolver
 {
   public:
-    ConjugateGradientSolver(int classTag, LinearSOE *theLinearSOE, double tol);    
+    ConjugateGradientSolver(int classTag, LinearSOE *theLinearSOE, double tol,
+			    int maxIter = 0);
     virtual ~ConjugateGradientSolver();
 
     virtual int setSize(void);    
     virtual int solve(void);
     virtual int formAp(const Vector &p, Vector &Ap) = 0;    
+    virtual int formZ(const Vector &r, Vector &z);
 //    virtual int setLinearSOE(LinearSOE &theSOE) =0;
 
+    int getNumIterations(void) const;
+
   protected:
+    void setLinearSOE(LinearSOE *theLinearSOE);
     
   private:
-    Vector *r, *p, *Ap, *x;
+    Vector *r, *p, *Ap, *x, *z;
     LinearSOE *theLinearSOE;
     double tolerance;
+    int maxIter;
+    int numIter;
 };
 
 #endif
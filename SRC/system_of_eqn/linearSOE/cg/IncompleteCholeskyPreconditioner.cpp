@@ -0,0 +1,348 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/IncompleteCholeskyPreconditioner.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// IncompleteCholeskyPreconditioner.
+//
+// What: "@(#) IncompleteCholeskyPreconditioner.cpp, revA"
+
+#include <IncompleteCholeskyPreconditioner.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <math.h>
+#include <stdlib.h>
+
+static int
+compareInt(const void *a, const void *b)
+{
+    return *((const int *)a) - *((const int *)b);
+}
+
+IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(int fill)
+:CG_Preconditioner(), fillLevel(fill), size(0), rowStartA(0), colA(0),
+ rowStartU(0), colU(0), U(0), sizeU(0),
+ first(0), next(0), position(0), mark(0), work(0)
+{
+    if (fillLevel < 0)
+	fillLevel = 0;
+}
+
+IncompleteCholeskyPreconditioner::~IncompleteCholeskyPreconditioner()
+{
+    if (rowStartU != 0) delete [] rowStartU;
+    if (colU != 0) delete [] colU;
+    if (U != 0) delete [] U;
+    if (first != 0) delete [] first;
+    if (next != 0) delete [] next;
+    if (position != 0) delete [] position;
+    if (mark != 0) delete [] mark;
+    if (work != 0) delete [] work;
+}
+
+int
+IncompleteCholeskyPreconditioner::setSize(int n, const int *rowStart, const int *col)
+{
+    if (rowStart == 0 || col == 0) {
+	opserr << "WARNING IncompleteCholeskyPreconditioner::setSize() - ";
+	opserr << "the structure of A is needed\n";
+	return -1;
+    }
+
+    rowStartA = rowStart;
+    colA = col;
+
+    if (n != size) {
+	if (rowStartU != 0) delete [] rowStartU;
+	if (first != 0) delete [] first;
+	if (next != 0) delete [] next;
+	if (position != 0) delete [] position;
+	if (mark != 0) delete [] mark;
+	if (work != 0) delete [] work;
+
+	rowStartU = new int[n+1];
+	first = new int[n];
+	next = new int[n];
+	position = new int[n];
+	mark = new int[n];
+	work = new double[n];
+	size = n;
+    }
+
+    //
+    // find the pattern of U a row at a time. the level of fill of an
+    // entry (i,j) is 0 if it is in A and otherwise the smallest
+    // lev(k,i) + lev(k,j) + 1 over the rows k < i of U with entries in
+    // columns i and j. the rows k with an entry in column i are found
+    // from linked lists: first[i] starts the list of the rows whose next
+    // entry, at position[k] in colU, is in column i.
+    //
+
+    int nnzA = 0;
+    for (int i=0; i<n; i++)
+	for (int p=rowStartA[i]; p<rowStartA[i+1]; p++)
+	    if (colA[p] >= i)
+		nnzA++;
+    
+    int capacity = nnzA + n;
+    if (fillLevel > 0)
+	capacity *= 2;
+    int *newCol = new int[capacity];
+    int *levU = new int[capacity];
+    
+    int *lev = mark;       // level of the entries in the current row
+    int *touched = new int[n];
+    for (int i=0; i<n; i++) {
+	first[i] = -1;
+	lev[i] = fillLevel+1;
+    }
+
+    int nnzU = 0;
+    rowStartU[0] = 0;
+    for (int i=0; i<n; i++) {
+
+	int numTouched = 0;
+	for (int p=rowStartA[i]; p<rowStartA[i+1]; p++) {
+	    int j = colA[p];
+	    if (j >= i && lev[j] > fillLevel) {
+		lev[j] = 0;
+		touched[numTouched++] = j;
+	    }
+	}
+	if (lev[i] > fillLevel) {
+	    lev[i] = 0;
+	    touched[numTouched++] = i;
+	}
+
+	int k = first[i];
+	while (k != -1) {
+	    int nextK = next[k];
+	    int pos = position[k];
+	    int levKI = levU[pos];
+	    int end = rowStartU[k+1];
+	    for (int p=pos+1; p<end; p++) {
+		int l = levKI + levU[p] + 1;
+		int j = newCol[p];
+		if (l < lev[j]) {
+		    if (lev[j] > fillLevel)
+			touched[numTouched++] = j;
+		    lev[j] = l;
+		}
+	    }
+	    position[k] = ++pos;
+	    if (pos < end) {
+		int j = newCol[pos];
+		next[k] = first[j];
+		first[j] = k;
+	    }
+	    k = nextK;
+	}
+
+	// make room for the row and add it in order, the diagonal first
+	if (nnzU + numTouched > capacity) {
+	    int newCapacity = 2*capacity;
+	    if (newCapacity < nnzU + numTouched)
+		newCapacity = nnzU + numTouched;
+	    int *tmpCol = new int[newCapacity];
+	    int *tmpLev = new int[newCapacity];
+	    for (int p=0; p<nnzU; p++) {
+		tmpCol[p] = newCol[p];
+		tmpLev[p] = levU[p];
+	    }
+	    delete [] newCol;
+	    delete [] levU;
+	    newCol = tmpCol;
+	    levU = tmpLev;
+	    capacity = newCapacity;
+	}
+
+	qsort(touched, numTouched, sizeof(int), compareInt);
+	for (int p=0; p<numTouched; p++) {
+	    int j = touched[p];
+	    newCol[nnzU] = j;
+	    levU[nnzU++] = lev[j];
+	    lev[j] = fillLevel+1;
+	}
+	rowStartU[i+1] = nnzU;
+
+	// link row i in the list of its first entry to the right of the diagonal
+	position[i] = rowStartU[i]+1;
+	if (position[i] < nnzU) {
+	    int j = newCol[position[i]];
+	    next[i] = first[j];
+	    first[j] = i;
+	}
+    }
+
+    delete [] touched;
+    delete [] levU;
+
+    if (colU != 0) delete [] colU;
+    colU = newCol;
+
+    if (nnzU > sizeU) {
+	if (U != 0) delete [] U;
+	U = new double[nnzU];
+	sizeU = nnzU;
+    }
+
+    return 0;
+}
+
+int
+IncompleteCholeskyPreconditioner::formPreconditioner(const double *A, const double *diagA)
+{
+    if (A == 0) {
+	opserr << "WARNING IncompleteCholeskyPreconditioner::formPreconditioner() - ";
+	opserr << "A has not been assembled\n";
+	return -1;
+    }
+
+    double alpha = 0.0;
+    int result = this->factor(A, alpha);
+    while (result == -1) {
+	alpha = (alpha == 0.0) ? 1.0e-3 : 2.0*alpha;
+	if (alpha > 1.0e3) {
+	    opserr << "WARNING IncompleteCholeskyPreconditioner::formPreconditioner() - ";
+	    opserr << "failed to factor A with a diagonal shift up to " << alpha/2.0 << endln;
+	    return -1;
+	}
+	result = this->factor(A, alpha);
+    }
+
+    if (result < 0)
+	return result;
+    
+    if (alpha != 0.0) {
+	opserr << "WARNING IncompleteCholeskyPreconditioner::formPreconditioner() - ";
+	opserr << "factorization broke down, diagonal of A increased by " << alpha*100.0 << "%\n";
+    }
+
+    return 0;
+}
+
+int
+IncompleteCholeskyPreconditioner::factor(const double *A, double alpha)
+{
+    // left looking: row i of U is row i of A less the contributions of
+    // the rows k < i with an entry in column i, which are again found
+    // from the linked lists first/next. fill outside the pattern of U is
+    // dropped.
+
+    for (int i=0; i<size; i++) {
+	first[i] = -1;
+	mark[i] = -1;
+    }
+
+    for (int i=0; i<size; i++) {
+	int start = rowStartU[i];
+	int end = rowStartU[i+1];
+	for (int p=start; p<end; p++) {
+	    int j = colU[p];
+	    work[j] = 0.0;
+	    mark[j] = i;
+	}
+
+	double aii = 0.0;
+	for (int p=rowStartA[i]; p<rowStartA[i+1]; p++) {
+	    int j = colA[p];
+	    if (j == i)
+		aii = A[p];
+	    if (j >= i)
+		work[j] = A[p];
+	}
+
+	if (aii <= 0.0) {
+	    opserr << "WARNING IncompleteCholeskyPreconditioner::factor() - ";
+	    opserr << "diagonal " << aii << " at equation " << i << " not positive\n";
+	    return -2;
+	}
+	work[i] *= (1.0 + alpha);
+
+	int k = first[i];
+	while (k != -1) {
+	    int nextK = next[k];
+	    int pos = position[k];
+	    double uki = U[pos];
+	    int endK = rowStartU[k+1];
+	    for (int p=pos+1; p<endK; p++) {
+		int j = colU[p];
+		if (mark[j] == i)
+		    work[j] -= uki * U[p];
+	    }
+	    position[k] = ++pos;
+	    if (pos < endK) {
+		int j = colU[pos];
+		next[k] = first[j];
+		first[j] = k;
+	    }
+	    k = nextK;
+	}
+
+	double d = work[i];
+	if (d <= 1.0e-12*aii)
+	    return -1;
+
+	double uii = sqrt(d);
+	U[start] = uii;
+	for (int p=start+1; p<end; p++)
+	    U[p] = work[colU[p]]/uii;
+
+	position[i] = start+1;
+	if (start+1 < end) {
+	    int j = colU[start+1];
+	    next[i] = first[j];
+	    first[j] = i;
+	}
+    }
+
+    return 0;
+}
+
+int
+IncompleteCholeskyPreconditioner::solve(const Vector &r, Vector &z)
+{
+    z = r;
+
+    // solve U^T y = r, a column of U^T at a time
+    for (int i=0; i<size; i++) {
+	int start = rowStartU[i];
+	double yi = z(i)/U[start];
+	z(i) = yi;
+	for (int p=start+1; p<rowStartU[i+1]; p++)
+	    z(colU[p]) -= U[p] * yi;
+    }
+
+    // solve U z = y
+    for (int i=size-1; i>=0; i--) {
+	int start = rowStartU[i];
+	double zi = z(i);
+	for (int p=start+1; p<rowStartU[i+1]; p++)
+	    zi -= U[p] * z(colU[p]);
+	z(i) = zi/U[start];
+    }
+
+    return 0;
+}
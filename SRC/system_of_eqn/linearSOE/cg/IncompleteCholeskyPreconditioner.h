@@ -0,0 +1,71 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/IncompleteCholeskyPreconditioner.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// IncompleteCholeskyPreconditioner. IncompleteCholeskyPreconditioner
+// is a CG_Preconditioner that forms an incomplete factorization
+// A ~ U^T U, where U is upper triangular and has the pattern of the
+// level of fill IC(k) factorization of A: fill entries whose level
+// exceeds fillLevel are dropped, fillLevel 0 giving a U with the
+// pattern of the upper triangle of A. The pattern is found in setSize()
+// and the values in formPreconditioner(). Should the factorization
+// break down the diagonal of A is increased by a growing fraction
+// alpha, A + alpha*diag(A), until it succeeds.
+//
+// What: "@(#) IncompleteCholeskyPreconditioner.h, revA"
+
+#ifndef IncompleteCholeskyPreconditioner_h
+#define IncompleteCholeskyPreconditioner_h
+
+#include <CG_Preconditioner.h>
+
+class IncompleteCholeskyPreconditioner : public CG_Preconditioner
+{
+  public:
+    IncompleteCholeskyPreconditioner(int fillLevel = 0);
+    ~IncompleteCholeskyPreconditioner();
+
+    int setSize(int n, const int *rowStartA, const int *colA);
+    int formPreconditioner(const double *A, const double *diagA);
+    int solve(const Vector &r, Vector &z);
+
+  protected:
+
+  private:
+    int factor(const double *A, double alpha);
+
+    int fillLevel;
+    int size;
+    const int *rowStartA, *colA; // structure of A, owned by the PCGLinSOE
+    int *rowStartU, *colU;       // rows of U, the diagonal first in each row
+    double *U;
+    int sizeU;
+    int *first, *next, *position; // linked lists of the rows of U, see factor()
+    int *mark;
+    double *work;
+};
+
+#endif
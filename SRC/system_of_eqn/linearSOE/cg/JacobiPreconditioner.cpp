@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/JacobiPreconditioner.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of JacobiPreconditioner.
+//
+// What: "@(#) JacobiPreconditioner.cpp, revA"
+
+#include <JacobiPreconditioner.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+JacobiPreconditioner::JacobiPreconditioner()
+:CG_Preconditioner(), size(0), invD(0)
+{
+
+}
+
+JacobiPreconditioner::~JacobiPreconditioner()
+{
+    if (invD != 0)
+	delete [] invD;
+}
+
+int
+JacobiPreconditioner::setSize(int n, const int *rowStartA, const int *colA)
+{
+    if (n != size) {
+	if (invD != 0)
+	    delete [] invD;
+	invD = new double[n];
+	size = n;
+    }
+
+    return 0;
+}
+
+int
+JacobiPreconditioner::formPreconditioner(const double *A, const double *diagA)
+{
+    for (int i=0; i<size; i++) {
+	double aii = diagA[i];
+	if (aii <= 0.0) {
+	    opserr << "WARNING JacobiPreconditioner::formPreconditioner() - ";
+	    opserr << "diagonal " << aii << " at equation " << i << " not positive\n";
+	    return -1;
+	}
+	invD[i] = 1.0/aii;
+    }
+
+    return 0;
+}
+
+int
+JacobiPreconditioner::solve(const Vector &r, Vector &z)
+{
+    for (int i=0; i<size; i++)
+	z(i) = invD[i] * r(i);
+
+    return 0;
+}
+
+bool
+JacobiPreconditioner::needsMatrix(void)
+{
+    return false;
+}
@@ -0,0 +1,58 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/JacobiPreconditioner.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// JacobiPreconditioner. JacobiPreconditioner is a CG_Preconditioner
+// that scales the residual by the inverse of the diagonal of A. As only
+// the diagonal is needed it can be used with a matrix free PCGLinSOE.
+//
+// What: "@(#) JacobiPreconditioner.h, revA"
+
+#ifndef JacobiPreconditioner_h
+#define JacobiPreconditioner_h
+
+#include <CG_Preconditioner.h>
+
+class JacobiPreconditioner : public CG_Preconditioner
+{
+  public:
+    JacobiPreconditioner();
+    ~JacobiPreconditioner();
+
+    int setSize(int n, const int *rowStartA, const int *colA);
+    int formPreconditioner(const double *A, const double *diagA);
+    int solve(const Vector &r, Vector &z);
+
+    bool needsMatrix(void);
+
+  protected:
+
+  private:
+    int size;
+    double *invD;     // inverse of the diagonal of A
+};
+
+#endif
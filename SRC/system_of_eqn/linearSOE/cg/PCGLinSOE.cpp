@@ -0,0 +1,668 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/PCGLinSOE.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for PCGLinSOE
+//
+// What: "@(#) PCGLinSOE.cpp, revA"
+
+#include <PCGLinSOE.h>
+#include <PCGLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <ThreadPool.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+static int
+compareIDs(const void *a, const void *b)
+{
+    const ID *idA = *((const ID **)a);
+    const ID *idB = *((const ID **)b);
+    if (idA < idB)
+	return -1;
+    if (idA > idB)
+	return 1;
+    return 0;
+}
+
+// ThreadTask used to form Ap = A*p for the rows [start, end) of an
+// assembled A; each thread writes its own entries of Ap
+class PCGLinSOE_ApTask : public ThreadTask
+{
+ public:
+  PCGLinSOE_ApTask(const double *theA, const int *theRowStart, const int *theCol,
+		   const Vector &theP, Vector &theAp)
+    :A(theA), rowStartA(theRowStart), colA(theCol), p(theP), Ap(theAp) {};
+
+  int execute(int start, int end, int threadID) {
+    for (int i=start; i<end; i++) {
+      double sum = 0.0;
+      for (int k=rowStartA[i]; k<rowStartA[i+1]; k++)
+	sum += A[k] * p(colA[k]);
+      Ap(i) = sum;
+    }
+    return 0;
+  };
+
+ private:
+  const double *A;
+  const int *rowStartA, *colA;
+  const Vector &p;
+  Vector &Ap;
+};
+
+PCGLinSOE::PCGLinSOE(PCGLinSolver &the_Solver, bool mFree)
+:LinearSOE(the_Solver, LinSOE_TAGS_PCGLinSOE),
+ size(0), nnz(0), A(0), B(0), X(0), diagA(0), colA(0), rowStartA(0),
+ vectX(0), vectB(0),
+ Asize(0), Bsize(0),
+ factored(false), matrixFree(mFree),
+ theFE_IDs(0), numFE_IDs(0),
+ otherIDs(0), otherMatrices(0), numOther(0), sizeOther(0)
+{
+    the_Solver.setLinearSOE(*this);
+}
+
+PCGLinSOE::~PCGLinSOE()
+{
+    if (A != 0) delete [] A;
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (diagA != 0) delete [] diagA;
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colA != 0) delete []colA;
+    if (vectX != 0) delete vectX;    
+    if (vectB != 0) delete vectB;        
+    if (theFE_IDs != 0) delete [] theFE_IDs;
+
+    for (int i=0; i<sizeOther; i++) {
+	if (otherIDs[i] != 0) delete otherIDs[i];
+	if (otherMatrices[i] != 0) delete otherMatrices[i];
+    }
+    if (otherIDs != 0) delete [] otherIDs;
+    if (otherMatrices != 0) delete [] otherMatrices;
+}
+
+
+int
+PCGLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+int 
+PCGLinSOE::setSize(Graph &theGraph)
+{
+
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    // fist itearte through the vertices of the graph to get nnz
+    Vertex *theVertex;
+    int newNNZ = 0;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((theVertex = theVertices()) != 0) {
+	const ID &theAdjacency = theVertex->getAdjacency();
+	newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+    }
+    nnz = newNNZ;
+
+    if (matrixFree == false && newNNZ > Asize) { // we have to get more space for A and colA
+	if (A != 0) 
+	    delete [] A;
+	if (colA != 0)
+	    delete [] colA;
+	
+	A = new double[newNNZ];
+	colA = new int[newNNZ];
+	
+        if (A == 0 || colA == 0) {
+            opserr << "WARNING PCGLinSOE::setSize :";
+	    opserr << " ran out of memory for A and colA with nnz = ";
+	    opserr << newNNZ << " \n";
+	    size = 0; Asize = 0; nnz = 0;
+	    result =  -1;
+        } 
+	
+	Asize = newNNZ;
+    }
+
+    // zero the matrix
+    for (int i=0; i<Asize; i++)
+	A[i] = 0;
+	
+    factored = false;
+    
+    if (size > Bsize) { // we have to get space for the vectors
+	
+	// delete the old	
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+	if (diagA != 0) delete [] diagA;
+	if (rowStartA != 0) delete [] rowStartA;
+
+	// create the new
+	B = new double[size];
+	X = new double[size];
+	diagA = new double[size];
+	rowStartA = new int[size+1]; 
+	
+        if (B == 0 || X == 0 || diagA == 0 || rowStartA == 0) {
+            opserr << "WARNING PCGLinSOE::setSize :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    size = 0; Bsize = 0;
+	    result =  -1;
+        }
+	else
+	    Bsize = size;
+    }
+
+    // zero the vectors
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+	diagA[j] = 0;
+    }
+    
+    // create new Vectors objects
+    if (size != oldSize) {
+	if (vectX != 0)
+	    delete vectX;
+
+	if (vectB != 0)
+	    delete vectB;
+	
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);	
+    }
+
+    if (matrixFree == true) {
+
+	// no A; find the IDs of the FE_Elements that can form K_e p_e, which
+	// are not kept by addA(); the matrices of the others (constraint
+	// FE_Elements, TransformationFE) are kept like those of a non FE
+	if (theFE_IDs != 0)
+	    delete [] theFE_IDs;
+	theFE_IDs = 0;
+	numFE_IDs = 0;
+	numOther = 0;
+
+	if (theModel == 0) {
+	    opserr << "WARNING PCGLinSOE::setSize :";
+	    opserr << " no AnalysisModel, needed when matrix free\n";
+	    return -1;
+	}
+
+	int numFE = 0;
+	FE_EleIter &theEles = theModel->getFEs();
+	FE_Element *elePtr;
+	while ((elePtr = theEles()) != 0)
+	    if (elePtr->canFormTangForce() == true)
+		numFE++;
+
+	if (numFE > 0) {
+	    theFE_IDs = new const ID *[numFE];
+	    FE_EleIter &theEles2 = theModel->getFEs();
+	    while ((elePtr = theEles2()) != 0)
+		if (elePtr->canFormTangForce() == true)
+		    theFE_IDs[numFE_IDs++] = &(elePtr->getID());
+	    qsort(theFE_IDs, numFE_IDs, sizeof(const ID *), compareIDs);
+	}
+
+	nnz = 0;
+
+    } else if (size != 0) {
+
+      // fill in rowStartA and colA
+      rowStartA[0] = 0;
+      int startLoc = 0;
+      int lastLoc = 0;
+      for (int a=0; a<size; a++) {
+
+	theVertex = theGraph.getVertexPtr(a);
+	if (theVertex == 0) {
+	  opserr << "WARNING:PCGLinSOE::setSize :";
+	  opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	  size = 0;
+	  return -1;
+	}
+
+	colA[lastLoc++] = theVertex->getTag(); // place diag in first
+	const ID &theAdjacency = theVertex->getAdjacency();
+	int idSize = theAdjacency.Size();
+	
+	// now we have to place the entries in the ID into order in colA
+	for (int i=0; i<idSize; i++) {
+
+	  int row = theAdjacency(i);
+	  bool foundPlace = false;
+	  // find a place in colA for current col
+	  for (int j=startLoc; j<lastLoc; j++)
+	    if (colA[j] > row) { 
+	      // move the entries already there one further on
+	      // and place col in current location
+	      for (int k=lastLoc; k>j; k--)
+		
+		colA[k] = colA[k-1];
+	      colA[j] = row;
+	      foundPlace = true;
+	      j = lastLoc;
+	    }
+	  if (foundPlace == false) // put in at the end
+	    colA[lastLoc] = row;
+
+	  lastLoc++;
+	}
+	rowStartA[a+1] = lastLoc;;	    
+	startLoc = lastLoc;
+      }
+
+      // find the location in A of the entries of each FE_Element matrix
+      theScatterMap.setSize(theModel, size, rowStartA, colA, false);
+    }
+
+    // invoke setSize() on the Solver   
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:PCGLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }    
+    return result;
+}
+
+int 
+PCGLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  
+	return 0;
+
+    int idSize = id.Size();
+    
+    // check that m and id are of similar size
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "PCGLinSOE::addA() ";
+	opserr << " - Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (matrixFree == true) {
+
+	// keep the diagonal for the preconditioner
+	for (int i=0; i<idSize; i++) {
+	    int row = id(i);
+	    if (row < size && row >= 0)
+		diagA[row] += fact * m(i,i);
+	}
+
+	// the FE_Elements form their matrix again in formAp(), keep the rest
+	if (this->isFE_ID(id) == true)
+	    return 0;
+
+	if (numOther == sizeOther) {
+	    int newSize = 2*sizeOther + 8;
+	    ID **newIDs = new ID *[newSize];
+	    Matrix **newMatrices = new Matrix *[newSize];
+	    for (int i=0; i<sizeOther; i++) {
+		newIDs[i] = otherIDs[i];
+		newMatrices[i] = otherMatrices[i];
+	    }
+	    for (int i=sizeOther; i<newSize; i++) {
+		newIDs[i] = 0;
+		newMatrices[i] = 0;
+	    }
+	    if (otherIDs != 0) delete [] otherIDs;
+	    if (otherMatrices != 0) delete [] otherMatrices;
+	    otherIDs = newIDs;
+	    otherMatrices = newMatrices;
+	    sizeOther = newSize;
+	}
+
+	// the storage of the last step is reused if of the right size
+	if (otherIDs[numOther] == 0 || otherIDs[numOther]->Size() != idSize) {
+	    if (otherIDs[numOther] != 0) delete otherIDs[numOther];
+	    if (otherMatrices[numOther] != 0) delete otherMatrices[numOther];
+	    otherIDs[numOther] = new ID(idSize);
+	    otherMatrices[numOther] = new Matrix(idSize, idSize);
+	}
+	*(otherIDs[numOther]) = id;
+	Matrix &theMatrix = *(otherMatrices[numOther]);
+	for (int j=0; j<idSize; j++)
+	    for (int i=0; i<idSize; i++)
+		theMatrix(i,j) = fact * m(i,j);
+	numOther++;
+
+	return 0;
+    }
+
+    // if the ID is that of an FE_Element use the locations found in setSize()
+    const int *theLocations = theScatterMap.getLocations(id);
+    if (theLocations != 0) {
+      for (int j=0; j<idSize; j++)
+	for (int i=0; i<idSize; i++) {
+	  int loc = *theLocations++;
+	  if (loc >= 0)
+	    A[loc] += fact * m(i,j);
+	}
+      return 0;
+    }
+    
+    for (int i=0; i<idSize; i++) {
+	int row = id(i);
+	if (row < size && row >= 0) {
+	    int startRowLoc = rowStartA[row];
+	    int endRowLoc = rowStartA[row+1];
+	    for (int j=0; j<idSize; j++) {
+		int col = id(j);
+		if (col <size && col >= 0) {
+		    // find place in A using colA
+		    for (int k=startRowLoc; k<endRowLoc; k++)
+			if (colA[k] == col) {
+			    A[k] += fact * m(i,j);
+			    k = endRowLoc;
+			}
+		}
+	    }  // for j		
+	} 
+    }  // for i
+
+    return 0;
+}
+
+    
+int 
+PCGLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    int idSize = id.Size();    
+    // check that m and id are of similar size
+    if (idSize != v.Size() ) {
+	opserr << "PCGLinSOE::addB() ";
+	opserr << " - Vector and ID not of similar sizes\n";
+	return -1;
+    }    
+
+    for (int i=0; i<idSize; i++) {
+	int pos = id(i);
+	if (pos <size && pos >= 0)
+	    B[pos] += v(i) * fact;
+    }
+
+    return 0;
+}
+
+bool
+PCGLinSOE::canAddConcurrently(void)
+{
+    // addA() and addB() only write the entries of the equations in the ID;
+    // when matrix free the matrices kept are those of the DOF_Groups,
+    // which are not added concurrently
+    return true;
+}
+
+int
+PCGLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING PCGLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+    
+    for (int i=0; i<size; i++)
+	B[i] = v(i) * fact;
+
+    return 0;
+}
+
+void 
+PCGLinSOE::zeroA(void)
+{
+    double *Aptr = A;
+    for (int i=0; i<Asize; i++)
+	*Aptr++ = 0;
+
+    for (int i=0; i<size; i++)
+	diagA[i] = 0;
+    numOther = 0;
+
+    factored = false;
+}
+	
+void 
+PCGLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+void 
+PCGLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >=0)
+	X[loc] = value;
+}
+
+void 
+PCGLinSOE::setX(const Vector &x)
+{
+  if (x.Size() == size && vectX != 0)
+    *vectX = x;
+}
+
+const Vector &
+PCGLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL PCGLinSOE::getX - vectX == 0";
+	exit(-1);
+    }
+    return *vectX;
+}
+
+const Vector &
+PCGLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL PCGLinSOE::getB - vectB == 0";
+	exit(-1);
+    }        
+    return *vectB;
+}
+
+double 
+PCGLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    for (int i=0; i<size; i++) {
+	double Yi = B[i];
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+    
+}    
+
+
+int
+PCGLinSOE::setPCGLinSolver(PCGLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+    
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:PCGLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return -1;
+	}
+    }
+    
+    return this->LinearSOE::setSolver(newSolver);
+}
+
+
+bool
+PCGLinSOE::isMatrixFree(void) const
+{
+    return matrixFree;
+}
+
+int
+PCGLinSOE::formAp(const Vector &p, Vector &Ap)
+{
+    if (matrixFree == false) {
+	ThreadPool *thePool = ThreadPool::getThreadPool();
+	PCGLinSOE_ApTask theTask(A, rowStartA, colA, p, Ap);
+	if (thePool != 0)
+	    thePool->run(theTask, size);
+	else
+	    theTask.execute(0, size, 0);
+	return 0;
+    }
+
+    Ap.Zero();
+
+    // K_e p_e from each FE_Element, the tangent being formed again by
+    // the Integrator that formed it for addA()
+    FE_EleIter &theEles = theModel->getFEs();
+    FE_Element *elePtr;
+    while ((elePtr = theEles()) != 0) {
+	if (elePtr->canFormTangForce() == false)
+	    continue;
+	if (elePtr->getLastIntegrator() == 0) {
+	    opserr << "WARNING PCGLinSOE::formAp() - no tangent formed for FE_Element ";
+	    opserr << elePtr->getID();
+	    return -1;
+	}
+	const Vector &theForce = elePtr->getTangForce(p);
+	Ap.Assemble(theForce, elePtr->getID());
+    }
+
+    // and the matrices kept by addA()
+    for (int a=0; a<numOther; a++) {
+	const ID &id = *(otherIDs[a]);
+	const Matrix &m = *(otherMatrices[a]);
+	int idSize = id.Size();
+	for (int i=0; i<idSize; i++) {
+	    int row = id(i);
+	    if (row < size && row >= 0) {
+		double sum = 0.0;
+		for (int j=0; j<idSize; j++) {
+		    int col = id(j);
+		    if (col < size && col >= 0)
+			sum += m(i,j) * p(col);
+		}
+		Ap(row) += sum;
+	    }
+	}
+    }
+
+    return 0;
+}
+
+bool
+PCGLinSOE::isFE_ID(const ID &id) const
+{
+    // binary search of the FE_Element ID addresses
+    const ID *theID = &id;
+    int low = 0;
+    int high = numFE_IDs-1;
+    while (low <= high) {
+	int middle = (low + high)/2;
+	if (theFE_IDs[middle] == theID)
+	    return true;
+	if (theFE_IDs[middle] < theID)
+	    low = middle+1;
+	else
+	    high = middle-1;
+    }
+    return false;
+}
+
+void
+PCGLinSOE::formDiagonal(void)
+{
+    // when matrix free the diagonal is summed by addA()
+    if (matrixFree == true)
+	return;
+
+    for (int i=0; i<size; i++) {
+	diagA[i] = 0.0;
+	for (int k=rowStartA[i]; k<rowStartA[i+1]; k++)
+	    if (colA[k] == i) {
+		diagA[i] = A[k];
+		k = rowStartA[i+1];
+	    }
+    }
+}
+
+
+int 
+PCGLinSOE::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+int 
+PCGLinSOE::recvSelf(int cTag, Channel &theChannel, 
+		    FEM_ObjectBroker &theBroker)  
+{
+    return 0;
+}
+
+
+void
+PCGLinSOE::Print(OPS_Stream &s, int flag)
+{
+    s << "PCGLinSOE: size: " << size;
+    if (matrixFree == true) {
+	s << " matrix free, FE_Elements: " << numFE_IDs;
+	s << " other matrices: " << numOther << endln;
+    } else {
+	s << " nnz: " << nnz;
+	s << " memory for A: " << nnz*(sizeof(double)+sizeof(int))/1024.0 << " kbytes\n";
+	s << "  scatter map: " << theScatterMap.getNumFE_Eles() << " FE_Elements, ";
+	s << theScatterMap.getMemory()/1024.0 << " kbytes\n";
+    }
+}
@@ -0,0 +1,114 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/PCGLinSOE.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for PCGLinSOE.
+// PCGLinSOE is a subclass of LinearSOE. It stores the symmetric matrix
+// equation Ax=b for the PCGLinSolver using the sparse row-compacted
+// storage scheme, all of A being stored so that Ap can be formed a row
+// at a time.
+//
+// If constructed matrix free, A is not assembled. Ap is then formed
+// element by element: each FE_Element forms its tangent again through
+// the Integrator last used to form it and adds K_e p_e, so that apart
+// from B and X only the diagonal of A is stored. The contributions of
+// the DOF_Groups, of FE_Elements whose canFormTangForce() is false
+// (constraint FE_Elements, TransformationFE) and of any other matrices
+// are kept as they are added.
+//
+// What: "@(#) PCGLinSOE.h, revA"
+
+#ifndef PCGLinSOE_h
+#define PCGLinSOE_h
+
+#include <LinearSOE.h>
+#include <Vector.h>
+#include <SparseScatterMap.h>
+
+class PCGLinSolver;
+
+class PCGLinSOE : public LinearSOE
+{
+  public:
+    PCGLinSOE(PCGLinSolver &theSolver, bool matrixFree = false);
+
+    ~PCGLinSOE();
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool canAddConcurrently(void);
+    int setB(const Vector &, double fact = 1.0);        
+    
+    void zeroA(void);
+    void zeroB(void);
+    
+    const Vector &getX(void);
+    const Vector &getB(void);    
+    double normRHS(void);
+
+    void setX(int loc, double value);        
+    void setX(const Vector &x);        
+    int setPCGLinSolver(PCGLinSolver &newSolver);    
+
+    bool isMatrixFree(void) const;
+    int formAp(const Vector &p, Vector &Ap);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+
+    void Print(OPS_Stream &s, int flag = 0);
+    friend class PCGLinSolver;
+
+  protected:
+    
+  private:
+    bool isFE_ID(const ID &id) const;
+    void formDiagonal(void);
+
+    int size;            // order of A
+    int nnz;             // number of non-zeros in A
+    double *A, *B, *X;   // 1d arrays containing coefficients of A, B and X
+    double *diagA;       // the diagonal of A
+    int *colA, *rowStartA; // int arrays containing info about coeficientss in A
+    Vector *vectX;
+    Vector *vectB;    
+    int Asize, Bsize;    // size of the 1d array holding A
+    bool factored;       // true once the preconditioner is formed for A
+    bool matrixFree;
+    SparseScatterMap theScatterMap; // locations in A of the FE_Element entries
+
+    // matrix free storage: the addresses of the FE_Element IDs, sorted,
+    // and the matrices added for anything else
+    const ID **theFE_IDs;
+    int numFE_IDs;
+    ID **otherIDs;
+    Matrix **otherMatrices;
+    int numOther, sizeOther;
+};
+
+
+#endif
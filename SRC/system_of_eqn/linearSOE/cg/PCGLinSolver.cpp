@@ -0,0 +1,130 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/PCGLinSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for PCGLinSolver
+//
+// What: "@(#) PCGLinSolver.cpp, revA"
+
+#include <PCGLinSolver.h>
+#include <PCGLinSOE.h>
+#include <CG_Preconditioner.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+PCGLinSolver::PCGLinSolver(double tol, int maxIter, CG_Preconditioner *thePrecond)
+:ConjugateGradientSolver(SOLVER_TAGS_PCGLinSolver, 0, tol, maxIter),
+ theSOE(0), thePreconditioner(thePrecond)
+{
+
+}
+
+PCGLinSolver::~PCGLinSolver()
+{
+    if (thePreconditioner != 0)
+	delete thePreconditioner;
+}
+
+int
+PCGLinSolver::setSize(void)
+{
+    int result = this->ConjugateGradientSolver::setSize();
+    if (result < 0)
+	return result;
+
+    if (thePreconditioner != 0) {
+	if (theSOE->matrixFree == true && thePreconditioner->needsMatrix() == true) {
+	    opserr << "WARNING PCGLinSolver::setSize() - the preconditioner needs A, ";
+	    opserr << "which a matrix free PCGLinSOE does not assemble\n";
+	    return -1;
+	}
+
+	result = thePreconditioner->setSize(theSOE->size, theSOE->rowStartA, theSOE->colA);
+	if (result < 0) {
+	    opserr << "WARNING PCGLinSolver::setSize() - preconditioner failed setSize()\n";
+	    return result;
+	}
+    }
+
+    return 0;
+}
+
+int
+PCGLinSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING PCGLinSolver::solve() - no PCGLinSOE set\n";
+	return -1;
+    }
+
+    // form the preconditioner if A has changed
+    if (thePreconditioner != 0 && theSOE->factored == false) {
+	theSOE->formDiagonal();
+	double *theA = (theSOE->matrixFree == true) ? 0 : theSOE->A;
+	if (thePreconditioner->formPreconditioner(theA, theSOE->diagA) < 0) {
+	    opserr << "WARNING PCGLinSolver::solve() - failed to form the preconditioner\n";
+	    return -1;
+	}
+    }
+    theSOE->factored = true;
+
+    return this->ConjugateGradientSolver::solve();
+}
+
+int
+PCGLinSolver::formAp(const Vector &p, Vector &Ap)
+{
+    return theSOE->formAp(p, Ap);
+}
+
+int
+PCGLinSolver::formZ(const Vector &r, Vector &z)
+{
+    if (thePreconditioner == 0)
+	return this->ConjugateGradientSolver::formZ(r, z);
+
+    return thePreconditioner->solve(r, z);
+}
+
+int
+PCGLinSolver::setLinearSOE(PCGLinSOE &theLinearSOE)
+{
+    theSOE = &theLinearSOE;
+    this->ConjugateGradientSolver::setLinearSOE(&theLinearSOE);
+    return 0;
+}
+
+int
+PCGLinSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+int
+PCGLinSolver::recvSelf(int cTag, Channel &theChannel, 
+		       FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
@@ -0,0 +1,69 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/cg/PCGLinSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for PCGLinSolver.
+// PCGLinSolver is a ConjugateGradientSolver for the PCGLinSOE, Ap being
+// formed by the PCGLinSOE and the iterations preconditioned by a
+// CG_Preconditioner. The preconditioner, which is deleted by the solver,
+// is formed again whenever A has changed since the last solve(); with
+// no preconditioner the iterations are not preconditioned.
+//
+// What: "@(#) PCGLinSolver.h, revA"
+
+#ifndef PCGLinSolver_h
+#define PCGLinSolver_h
+
+#include <ConjugateGradientSolver.h>
+
+class PCGLinSOE;
+class CG_Preconditioner;
+
+class PCGLinSolver : public ConjugateGradientSolver
+{
+  public:
+    PCGLinSolver(double tol = 1.0e-8, int maxIter = 0,
+		 CG_Preconditioner *thePreconditioner = 0);
+    ~PCGLinSolver();
+
+    int setSize(void);    
+    int solve(void);
+    int formAp(const Vector &p, Vector &Ap);
+    int formZ(const Vector &r, Vector &z);
+
+    int setLinearSOE(PCGLinSOE &theSOE);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);    
+
+  protected:
+    
+  private:
+    PCGLinSOE *theSOE;
+    CG_Preconditioner *thePreconditioner;
+};
+
+#endif
@@ -39,14 +39,17 @@
 #include <ProfileSPDLinSOE.h>
 #include <math.h>
 #include <stdlib.h>
+#include <float.h>
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 //#include <Timer.h>
 
-ProfileSPDLinDirectSolver::ProfileSPDLinDirectSolver(double tol)
+ProfileSPDLinDirectSolver::ProfileSPDLinDirectSolver(double tol, bool mixed)
 :ProfileSPDLinSolver(SOLVER_TAGS_ProfileSPDLinDirectSolver),
- minDiagTol(tol), size(0), RowTop(0), topRowPtr(0), invD(0)
+ minDiagTol(tol), size(0), RowTop(0), topRowPtr(0), invD(0),
+ mixedPrecision(mixed), singleFactored(false), Af(0), invDf(0), R(0),
+ normA(0.0), sizeAf(0)
 {
 
 }
@@ -57,6 +60,9 @@ ProfileSPDLinDirectSolver::~ProfileSPDLinDirectSolver()
     if (RowTop != 0) delete [] RowTop;
     if (topRowPtr != 0) free((void *)topRowPtr);
     if (invD != 0) delete [] invD;
+    if (Af != 0) delete [] Af;
+    if (invDf != 0) delete [] invDf;
+    if (R != 0) delete [] R;
 }
 
 int
@@ -107,6 +113,28 @@ ProfileSPDLinDirectSolver::setSize(void)
 	topRowPtr[j] = &A[iDiagLoc[j-1]]; // FORTRAN array indexing in iDiagLoc
     }
 
+    // space for the single precision factor
+    if (mixedPrecision == true) {
+	int profileSize = iDiagLoc[size-1];
+	if (profileSize > sizeAf) {
+	    if (Af != 0) delete [] Af;
+	    Af = new float[profileSize];
+	    sizeAf = profileSize;
+	}
+	if (invDf != 0) delete [] invDf;
+	if (R != 0) delete [] R;
+	invDf = new float[size];
+	R = new double[size];
+
+	if (Af == 0 || invDf == 0 || R == 0) {
+	    opserr << "Warning :ProfileSPDLinDirectSolver::setSize() :";
+	    opserr << " ran out of memory for the single precision factor\n";
+	    sizeAf = 0;
+	    return -1;
+	}
+    }
+    singleFactored = false;
+
     size = theSOE->size;
     return 0;
 }
@@ -128,6 +156,19 @@ ProfileSPDLinDirectSolver::solve(void)
     if (theSOE->size == 0)
 	return 0;
 
+    // try the single precision factor first, if that fails A is still
+    // intact and is factored below
+    if (mixedPrecision == true) {
+	if (theSOE->isAfactored == false)
+	    singleFactored = (this->factorSingle() == 0);
+	if (singleFactored == true) {
+	    if (this->solveSingle() == 0)
+		return 0;
+	    singleFactored = false;
+	    theSOE->isAfactored = false;
+	}
+    }
+
     // set some pointers
     double *B = theSOE->B;
     double *X = theSOE->X;
@@ -303,6 +344,204 @@ ProfileSPDLinDirectSolver::solve(void)
     return 0;
 }
 
+// factorSingle: factors a single precision copy of A into U^t D U,
+// as solve() does for A itself, leaving A unchanged. returns -2 if a
+// diagonal term is not positive or A does not fit in single precision.
+
+int
+ProfileSPDLinDirectSolver::factorSingle(void)
+{
+    int theSize = theSOE->size;
+    double *A = theSOE->A;
+    int *iDiagLoc = theSOE->iDiagLoc;
+    int profileSize = iDiagLoc[theSize-1];
+
+    for (int k=0; k<profileSize; k++) {
+	double aij = A[k];
+	if (!(fabs(aij) < FLT_MAX))
+	    return -2;
+	Af[k] = (float)aij;
+    }
+
+    // infinity norm of A, used in the convergence test of the refinement
+    for (int i=0; i<theSize; i++)
+	R[i] = 0.0;
+    for (int i=0; i<theSize; i++) {
+	double *ajiPtr = topRowPtr[i];
+	for (int j=RowTop[i]; j<i; j++) {
+	    double aji = fabs(*ajiPtr++);
+	    R[j] += aji;
+	    R[i] += aji;
+	}
+	R[i] += fabs(*ajiPtr);
+    }
+    normA = 0.0;
+    for (int i=0; i<theSize; i++)
+	if (R[i] > normA)
+	    normA = R[i];
+
+    if (!(Af[0] > minDiagTol))
+	return -2;
+    invDf[0] = 1.0f/Af[0];
+
+    // for every col across
+    for (int i=1; i<theSize; i++) {
+
+	int rowitop = RowTop[i];
+	float *aiTop = Af + (topRowPtr[i] - A);
+	float *ajiPtr = aiTop;
+
+	for (int j=rowitop; j<i; j++) {
+	    float tmp = *ajiPtr;
+	    int rowjtop = RowTop[j];
+	    float *akjPtr, *akiPtr;
+	    int k;
+
+	    if (rowitop > rowjtop) {
+		akjPtr = Af + (topRowPtr[j] - A) + (rowitop-rowjtop);
+		akiPtr = aiTop;
+		k = rowitop;
+	    } else {
+		akjPtr = Af + (topRowPtr[j] - A);
+		akiPtr = aiTop + (rowjtop-rowitop);
+		k = rowjtop;
+	    }
+
+	    for ( ; k<j; k++)
+		tmp -= *akjPtr++ * *akiPtr++ ;
+
+	    *ajiPtr++ = tmp;
+	}
+
+	// now form i'th col of [U] and determine [dii]
+	float aii = Af[iDiagLoc[i] -1]; // FORTRAN ARRAY INDEXING
+	ajiPtr = aiTop;
+	for (int jj=rowitop; jj<i; jj++) {
+	    float aji = *ajiPtr;
+	    float lij = aji * invDf[jj];
+	    *ajiPtr++ = lij;
+	    aii = aii - lij*aji;
+	}
+
+	if (!(aii > minDiagTol))
+	    return -2;
+
+	invDf[i] = 1.0f/aii;
+    }
+
+    // keep invD in step so getDeterminant() sees the current factor
+    for (int i=0; i<theSize; i++)
+	invD[i] = invDf[i];
+
+    theSOE->isAfactored = true;
+    theSOE->numInt = 0;
+
+    return 0;
+}
+
+
+// substituteSingle: overwrites x with the solution of the system
+// using the single precision factor.
+
+void
+ProfileSPDLinDirectSolver::substituteSingle(double *x)
+{
+    int theSize = theSOE->size;
+    double *A = theSOE->A;
+
+    // do forward substitution
+    for (int i=1; i<theSize; i++) {
+	int rowitop = RowTop[i];
+	float *ajiPtr = Af + (topRowPtr[i] - A);
+	double *bjPtr  = &x[rowitop];
+	double tmp = 0;
+
+	for (int j=rowitop; j<i; j++)
+	    tmp -= *ajiPtr++ * *bjPtr++;
+
+	x[i] += tmp;
+    }
+
+    // divide by diag term
+    for (int j=0; j<theSize; j++)
+	x[j] *= invDf[j];
+
+    // now do the back substitution
+    for (int k=(theSize-1); k>0; k--) {
+	int rowktop = RowTop[k];
+	double bk = x[k];
+	float *ajiPtr = Af + (topRowPtr[k] - A);
+
+	for (int j=rowktop; j<k; j++)
+	    x[j] -= *ajiPtr++ * bk;
+    }
+}
+
+
+// solveSingle: solves with the single precision factor and refines X
+// against A until the residual is at the level of double precision
+// roundoff, as in the LAPACK routine dsposv. returns -1 if the
+// residual fails to halve in an iteration or maxIter is reached.
+
+int
+ProfileSPDLinDirectSolver::solveSingle(void)
+{
+    static const int maxIter = 30;
+
+    int theSize = theSOE->size;
+    double *B = theSOE->B;
+    double *X = theSOE->X;
+    double tol = normA * DBL_EPSILON * sqrt((double)theSize);
+    double lastNorm = 0.0;
+
+    for (int i=0; i<theSize; i++)
+	X[i] = B[i];
+    this->substituteSingle(X);
+
+    for (int iter=0; iter<=maxIter; iter++) {
+
+	// R = B - A X
+	for (int i=0; i<theSize; i++)
+	    R[i] = B[i];
+	for (int i=0; i<theSize; i++) {
+	    double *ajiPtr = topRowPtr[i];
+	    double xi = X[i];
+	    double tmp = 0.0;
+	    for (int j=RowTop[i]; j<i; j++) {
+		double aji = *ajiPtr++;
+		R[j] -= aji * xi;
+		tmp += aji * X[j];
+	    }
+	    R[i] -= tmp + *ajiPtr * xi;
+	}
+
+	double normR = 0.0;
+	double normX = 0.0;
+	for (int i=0; i<theSize; i++) {
+	    double ri = fabs(R[i]);
+	    double xi = fabs(X[i]);
+	    if (!(ri <= DBL_MAX && xi <= DBL_MAX)) // inf or nan
+		return -1;
+	    if (ri > normR) normR = ri;
+	    if (xi > normX) normX = xi;
+	}
+
+	if (normR <= normX * tol)
+	    return 0;
+	if (iter == maxIter || (iter > 0 && normR > 0.5*lastNorm))
+	    return -1;
+	lastNorm = normR;
+
+	// X += A^-1 R
+	this->substituteSingle(R);
+	for (int i=0; i<theSize; i++)
+	    X[i] += R[i];
+    }
+
+    return -1;
+}
+
+
 double
 ProfileSPDLinDirectSolver::getDeterminant(void) 
 {
@@ -33,6 +33,12 @@
 // ProfileSPDLinDirectSolver. ProfileSPDLinDirectSolver is a subclass 
 // of LinearSOESOlver. It solves a ProfileSPDLinSOE object using
 // the LDL^t factorization.
+//
+// With the mixedPrecision option the factorization is done in single
+// precision on a copy of A, and the solution is brought to double
+// precision by iterative refinement against A, which is left intact.
+// If the single precision factorization breaks down or the refinement
+// stalls, A is factored in double precision as usual.
 
 // What: "@(#) ProfileSPDLinDirectSolver.h, revA"
 
@@ -45,7 +51,7 @@ class ProfileSPDLinSOE;
 class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
 {
   public:
-    ProfileSPDLinDirectSolver(double tol=1.0e-12);    
+    ProfileSPDLinDirectSolver(double tol=1.0e-12, bool mixedPrecision=false);    
     virtual ~ProfileSPDLinDirectSolver();
 
     virtual int solve(void);        
@@ -66,6 +72,16 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     double **topRowPtr, *invD;
     
   private:
+    int factorSingle(void);
+    int solveSingle(void);
+    void substituteSingle(double *x);
+
+    bool mixedPrecision;  // factor in single precision and refine
+    bool singleFactored;  // true if the current factor is the single one
+    float *Af, *invDf;    // single precision factor
+    double *R;            // residual
+    double normA;         // infinity norm of A
+    int sizeAf;
 
 };
 
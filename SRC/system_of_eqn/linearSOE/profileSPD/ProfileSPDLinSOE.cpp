@@ -453,6 +453,13 @@ ProfileSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
     return 0;
 }
 
+bool
+ProfileSPDLinSOE::canAddConcurrently(void)
+{
+    // addA() and addB() only write the entries of the equations in the ID
+    return true;
+}
+
 
 int
 ProfileSPDLinSOE::setB(const Vector &v, double fact)
@@ -56,6 +56,7 @@ class ProfileSPDLinSOE : public LinearSOE
 
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);
+    virtual bool canAddConcurrently(void);
     
     virtual void zeroA(void);
     virtual void zeroB(void);
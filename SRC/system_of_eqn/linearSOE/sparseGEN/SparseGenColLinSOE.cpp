@@ -168,13 +168,20 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
-    // fist itearte through the vertices of the graph to get nnz
+    // fist itearte through the vertices of the graph to get nnz, unless
+    // the graph holds its edges in compressed rows
     Vertex *theVertex;
     int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
+    const int *graphRowStart = theGraph.getCSR_RowStart();
+    const int *graphAdjacency = theGraph.getCSR_Adjacency();
+    if (graphRowStart != 0 && graphAdjacency != 0)
+      newNNZ = graphRowStart[size] + size; // the +size is for the diag entries
+    else {
+      VertexIter &theVertices = theGraph.getVertices();
+      while ((theVertex = theVertices()) != 0) {
 	const ID &theAdjacency = theVertex->getAdjacency();
 	newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+      }
     }
     nnz = newNNZ;
 
@@ -245,8 +252,23 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	vectB = new Vector(B,size);	
     }
 
-    // fill in colStartA and rowA
-    if (size != 0) {
+    // fill in colStartA and rowA; the rows of a graph held in compressed
+    // rows are already sorted, only the diag has to be placed
+    if (size != 0 && graphRowStart != 0 && graphAdjacency != 0) {
+      colStartA[0] = 0;
+      int lastLoc = 0;
+      for (int a=0; a<size; a++) {
+	int j = graphRowStart[a];
+	int end = graphRowStart[a+1];
+	while (j < end && graphAdjacency[j] < a)
+	  rowA[lastLoc++] = graphAdjacency[j++];
+	rowA[lastLoc++] = a;
+	while (j < end)
+	  rowA[lastLoc++] = graphAdjacency[j++];
+	colStartA[a+1] = lastLoc;
+      }
+    }
+    else if (size != 0) {
       colStartA[0] = 0;
       int startLoc = 0;
       int lastLoc = 0;
@@ -292,6 +314,9 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     }
 
     
+    // find the location in A of the entries of each FE_Element matrix
+    theScatterMap.setSize(theModel, size, colStartA, rowA, true);
+
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -319,6 +344,18 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	opserr << " - Matrix and ID not of similar sizes\n";
 	return -1;
     }
+
+    // if the ID is that of an FE_Element use the locations found in setSize()
+    const int *theLocations = theScatterMap.getLocations(id);
+    if (theLocations != 0) {
+      for (int j=0; j<idSize; j++)
+	for (int i=0; i<idSize; i++) {
+	  int loc = *theLocations++;
+	  if (loc >= 0)
+	    A[loc] += fact * m(i,j);
+	}
+      return 0;
+    }
     
     if (fact == 1.0) { // do not need to multiply 
       for (int i=0; i<idSize; i++) {
@@ -400,6 +437,13 @@ SparseGenColLinSOE::addB(const Vector &v, const ID &id, double fact)
     return 0;
 }
 
+bool
+SparseGenColLinSOE::canAddConcurrently(void)
+{
+    // addA() and addB() only write the entries of the equations in the ID
+    return true;
+}
+
 
 int
 SparseGenColLinSOE::setB(const Vector &v, double fact)
@@ -526,3 +570,12 @@ SparseGenColLinSOE::recvSelf(int cTag, Channel &theChannel,
     return 0;
 }
 
+
+void
+SparseGenColLinSOE::Print(OPS_Stream &s, int flag)
+{
+    s << "SparseGenColLinSOE: size: " << size << " nnz: " << nnz;
+    s << " memory for A: " << nnz*(sizeof(double)+sizeof(int))/1024.0 << " kbytes\n";
+    s << "  scatter map: " << theScatterMap.getNumFE_Eles() << " FE_Elements, ";
+    s << theScatterMap.getMemory()/1024.0 << " kbytes\n";
+}
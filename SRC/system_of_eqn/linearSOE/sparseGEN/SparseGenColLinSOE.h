@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 
 class SparseGenColLinSolver;
 
@@ -58,6 +59,7 @@ class SparseGenColLinSOE : public LinearSOE
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
+    virtual bool canAddConcurrently(void);
     
     virtual void zeroA(void);
     virtual void zeroB(void);
@@ -72,6 +74,8 @@ class SparseGenColLinSOE : public LinearSOE
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+
+    virtual void Print(OPS_Stream &s, int flag = 0);
 #ifdef _PARALLEL_PROCESSING
     friend class SuperLU;    
     friend class ThreadedSuperLU;        
@@ -96,6 +100,7 @@ class SparseGenColLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    SparseScatterMap theScatterMap; // locations in A of the FE_Element entries
     
   private:
 
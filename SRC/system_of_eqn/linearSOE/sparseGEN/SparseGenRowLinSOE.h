@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 
 class SparseGenRowLinSolver;
 
@@ -67,6 +68,8 @@ class SparseGenRowLinSOE : public LinearSOE
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+
+    void Print(OPS_Stream &s, int flag = 0);
     friend class PetscSparseSeqSolver;    
     friend class CulaSparseSolverS4;    
     friend class CulaSparseSolverS5;    
@@ -83,6 +86,7 @@ class SparseGenRowLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    SparseScatterMap theScatterMap; // locations in A of the FE_Element entries
 };
 
 
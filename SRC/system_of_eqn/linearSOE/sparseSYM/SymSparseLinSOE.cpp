@@ -236,6 +236,15 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
     nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
 
+    // invoke setSize() on the Solver, which sets up the elimination tree
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:SymSparseLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
     return result;
 }
 
@@ -19,6 +19,7 @@
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <ThreadPool.h>
 
 extern "C" {
   #include "FeStructs.h"
@@ -28,7 +29,7 @@ extern "C" {
 
 SymSparseLinSolver::SymSparseLinSolver()
 :LinearSOESolver(SOLVER_TAGS_SymSparseLinSolver),
- theSOE(0)
+ theSOE(0), sizeBlks(0), blkParent(0), blkNumChildren(0), blkFirst(0)
 {
     // nothing to do.
 }
@@ -36,13 +37,18 @@ SymSparseLinSolver::SymSparseLinSolver()
 
 SymSparseLinSolver::~SymSparseLinSolver()
 { 
-    // nothing to do.
+    if (blkParent != 0) delete [] blkParent;
+    if (blkNumChildren != 0) delete [] blkNumChildren;
+    if (blkFirst != 0) delete [] blkFirst;
 }
 
 
 extern "C" int pfsfct(int neqns, double *diag, double **penv, int nblks, int *xblk,
 		      OFFDBLK **begblk, OFFDBLK *first, int *rowblks);
 
+extern "C" int pfblkfct(int blk, double *diag, double **penv, int *xblk,
+			OFFDBLK **begblk, OFFDBLK **pjs, int *rowblks);
+
 extern "C" void pfsslv(int neqns, double *diag, double **penv, int nblks,
 		       int *xblk, double *rhs, OFFDBLK **begblk);
 
@@ -83,7 +89,10 @@ SymSparseLinSolver::solve(void)
         //factor the matrix
         //call the "C" function to do the numerical factorization.
         int factor;
-	factor = pfsfct(neq, diag, penv, nblks, xblk, begblk, first, rowblks);
+	if (ThreadPool::getThreadPool() != 0 && nblks > 1 && sizeBlks == nblks)
+	    factor = this->factorBlocks();
+	else
+	    factor = pfsfct(neq, diag, penv, nblks, xblk, begblk, first, rowblks);
 	if (factor > 0) {
 	    opserr << "In SymSparseLinSolver: error in factorization.\n";
 	    return -1;
@@ -122,11 +131,204 @@ SymSparseLinSolver::solve(void)
 int
 SymSparseLinSolver::setSize()
 {
-    // nothing to do
+    if (theSOE == 0) {
+	opserr << "WARNING SymSparseLinSolver::setSize(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int nblks = theSOE->nblks;
+    int neq = theSOE->size;
+    int *xblk = theSOE->xblk;
+    int *rowblks = theSOE->rowblks;
+    OFFDBLK **begblk = theSOE->begblk;
+
+    if (nblks > sizeBlks) {
+	if (blkParent != 0) delete [] blkParent;
+	if (blkNumChildren != 0) delete [] blkNumChildren;
+	if (blkFirst != 0) delete [] blkFirst;
+
+	blkParent = new int[nblks];
+	blkNumChildren = new int[nblks];
+	blkFirst = new OFFDBLK *[nblks];
+
+	if (blkParent == 0 || blkNumChildren == 0 || blkFirst == 0) {
+	    opserr << "WARNING SymSparseLinSolver::setSize() :";
+	    opserr << " ran out of memory for the elimination tree\n";
+	    sizeBlks = 0;
+	    return -1;
+	}
+    }
+    sizeBlks = nblks;
+
+    // the parent of a block is the block holding the first row segment
+    // under it; the row segments of the block rows start where the
+    // segments of the rows of the previous block end.
+    OFFDBLK *js = theSOE->first;
+    for (int blk=0; blk<nblks; blk++)
+	blkNumChildren[blk] = 0;
+
+    for (int blk=0; blk<nblks; blk++) {
+	OFFDBLK *ks = begblk[blk];
+	if (ks->row < neq) {
+	    blkParent[blk] = rowblks[ks->row];
+	    blkNumChildren[blkParent[blk]]++;
+	} else
+	    blkParent[blk] = -1;
+
+	while (js->row < xblk[blk])
+	    js = js->next;
+	blkFirst[blk] = js;
+    }
+
     return 0;
 }
 
 
+// SymSparseLinSolverFactorTask: each thread of the pool repeatedly takes
+// a block whose children have all been factored off the ready stack,
+// factors it, and pushes its parent once the last of the parent's
+// children is done. Each block does the same operations in the same
+// order as in pfsfct(), so the factor does not depend on the number of
+// threads.
+
+class SymSparseLinSolverFactorTask : public ThreadTask
+{
+  public:
+    SymSparseLinSolverFactorTask(int nblks, double *diag, double **penv,
+				 int *xblk, int *rowblks, OFFDBLK **begblk,
+				 int *blkParent, int *blkNumChildren,
+				 OFFDBLK **blkFirst);
+    ~SymSparseLinSolverFactorTask();
+
+    int execute(int start, int end, int threadID);
+
+    int getResult(void) {return result;};
+
+  private:
+    int nblks;
+    double *diag;
+    double **penv;
+    int *xblk;
+    int *rowblks;
+    OFFDBLK **begblk;
+    int *blkParent;
+    OFFDBLK **blkFirst;
+
+    int *numLeft;         // children of each block still to be factored
+    int *readyBlks;       // stack of blocks that can be factored
+    int numReady;
+    int numDone;
+    int result;
+
+#ifndef _WIN32
+    pthread_mutex_t theMutex;
+    pthread_cond_t readyCond;
+#endif
+};
+
+SymSparseLinSolverFactorTask::SymSparseLinSolverFactorTask(int numBlks,
+							   double *theDiag,
+							   double **thePenv,
+							   int *theXblk,
+							   int *theRowblks,
+							   OFFDBLK **theBegblk,
+							   int *parent,
+							   int *numChildren,
+							   OFFDBLK **first)
+  :nblks(numBlks), diag(theDiag), penv(thePenv), xblk(theXblk),
+   rowblks(theRowblks), begblk(theBegblk),
+   blkParent(parent), blkFirst(first),
+   numLeft(0), readyBlks(0), numReady(0), numDone(0), result(0)
+{
+    numLeft = new int[nblks];
+    readyBlks = new int[nblks];
+
+    // leaves go on the stack last to first, so the first is taken first
+    for (int blk=nblks-1; blk>=0; blk--) {
+	numLeft[blk] = numChildren[blk];
+	if (numLeft[blk] == 0)
+	    readyBlks[numReady++] = blk;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_init(&theMutex, 0);
+    pthread_cond_init(&readyCond, 0);
+#endif
+}
+
+SymSparseLinSolverFactorTask::~SymSparseLinSolverFactorTask()
+{
+#ifndef _WIN32
+    pthread_cond_destroy(&readyCond);
+    pthread_mutex_destroy(&theMutex);
+#endif
+    delete [] numLeft;
+    delete [] readyBlks;
+}
+
+int
+SymSparseLinSolverFactorTask::execute(int start, int end, int threadID)
+{
+#ifndef _WIN32
+    pthread_mutex_lock(&theMutex);
+    while (true) {
+	while (numReady == 0 && numDone < nblks && result == 0)
+	    pthread_cond_wait(&readyCond, &theMutex);
+	if (numDone == nblks || result != 0)
+	    break;
+
+	int blk = readyBlks[--numReady];
+	pthread_mutex_unlock(&theMutex);
+
+	OFFDBLK *js = blkFirst[blk];
+	int factor = pfblkfct(blk, diag, penv, xblk, begblk, &js, rowblks);
+
+	pthread_mutex_lock(&theMutex);
+	numDone++;
+	if (factor != 0) {
+	    if (result == 0)
+		result = factor;
+	    pthread_cond_broadcast(&readyCond);
+	} else {
+	    int parent = blkParent[blk];
+	    if (parent >= 0 && --numLeft[parent] == 0) {
+		readyBlks[numReady++] = parent;
+		pthread_cond_signal(&readyCond);
+	    }
+	    if (numDone == nblks)
+		pthread_cond_broadcast(&readyCond);
+	}
+    }
+    pthread_mutex_unlock(&theMutex);
+#else
+    // the pool is never threaded here; factor the blocks in order
+    for (int blk=0; blk<nblks && result == 0; blk++) {
+	OFFDBLK *js = blkFirst[blk];
+	result = pfblkfct(blk, diag, penv, xblk, begblk, &js, rowblks);
+    }
+#endif
+
+    return 0;
+}
+
+
+int
+SymSparseLinSolver::factorBlocks(void)
+{
+    ThreadPool *thePool = ThreadPool::getThreadPool();
+    SymSparseLinSolverFactorTask theTask(sizeBlks, theSOE->diag, theSOE->penv,
+					 theSOE->xblk, theSOE->rowblks,
+					 theSOE->begblk, blkParent,
+					 blkNumChildren, blkFirst);
+
+    // one item per thread; the threads share the blocks among themselves
+    thePool->run(theTask, thePool->getNumThreads());
+
+    return theTask.getResult();
+}
+
+
 int
 SymSparseLinSolver::setLinearSOE(SymSparseLinSOE &theLinearSOE)
 {
@@ -11,6 +11,13 @@
 // some "C" functions. The solver used here is generalized sparse
 // solver. The user can choose three different ordering schema.
 //
+// The symbolic factorization done by the SymSparseLinSOE in setSize()
+// is kept for every numerical factorization until the structure of A
+// changes. When a ThreadPool is in use the blocks of the factor are
+// factored concurrently: setSize() builds the block elimination tree,
+// and a block is handed to the next free thread as soon as all its
+// children in the tree have been factored.
+//
 // What: "@(#) SymSparseLinSolver.h, revA"
 
 
@@ -19,6 +26,10 @@
 
 #include <LinearSOESolver.h>
 
+extern "C" {
+  #include <FeStructs.h>
+}
+
 
 class SymSparseLinSOE;
 
@@ -40,8 +51,14 @@ class SymSparseLinSolver : public LinearSOESolver
   protected:
 
   private:
+    int factorBlocks(void);
 
     SymSparseLinSOE *theSOE;
+
+    int sizeBlks;         // size of the block arrays
+    int *blkParent;       // parent of each block in the elimination tree, -1 for a root
+    int *blkNumChildren;  // number of children of each block
+    OFFDBLK **blkFirst;   // first row segment in the rows of each block
     
 };
 
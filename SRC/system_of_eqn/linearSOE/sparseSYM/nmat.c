@@ -63,104 +63,145 @@ int pfsfct(int neqns, double *diag, double **penv, int nblks,
 /*************************************************************** 
  ***************************************************************/
 {  
-   int blk, nextblk, jbeg, iflag ;
-   int iband, blkbeg, blkend, blksze ;
-   int jrow, krow ;
-   int jblk, jb, kb, pos ;
-   OFFDBLK *marker, *ks, *js, *ls ;
-   double *work;
-   int ii;
+   int blk, iflag ;
+   OFFDBLK *js ;
    
    if  ( neqns <= 0 )  return(0) ;
-   marker = begblk[0];
 
-   marker = first;
-   js = marker;
+   js = first;
 /* ----------------------------------------------------------
    for each block blk, do ...
    ----------------------------------------------------------*/
    for (blk = 0; blk < nblks; blk++)
    {  
-      nextblk = blk + 1 ;
-      blkbeg = xblk[blk] ;
-      blkend = xblk[nextblk]  ;
-      blksze = blkend - blkbeg ;
-/*    --------------------------------------------------------
-      update rows from row segments
-      The function Dotrows();
-      -------------------------------------------------------*/
-      while( js->row < blkend)
-      {
-	 jrow = js->row;
-	 jbeg = js->beg;
+      iflag = pfblkfct(blk, diag, penv, xblk, begblk, &js, rowblks) ;
+      if (iflag) return(iflag);
+   }
+
+   return(0) ;
+}
+
+/***************************************************************
+ ******    pfblkfct ..... factor one block of the matrix  ******
+ ***************************************************************
+ 
+   purpose - this routine performs the work of pfsfct on a single
+        block blk. it only reads the blocks of the subtree rooted
+        at blk in the block elimination tree, and only writes the
+        rows of blk and the row segments under blk, so that blocks
+        lying in disjoint subtrees may be factored concurrently
+        once all their descendants have been factored.
+ 
+   input parameters -
+        blk   - the block to be factored.
+        (xblk) - partitioning blocks
+        rowblks - the block of each row.
+   updated parameters -
+        diag, penv, begblk - as for pfsfct.
+        pjs   - on input, the first row segment in the row ordered
+                list whose row lies in blk; on return, the first
+                row segment of the next block.
+   return value -
+        0 on success, 1 if a zero diagonal is found while updating
+        from the row segments, blk+1 if the envelope factorization
+        of the diagonal block fails.
+
+ ***************************************************************/
+int pfblkfct(int blk, double *diag, double **penv, int *xblk,
+	     OFFDBLK **begblk, OFFDBLK **pjs, int *rowblks)
+/*************************************************************** 
+ ***************************************************************/
+{  
+   int nextblk, jbeg, iflag ;
+   int iband, blkbeg, blkend, blksze ;
+   int jrow, krow ;
+   int jblk, jb, kb, pos ;
+   OFFDBLK *ks, *js, *ls ;
+   double *work;
+   int ii;
+   
+   js = *pjs;
+   nextblk = blk + 1 ;
+   blkbeg = xblk[blk] ;
+   blkend = xblk[nextblk]  ;
+   blksze = blkend - blkbeg ;
+/* --------------------------------------------------------
+   update rows from row segments
+   The function Dotrows();
+   -------------------------------------------------------*/
+   while( js->row < blkend)
+   {
+      jrow = js->row;
+      jbeg = js->beg;
  
-	 jblk = rowblks[jbeg];
-         ls = begblk[blk] ;
-         ks = js->bnext ;
-/*    -------------------------------------------------------
-      update the diagonals from the off diagonal row segments
-      ------------------------------------------------------*/
+      jblk = rowblks[jbeg];
+      ls = begblk[blk] ;
+      ks = js->bnext ;
+/* -------------------------------------------------------
+   update the diagonals from the off diagonal row segments
+   ------------------------------------------------------*/
 	 
-	 iband = xblk[jblk+1] - jbeg;
-	 work = (double*) calloc(iband, sizeof(double)); 
-	 for (ii = 0; ii < iband; ii++) {
-	     work[ii] = js->nz[ii];
-	     js->nz[ii] /= diag[ii + jbeg]; 	    
-	 }
-	 diag[jrow] -= dot_real(js->nz, work, iband);
-	 if (diag[jrow] == 0) {
-	     printf("!!!pfsfct(): The diagonal entry %d is zero !!!\n", jrow);
-	     return (1);
-	 }
-	 free (work);
+      iband = xblk[jblk+1] - jbeg;
+      work = (double*) calloc(iband, sizeof(double)); 
+      for (ii = 0; ii < iband; ii++) {
+	  work[ii] = js->nz[ii];
+	  js->nz[ii] /= diag[ii + jbeg]; 	    
+      }
+      diag[jrow] -= dot_real(js->nz, work, iband);
+      free (work);
+      if (diag[jrow] == 0) {
+	  printf("!!!pfsfct(): The diagonal entry %d is zero !!!\n", jrow);
+	  *pjs = js;
+	  return (1);
+      }
 	 
-	 if (ks->row < blkend )
-	 {  /* part of envelop block*/
-	    for ( ; ks->row < blkend ; ks = ks->bnext)
-	    {
-	       krow = ks->row ;
-	       pos = MAX(jbeg, ks->beg) ;
-	       iband = xblk[jblk+1] - pos;
-	       jb = pos - jbeg ;
-	       kb = pos - ks->beg ;
-	       pos = jrow - krow + (penv[krow + 1] - penv[krow]) ;
-	       *(penv[krow] + pos) -= 
-		   dot_real(js->nz+jb, ks->nz+kb, iband);
-            }
-         }
-	 for ( ; ks->beg < blkend ; ks = ks->bnext)
+      if (ks->row < blkend )
+      {  /* part of envelop block*/
+	 for ( ; ks->row < blkend ; ks = ks->bnext)
 	 {
 	    krow = ks->row ;
-	    pos = MAX(jbeg, ks->beg);
+	    pos = MAX(jbeg, ks->beg) ;
 	    iband = xblk[jblk+1] - pos;
 	    jb = pos - jbeg ;
 	    kb = pos - ks->beg ;
-	    /* part of another row segment */
-	    while ( ls->row != krow) ls = ls->bnext ;
-	    pos = jrow - ls->beg ;
-	    ls->nz[pos] -= 
-	        dot_real(js->nz+jb, ks->nz+kb, iband) ;
+	    pos = jrow - krow + (penv[krow + 1] - penv[krow]) ;
+	    *(penv[krow] + pos) -= 
+		dot_real(js->nz+jb, ks->nz+kb, iband);
          }
-
-	 js = js->next ;
       }
-/*    -------------------------------------------------------
-      perform envelope fct on diag block blk.
-      -------------------------------------------------------
+      for ( ; ks->beg < blkend ; ks = ks->bnext)
+      {
+	 krow = ks->row ;
+	 pos = MAX(jbeg, ks->beg);
+	 iband = xblk[jblk+1] - pos;
+	 jb = pos - jbeg ;
+	 kb = pos - ks->beg ;
+	 /* part of another row segment */
+	 while ( ls->row != krow) ls = ls->bnext ;
+	 pos = jrow - ls->beg ;
+	 ls->nz[pos] -= 
+	     dot_real(js->nz+jb, ks->nz+kb, iband) ;
+      }
+
+      js = js->next ;
+   }
+   *pjs = js;
+/* -------------------------------------------------------
+   perform envelope fct on diag block blk.
+   -------------------------------------------------------
 */
-      iflag = pfefct(blksze, penv+blkbeg, diag+ blkbeg) ;
-      if (iflag) return(nextblk);
+   iflag = pfefct(blksze, penv+blkbeg, diag+ blkbeg) ;
+   if (iflag) return(nextblk);
 
-/*    -------------------------------------------------------
-      for each row "node" in this block, do
-         update row segments under block blk with a backsolve
-      -------------------------------------------------------
+/* -------------------------------------------------------
+   for each row "node" in this block, do
+      update row segments under block blk with a backsolve
+   -------------------------------------------------------
 */
-      for (ks = begblk[blk]; ks->beg < blkend ; ks = ks->bnext )
-      {  jbeg = ks->beg ;
-         iband = blkend - jbeg ;
-         pflslv(iband, (penv + jbeg), (diag + jbeg), ks->nz);
-      }
+   for (ks = begblk[blk]; ks->beg < blkend ; ks = ks->bnext )
+   {  jbeg = ks->beg ;
+      iband = blkend - jbeg ;
+      pflslv(iband, (penv + jbeg), (diag + jbeg), ks->nz);
    }
 
    return(0) ;
@@ -97,13 +97,20 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
-    // fist itearte through the vertices of the graph to get nnz
+    // fist itearte through the vertices of the graph to get nnz, unless
+    // the graph holds its edges in compressed rows
     Vertex *theVertex;
     int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
+    const int *graphRowStart = theGraph.getCSR_RowStart();
+    const int *graphAdjacency = theGraph.getCSR_Adjacency();
+    if (graphRowStart != 0 && graphAdjacency != 0)
+      newNNZ = graphRowStart[size] + size; // the +size is for the diag entries
+    else {
+      VertexIter &theVertices = theGraph.getVertices();
+      while ((theVertex = theVertices()) != 0) {
 	const ID &theAdjacency = theVertex->getAdjacency();
 	newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+      }
     }
     nnz = newNNZ;
 
@@ -183,8 +190,23 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	vectB = new Vector(B,size);	
     }
 
-    // fill in rowStartA and colA
-    if (size != 0) {
+    // fill in rowStartA and colA; the rows of a graph held in compressed
+    // rows are already sorted, only the diag has to be placed
+    if (size != 0 && graphRowStart != 0 && graphAdjacency != 0) {
+      rowStartA[0] = 0;
+      int lastLoc = 0;
+      for (int a=0; a<size; a++) {
+	int j = graphRowStart[a];
+	int end = graphRowStart[a+1];
+	while (j < end && graphAdjacency[j] < a)
+	  colA[lastLoc++] = graphAdjacency[j++];
+	colA[lastLoc++] = a;
+	while (j < end)
+	  colA[lastLoc++] = graphAdjacency[j++];
+	rowStartA[a+1] = lastLoc;
+      }
+    }
+    else if (size != 0) {
       rowStartA[0] = 0;
       int startLoc = 0;
       int lastLoc = 0;
@@ -244,6 +266,9 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
       }
     }
 
+    // find the location in A of the entries of each FE_Element matrix
+    theScatterMap.setSize(theModel, size, rowStartA, colA, false);
+
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -273,6 +298,18 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	opserr << " - Matrix and ID not of similar sizes\n";
 	return -1;
     }
+
+    // if the ID is that of an FE_Element use the locations found in setSize()
+    const int *theLocations = theScatterMap.getLocations(id);
+    if (theLocations != 0) {
+      for (int j=0; j<idSize; j++)
+	for (int i=0; i<idSize; i++) {
+	  int loc = *theLocations++;
+	  if (loc >= 0)
+	    A[loc] += fact * m(i,j);
+	}
+      return 0;
+    }
     
     if (fact == 1.0) { // do not need to multiply 
 	for (int i=0; i<idSize; i++) {
@@ -410,6 +447,13 @@ UmfpackGenLinSOE::addB(const Vector &v, const ID &id, double fact)
     return 0;
 }
 
+bool
+UmfpackGenLinSOE::canAddConcurrently(void)
+{
+    // addA() and addB() only write the entries of the equations in the ID
+    return true;
+}
+
 
 int
 UmfpackGenLinSOE::setB(const Vector &v, double fact)
@@ -560,3 +604,12 @@ UmfpackGenLinSOE::recvSelf(int cTag, Channel &theChannel,
   return 0;
 }
 
+
+void
+UmfpackGenLinSOE::Print(OPS_Stream &s, int flag)
+{
+    s << "UmfpackGenLinSOE: size: " << size << " nnz: " << nnz;
+    s << " memory for A: " << nnz*(sizeof(double)+sizeof(int))/1024.0 << " kbytes\n";
+    s << "  scatter map: " << theScatterMap.getNumFE_Eles() << " FE_Elements, ";
+    s << theScatterMap.getMemory()/1024.0 << " kbytes\n";
+}
@@ -37,6 +37,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 
 class UmfpackGenLinSolver;
 
@@ -59,6 +60,7 @@ class UmfpackGenLinSOE : public LinearSOE
     int addColA(const Vector &colData, int row, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);        
+    bool canAddConcurrently(void);
     
     void zeroA(void);
     void zeroB(void);
@@ -75,6 +77,8 @@ class UmfpackGenLinSOE : public LinearSOE
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker); 
 
+    void Print(OPS_Stream &s, int flag = 0);
+
     friend class UmfpackGenLinSolver;
 
   protected:
@@ -90,6 +94,7 @@ class UmfpackGenLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    SparseScatterMap theScatterMap; // locations in A of the FE_Element entries
     int factLVALUE;
 	int factorOnce;
 	int printSolveTime;
@@ -77,6 +77,7 @@ OPS_Stream *opserrPtr = &sserr;
 #include <FEM_ObjectBrokerAllClasses.h>
 
 #include <Timer.h>
+#include <ThreadPool.h>
 #include <ModelBuilder.h>
 #include "commands.h"
 
@@ -210,6 +211,7 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #include <StaticAnalysis.h>
 #include <DirectIntegrationAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
+#include <ExplicitDynamicAnalysis.h>
 #include <PFEMAnalysis.h>
 
 // system of eqn and solvers
@@ -220,6 +222,11 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #include <BandGenLinLapackSolver.h>
 
 #include <ConjugateGradientSolver.h>
+#include <PCGLinSOE.h>
+#include <PCGLinSolver.h>
+#include <JacobiPreconditioner.h>
+#include <IncompleteCholeskyPreconditioner.h>
+#include <AMG_Preconditioner.h>
 
 #ifdef _ITPACK
 //#include <ItpackLinSOE.h>
@@ -323,6 +330,10 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #endif
 
 #include <FE_Datastore.h>
+#include <SnapshotStack.h>
+#include <IDA_BatchDriver.h>
+
+extern TimeSeries *TclSeriesCommand(ClientData clientData, Tcl_Interp *interp, TCL_Char *arg);
 
 #ifdef _RELIABILITY
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
@@ -373,8 +384,10 @@ ModelBuilder *theBuilder =0;
 
 #include <DistributedDisplacementControl.h>
 #include <ShadowSubdomain.h>
+#include <ThreadedSubdomain.h>
 #include <Metis.h>
 #include <ShedHeaviest.h>
+#include <RepartitionImbalanced.h>
 #include <DomainPartitioner.h>
 #include <GraphPartitioner.h>
 #include <FEM_ObjectBrokerAllClasses.h>
@@ -406,12 +419,15 @@ PartitionedDomain theDomain;
 int OPS_PARALLEL_PROCESSING =0;
 int OPS_NUM_SUBDOMAINS      =0;
 bool OPS_PARTITIONED        =false;
+bool OPS_THREADED_SUBDOMAINS =false;
 bool OPS_USING_MAIN_DOMAIN  = false;
 int OPS_MAIN_DOMAIN_PARTITION_ID =0;
 
 DomainPartitioner *OPS_DOMAIN_PARTITIONER =0;
 GraphPartitioner  *OPS_GRAPH_PARTITIONER =0;
 LoadBalancer      *OPS_BALANCER = 0;
+double OPS_REBALANCE_THRESHOLD = 0.0;
+int OPS_REBALANCE_PERIOD = 10;
 FEM_ObjectBroker  *OPS_OBJECT_BROKER;
 MachineBroker     *OPS_MACHINE;
 Channel          **OPS_theChannels = 0;
@@ -497,6 +513,7 @@ static EigenSOE *theEigenSOE =0;
 static StaticAnalysis *theStaticAnalysis = 0;
 static DirectIntegrationAnalysis *theTransientAnalysis = 0;
 static VariableTimeStepDirectIntegrationAnalysis *theVariableTimeStepTransientAnalysis = 0;
+static ExplicitDynamicAnalysis *theExplicitAnalysis = 0;
 static int numEigen = 0;
 
 #ifdef _PFEM
@@ -550,6 +567,7 @@ char *neesCentralPasswd =0;
 
 FE_Datastore *theDatabase  =0;
 FEM_ObjectBrokerAllClasses theBroker;
+static SnapshotStack *theSnapshots = 0;
 
 // init the global variabled defined in OPS_Globals.h
 // double        ops_Dt = 1.0;
@@ -646,6 +664,9 @@ convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
 int
 maxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+setNumThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 
 // pointer for old putsCommand
 
@@ -806,6 +827,12 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
     Tcl_CreateCommand(interp, "reset", &resetModel,
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+    Tcl_CreateCommand(interp, "snapshot", &snapshotModel,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+    Tcl_CreateCommand(interp, "revertToSnapshot", &revertToSnapshot,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+    Tcl_CreateCommand(interp, "IDA", &runIDA,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
 	
     Tcl_CreateCommand(interp, "initialize", &initializeAnalysis,
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);        
@@ -1008,6 +1035,9 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     Tcl_CreateCommand(interp, "setMaxOpenFiles", &maxOpenFiles, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
 
+    Tcl_CreateCommand(interp, "threads", &setNumThreads, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
 #ifdef _RELIABILITY
     Tcl_CreateCommand(interp, "wipeReliability", wipeReliability, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL); 
@@ -1056,6 +1086,7 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     theStaticAnalysis =0;
     theTransientAnalysis =0;    
     theVariableTimeStepTransientAnalysis =0;    
+    theExplicitAnalysis =0;
     theTest = 0;
 
     // create an error handler
@@ -1308,9 +1339,19 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   // NOTE : DON'T do the above on theVariableTimeStepAnalysis
   // as it and theTansientAnalysis are one in the same
+  if (theExplicitAnalysis != 0) {
+      theExplicitAnalysis->clearAll();
+      delete theExplicitAnalysis;  
+  }
+
   if (theDatabase != 0)
     delete theDatabase;
 
+  if (theSnapshots != 0) {
+    delete theSnapshots;
+    theSnapshots = 0;
+  }
+
   theDomain.clearAll();
 
   ops_Dt = 0.0;
@@ -1339,6 +1380,7 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   theStaticAnalysis =0;
   theTransientAnalysis =0;    
   theVariableTimeStepTransientAnalysis =0;    
+  theExplicitAnalysis =0;
 
   theTest = 0;
   theDatabase = 0;
@@ -1380,6 +1422,11 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
       delete theTransientAnalysis;  
   }
 
+  if (theExplicitAnalysis != 0) {
+      theExplicitAnalysis->clearAll();
+      delete theExplicitAnalysis;  
+  }
+
   // NOTE : DON'T do the above on theVariableTimeStepAnalysis
   // as it and theTansientAnalysis are one in the same
 
@@ -1394,6 +1441,7 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   theStaticAnalysis =0;
   theTransientAnalysis =0;    
   theVariableTimeStepTransientAnalysis =0;    
+  theExplicitAnalysis =0;
 #ifdef _PFEM
   thePFEMAnalysis = 0;
 #endif
@@ -1424,11 +1472,212 @@ resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 	return TCL_OK;
 }
 
+// snapshot <-max numSnapshots?>
+//   keeps a copy of the last committed state of the model; returns the
+//   number of snapshots held
+int
+snapshotModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc > 1) {
+    int maxNum;
+    if (argc < 3 || strcmp(argv[1],"-max") != 0 || Tcl_GetInt(interp, argv[2], &maxNum) != TCL_OK) {
+      opserr << "WARNING want - snapshot <-max numSnapshots?>\n";
+      return TCL_ERROR;
+    }
+    if (theSnapshots != 0 && theSnapshots->getMaxNumSnapshots() != maxNum) {
+      delete theSnapshots;
+      theSnapshots = 0;
+    }
+    if (theSnapshots == 0)
+      theSnapshots = new SnapshotStack(theDomain, theBroker, maxNum);
+    return TCL_OK;
+  }
+
+  if (theSnapshots == 0)
+    theSnapshots = new SnapshotStack(theDomain, theBroker);
+
+  if (theSnapshots->push() < 0) {
+    opserr << "WARNING snapshot - failed to take snapshot of the model\n";
+    return TCL_ERROR;
+  }
+
+  char buffer[20];
+  sprintf(buffer, "%d", theSnapshots->getNumSnapshots());
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+// revertToSnapshot <numBack?>
+//   returns the model to the numBack'th most recent snapshot, default 1
+int
+revertToSnapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  int numBack = 1;
+  if (argc > 1 && Tcl_GetInt(interp, argv[1], &numBack) != TCL_OK) {
+    opserr << "WARNING want - revertToSnapshot <numBack?>\n";
+    return TCL_ERROR;
+  }
+
+  if (theSnapshots == 0 || theSnapshots->revert(numBack) < 0) {
+    opserr << "WARNING revertToSnapshot - failed to revert to snapshot " << numBack << endln;
+    return TCL_ERROR;
+  }
+
+  // the integrator keeps its own copy of the committed response
+  if (theTransientAnalysis != 0 && theTransientIntegrator != 0)
+    theTransientIntegrator->domainChanged();
+
+  return TCL_OK;
+}
+
+// IDA fileName -dir dir -dt dt -node nodeTag -dof dof -records {series ...}
+//     -scales {scale ...} <-collapse limit> <-freeVibration time>
+//     <-numProcesses n>
+//   runs the transient analysis for every record at every scale factor,
+//   from the current state of the model, and writes one line per case to
+//   fileName; returns the number of collapses
+int
+runIDA(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want - IDA fileName -dir dir -dt dt -node nodeTag -dof dof -records {series ...} -scales {scale ...}\n";
+    opserr << "                <-collapse limit> <-freeVibration time> <-numProcesses n>\n";
+    return TCL_ERROR;
+  }
+
+  if (theTransientAnalysis == 0) {
+    opserr << "WARNING IDA - no transient analysis has been defined\n";
+    return TCL_ERROR;
+  }
+
+  const char *fileName = argv[1];
+  int dir = 0;
+  int nodeTag = 0;
+  int dof = 0;
+  double dT = 0.0;
+  double collapseLimit = 0.0;
+  double freeVibrationTime = 0.0;
+  int numProcesses = 1;
+  TCL_Char *records = 0;
+  TCL_Char *scales = 0;
+
+  int loc = 2;
+  while (loc < argc) {
+    if (loc+1 >= argc) {
+      opserr << "WARNING IDA - no value given for " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+
+    if (strcmp(argv[loc],"-dir") == 0) {
+      if (Tcl_GetInt(interp, argv[loc+1], &dir) != TCL_OK || dir < 1) {
+	opserr << "WARNING IDA - invalid dir " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-dt") == 0) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &dT) != TCL_OK || dT <= 0.0) {
+	opserr << "WARNING IDA - invalid dt " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-node") == 0) {
+      if (Tcl_GetInt(interp, argv[loc+1], &nodeTag) != TCL_OK) {
+	opserr << "WARNING IDA - invalid node " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-dof") == 0) {
+      if (Tcl_GetInt(interp, argv[loc+1], &dof) != TCL_OK || dof < 1) {
+	opserr << "WARNING IDA - invalid dof " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-collapse") == 0) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &collapseLimit) != TCL_OK) {
+	opserr << "WARNING IDA - invalid collapse limit " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-freeVibration") == 0) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &freeVibrationTime) != TCL_OK) {
+	opserr << "WARNING IDA - invalid free vibration time " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-numProcesses") == 0) {
+      if (Tcl_GetInt(interp, argv[loc+1], &numProcesses) != TCL_OK || numProcesses < 1) {
+	opserr << "WARNING IDA - invalid numProcesses " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-records") == 0) {
+      records = argv[loc+1];
+    } else if (strcmp(argv[loc],"-scales") == 0) {
+      scales = argv[loc+1];
+    } else {
+      opserr << "WARNING IDA - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+    loc += 2;
+  }
+
+  if (dir == 0 || dT == 0.0 || nodeTag == 0 || dof == 0 || records == 0 || scales == 0) {
+    opserr << "WARNING IDA - -dir, -dt, -node, -dof, -records and -scales are all needed\n";
+    return TCL_ERROR;
+  }
+
+  IDA_BatchDriver theDriver(theDomain, *theTransientAnalysis, theBroker,
+			    dir-1, dT, nodeTag, dof-1);
+  theDriver.setCollapseLimit(collapseLimit);
+  theDriver.setFreeVibrationTime(freeVibrationTime);
+  theDriver.setNumProcesses(numProcesses);
+
+  int numItems;
+  TCL_Char **items;
+  if (Tcl_SplitList(interp, records, &numItems, &items) != TCL_OK) {
+    opserr << "WARNING IDA - could not split the list of records\n";
+    return TCL_ERROR;
+  }
+  for (int i=0; i<numItems; i++) {
+    TimeSeries *theSeries = TclSeriesCommand(clientData, interp, items[i]);
+    if (theSeries == 0) {
+      opserr << "WARNING IDA - invalid record " << items[i] << endln;
+      Tcl_Free((char *)items);
+      return TCL_ERROR;
+    }
+    theDriver.addRecord(theSeries);
+  }
+  Tcl_Free((char *)items);
+
+  if (Tcl_SplitList(interp, scales, &numItems, &items) != TCL_OK) {
+    opserr << "WARNING IDA - could not split the list of scale factors\n";
+    return TCL_ERROR;
+  }
+  Vector scaleFactors(numItems);
+  for (int i=0; i<numItems; i++) {
+    if (Tcl_GetDouble(interp, items[i], &scaleFactors(i)) != TCL_OK) {
+      opserr << "WARNING IDA - invalid scale factor " << items[i] << endln;
+      Tcl_Free((char *)items);
+      return TCL_ERROR;
+    }
+  }
+  Tcl_Free((char *)items);
+  theDriver.setScaleFactors(scaleFactors);
+
+  FileStream theOutput(fileName);
+  if (theDriver.run(theOutput) < 0) {
+    opserr << "WARNING IDA - the incremental dynamic analysis failed\n";
+    return TCL_ERROR;
+  }
+
+  char buffer[20];
+  sprintf(buffer, "%d", theDriver.getNumCollapses());
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
 int
 initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
   if (theTransientAnalysis != 0)
     theTransientAnalysis->initialize();
+  else if (theExplicitAnalysis != 0)
+    theExplicitAnalysis->initialize();
   else if (theStaticAnalysis != 0)
     theStaticAnalysis->initialize();
   
@@ -1559,7 +1808,12 @@ partitionModel(int eleTag)
   
   // create some subdomains
   for (int i=1; i<=OPS_NUM_SUBDOMAINS; i++) {
-    if (i != OPS_MAIN_DOMAIN_PARTITION_ID) {
+    if (OPS_THREADED_SUBDOMAINS == true) {
+      // subdomains in this process, worked on by the ThreadPool
+      ThreadedSubdomain *theSubdomain = new ThreadedSubdomain(i, *OPS_OBJECT_BROKER);
+      theDomain.addSubdomain(theSubdomain);
+      OPS_theChannels[i-1] = 0;
+    } else if (i != OPS_MAIN_DOMAIN_PARTITION_ID) {
       ShadowSubdomain *theSubdomain = new ShadowSubdomain(i, *OPS_MACHINE, *OPS_OBJECT_BROKER);
       theDomain.addSubdomain(theSubdomain);
       OPS_theChannels[i-1] = theSubdomain->getChannelPtr();
@@ -1571,7 +1825,12 @@ partitionModel(int eleTag)
     //      OPS_BALANCER = new ShedHeaviest();
     OPS_GRAPH_PARTITIONER  = new Metis;
     //OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
-    OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
+    if (OPS_REBALANCE_THRESHOLD > 0.0) {
+      // repartition on the measured element costs as the analysis proceeds
+      OPS_BALANCER = new RepartitionImbalanced(OPS_REBALANCE_THRESHOLD, OPS_REBALANCE_PERIOD);
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
+    } else
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
     theDomain.setPartitioner(OPS_DOMAIN_PARTITIONER);
   }
  // opserr << "commands.cpp - partition numPartitions: " << OPS_NUM_SUBDOMAINS << endln;
@@ -1625,13 +1884,57 @@ int
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
 #ifdef _PARALLEL_PROCESSING
-  int eleTag;
-  if (argc == 2) {
+  int eleTag = 0;
+  int count = 1;
+  if (argc > 1 && argv[1][0] != '-') {
     if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK) {
       ;
     }
+    count++;
+  }
+
+  // partition <eleTag> <-threads numSubdomains> <-rebalance threshold <period>>
+  while (count < argc) {
+    if (argc > count+1 && strcmp(argv[count],"-threads") == 0) {
+      int numSubdomains;
+      if (Tcl_GetInt(interp, argv[count+1], &numSubdomains) != TCL_OK || numSubdomains < 1) {
+	opserr << "WARNING partition <eleTag> -threads numSubdomains - invalid numSubdomains " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+      OPS_THREADED_SUBDOMAINS = true;
+      OPS_USING_MAIN_DOMAIN = false;
+      OPS_MAIN_DOMAIN_PARTITION_ID = 0;
+      OPS_NUM_SUBDOMAINS = numSubdomains;
+      count += 2;
+
+    } else if (argc > count+1 && strcmp(argv[count],"-rebalance") == 0) {
+      // repartition every period commits if the costliest subdomain
+      // exceeds the average cost by the factor threshold
+      double threshold;
+      if (Tcl_GetDouble(interp, argv[count+1], &threshold) != TCL_OK || threshold < 1.0) {
+	opserr << "WARNING partition <eleTag> -rebalance threshold <period> - invalid threshold " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+      OPS_REBALANCE_THRESHOLD = threshold;
+      count += 2;
+      if (count < argc && argv[count][0] != '-') {
+	if (Tcl_GetInt(interp, argv[count], &OPS_REBALANCE_PERIOD) != TCL_OK || OPS_REBALANCE_PERIOD < 1) {
+	  opserr << "WARNING partition <eleTag> -rebalance threshold <period> - invalid period " << argv[count] << endln;
+	  return TCL_ERROR;
+	}
+	count++;
+      }
+
+    } else {
+      opserr << "WARNING partition <eleTag> <-threads numSubdomains> <-rebalance threshold <period>> - unknown option " << argv[count] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  if (partitionModel(eleTag) < 0) {
+    opserr << "WARNING partition failed\n";
+    return TCL_ERROR;
   }
-  partitionModel(eleTag);
 
 #endif
   return TCL_OK;
@@ -1706,6 +2009,23 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
       result = theTransientAnalysis->analyze(numIncr, dT);
     }
 
+  } else if (theExplicitAnalysis != 0) {
+    if (argc < 3) {
+      opserr << "WARNING explicit analysis: analysis numIncr? deltaT?\n";
+      return TCL_ERROR;
+    }
+    int numIncr;
+    if (Tcl_GetInt(interp, argv[1], &numIncr) != TCL_OK)	
+      return TCL_ERROR;
+    double dT;
+    if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)	
+      return TCL_ERROR;
+
+    // Set global timestep variable
+    ops_Dt = dT;
+
+    result = theExplicitAnalysis->analyze(numIncr, dT);
+
   } else {
     opserr << "WARNING No Analysis type has been specified \n";
     return TCL_ERROR;
@@ -1785,6 +2105,15 @@ printModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       done = true;
     }
 
+    // if 'print system' print out the size and storage of the LinearSOE
+    else if ((strcmp(argv[currentArg],"system") == 0) || 
+	     (strcmp(argv[currentArg],"-system") == 0)) {
+      currentArg++;
+      if (theSOE != 0)
+	theSOE->Print(*output);
+      done = true;
+    }
+
     else {
 
       if ((strcmp(argv[currentArg],"file") == 0) || 
@@ -2107,6 +2436,10 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	theTransientAnalysis = 0;
 	theVariableTimeStepTransientAnalysis = 0;
     }
+    if (theExplicitAnalysis != 0) {
+	delete theExplicitAnalysis;
+	theExplicitAnalysis = 0;
+    }
     
     // check argv[1] for type of SOE and create it
     if (strcmp(argv[1],"Static") == 0) {
@@ -2368,6 +2701,11 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	// set the pointer for variabble time step analysis
 	theTransientAnalysis = theVariableTimeStepTransientAnalysis;
 
+    } else if (strcmp(argv[1],"Explicit") == 0) {
+	// central difference on the lumped mass, no system of equations
+	// or algorithm is used
+	theExplicitAnalysis = new ExplicitDynamicAnalysis(theDomain);
+
 	#ifdef _RELIABILITY
 
 	//////////////////////////////////
@@ -2592,7 +2930,10 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   // BAND SPD SOE & SOLVER
   else if (strcmp(argv[1],"BandSPD") == 0) {
-      BandSPDLinSolver    *theSolver = new BandSPDLinLapackSolver();   
+      bool mixedPrecision = false;
+      if (argc > 2 && strcmp(argv[2],"-mixedPrecision") == 0)
+	mixedPrecision = true;
+      BandSPDLinSolver    *theSolver = new BandSPDLinLapackSolver(mixedPrecision);   
 #ifdef _PARALLEL_PROCESSING
       theSOE = new DistributedBandSPDLinSOE(*theSolver);        
 #else
@@ -2635,7 +2976,10 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   else if (strcmp(argv[1],"ProfileSPD") == 0) {
     // now must determine the type of solver to create from rest of args
-    ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver(); 	
+    bool mixedPrecision = false;
+    if (argc > 2 && strcmp(argv[2],"-mixedPrecision") == 0)
+      mixedPrecision = true;
+    ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver(1.0e-12, mixedPrecision); 	
 
     /* *********** Some misc solvers i play with ******************
     else if (strcmp(argv[2],"Normal") == 0) {
@@ -2995,6 +3339,65 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     UmfpackGenLinSolver *theSolver = new UmfpackGenLinSolver();
     theSOE = new UmfpackGenLinSOE(*theSolver, factLVALUE, factorOnce, printTime);      
   }	  
+  else if (strcmp(argv[1],"PCG") == 0) {
+
+    // system PCG <-tol tol> <-maxIter n> <-precond None|Jacobi|IC|AMG> <-fill k> <-matrixFree>
+    double tol = 1.0e-8;
+    int maxIter = 0;
+    int fillLevel = 0;
+    int precond = 1;      // 0: none, 1: Jacobi, 2: IC, 3: AMG
+    bool matrixFree = false;
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count],"-tol") == 0 && count+1 < argc) {
+	if (Tcl_GetDouble(interp, argv[count+1], &tol) != TCL_OK)
+	  return TCL_ERROR;
+	count++;
+      } else if (strcmp(argv[count],"-maxIter") == 0 && count+1 < argc) {
+	if (Tcl_GetInt(interp, argv[count+1], &maxIter) != TCL_OK)
+	  return TCL_ERROR;
+	count++;
+      } else if (strcmp(argv[count],"-fill") == 0 && count+1 < argc) {
+	if (Tcl_GetInt(interp, argv[count+1], &fillLevel) != TCL_OK)
+	  return TCL_ERROR;
+	count++;
+      } else if (strcmp(argv[count],"-precond") == 0 && count+1 < argc) {
+	if (strcmp(argv[count+1],"None") == 0)
+	  precond = 0;
+	else if (strcmp(argv[count+1],"Jacobi") == 0)
+	  precond = 1;
+	else if (strcmp(argv[count+1],"IC") == 0)
+	  precond = 2;
+	else if (strcmp(argv[count+1],"AMG") == 0)
+	  precond = 3;
+	else {
+	  opserr << "WARNING system PCG - unknown preconditioner " << argv[count+1] << endln;
+	  return TCL_ERROR;
+	}
+	count++;
+      } else if (strcmp(argv[count],"-matrixFree") == 0) {
+	matrixFree = true;
+      }
+      count++;
+    }
+
+    if (matrixFree == true && precond > 1) {
+      opserr << "WARNING system PCG - only Jacobi or no preconditioning with -matrixFree\n";
+      return TCL_ERROR;
+    }
+
+    CG_Preconditioner *thePreconditioner = 0;
+    if (precond == 1)
+      thePreconditioner = new JacobiPreconditioner();
+    else if (precond == 2)
+      thePreconditioner = new IncompleteCholeskyPreconditioner(fillLevel);
+    else if (precond == 3)
+      thePreconditioner = new AMG_Preconditioner();
+
+    PCGLinSolver *theSolver = new PCGLinSolver(tol, maxIter, thePreconditioner);
+    theSOE = new PCGLinSOE(*theSolver, matrixFree);
+  }
+
 #ifdef _ITPACK
 //  else if (strcmp(argv[1],"Itpack") == 0) {
 //    
@@ -9355,6 +9758,37 @@ maxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   return TCL_OK;
 }
 
+// threads numThreads?
+// sets the number of threads used in the element state determination;
+// with no argument returns the number currently in use
+int
+setNumThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  char buffer[20];
+
+  if (argc > 1) {
+    int numThreads;
+    if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK) {
+      opserr << "WARNING threads numThreads? - invalid numThreads " << argv[1] << endln;
+      return TCL_ERROR;
+    } 
+
+    if (numThreads < 1) {
+      opserr << "WARNING threads numThreads? - numThreads must be > 0\n";
+      return TCL_ERROR;
+    }
+
+    if (ThreadPool::setNumThreads(numThreads) != 0) {
+      opserr << "WARNING threads numThreads? - could not start threads, using 1\n";
+    }
+  }
+
+  sprintf(buffer, "%d", ThreadPool::getNumThreadsRequested());
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
 // Talledo Start
 int 
 printModelGID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
@@ -53,6 +53,15 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 int 
 resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+snapshotModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+revertToSnapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+runIDA(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
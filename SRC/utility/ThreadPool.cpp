@@ -0,0 +1,291 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadPool.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ThreadPool.
+//
+// What: "@(#) ThreadPool.cpp, revA"
+
+#include <ThreadPool.h>
+#include <ThreadedStream.h>
+#include <OPS_Globals.h>
+
+static ThreadPool *thePool = 0;
+static int numThreadsRequested = 1;
+
+#ifndef _WIN32
+
+// each worker stores its id under this key; the key is unset for the
+// thread that created the pool, which therefore gets id 0
+static pthread_key_t threadIDKey;
+static pthread_once_t threadIDKeyOnce = PTHREAD_ONCE_INIT;
+
+static void
+createThreadIDKey(void)
+{
+  pthread_key_create(&threadIDKey, 0);
+}
+
+struct ThreadPoolWorkerData {
+  ThreadPool *thePool;
+  int threadID;
+};
+
+#endif
+
+ThreadPool::ThreadPool(int numT)
+  :numThreads(numT), running(false),
+   theTask(0), numItems(0), results(0), theStream(0)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+  if (numThreads > maxNumThreads)
+    numThreads = maxNumThreads;
+
+#ifdef _WIN32
+  if (numThreads > 1) {
+    opserr << "WARNING ThreadPool::ThreadPool() - threads not available on this machine\n";
+    numThreads = 1;
+  }
+#else
+  theThreads = 0;
+  generation = 0;
+  numDone = 0;
+  shutdown = false;
+
+  pthread_once(&threadIDKeyOnce, createThreadIDKey);
+  pthread_mutex_init(&theMutex, 0);
+  pthread_cond_init(&startCond, 0);
+  pthread_cond_init(&doneCond, 0);
+
+  if (numThreads > 1) {
+    theThreads = new pthread_t[numThreads];
+    for (int i=1; i<numThreads; i++) {
+      ThreadPoolWorkerData *theData = new ThreadPoolWorkerData;
+      theData->thePool = this;
+      theData->threadID = i;
+      if (pthread_create(&theThreads[i], 0, ThreadPool::worker, theData) != 0) {
+	opserr << "WARNING ThreadPool::ThreadPool() - could only start " << i << " threads\n";
+	delete theData;
+	numThreads = i;
+      }
+    }
+  }
+#endif
+
+  results = new int[numThreads];
+  theStream = new ThreadedStream(numThreads);
+}
+
+ThreadPool::~ThreadPool()
+{
+#ifndef _WIN32
+  if (theThreads != 0) {
+    pthread_mutex_lock(&theMutex);
+    shutdown = true;
+    pthread_cond_broadcast(&startCond);
+    pthread_mutex_unlock(&theMutex);
+
+    for (int i=1; i<numThreads; i++)
+      pthread_join(theThreads[i], 0);
+
+    delete [] theThreads;
+  }
+
+  pthread_cond_destroy(&doneCond);
+  pthread_cond_destroy(&startCond);
+  pthread_mutex_destroy(&theMutex);
+#endif
+
+  if (results != 0)
+    delete [] results;
+  if (theStream != 0)
+    delete theStream;
+}
+
+int
+ThreadPool::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+// isRunning() returns true while run() is executing a task, so that
+// code invoked by the task can tell it is sharing the process with
+// the other threads of the pool.
+bool
+ThreadPool::isRunning(void) const
+{
+  return running;
+}
+
+int
+ThreadPool::run(ThreadTask &task, int nItems)
+{
+  // nested calls, and calls made from inside a worker, run serially
+  if (numThreads == 1 || running == true || nItems < 2)
+    return task.execute(0, nItems, getThreadID());
+
+#ifdef _WIN32
+  return task.execute(0, nItems, 0);
+#else
+  // redirect opserr to the per thread buffers
+  OPS_Stream *theErrorStream = opserrPtr;
+  opserrPtr = theStream;
+
+  pthread_mutex_lock(&theMutex);
+  running = true;
+  theTask = &task;
+  numItems = nItems;
+  numDone = 0;
+  generation++;
+  pthread_cond_broadcast(&startCond);
+  pthread_mutex_unlock(&theMutex);
+
+  // the calling thread does the first block
+  int end = nItems/numThreads;
+  results[0] = task.execute(0, end, 0);
+
+  pthread_mutex_lock(&theMutex);
+  while (numDone < numThreads-1)
+    pthread_cond_wait(&doneCond, &theMutex);
+  running = false;
+  theTask = 0;
+  pthread_mutex_unlock(&theMutex);
+
+  opserrPtr = theErrorStream;
+  theStream->flush(*theErrorStream);
+
+  // reduce in thread order so the result does not depend on timing
+  int result = 0;
+  for (int i=0; i<numThreads; i++)
+    result += results[i];
+
+  return result;
+#endif
+}
+
+#ifndef _WIN32
+void *
+ThreadPool::worker(void *data)
+{
+  ThreadPoolWorkerData *theData = (ThreadPoolWorkerData *)data;
+  ThreadPool *self = theData->thePool;
+  long threadID = theData->threadID;
+  delete theData;
+
+  pthread_setspecific(threadIDKey, (void *)threadID);
+
+  int lastGeneration = 0;
+  pthread_mutex_lock(&self->theMutex);
+
+  while (true) {
+    while (self->generation == lastGeneration && self->shutdown == false)
+      pthread_cond_wait(&self->startCond, &self->theMutex);
+
+    if (self->shutdown == true)
+      break;
+
+    lastGeneration = self->generation;
+    ThreadTask *task = self->theTask;
+    int nItems = self->numItems;
+    int nThreads = self->numThreads;
+    pthread_mutex_unlock(&self->theMutex);
+
+    int start = (int)(((long)nItems*threadID)/nThreads);
+    int end = (int)(((long)nItems*(threadID+1))/nThreads);
+    int result = task->execute(start, end, (int)threadID);
+
+    pthread_mutex_lock(&self->theMutex);
+    self->results[threadID] = result;
+    self->numDone++;
+    if (self->numDone == nThreads-1)
+      pthread_cond_signal(&self->doneCond);
+  }
+
+  pthread_mutex_unlock(&self->theMutex);
+  return 0;
+}
+#endif
+
+int
+ThreadPool::getThreadID(void)
+{
+#ifdef _WIN32
+  return 0;
+#else
+  pthread_once(&threadIDKeyOnce, createThreadIDKey);
+  return (int)(long)pthread_getspecific(threadIDKey);
+#endif
+}
+
+int
+ThreadPool::setNumThreads(int numThreads)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+  if (numThreads > maxNumThreads)
+    numThreads = maxNumThreads;
+
+  if (thePool != 0 && thePool->getNumThreads() != numThreads) {
+    delete thePool;
+    thePool = 0;
+  }
+
+  numThreadsRequested = numThreads;
+  if (numThreads > 1 && thePool == 0) {
+    thePool = new ThreadPool(numThreads);
+    if (thePool->getNumThreads() == 1) {
+      delete thePool;
+      thePool = 0;
+      numThreadsRequested = 1;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int
+ThreadPool::getNumThreadsRequested(void)
+{
+  return numThreadsRequested;
+}
+
+ThreadPool *
+ThreadPool::getThreadPool(void)
+{
+  return thePool;
+}
+
+// resetAfterFork() is called in a child process created by fork(),
+// which has none of the worker threads; the pool is forgotten, not
+// deleted, as its destructor would wait for them, and the child then
+// runs serially.
+void
+ThreadPool::resetAfterFork(void)
+{
+  thePool = 0;
+  numThreadsRequested = 1;
+}
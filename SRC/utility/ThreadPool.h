@@ -0,0 +1,108 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadPool.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definitions for ThreadTask
+// and ThreadPool. A ThreadPool is a fixed set of worker threads that
+// execute a ThreadTask over a range of items. The range is split into
+// contiguous blocks, block i always going to thread i, so that a task
+// run twice on the same range sees the same work distribution. The
+// calling thread acts as thread 0. While a task runs each worker writes
+// its diagnostics into its own buffer (see ThreadedStream); the buffers
+// are flushed to opserr in thread order once the task has completed, so
+// the output matches what a serial run would have printed.
+//
+// The pool used by the Domain and the analysis classes is obtained with
+// ThreadPool::getThreadPool(), which returns 0 unless more than one
+// thread has been requested with ThreadPool::setNumThreads(). A process
+// created by fork() has none of the threads of the pool; it must call
+// ThreadPool::resetAfterFork(), after which it runs serially.
+//
+// What: "@(#) ThreadPool.h, revA"
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class ThreadedStream;
+
+class ThreadTask
+{
+ public:
+  ThreadTask() {};
+  virtual ~ThreadTask() {};
+
+  // invoked once by each thread on the items [start, end); the return
+  // values of the threads are summed in thread order by ThreadPool::run()
+  virtual int execute(int start, int end, int threadID) =0;
+};
+
+class ThreadPool
+{
+ public:
+  enum {maxNumThreads = 256};
+
+  ThreadPool(int numThreads);
+  ~ThreadPool();
+
+  int getNumThreads(void) const;
+  int run(ThreadTask &theTask, int numItems);
+  bool isRunning(void) const;
+
+  // id of the calling thread in the pool currently running, 0 otherwise
+  static int getThreadID(void);
+
+  // the pool shared by the state determination and assembly routines
+  static int setNumThreads(int numThreads);
+  static int getNumThreadsRequested(void);
+  static ThreadPool *getThreadPool(void);
+  static void resetAfterFork(void);
+
+ private:
+  int numThreads;
+  bool running;
+
+  ThreadTask *theTask;
+  int numItems;
+  int *results;
+  ThreadedStream *theStream;
+
+#ifndef _WIN32
+  static void *worker(void *);
+
+  pthread_t *theThreads;
+  pthread_mutex_t theMutex;
+  pthread_cond_t startCond;
+  pthread_cond_t doneCond;
+  int generation;
+  int numDone;
+  bool shutdown;
+#endif
+};
+
+#endif
@@ -0,0 +1,71 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadWorkspace.h,v $
+
+// Description: This file contains the class template ThreadWorkspace.
+// A ThreadWorkspace replaces the static scratch matrices and vectors a
+// class would otherwise share between all its objects: it holds one
+// object of type T for each thread of the ThreadPool, created the first
+// time that thread asks for it. Each slot is only ever written by its
+// own thread, so get() needs no locking. As with the static members it
+// replaces, a reference returned by get() (and any Matrix or Vector
+// reference handed out from it) is only valid until the same thread
+// next uses the workspace.
+//
+// What: "@(#) ThreadWorkspace.h, revA"
+
+#ifndef ThreadWorkspace_h
+#define ThreadWorkspace_h
+
+#include <ThreadPool.h>
+
+template <class T>
+class ThreadWorkspace
+{
+ public:
+  ThreadWorkspace() {
+    for (int i=0; i<ThreadPool::maxNumThreads; i++)
+      theSpaces[i] = 0;
+  };
+
+  ~ThreadWorkspace() {
+    for (int i=0; i<ThreadPool::maxNumThreads; i++)
+      if (theSpaces[i] != 0)
+	delete theSpaces[i];
+  };
+
+  T &get(void) {
+    int threadID = ThreadPool::getThreadID();
+    T *theSpace = theSpaces[threadID];
+    if (theSpace == 0) {
+      theSpace = new T;
+      theSpaces[threadID] = theSpace;
+    }
+    return *theSpace;
+  };
+
+ private:
+  T *theSpaces[ThreadPool::maxNumThreads];
+};
+
+#endif
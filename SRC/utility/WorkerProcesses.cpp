@@ -0,0 +1,372 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/WorkerProcesses.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// WorkerProcesses.
+//
+// What: "@(#) WorkerProcesses.cpp, revA"
+
+#include <WorkerProcesses.h>
+#include <ThreadPool.h>
+#include <AsyncStream.h>
+#include <Domain.h>
+#include <OPS_Globals.h>
+
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
+#endif
+
+WorkerProcesses::WorkerProcesses(Domain *passedDomain, int passedMaxNumWorkers)
+  :theDomain(passedDomain), maxNumWorkers(passedMaxNumWorkers), numWorkers(0),
+   pid(0), toWorker(0), fromWorker(0), busy(0)
+{
+  if (maxNumWorkers < 1)
+    maxNumWorkers = 1;
+
+  pid = new int[maxNumWorkers];
+  toWorker = new int[maxNumWorkers];
+  fromWorker = new int[maxNumWorkers];
+  busy = new bool[maxNumWorkers];
+
+  for (int i=0; i<maxNumWorkers; i++) {
+    pid[i] = 0;
+    toWorker[i] = -1;
+    fromWorker[i] = -1;
+    busy[i] = false;
+  }
+}
+
+WorkerProcesses::~WorkerProcesses()
+{
+  this->stopAll();
+
+  delete [] pid;
+  delete [] toWorker;
+  delete [] fromWorker;
+  delete [] busy;
+}
+
+// int start(WorkerTask &theTask, bool busy);
+//	starts a worker process running theTask in a free slot and returns
+//	the slot, or -1 if there is no free slot or the process could not
+//	be started. If busy is true a reply is expected from the worker
+//	without a request being sent to it first.
+
+int
+WorkerProcesses::start(WorkerTask &theTask, bool isBusy)
+{
+#ifndef _WIN32
+  int worker = 0;
+  while (worker < maxNumWorkers && pid[worker] != 0)
+    worker++;
+  if (worker == maxNumWorkers)
+    return -1;
+
+  int down[2], up[2];
+  if (pipe(down) != 0)
+    return -1;
+  if (pipe(up) != 0) {
+    close(down[0]); close(down[1]);
+    return -1;
+  }
+
+  // anything buffered would otherwise be written twice
+  fflush(stdout);
+  fflush(stderr);
+
+  int childPid = fork();
+  if (childPid < 0) {
+    close(down[0]); close(down[1]); close(up[0]); close(up[1]);
+    return -1;
+  }
+
+  if (childPid == 0) {
+    // the worker; it must not return into the program
+    close(down[1]);
+    close(up[0]);
+    this->resetWorker(worker);
+    int res = theTask.runWorker(down[0], up[1]);
+    _exit(res == 0 ? 0 : 1);
+  }
+
+  close(down[0]);
+  close(up[1]);
+  pid[worker] = childPid;
+  toWorker[worker] = down[1];
+  fromWorker[worker] = up[0];
+  busy[worker] = isBusy;
+  numWorkers++;
+
+  return worker;
+#else
+  return -1;
+#endif
+}
+
+// void resetWorker(int worker);
+//	invoked in a new worker process; closes the pipes to the other
+//	workers and replaces what fork() does not copy, the threads of the
+//	ThreadPool and of the AsyncStreams, and detaches the recorders.
+
+void
+WorkerProcesses::resetWorker(int worker)
+{
+#ifndef _WIN32
+  for (int i=0; i<maxNumWorkers; i++) {
+    if (pid[i] != 0 && i != worker) {
+      close(toWorker[i]);
+      close(fromWorker[i]);
+    }
+    pid[i] = 0;
+    toWorker[i] = -1;
+    fromWorker[i] = -1;
+    busy[i] = false;
+  }
+  numWorkers = 0;
+
+  ThreadPool::resetAfterFork();
+  AsyncStream::resetAfterFork();
+
+  if (theDomain != 0)
+    theDomain->detachRecorders();
+#endif
+}
+
+// int stop(int worker);
+//	stops the worker, killing it whether it is busy or not, as a
+//	worker started later by another part of the program may hold its
+//	request pipe open, and waits for it to exit.
+
+int
+WorkerProcesses::stop(int worker)
+{
+#ifndef _WIN32
+  if (worker < 0 || worker >= maxNumWorkers || pid[worker] == 0)
+    return 0;
+
+  close(toWorker[worker]);
+  close(fromWorker[worker]);
+  kill(pid[worker], SIGKILL);
+  waitpid(pid[worker], 0, 0);
+
+  pid[worker] = 0;
+  toWorker[worker] = -1;
+  fromWorker[worker] = -1;
+  busy[worker] = false;
+  numWorkers--;
+#endif
+
+  return 0;
+}
+
+int
+WorkerProcesses::stopAll(void)
+{
+  for (int i=0; i<maxNumWorkers; i++)
+    this->stop(i);
+
+  return 0;
+}
+
+// int send(int worker, const void *data, long numBytes);
+//	sends a request to the worker. If it cannot be sent whole, as when
+//	the worker has died and the write fails with EPIPE, the worker is
+//	stopped and -1 returned.
+
+int
+WorkerProcesses::send(int worker, const void *data, long numBytes)
+{
+  if (this->isRunning(worker) == false)
+    return -1;
+
+  if (writeAll(toWorker[worker], data, numBytes) < 0) {
+    this->stop(worker);
+    return -1;
+  }
+
+  busy[worker] = true;
+  return 0;
+}
+
+// int receive(int worker, void *data, long numBytes);
+//	reads a reply from the worker; the worker is no longer busy,
+//	whether or not the whole reply could be read.
+
+int
+WorkerProcesses::receive(int worker, void *data, long numBytes)
+{
+  if (this->isRunning(worker) == false)
+    return -1;
+
+  busy[worker] = false;
+  return readAll(fromWorker[worker], data, numBytes);
+}
+
+// int waitForReply(void);
+//	blocks until one of the busy workers has a reply ready, or has
+//	exited, and returns it; -1 is returned if no worker is busy.
+
+int
+WorkerProcesses::waitForReply(void)
+{
+#ifndef _WIN32
+  struct pollfd *fds = new struct pollfd[maxNumWorkers];
+  int *workerOfFd = new int[maxNumWorkers];
+
+  int result = -1;
+  while (true) {
+    int numFds = 0;
+    for (int i=0; i<maxNumWorkers; i++) {
+      if (pid[i] != 0 && busy[i] == true) {
+	fds[numFds].fd = fromWorker[i];
+	fds[numFds].events = POLLIN;
+	fds[numFds].revents = 0;
+	workerOfFd[numFds] = i;
+	numFds++;
+      }
+    }
+
+    if (numFds == 0)
+      break;
+
+    if (poll(fds, numFds, -1) < 0) {
+      if (errno == EINTR)
+	continue;
+      break;
+    }
+
+    for (int j=0; j<numFds && result < 0; j++)
+      if (fds[j].revents != 0)
+	result = workerOfFd[j];
+
+    if (result >= 0)
+      break;
+  }
+
+  delete [] fds;
+  delete [] workerOfFd;
+
+  return result;
+#else
+  return -1;
+#endif
+}
+
+int
+WorkerProcesses::getNumWorkers(void) const
+{
+  return numWorkers;
+}
+
+int
+WorkerProcesses::getMaxNumWorkers(void) const
+{
+  return maxNumWorkers;
+}
+
+bool
+WorkerProcesses::isRunning(int worker) const
+{
+  return (worker >= 0 && worker < maxNumWorkers && pid[worker] != 0);
+}
+
+bool
+WorkerProcesses::isBusy(int worker) const
+{
+  return (this->isRunning(worker) == true && busy[worker] == true);
+}
+
+int
+WorkerProcesses::getPid(int worker) const
+{
+  if (this->isRunning(worker) == false)
+    return 0;
+
+  return pid[worker];
+}
+
+// int writeAll(int fd, const void *data, long numBytes);
+//	SIGPIPE is ignored while writing, so that writing to a process
+//	that has died fails with EPIPE instead of killing this one; the
+//	previous action is restored afterwards.
+
+int
+WorkerProcesses::writeAll(int fd, const void *data, long numBytes)
+{
+#ifndef _WIN32
+  struct sigaction ignorePipe, oldAction;
+  ignorePipe.sa_handler = SIG_IGN;
+  sigemptyset(&ignorePipe.sa_mask);
+  ignorePipe.sa_flags = 0;
+  sigaction(SIGPIPE, &ignorePipe, &oldAction);
+
+  int result = 0;
+  const char *ptr = (const char *)data;
+  while (numBytes > 0) {
+    long n = write(fd, ptr, numBytes);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0) {
+      result = -1;
+      break;
+    }
+    ptr += n;
+    numBytes -= n;
+  }
+
+  sigaction(SIGPIPE, &oldAction, 0);
+  return result;
+#else
+  return -1;
+#endif
+}
+
+int
+WorkerProcesses::readAll(int fd, void *data, long numBytes)
+{
+#ifndef _WIN32
+  char *ptr = (char *)data;
+  while (numBytes > 0) {
+    long n = read(fd, ptr, numBytes);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return -1;
+    ptr += n;
+    numBytes -= n;
+  }
+  return 0;
+#else
+  return -1;
+#endif
+}
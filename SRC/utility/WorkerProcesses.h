@@ -0,0 +1,103 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-18 10:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/WorkerProcesses.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definitions for WorkerTask
+// and WorkerProcesses. A WorkerProcesses starts worker processes, each
+// a fork() of the running program with its own copy of the domain, and
+// talks to them through a pair of pipes. The work a process does is
+// given by the runWorker() method of a WorkerTask; the process exits
+// when runWorker() returns, without returning into the program.
+//
+// Before runWorker() is invoked the copy of the program is made safe
+// to use on its own: the ThreadPool, whose threads are not copied by
+// fork(), is replaced by serial execution, the AsyncStreams, whose
+// writer threads are not copied either, write synchronously, and the
+// recorders are detached from the domain given so that the worker
+// neither writes to nor closes the files of the parent's recorders.
+//
+// The parent sends requests with send() and collects the replies with
+// receive(); waitForReply() blocks until one of the workers that has
+// been sent a request (or was started busy) has a reply ready. stop()
+// kills the worker and waits for it; a worker that has died is stopped
+// by the send() that finds its pipe closed, which returns an error
+// rather than the parent being killed by SIGPIPE. Where fork() is not available
+// start() fails and the caller does the work itself.
+//
+// What: "@(#) WorkerProcesses.h, revA"
+
+#ifndef WorkerProcesses_h
+#define WorkerProcesses_h
+
+class Domain;
+
+class WorkerTask
+{
+ public:
+  WorkerTask() {};
+  virtual ~WorkerTask() {};
+
+  // invoked in the worker process with the file descriptors of the
+  // pipes from and to the parent; the return value is the exit status
+  virtual int runWorker(int fromParent, int toParent) =0;
+};
+
+class WorkerProcesses
+{
+ public:
+  WorkerProcesses(Domain *theDomain, int maxNumWorkers);
+  ~WorkerProcesses();
+
+  int start(WorkerTask &theTask, bool busy = false);
+  int stop(int worker);
+  int stopAll(void);
+
+  int send(int worker, const void *data, long numBytes);
+  int receive(int worker, void *data, long numBytes);
+  int waitForReply(void);
+
+  int getNumWorkers(void) const;
+  int getMaxNumWorkers(void) const;
+  bool isRunning(int worker) const;
+  bool isBusy(int worker) const;
+  int getPid(int worker) const;
+
+  // blocking transfers on a pipe, retried when interrupted by a signal
+  static int writeAll(int fd, const void *data, long numBytes);
+  static int readAll(int fd, void *data, long numBytes);
+
+ private:
+  void resetWorker(int worker);
+
+  Domain *theDomain;
+  int maxNumWorkers;
+  int numWorkers;
+  int *pid;                 // 0 for a slot with no worker
+  int *toWorker;
+  int *fromWorker;
+  bool *busy;               // a reply is expected from the worker
+};
+
+#endif